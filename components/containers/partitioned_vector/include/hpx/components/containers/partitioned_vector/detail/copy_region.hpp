@@ -0,0 +1,92 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/partitioned_vector/detail/copy_region.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \cond NOINTERNAL
+
+namespace hpx::detail {
+
+    // Copy the region of extents 'sizes' starting at 'src_lower' in the
+    // multi-dimensional array 'src' of extents 'src_shape' to the region
+    // starting at 'dst_lower' in the array 'dst' of extents 'dst_shape'. Both
+    // arrays are stored with their first dimension varying fastest, which is
+    // the order partitioned_vector_view uses to linearize its subscripts.
+    // Every contiguous row of the region is copied at once.
+    template <typename InIter, typename OutIter, typename Shape,
+        typename Lower, typename Sizes>
+    void copy_region(InIter src, Shape const& src_shape, Lower const& src_lower,
+        OutIter dst, Shape const& dst_shape, Lower const& dst_lower,
+        Sizes const& sizes)
+    {
+        std::size_t const dims = std::size(sizes);
+
+        HPX_ASSERT(std::size(src_shape) == dims);
+        HPX_ASSERT(std::size(dst_shape) == dims);
+        HPX_ASSERT(std::size(src_lower) == dims);
+        HPX_ASSERT(std::size(dst_lower) == dims);
+
+        if (dims == 0)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i != dims; ++i)
+        {
+            if (sizes[i] == 0)
+            {
+                return;
+            }
+        }
+
+        // the index of the current row relative to the lower corner of the
+        // region, the first dimension is always zero
+        std::vector<std::size_t> index(dims, 0);
+
+        auto const offset = [&](auto const& shape, auto const& lower) {
+            std::size_t result = 0;
+            std::size_t stride = 1;
+            for (std::size_t i = 0; i != dims; ++i)
+            {
+                result += (lower[i] + index[i]) * stride;
+                stride *= shape[i];
+            }
+            return static_cast<std::ptrdiff_t>(result);
+        };
+
+        while (true)
+        {
+            std::copy_n(std::next(src, offset(src_shape, src_lower)), sizes[0],
+                std::next(dst, offset(dst_shape, dst_lower)));
+
+            std::size_t i = 1;
+            for (/**/; i != dims; ++i)
+            {
+                if (++index[i] != sizes[i])
+                {
+                    break;
+                }
+                index[i] = 0;
+            }
+
+            if (i == dims)
+            {
+                return;
+            }
+        }
+    }
+}    // namespace hpx::detail
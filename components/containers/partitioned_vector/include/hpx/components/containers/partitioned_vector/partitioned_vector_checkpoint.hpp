@@ -0,0 +1,365 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/collectives/barrier.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx::util {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // Every locality writes the partitions it holds into its own shard
+        // file. A shard holds the serialized data of each partition followed
+        // by an index describing the partitions, the last 8 bytes hold the
+        // offset of the index.
+        struct checkpoint_shard_entry
+        {
+            std::uint64_t first = 0;     // global index of first element
+            std::uint64_t size = 0;      // number of elements
+            std::uint64_t offset = 0;    // position of data in the shard
+            std::uint64_t length = 0;    // number of bytes
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & first & size & offset & length;
+                // clang-format on
+            }
+        };
+
+        inline std::string checkpoint_shard_name(
+            std::string const& basename, std::uint32_t locality_id)
+        {
+            return basename + "." + std::to_string(locality_id);
+        }
+
+        inline std::string checkpoint_manifest_name(std::string const& basename)
+        {
+            return basename + ".manifest";
+        }
+
+        template <typename T, typename Data, typename Partition>
+        std::shared_ptr<hpx::server::partitioned_vector<T, Data>>
+        get_local_partition(Partition const& p)
+        {
+            if (p.local_data_)
+            {
+                return p.local_data_;
+            }
+            return hpx::get_ptr<hpx::server::partitioned_vector<T, Data>>(
+                hpx::launch::sync, p.partition_);
+        }
+
+        template <typename T, typename Data>
+        std::vector<std::uint32_t> checkpoint_shards(
+            partitioned_vector<T, Data> const& v)
+        {
+            std::vector<std::uint32_t> shards;
+            shards.reserve(v.partitions().size());
+            for (auto const& p : v.partitions())
+            {
+                shards.push_back(p.locality_id_);
+            }
+
+            std::sort(shards.begin(), shards.end());
+            shards.erase(
+                std::unique(shards.begin(), shards.end()), shards.end());
+            return shards;
+        }
+
+        // A shard that was mapped for restoring partitions, the shard file
+        // might hold a newer generation if a save was interrupted before the
+        // manifest was written
+        struct checkpoint_shard
+        {
+            checkpoint_shard(
+                std::string const& filename, std::uint64_t generation)
+              : file(filename, generation)
+            {
+                std::uint64_t index_offset = 0;
+                if (file.size() >= sizeof(index_offset))
+                {
+                    std::memcpy(&index_offset,
+                        file.data() + file.size() - sizeof(index_offset),
+                        sizeof(index_offset));
+                }
+
+                if (file.size() < sizeof(index_offset) ||
+                    index_offset > file.size() - sizeof(index_offset))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                        "hpx::util::restore_distributed_checkpoint",
+                        "{} is not a checkpoint shard", filename);
+                }
+
+                hpx::util::restore_checkpoint_data(
+                    checkpoint_data_view(file.data() + index_offset,
+                        file.size() - sizeof(index_offset) - index_offset),
+                    entries);
+
+                for (auto const& e : entries)
+                {
+                    if (e.offset > index_offset ||
+                        e.length > index_offset - e.offset)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                            "hpx::util::restore_distributed_checkpoint",
+                            "the index of checkpoint shard {} is corrupted",
+                            filename);
+                    }
+                }
+            }
+
+            [[nodiscard]] checkpoint_data_view data(
+                checkpoint_shard_entry const& e) const noexcept
+            {
+                return {file.data() + e.offset, e.length};
+            }
+
+            mapped_checkpoint_file file;
+            std::vector<checkpoint_shard_entry> entries;
+        };
+
+        // Fill the elements [first, first + data.size()) from all saved
+        // partitions overlapping this range.
+        template <typename DataType>
+        void restore_partition(std::vector<checkpoint_shard> const& shards,
+            DataType& data, std::uint64_t first)
+        {
+            std::uint64_t const last = first + data.size();
+            for (auto const& shard : shards)
+            {
+                for (auto const& e : shard.entries)
+                {
+                    if (e.first >= last || e.first + e.size <= first)
+                    {
+                        continue;
+                    }
+
+                    // partitions that were not moved are restored in place
+                    if (e.first == first && e.size == data.size())
+                    {
+                        hpx::util::restore_checkpoint_data(shard.data(e), data);
+                        continue;
+                    }
+
+                    DataType saved;
+                    hpx::util::restore_checkpoint_data(shard.data(e), saved);
+
+                    std::uint64_t const lo = (std::max)(first, e.first);
+                    std::uint64_t const hi = (std::min)(last, e.first + e.size);
+                    std::copy(saved.begin() + (lo - e.first),
+                        saved.begin() + (hi - e.first),
+                        data.begin() + (lo - first));
+                }
+            }
+        }
+
+        // Write the partitions held by this locality to its shard file
+        template <typename T, typename Data>
+        void save_checkpoint_shard(std::string const& basename,
+            partitioned_vector<T, Data> const& v,
+            checkpoint_file_options const& options)
+        {
+            std::uint32_t const here = hpx::get_locality_id();
+
+            checkpoint_file_writer writer(
+                checkpoint_shard_name(basename, here), options);
+
+            std::vector<checkpoint_shard_entry> entries;
+            for (auto const& p : v.partitions())
+            {
+                if (p.locality_id_ != here)
+                {
+                    continue;
+                }
+
+                auto const part = get_local_partition<T, Data>(p);
+                auto const& data = part->get_data();
+
+                checkpoint_file_appender section(writer);
+                hpx::util::save_checkpoint_data(section, data);
+
+                entries.push_back(checkpoint_shard_entry{
+                    p.first_, data.size(), section.offset(), section.size()});
+            }
+
+            checkpoint_file_appender section(writer);
+            hpx::util::save_checkpoint_data(section, entries);
+
+            std::uint64_t const index_offset = section.offset();
+            writer.write(writer.size(), &index_offset, sizeof(index_offset));
+            writer.commit();
+        }
+
+        // Write the manifest referring to the current generation of all
+        // shards, this makes the new checkpoint the one to be restored
+        template <typename T, typename Data>
+        void save_checkpoint_manifest(std::string const& basename,
+            partitioned_vector<T, Data> const& v,
+            std::vector<std::uint32_t> const& shards)
+        {
+            std::vector<std::uint64_t> generations;
+            generations.reserve(shards.size());
+            for (std::uint32_t const shard : shards)
+            {
+                mapped_checkpoint_file const file(
+                    checkpoint_shard_name(basename, shard));
+                generations.push_back(file.generation());
+            }
+
+            checkpoint_file_writer writer(checkpoint_manifest_name(basename));
+            hpx::util::save_checkpoint_data(writer,
+                static_cast<std::uint64_t>(v.size()), shards, generations);
+            writer.commit();
+        }
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_distributed_checkpoint
+    ///
+    /// \param basename     The base name of the checkpoint files
+    ///
+    /// \param v            The partitioned_vector to save
+    ///
+    /// \param options      Controls how the shard files are written (see
+    ///                     \a checkpoint_file_options)
+    ///
+    /// Save_distributed_checkpoint writes the given partitioned_vector to a
+    /// set of files. Every locality writes the partitions it holds into its
+    /// own shard file named <basename>.<locality id>, all localities write
+    /// concurrently. Once all shards are complete, locality 0 writes a
+    /// manifest (<basename>.manifest) describing the checkpoint. Repeated
+    /// checkpoints to the same files rewrite only the changed parts of the
+    /// shards. The previous checkpoint can be restored until the new
+    /// manifest was written.
+    ///
+    /// \note This function has to be called on all localities. The vector
+    ///       must not be modified concurrently.
+    template <typename T, typename Data>
+    void save_distributed_checkpoint(std::string const& basename,
+        partitioned_vector<T, Data> const& v,
+        checkpoint_file_options const& options = checkpoint_file_options())
+    {
+        std::uint32_t const here = hpx::get_locality_id();
+        std::vector<std::uint32_t> const shards =
+            detail::checkpoint_shards(v);
+
+        if (std::binary_search(shards.begin(), shards.end(), here))
+        {
+            detail::save_checkpoint_shard(basename, v, options);
+        }
+
+        // the manifest refers to the current generation of all shards
+        hpx::distributed::barrier::synchronize();
+
+        if (here == 0)
+        {
+            detail::save_checkpoint_manifest(basename, v, shards);
+        }
+
+        hpx::distributed::barrier::synchronize();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_distributed_checkpoint
+    ///
+    /// \param basename     The base name of the checkpoint files
+    ///
+    /// \param v            The partitioned_vector to restore
+    ///
+    /// Restore_distributed_checkpoint fills the given partitioned_vector from
+    /// the files written by save_distributed_checkpoint. Every locality
+    /// restores the partitions it holds concurrently, reading only those
+    /// parts of the shard files that overlap with its partitions. The vector
+    /// must have the same size as the saved one, but it may be partitioned
+    /// differently, e.g. for running on a different number of localities.
+    /// The shards are restored in the generation recorded in the manifest.
+    ///
+    /// \note This function has to be called on all localities. All files
+    ///       have to be accessible from all localities.
+    template <typename T, typename Data>
+    void restore_distributed_checkpoint(
+        std::string const& basename, partitioned_vector<T, Data>& v)
+    {
+        std::uint64_t size = 0;
+        std::vector<std::uint32_t> shard_ids;
+        std::vector<std::uint64_t> generations;
+        {
+            mapped_checkpoint_file const manifest(
+                detail::checkpoint_manifest_name(basename));
+            hpx::util::restore_checkpoint_data(
+                manifest, size, shard_ids, generations);
+        }
+
+        if (size != v.size() || shard_ids.size() != generations.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::util::restore_distributed_checkpoint",
+                "the checkpoint {} holds {} elements, the vector has {}",
+                basename, size, v.size());
+        }
+
+        std::vector<detail::checkpoint_shard> shards;
+        shards.reserve(shard_ids.size());
+        for (std::size_t i = 0; i != shard_ids.size(); ++i)
+        {
+            // throws if the shard does not hold this generation anymore
+            shards.emplace_back(
+                detail::checkpoint_shard_name(basename, shard_ids[i]),
+                generations[i]);
+        }
+
+        std::uint32_t const here = hpx::get_locality_id();
+
+        std::vector<hpx::future<void>> futures;
+        for (auto const& p : v.partitions())
+        {
+            if (p.locality_id_ != here)
+            {
+                continue;
+            }
+
+            auto part = detail::get_local_partition<T, Data>(p);
+            std::uint64_t const first = p.first_;
+            futures.push_back(hpx::async([&shards, part, first]() {
+                detail::restore_partition(shards, part->get_data(), first);
+            }));
+        }
+
+        // rethrows the first exception, if any
+        hpx::wait_all(futures);
+
+        hpx::distributed::barrier::synchronize();
+    }
+}    // namespace hpx::util
@@ -203,6 +203,23 @@ namespace hpx::server {
         ///
         std::vector<T> get_values(std::vector<size_type> const& pos) const;
 
+        /// Return the elements of a multi-dimensional region of the
+        /// partitioned_vector_partition container.
+        ///
+        /// The partition is interpreted as an array of the given \a shape
+        /// whose first dimension varies fastest.
+        ///
+        /// \param shape The extents of the array held by the partition
+        /// \param lower The first index of the region in each dimension
+        /// \param sizes The extents of the region
+        ///
+        /// \return Return the values of the elements in the region, stored
+        ///         with the first dimension varying fastest.
+        ///
+        std::vector<T> get_region(std::vector<size_type> const& shape,
+            std::vector<size_type> const& lower,
+            std::vector<size_type> const& sizes) const;
+
         /// Access the value of first element in the partitioned_vector_partition.
         ///
         /// Calling the function on empty container cause undefined behavior.
@@ -286,6 +303,7 @@ namespace hpx::server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_region)
 
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, front)
         // HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector_partition, back)
@@ -334,6 +352,8 @@ namespace hpx::server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::get_values_action,                   \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION_DECLARATION(type::get_region_action,                   \
+        HPX_PP_CAT(__vector_get_region_action_, name))                         \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION_DECLARATION(type::set_values_action,                   \
@@ -501,6 +521,35 @@ namespace hpx {
         future<std::vector<T>> get_values(
             std::vector<std::size_t> const& pos) const;
 
+        /// Returns the values of the elements in a multi-dimensional region
+        /// of the partitioned_vector_partition component.
+        ///
+        /// \param shape The extents of the array held by the partition
+        /// \param lower The first index of the region in each dimension
+        /// \param sizes The extents of the region
+        ///
+        /// \return Returns the values of the elements in the region, stored
+        ///         with the first dimension varying fastest
+        ///
+        std::vector<T> get_region(launch::sync_policy,
+            std::vector<std::size_t> const& shape,
+            std::vector<std::size_t> const& lower,
+            std::vector<std::size_t> const& sizes) const;
+
+        /// Returns the values of the elements in a multi-dimensional region
+        /// of the partitioned_vector_partition component.
+        ///
+        /// \param shape The extents of the array held by the partition
+        /// \param lower The first index of the region in each dimension
+        /// \param sizes The extents of the region
+        ///
+        /// \return This returns the values as the hpx::future
+        ///
+        future<std::vector<T>> get_region(
+            std::vector<std::size_t> const& shape,
+            std::vector<std::size_t> const& lower,
+            std::vector<std::size_t> const& sizes) const;
+
         // future<T> front_async() const
         // {
         //     HPX_ASSERT(this->get_id());
@@ -16,6 +16,7 @@
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
 
+#include <hpx/components/containers/partitioned_vector/detail/copy_region.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
 #include <cstddef>
@@ -222,6 +223,33 @@ namespace hpx::server {
         return result;
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector<T, Data>::get_region(std::vector<size_type> const& shape,
+        std::vector<size_type> const& lower,
+        std::vector<size_type> const& sizes) const
+    {
+        HPX_ASSERT(shape.size() == lower.size());
+        HPX_ASSERT(shape.size() == sizes.size());
+
+        std::size_t count = 1;
+        [[maybe_unused]] std::size_t total = 1;
+        for (std::size_t i = 0; i != shape.size(); ++i)
+        {
+            HPX_ASSERT(lower[i] + sizes[i] <= shape[i]);
+            count *= sizes[i];
+            total *= shape[i];
+        }
+
+        HPX_ASSERT(total == partitioned_vector_partition_.size());
+
+        std::vector<T> result(count);
+        hpx::detail::copy_region(partitioned_vector_partition_.begin(), shape,
+            lower, result.begin(), sizes, std::vector<size_type>(sizes.size()),
+            sizes);
+        return result;
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::front() const
@@ -323,6 +351,8 @@ namespace hpx::server {
         type::get_value_action, HPX_PP_CAT(__vector_get_value_action_, name))  \
     HPX_REGISTER_ACTION(type::get_values_action,                               \
         HPX_PP_CAT(__vector_get_values_action_, name))                         \
+    HPX_REGISTER_ACTION(type::get_region_action,                               \
+        HPX_PP_CAT(__vector_get_region_action_, name))                         \
     HPX_REGISTER_ACTION(                                                       \
         type::set_value_action, HPX_PP_CAT(__vector_set_value_action_, name))  \
     HPX_REGISTER_ACTION(type::set_values_action,                               \
@@ -490,6 +520,33 @@ namespace hpx {
 #endif
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT std::vector<T>
+    partitioned_vector_partition<T, Data>::get_region(launch::sync_policy,
+        std::vector<std::size_t> const& shape,
+        std::vector<std::size_t> const& lower,
+        std::vector<std::size_t> const& sizes) const
+    {
+        return get_region(shape, lower, sizes).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<std::vector<T>>
+    partitioned_vector_partition<T, Data>::get_region(
+        [[maybe_unused]] std::vector<std::size_t> const& shape,
+        [[maybe_unused]] std::vector<std::size_t> const& lower,
+        [[maybe_unused]] std::vector<std::size_t> const& sizes) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT(this->get_id());
+        return hpx::async(typename server_type::get_region_action(),
+            this->get_id(), shape, lower, sizes);
+#else
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<T>{});
+#endif
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector_partition<T, Data>::set_value(
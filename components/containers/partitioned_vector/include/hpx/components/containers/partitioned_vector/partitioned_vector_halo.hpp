@@ -0,0 +1,456 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/dataflow.hpp>
+#include <hpx/collectives/spmd_block.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <hpx/components/containers/partitioned_vector/detail/copy_region.hpp>
+#include <hpx/components/containers/partitioned_vector/detail/view_element.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_view.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    /// The partitioned_vector_halo exchanges the ghost regions of the
+    /// segments (tiles) of a partitioned_vector_view or of a coarray.
+    ///
+    /// Every tile of the view is interpreted as an N-dimensional array whose
+    /// first dimension varies fastest. It holds the interior of extents
+    /// \a extents surrounded by ghost cells of widths \a widths on both sides
+    /// of each dimension, i.e. the size of every tile has to be the product of
+    /// (extents[i] + 2 * widths[i]). The tile at the subscript (i0, i1, ...)
+    /// of the view is the neighbor of the tiles at the subscripts differing by
+    /// one in any of the dimensions.
+    ///
+    /// Because the ghost cells live inside the tiles, the interior and the
+    /// halo of the tiles owned by an image are accessed directly through the
+    /// local subscripts of a coarray or through partitioned_vector_local_view,
+    /// without any copies. The function offset() maps a subscript relative to
+    /// the first interior element (which may be negative to address the
+    /// ghost cells) to the position of the element inside a tile.
+    ///
+    /// An exchange copies the interior boundary of every neighbor into the
+    /// ghost cells of the tiles owned by the calling image. Neighbors which
+    /// live on the same locality are copied directly, every other neighbor
+    /// is fetched with one message per exchange.
+    ///
+    template <typename T, std::size_t N, typename Data = std::vector<T>>
+    class partitioned_vector_halo
+    {
+    private:
+        using view_type = hpx::partitioned_vector_view<T, N, Data>;
+        using partition_type = hpx::partitioned_vector_partition<T, Data>;
+        using server_type = hpx::server::partitioned_vector<T, Data>;
+        using indices = typename hpx::util::make_index_pack<N>::type;
+
+    public:
+        using shape_type = std::array<std::size_t, N>;
+
+        /// Create the halo description of a view. This has to be invoked by
+        /// all images of the block.
+        ///
+        /// \param block    The spmd_block the view belongs to
+        /// \param view     The view (or coarray) whose tiles get a halo
+        /// \param extents  The extents of the interior of every tile
+        /// \param widths   The widths of the ghost regions in each dimension,
+        ///                 which must not exceed the interior extents
+        /// \param corners  Exchange the edges and corners of the halo as
+        ///                 well, which is needed by box-shaped stencils
+        /// \param periodic Whether the tiles wrap around in each dimension
+        ///
+        partitioned_vector_halo(hpx::lcos::spmd_block const& block,
+            view_type const& view, shape_type const& extents,
+            shape_type const& widths, bool corners = true,
+            std::array<bool, N> const& periodic = {})
+          : block_(block)
+          , extents_(extents)
+          , widths_(widths)
+          , padded_(N)
+        {
+            std::size_t padded_size = 1;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                if (widths_[i] > extents_[i])
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "partitioned_vector_halo::partitioned_vector_halo",
+                        "the ghost width of dimension {} exceeds the extent "
+                        "of the interior ({} > {})",
+                        i, widths_[i], extents_[i]);
+                }
+
+                padded_[i] = extents_[i] + 2 * widths_[i];
+                padded_size *= padded_[i];
+            }
+
+            shape_type const grid = view.sizes();
+            std::size_t num_tiles = 1;
+            for (std::size_t const size : grid)
+            {
+                num_tiles *= size;
+            }
+
+            std::uint32_t const here = hpx::get_locality_id();
+
+            shape_type coords = {};
+            for (std::size_t t = 0; t != num_tiles; ++t)
+            {
+                hpx::detail::view_element<T, Data> tile =
+                    get_tile(view, coords, indices());
+
+                if (tile.is_owned_by_current_thread())
+                {
+                    std::shared_ptr<server_type> data = tile.get_ptr();
+                    if (data->get_data().size() != padded_size)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                            "partitioned_vector_halo::partitioned_vector_halo",
+                            "a tile holds {} elements, its interior and halo "
+                            "need {}",
+                            data->get_data().size(), padded_size);
+                    }
+
+                    tiles_.push_back(HPX_MOVE(data));
+                    add_regions(
+                        view, grid, coords, corners, periodic, here);
+                }
+
+                // advance to the next tile, the first dimension varies
+                // fastest
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    if (++coords[i] != grid[i])
+                    {
+                        break;
+                    }
+                    coords[i] = 0;
+                }
+            }
+        }
+
+        partitioned_vector_halo(partitioned_vector_halo const&) = delete;
+        partitioned_vector_halo(partitioned_vector_halo&&) = default;
+        partitioned_vector_halo& operator=(
+            partitioned_vector_halo const&) = delete;
+        partitioned_vector_halo& operator=(
+            partitioned_vector_halo&&) = default;
+
+        /// Return the extents of the interior of every tile
+        shape_type const& extents() const noexcept
+        {
+            return extents_;
+        }
+
+        /// Return the widths of the ghost regions
+        shape_type const& widths() const noexcept
+        {
+            return widths_;
+        }
+
+        /// Return the extents of a tile including its ghost regions
+        shape_type padded_extents() const noexcept
+        {
+            shape_type result;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                result[i] = padded_[i];
+            }
+            return result;
+        }
+
+        /// Return the number of tiles owned by the calling image
+        std::size_t num_local_tiles() const noexcept
+        {
+            return tiles_.size();
+        }
+
+        /// Return the number of ghost regions filled by an exchange of the
+        /// calling image and how many of them are fetched from another
+        /// locality
+        std::size_t num_regions() const noexcept
+        {
+            return regions_.size();
+        }
+
+        std::size_t num_remote_regions() const noexcept
+        {
+            return num_remote_;
+        }
+
+        /// Return the position inside a tile of the element at the given
+        /// subscript, relative to the first element of the interior. The
+        /// ghost cells are addressed by the subscripts in [-widths[i], 0) and
+        /// [extents[i], extents[i] + widths[i]).
+        template <typename... I>
+        std::size_t offset(I... index) const
+        {
+            static_assert(sizeof...(I) == N,
+                "Subscript must match the partitioned_vector_halo dimension");
+
+            std::array<std::ptrdiff_t, N> const idx = {
+                {static_cast<std::ptrdiff_t>(index)...}};
+
+            std::size_t result = 0;
+            std::size_t stride = 1;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                std::ptrdiff_t const pos =
+                    idx[i] + static_cast<std::ptrdiff_t>(widths_[i]);
+
+                HPX_ASSERT_MSG(pos >= 0 &&
+                        static_cast<std::size_t>(pos) < padded_[i],
+                    "Invalid partitioned_vector_halo subscript");
+
+                result += static_cast<std::size_t>(pos) * stride;
+                stride *= padded_[i];
+            }
+            return result;
+        }
+
+        /// Fill the ghost regions of all tiles owned by the calling image.
+        /// This has to be invoked by all images of the block. The exchange
+        /// starts once all images have reached it, the interior of all tiles
+        /// must not be modified until the returned future has become ready
+        /// on all images. The object must stay alive until the returned
+        /// future has become ready.
+        hpx::future<void> exchange()
+        {
+            return block_.get()
+                .sync_all(hpx::launch::async)
+                .then(hpx::launch::sync, [this](hpx::future<void>&& f) {
+                    f.get();    // rethrow exceptions
+                    return exchange_regions();
+                });
+        }
+
+        /// Fill the ghost regions of all tiles owned by the calling image.
+        void exchange(hpx::launch::sync_policy)
+        {
+            exchange().get();
+        }
+
+    private:
+        // A ghost region of one of the tiles owned by this image together
+        // with the part of the neighbor it is copied from.
+        struct ghost_region
+        {
+            std::size_t tile;
+            std::vector<std::size_t> dst_lower;
+            std::vector<std::size_t> src_lower;
+            std::vector<std::size_t> sizes;
+
+            // the neighbor if it lives on this locality
+            std::shared_ptr<server_type> local;
+
+            // the neighbor otherwise
+            partition_type remote;
+        };
+
+        template <std::size_t... I>
+        static hpx::detail::view_element<T, Data> get_tile(
+            view_type const& view, shape_type const& coords,
+            hpx::util::index_pack<I...>)
+        {
+            return view(coords[I]...);
+        }
+
+        void add_regions(view_type const& view, shape_type const& grid,
+            shape_type const& coords, bool corners,
+            std::array<bool, N> const& periodic, std::uint32_t here)
+        {
+            std::size_t num_directions = 1;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                num_directions *= 3;
+            }
+
+            // enumerate all directions in {-1, 0, 1}^N
+            for (std::size_t d = 0; d != num_directions; ++d)
+            {
+                std::array<int, N> dir;
+                std::size_t num_nonzero = 0;
+                bool skip = false;
+
+                std::size_t digits = d;
+                for (std::size_t i = 0; i != N; ++i, digits /= 3)
+                {
+                    dir[i] = static_cast<int>(digits % 3) - 1;
+                    if (dir[i] != 0)
+                    {
+                        ++num_nonzero;
+                        skip = skip || widths_[i] == 0;
+                    }
+                }
+
+                if (skip || num_nonzero == 0 || (!corners && num_nonzero > 1))
+                {
+                    continue;
+                }
+
+                ghost_region region;
+                region.tile = tiles_.size() - 1;
+                region.dst_lower.resize(N);
+                region.src_lower.resize(N);
+                region.sizes.resize(N);
+
+                shape_type neighbor;
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    if (dir[i] < 0)
+                    {
+                        if (coords[i] == 0 && !periodic[i])
+                        {
+                            skip = true;
+                            break;
+                        }
+                        neighbor[i] = coords[i] == 0 ? grid[i] - 1 :
+                                                       coords[i] - 1;
+
+                        // the lower ghost cells receive the upper end of
+                        // the neighbor's interior
+                        region.dst_lower[i] = 0;
+                        region.src_lower[i] = extents_[i];
+                        region.sizes[i] = widths_[i];
+                    }
+                    else if (dir[i] > 0)
+                    {
+                        if (coords[i] + 1 == grid[i] && !periodic[i])
+                        {
+                            skip = true;
+                            break;
+                        }
+                        neighbor[i] =
+                            coords[i] + 1 == grid[i] ? 0 : coords[i] + 1;
+
+                        // the upper ghost cells receive the lower end of
+                        // the neighbor's interior
+                        region.dst_lower[i] = widths_[i] + extents_[i];
+                        region.src_lower[i] = widths_[i];
+                        region.sizes[i] = widths_[i];
+                    }
+                    else
+                    {
+                        neighbor[i] = coords[i];
+                        region.dst_lower[i] = widths_[i];
+                        region.src_lower[i] = widths_[i];
+                        region.sizes[i] = extents_[i];
+                    }
+                }
+
+                if (skip)
+                {
+                    continue;
+                }
+
+                hpx::detail::view_element<T, Data> tile =
+                    get_tile(view, neighbor, indices());
+
+                if (hpx::naming::get_locality_id_from_id(tile.get_id()) ==
+                    here)
+                {
+                    region.local = tile.get_ptr();
+                }
+                else
+                {
+                    region.remote = partition_type(tile.get_id());
+                    ++num_remote_;
+                }
+
+                regions_.push_back(HPX_MOVE(region));
+            }
+        }
+
+        hpx::future<void> exchange_regions()
+        {
+            // issue the remote requests first to overlap them with the local
+            // copies
+            std::vector<hpx::future<void>> futures;
+            futures.reserve(num_remote_);
+
+            for (ghost_region const& region : regions_)
+            {
+                if (region.local)
+                {
+                    continue;
+                }
+
+                futures.push_back(
+                    region.remote
+                        .get_region(padded_, region.src_lower, region.sizes)
+                        .then(hpx::launch::sync,
+                            [this, &region](
+                                hpx::future<std::vector<T>>&& f) {
+                                std::vector<T> values = f.get();
+                                hpx::detail::copy_region(values.begin(),
+                                    region.sizes,
+                                    std::vector<std::size_t>(N),
+                                    std::begin(
+                                        tiles_[region.tile]->get_data()),
+                                    padded_, region.dst_lower,
+                                    region.sizes);
+                            }));
+            }
+
+            for (ghost_region const& region : regions_)
+            {
+                if (!region.local)
+                {
+                    continue;
+                }
+
+                hpx::detail::copy_region(
+                    std::begin(region.local->get_data()), padded_,
+                    region.src_lower,
+                    std::begin(tiles_[region.tile]->get_data()), padded_,
+                    region.dst_lower, region.sizes);
+            }
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [](std::vector<hpx::future<void>>&& futures) {
+                    // rethrow exceptions
+                    for (hpx::future<void>& f : futures)
+                    {
+                        f.get();
+                    }
+                },
+                HPX_MOVE(futures));
+        }
+
+    private:
+        std::reference_wrapper<hpx::lcos::spmd_block const> block_;
+        shape_type extents_;
+        shape_type widths_;
+        std::vector<std::size_t> padded_;
+
+        // the tiles owned by this image
+        std::vector<std::shared_ptr<server_type>> tiles_;
+
+        std::vector<ghost_region> regions_;
+        std::size_t num_remote_ = 0;
+    };
+}    // namespace hpx
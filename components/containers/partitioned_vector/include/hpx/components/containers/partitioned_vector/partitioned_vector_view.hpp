@@ -167,6 +167,17 @@ namespace hpx {
                 block_, begin_, end_, begin_ + offset);
         }
 
+        // Logical sizes of the view
+        std::array<std::size_t, N> sizes() const
+        {
+            std::array<std::size_t, N> result;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                result[i] = sw_basis_[i + 1] / sw_basis_[i];
+            }
+            return result;
+        }
+
         // Iterator interfaces
         iterator begin()
         {
@@ -8,6 +8,7 @@
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_view.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_local_view.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_halo.hpp>
 
 
 
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/collectives/spmd_block.hpp>
+#include <hpx/components/containers/coarray/coarray.hpp>
+#include <hpx/include/partitioned_vector_view.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// coarray<double> is predefined in the partitioned_vector module
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_COARRAY(double)
+#endif
+
+// interior extents of every tile
+constexpr std::ptrdiff_t ex = 4;
+constexpr std::ptrdiff_t ey = 3;
+
+double value(std::ptrdiff_t gx, std::ptrdiff_t gy)
+{
+    return static_cast<double>(gx + 1000 * gy);
+}
+
+void test_exchange(hpx::lcos::spmd_block const& block,
+    hpx::coarray<double, 2>& a, bool corners, std::array<bool, 2> periodic,
+    bool async)
+{
+    hpx::partitioned_vector_halo<double, 2> halo(
+        block, a, {{ex, ey}}, {{1, 1}}, corners, periodic);
+
+    std::size_t const num_images = block.get_num_images();
+    std::ptrdiff_t const size_x = 2 * ex;
+    std::ptrdiff_t const size_y = static_cast<std::ptrdiff_t>(num_images) * ey;
+
+    // the local view covers exactly the tiles the halo is exchanged for
+    std::size_t num_tiles = 0;
+    for (std::vector<double>& tile : hpx::local_view(a))
+    {
+        HPX_TEST_EQ(tile.size(), std::size_t((ex + 2) * (ey + 2)));
+        ++num_tiles;
+    }
+    HPX_TEST_EQ(num_tiles, halo.num_local_tiles());
+
+    for (std::ptrdiff_t k = 0; k != size_y / ey; ++k)
+    {
+        for (std::ptrdiff_t i = 0; i != 2; ++i)
+        {
+            auto tile = a(i, k);
+            if (!tile.is_owned_by_current_thread())
+                continue;
+
+            std::vector<double>& data = tile.data();
+            std::fill(data.begin(), data.end(), -1.0);
+
+            for (std::ptrdiff_t y = 0; y != ey; ++y)
+                for (std::ptrdiff_t x = 0; x != ex; ++x)
+                    data[halo.offset(x, y)] = value(i * ex + x, k * ey + y);
+        }
+    }
+
+    if (async)
+        halo.exchange().get();
+    else
+        halo.exchange(hpx::launch::sync);
+
+    for (std::ptrdiff_t k = 0; k != size_y / ey; ++k)
+    {
+        for (std::ptrdiff_t i = 0; i != 2; ++i)
+        {
+            auto tile = a(i, k);
+            if (!tile.is_owned_by_current_thread())
+                continue;
+
+            std::vector<double> const& data = tile.data();
+            for (std::ptrdiff_t y = -1; y != ey + 1; ++y)
+            {
+                for (std::ptrdiff_t x = -1; x != ex + 1; ++x)
+                {
+                    bool const ghost_x = x < 0 || x >= ex;
+                    bool const ghost_y = y < 0 || y >= ey;
+
+                    std::ptrdiff_t gx = i * ex + x;
+                    std::ptrdiff_t gy = k * ey + y;
+                    if (periodic[0])
+                        gx = (gx + size_x) % size_x;
+                    if (periodic[1])
+                        gy = (gy + size_y) % size_y;
+
+                    bool const inside =
+                        gx >= 0 && gx < size_x && gy >= 0 && gy < size_y;
+
+                    double expected = -1.0;
+                    if (inside && (corners || !(ghost_x && ghost_y)))
+                        expected = value(gx, gy);
+
+                    HPX_TEST_EQ(data[halo.offset(x, y)], expected);
+                }
+            }
+        }
+    }
+
+    // the neighbors may still be reading our interior
+    block.sync_all();
+}
+
+void halo_test(hpx::lcos::spmd_block block, std::string name)
+{
+    using hpx::container::placeholders::_;
+
+    hpx::coarray<double, 2> a(block, name, {2, _}, (ex + 2) * (ey + 2));
+
+    test_exchange(block, a, true, {{false, false}}, false);
+    test_exchange(block, a, false, {{false, false}}, true);
+    test_exchange(block, a, true, {{true, true}}, true);
+    test_exchange(block, a, false, {{true, false}}, false);
+}
+HPX_PLAIN_ACTION(halo_test, halo_test_action)
+
+int main()
+{
+    hpx::future<void> join = hpx::lcos::define_spmd_block(
+        "block", 2, halo_test_action(), std::string("halo"));
+
+    hpx::wait_all(join);
+
+    return hpx::util::report_errors();
+}
+#endif
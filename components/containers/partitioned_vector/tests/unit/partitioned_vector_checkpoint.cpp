@@ -0,0 +1,213 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector_checkpoint.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+#include <hpx/runtime_distributed/get_num_localities.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(double)
+#endif
+
+constexpr std::size_t vector_size = 100000;
+std::string const filename_base = "partitioned_vector_checkpoint_test.ckpt";
+
+// all localities run this function, locality 0 creates the vectors
+hpx::partitioned_vector<double> create_vector(std::string const& name,
+    std::size_t num_partitions, std::size_t size = vector_size)
+{
+    hpx::partitioned_vector<double> v;
+    if (hpx::get_locality_id() == 0)
+    {
+        v = hpx::partitioned_vector<double>(size,
+            hpx::container_layout(
+                num_partitions, hpx::find_all_localities()));
+        v.register_as(hpx::launch::sync, name);
+    }
+    else
+    {
+        v.connect_to(hpx::launch::sync, name);
+    }
+    return v;
+}
+
+void remove_files(std::uint32_t num_localities)
+{
+    hpx::distributed::barrier::synchronize();
+    if (hpx::get_locality_id() == 0)
+    {
+        // every file is written alternately to a second file (suffix .1)
+        for (std::uint32_t i = 0; i != num_localities; ++i)
+        {
+            std::string const shard = filename_base + "." + std::to_string(i);
+            hpx::filesystem::remove(shard);
+            hpx::filesystem::remove(shard + ".1");
+        }
+        hpx::filesystem::remove(filename_base + ".manifest");
+        hpx::filesystem::remove(filename_base + ".manifest.1");
+    }
+    hpx::distributed::barrier::synchronize();
+}
+
+void test_checkpoint(std::string const& name, std::size_t num_partitions,
+    std::size_t num_restored_partitions)
+{
+    hpx::partitioned_vector<double> v = create_vector(name, num_partitions);
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::size_t i = 0; i != vector_size; ++i)
+        {
+            v.set_value(hpx::launch::sync, i, static_cast<double>(i));
+        }
+    }
+    hpx::distributed::barrier::synchronize();
+
+    hpx::util::save_distributed_checkpoint(filename_base, v);
+
+    // restore into a vector that is partitioned differently
+    hpx::partitioned_vector<double> restored =
+        create_vector(name + "_restored", num_restored_partitions);
+    hpx::util::restore_distributed_checkpoint(filename_base, restored);
+
+    if (hpx::get_locality_id() == 0)
+    {
+        std::vector<double> const values = restored.get_values(
+            hpx::launch::sync, std::vector<std::size_t>{0, 1, vector_size / 2,
+                                   vector_size - 1});
+        HPX_TEST_EQ(values[0], 0.0);
+        HPX_TEST_EQ(values[1], 1.0);
+        HPX_TEST_EQ(values[2], static_cast<double>(vector_size / 2));
+        HPX_TEST_EQ(values[3], static_cast<double>(vector_size - 1));
+
+        for (std::size_t i = 0; i != vector_size; i += 997)
+        {
+            HPX_TEST_EQ(restored.get_value(hpx::launch::sync, i),
+                static_cast<double>(i));
+        }
+    }
+    hpx::distributed::barrier::synchronize();
+
+    // a vector of a different size can't be restored, all localities fail
+    hpx::partitioned_vector<double> other =
+        create_vector(name + "_other", 1, vector_size / 2);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::util::restore_distributed_checkpoint(filename_base, other);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    hpx::distributed::barrier::synchronize();
+}
+
+// all localities run this function, locality 0 checks the values
+void test_restored(hpx::partitioned_vector<double>& v, double factor)
+{
+    hpx::util::restore_distributed_checkpoint(filename_base, v);
+
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::size_t i = 0; i != vector_size; i += 997)
+        {
+            HPX_TEST_EQ(v.get_value(hpx::launch::sync, i),
+                factor * static_cast<double>(i));
+        }
+    }
+    hpx::distributed::barrier::synchronize();
+}
+
+void test_interrupted_save(std::string const& name, std::size_t num_partitions)
+{
+    hpx::partitioned_vector<double> v = create_vector(name, num_partitions);
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::size_t i = 0; i != vector_size; ++i)
+        {
+            v.set_value(hpx::launch::sync, i, static_cast<double>(i));
+        }
+    }
+    hpx::distributed::barrier::synchronize();
+
+    hpx::util::save_distributed_checkpoint(filename_base, v);
+
+    if (hpx::get_locality_id() == 0)
+    {
+        for (std::size_t i = 0; i != vector_size; ++i)
+        {
+            v.set_value(hpx::launch::sync, i, -static_cast<double>(i));
+        }
+    }
+    hpx::distributed::barrier::synchronize();
+
+    // the save is interrupted after all shards were committed but before
+    // the manifest was written, the previous checkpoint is restored
+    hpx::util::detail::save_checkpoint_shard(
+        filename_base, v, hpx::util::checkpoint_file_options());
+    hpx::distributed::barrier::synchronize();
+
+    hpx::partitioned_vector<double> restored =
+        create_vector(name + "_restored", num_partitions);
+    test_restored(restored, 1.0);
+
+    // the completed save replaces it
+    hpx::util::save_distributed_checkpoint(filename_base, v);
+    test_restored(restored, -1.0);
+}
+
+int hpx_main()
+{
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    remove_files(num_localities);
+
+    test_checkpoint("checkpoint_test_1", num_localities, num_localities);
+    test_checkpoint("checkpoint_test_2", 4 * num_localities, 3);
+
+    // repeated checkpoints to the same files are incremental
+    test_checkpoint("checkpoint_test_3", 4 * num_localities, 1);
+
+    test_interrupted_save("checkpoint_test_4", num_localities);
+
+    remove_files(num_localities);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
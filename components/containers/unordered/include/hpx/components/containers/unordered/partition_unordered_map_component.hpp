@@ -28,7 +28,7 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
@@ -36,40 +36,151 @@
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/unordered_map_statistics.hpp>
+
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace server {
+    namespace detail {
+        // The client selects the partition of a key using the lower bits of
+        // its hash, mix the bits such that the keys of one partition are
+        // still distributed evenly over the shards of the partition.
+        constexpr std::uint64_t mix_unordered_map_hash(std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        inline std::size_t get_unordered_map_num_shards() noexcept
+        {
+            std::size_t const concurrency = (std::min)(
+                2 * (std::max)(std::thread::hardware_concurrency(), 1U), 64U);
+
+            std::size_t num_shards = 1;
+            while (num_shards < concurrency)
+                num_shards <<= 1;
+            return num_shards;
+        }
+    }    // namespace detail
+
     /// \brief This is the basic wrapper class for stl unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
     /// component functionality.
+    ///
+    /// The elements are distributed over a number of shards, each of which
+    /// is protected by its own lock. Actions accessing different shards run
+    /// concurrently. The batched actions (get_values, set_values,
+    /// erase_values) acquire the lock of every shard they touch only once.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
-      : public components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
     {
     public:
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+        typedef hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        typedef hpx::spinlock mutex_type;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            data_type data_;
+        };
+
+        typedef hpx::util::cache_aligned_data_derived<shard> shard_type;
+
+        std::size_t num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        Hash hash_;
+
+        unordered_map_partition_load load_;
+
+        std::size_t get_shard_index(Key const& key) const
+        {
+            return static_cast<std::size_t>(detail::mix_unordered_map_hash(
+                       static_cast<std::uint64_t>(hash_(key)))) &
+                (num_shards_ - 1);
+        }
+
+        shard_type& get_shard(Key const& key) const
+        {
+            return shards_[get_shard_index(key)];
+        }
+
+        // Invoke f(data, i) for all keys[i] while holding the lock of the
+        // shard the key belongs to. The keys are grouped by their shard,
+        // every lock is acquired once. The keys of one shard are visited in
+        // their original order.
+        template <typename F>
+        void for_each_shard(std::vector<Key> const& keys, F&& f) const
+        {
+            std::vector<std::size_t> shard_of(keys.size());
+            std::vector<std::size_t> bounds(num_shards_ + 1, 0);
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                shard_of[i] = get_shard_index(keys[i]);
+                ++bounds[shard_of[i] + 1];
+            }
+            std::partial_sum(bounds.begin(), bounds.end(), bounds.begin());
+
+            std::vector<std::size_t> positions(keys.size());
+            std::vector<std::size_t> next(bounds.begin(), bounds.end() - 1);
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                positions[next[shard_of[i]]++] = i;
+            }
+
+            for (std::size_t s = 0; s != num_shards_; ++s)
+            {
+                if (bounds[s] == bounds[s + 1])
+                    continue;
+
+                shard_type& sh = shards_[s];
+                std::lock_guard<mutex_type> l(sh.mtx_);
+                for (std::size_t j = bounds[s]; j != bounds[s + 1]; ++j)
+                {
+                    f(sh.data_, positions[j]);
+                }
+            }
+        }
+
+        void record_batch(
+            std::size_t num_keys, std::uint64_t start) const noexcept
+        {
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - start;
+            record_unordered_map_batch_service(
+                num_keys, static_cast<std::int64_t>(elapsed));
+        }
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -78,24 +189,44 @@ namespace hpx { namespace server {
 
         /// Default Constructor which create partition_unordered_map
         /// with size 0.
-        partition_unordered_map() {}
+        partition_unordered_map()
+          : partition_unordered_map(0, Hash(), KeyEqual())
+        {
+        }
 
         explicit partition_unordered_map(size_type bucket_count)
-          : partition_unordered_map_(bucket_count)
+          : partition_unordered_map(bucket_count, Hash(), KeyEqual())
         {
         }
 
         partition_unordered_map(
             size_type bucket_count, Hash const& hash, KeyEqual const& equal)
-          : partition_unordered_map_(bucket_count, hash, equal)
+          : num_shards_(detail::get_unordered_map_num_shards())
+          , shards_(new shard_type[num_shards_])
+          , hash_(hash)
         {
+            size_type const shard_buckets =
+                (bucket_count + num_shards_ - 1) / num_shards_;
+            for (std::size_t s = 0; s != num_shards_; ++s)
+            {
+                shards_[s].data_ = data_type(shard_buckets, hash, equal);
+            }
         }
 
         // support components::copy
         partition_unordered_map(partition_unordered_map const& rhs)
           : base_type(rhs)
-          , partition_unordered_map_(rhs.partition_unordered_map_)
+          , num_shards_(rhs.num_shards_)
+          , shards_(new shard_type[num_shards_])
+          , hash_(rhs.hash_)
         {
+            for (std::size_t s = 0; s != num_shards_; ++s)
+            {
+                std::lock_guard<mutex_type> l(rhs.shards_[s].mtx_);
+                shards_[s].data_ = rhs.shards_[s].data_;
+                load_.add_elements(
+                    static_cast<std::int64_t>(shards_[s].data_.size()));
+            }
         }
 
         partition_unordered_map& operator=(partition_unordered_map const& rhs)
@@ -103,64 +234,66 @@ namespace hpx { namespace server {
             if (this != &rhs)
             {
                 this->base_type::operator=(rhs);
-                partition_unordered_map_ = rhs.partition_unordered_map_;
+
+                std::unique_ptr<shard_type[]> shards(
+                    new shard_type[rhs.num_shards_]);
+                std::int64_t elements = 0;
+                for (std::size_t s = 0; s != rhs.num_shards_; ++s)
+                {
+                    std::lock_guard<mutex_type> l(rhs.shards_[s].mtx_);
+                    shards[s].data_ = rhs.shards_[s].data_;
+                    elements +=
+                        static_cast<std::int64_t>(shards[s].data_.size());
+                }
+
+                num_shards_ = rhs.num_shards_;
+                shards_ = HPX_MOVE(shards);
+                hash_ = rhs.hash_;
+                load_.add_elements(elements - load_.elements());
             }
             return *this;
         }
 
         partition_unordered_map(partition_unordered_map&& rhs) noexcept
           : base_type(HPX_MOVE(rhs))
-          , partition_unordered_map_(HPX_MOVE(rhs.partition_unordered_map_))
-        {
-        }
-
-        partition_unordered_map& operator=(
-            partition_unordered_map&& rhs) noexcept
+          , num_shards_(rhs.num_shards_)
+          , shards_(HPX_MOVE(rhs.shards_))
+          , hash_(HPX_MOVE(rhs.hash_))
         {
-            if (this != &rhs)
-            {
-                this->base_type::operator=(HPX_MOVE(rhs));
-                partition_unordered_map_ =
-                    HPX_MOVE(rhs.partition_unordered_map_);
-            }
-            return *this;
+            std::int64_t const elements = rhs.load_.elements();
+            load_.add_elements(elements);
+            rhs.load_.add_elements(-elements);
+            rhs.num_shards_ = 0;
         }
 
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            data_type result(0, hash_, shards_[0].data_.key_eq());
+            result.reserve(size());
+            for (std::size_t s = 0; s != num_shards_; ++s)
+            {
+                std::lock_guard<mutex_type> l(shards_[s].mtx_);
+                result.insert(
+                    shards_[s].data_.begin(), shards_[s].data_.end());
+            }
+            return result;
         }
         void set_copied_data(data_type&& d)
         {
-            partition_unordered_map_ = HPX_MOVE(d);
-        }
+            clear();
 
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
+            std::int64_t inserted = 0;
+            while (!d.empty())
+            {
+                auto node = d.extract(d.begin());
 
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+                shard_type& sh = get_shard(node.key());
+                std::lock_guard<mutex_type> l(sh.mtx_);
+                if (sh.data_.insert(HPX_MOVE(node)).inserted)
+                    ++inserted;
+            }
+            load_.add_elements(inserted);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -170,27 +303,19 @@ namespace hpx { namespace server {
         /// Returns the number of elements
         size_type size() const
         {
-            return partition_unordered_map_.size();
-        }
-
-        /// Returns the maximum possible number of elements
-        size_type max_size() const
-        {
-            return partition_unordered_map_.max_size();
+            return static_cast<size_type>(load_.elements());
         }
 
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
+        /// Checks if the container has no elements
+        bool empty() const
         {
-            return partition_unordered_map_.capacity();
+            return size() == 0;
         }
 
-        /// Checks if the container has no elements, i.e. whether
-        /// begin() == end().
-        bool empty() const
+        /// Returns the number of shards the elements are distributed over
+        std::size_t num_shards() const
         {
-            return partition_unordered_map_.empty();
+            return num_shards_;
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -207,23 +332,28 @@ namespace hpx { namespace server {
         ///
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it =
-                partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            load_.add_accesses(1);
             {
-                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                    "partition_unordered_map::get_value",
-                    "unable to find requested key in this partition of the "
-                    "unordered_map");
-            }
+                shard_type& sh = get_shard(key);
+                std::lock_guard<mutex_type> l(sh.mtx_);
 
-            if (!erase)
-                return it->second;
+                typename data_type::iterator it = sh.data_.find(key);
+                if (it != sh.data_.end())
+                {
+                    if (!erase)
+                        return it->second;
 
-            auto on_exit = hpx::experimental::scope_exit(
-                [this, &it] { partition_unordered_map_.erase(it); });
+                    T result = HPX_MOVE(it->second);
+                    sh.data_.erase(it);
+                    load_.add_elements(-1);
+                    return result;
+                }
+            }
 
-            return it->second;
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "partition_unordered_map::get_value",
+                "unable to find requested key in this partition of the "
+                "unordered_map");
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -236,22 +366,38 @@ namespace hpx { namespace server {
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            // T is not required to be default constructible
+            std::vector<std::optional<T>> found(keys.size());
+            bool found_all = true;
+
+            for_each_shard(
+                keys, [&](data_type const& data, std::size_t i) {
+                    typename data_type::const_iterator it = data.find(keys[i]);
+                    if (it == data.end())
+                        found_all = false;
+                    else
+                        found[i].emplace(it->second);
+                });
+
+            load_.add_accesses(static_cast<std::int64_t>(keys.size()));
+            record_batch(keys.size(), start);
+
+            if (!found_all)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "partition_unordered_map::get_values",
+                    "unable to find requested key in this partition of the "
+                    "unordered_map");
+            }
+
             std::vector<T> result;
             result.reserve(keys.size());
-
-            for (std::size_t i = 0; i != keys.size(); ++i)
+            for (std::optional<T>& value : found)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
-                {
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "partition_unordered_map::get_values",
-                        "unable to find requested key in this partition of the "
-                        "unordered_map");
-                    break;
-                }
-                result.push_back(it->second);
+                result.emplace_back(HPX_MOVE(*value));
             }
             return result;
         }
@@ -269,7 +415,12 @@ namespace hpx { namespace server {
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            load_.add_accesses(1);
+
+            shard_type& sh = get_shard(pos);
+            std::lock_guard<mutex_type> l(sh.mtx_);
+            if (sh.data_.insert_or_assign(pos, val).second)
+                load_.add_elements(1);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -282,10 +433,19 @@ namespace hpx { namespace server {
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
-            for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::int64_t inserted = 0;
+            for_each_shard(keys, [&](data_type& data, std::size_t i) {
+                if (data.insert_or_assign(keys[i], val[i]).second)
+                    ++inserted;
+            });
+
+            load_.add_elements(inserted);
+            load_.add_accesses(static_cast<std::int64_t>(keys.size()));
+            record_batch(keys.size(), start);
         }
 
         /// Remove all elements from the vector leaving the
@@ -293,13 +453,46 @@ namespace hpx { namespace server {
         ///
         void clear()
         {
-            partition_unordered_map_.clear();
+            std::int64_t erased = 0;
+            for (std::size_t s = 0; s != num_shards_; ++s)
+            {
+                std::lock_guard<mutex_type> l(shards_[s].mtx_);
+                erased += static_cast<std::int64_t>(shards_[s].data_.size());
+                shards_[s].data_.clear();
+            }
+            load_.add_elements(-erased);
         }
 
         /// Erase the given element
         std::size_t erase(Key const& key)
         {
-            return partition_unordered_map_.erase(key);
+            load_.add_accesses(1);
+
+            shard_type& sh = get_shard(key);
+            std::lock_guard<mutex_type> l(sh.mtx_);
+            std::size_t const erased = sh.data_.erase(key);
+            load_.add_elements(-static_cast<std::int64_t>(erased));
+            return erased;
+        }
+
+        /// Erase the elements with the given keys
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(std::vector<Key> const& keys)
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::size_t erased = 0;
+            for_each_shard(keys, [&](data_type& data, std::size_t i) {
+                erased += data.erase(keys[i]);
+            });
+
+            load_.add_elements(-static_cast<std::int64_t>(erased));
+            load_.add_accesses(static_cast<std::int64_t>(keys.size()));
+            record_batch(keys.size(), start);
+            return erased;
         }
 
         /// Macros to define HPX component actions for all exported functions.
@@ -312,6 +505,8 @@ namespace hpx { namespace server {
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, erase_values)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
             partition_unordered_map, get_copied_data)
@@ -364,6 +559,9 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,           \
         HPX_PP_CAT(__unordered_map_erase_action_, name))                       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action,    \
+        HPX_PP_CAT(__unordered_map_erase_values_action_, name))                \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action, \
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name))             \
@@ -421,6 +619,9 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,           \
         HPX_PP_CAT(__unordered_map_erase_action_, name))                       \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action,    \
+        HPX_PP_CAT(__unordered_map_erase_values_action_, name))                \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action, \
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name))             \
@@ -664,6 +865,34 @@ namespace hpx {
                 this->get_id(), key);
         }
 
+        /// Erase the elements with the given keys from the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(
+            launch::sync_policy, std::vector<Key> const& keys)
+        {
+            return erase_values(keys).get();
+        }
+
+        /// Erase the elements with the given keys from the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         elements erased
+        ///
+        future<std::size_t> erase_values(std::vector<Key> const& keys)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::erase_values_action>(
+                this->get_id(), keys);
+        }
+
         /// Get/set all the data of this partition
         future<typename server_type::data_type> get_data() const
         {
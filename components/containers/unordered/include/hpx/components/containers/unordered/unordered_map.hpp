@@ -12,6 +12,7 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/dataflow.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -23,13 +24,16 @@
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/unordered_map.hpp>
 #include <hpx/serialization/vector.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
 #include <hpx/components/containers/unordered/unordered_map_segmented_iterator.hpp>
+#include <hpx/components/containers/unordered/unordered_map_statistics.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <string>
@@ -377,6 +381,59 @@ namespace hpx {
             return ids;
         }
 
+        // Split the positions of the given keys into one batch per partition
+        std::vector<std::vector<std::size_t>> get_partition_batches(
+            std::vector<Key> const& keys) const
+        {
+            std::vector<std::vector<std::size_t>> batches(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                batches[get_partition(keys[i])].push_back(i);
+            }
+            return batches;
+        }
+
+        // Return the non-empty batches, the batches of remote partitions
+        // first such that their actions are in flight while the local
+        // partitions are accessed.
+        std::vector<std::size_t> get_batch_order(
+            std::vector<std::vector<std::size_t>> const& batches) const
+        {
+            std::vector<std::size_t> order;
+            for (std::size_t part = 0; part != batches.size(); ++part)
+            {
+                if (!batches[part].empty() && !partitions_[part].local_data_)
+                    order.push_back(part);
+            }
+            for (std::size_t part = 0; part != batches.size(); ++part)
+            {
+                if (!batches[part].empty() && partitions_[part].local_data_)
+                    order.push_back(part);
+            }
+            return order;
+        }
+
+        template <typename U>
+        static std::vector<U> gather_batch(std::vector<U> const& values,
+            std::vector<std::size_t> const& positions)
+        {
+            std::vector<U> result;
+            result.reserve(positions.size());
+            for (std::size_t pos : positions)
+            {
+                result.push_back(values[pos]);
+            }
+            return result;
+        }
+
+        static void record_batch_latency(std::uint64_t start) noexcept
+        {
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - start;
+            server::record_unordered_map_batch_latency(
+                static_cast<std::int64_t>(elapsed));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         struct get_ptr_helper
         {
@@ -878,6 +935,255 @@ namespace hpx {
                 .erase(key);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Bulk operations
+        //
+        // The keys are grouped by the partition they belong to, every
+        // partition receives a single action for all of its keys. The
+        // batches for remote partitions are sent before the local partitions
+        // are accessed.
+
+        /// Returns the elements with the given keys in the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements with the given keys
+        ///         (in the order of the keys)
+        ///
+        std::vector<T> get_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Returns the elements with the given keys in the unordered_map
+        /// container asynchronously.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements with
+        ///         the given keys (in the order of the keys)
+        ///
+        future<std::vector<T>> get_values(std::vector<Key> const& keys) const
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::vector<std::vector<std::size_t>> batches =
+                get_partition_batches(keys);
+
+            std::vector<std::size_t> parts;
+            std::vector<future<std::vector<T>>> results;
+            for (std::size_t part : get_batch_order(batches))
+            {
+                partition_data const& part_data = partitions_[part];
+                std::vector<Key> part_keys = gather_batch(keys, batches[part]);
+
+                parts.push_back(part);
+                if (part_data.local_data_)
+                {
+                    // report errors through the returned future, as for the
+                    // remote partitions
+                    try
+                    {
+                        results.push_back(make_ready_future(
+                            part_data.local_data_->get_values(part_keys)));
+                    }
+                    catch (...)
+                    {
+                        results.push_back(
+                            hpx::make_exceptional_future<std::vector<T>>(
+                                std::current_exception()));
+                    }
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .get_values(part_keys));
+                }
+            }
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [start, count = keys.size(), parts = HPX_MOVE(parts),
+                    batches = HPX_MOVE(batches)](
+                    std::vector<future<std::vector<T>>>&& results)
+                    -> std::vector<T> {
+                    // the index of the result holding the value of every
+                    // key, the positions of each batch are in key order
+                    std::vector<std::size_t> source(count);
+                    std::vector<std::vector<T>> part_values;
+                    part_values.reserve(results.size());
+                    for (std::size_t i = 0; i != results.size(); ++i)
+                    {
+                        for (std::size_t pos : batches[parts[i]])
+                        {
+                            source[pos] = i;
+                        }
+                        part_values.push_back(results[i].get());
+                    }
+
+                    // T is not required to be default constructible
+                    std::vector<std::size_t> next(results.size(), 0);
+                    std::vector<T> values;
+                    values.reserve(count);
+                    for (std::size_t pos = 0; pos != count; ++pos)
+                    {
+                        std::size_t const i = source[pos];
+                        values.emplace_back(
+                            HPX_MOVE(part_values[i][next[i]++]));
+                    }
+                    record_batch_latency(start);
+                    return values;
+                },
+                HPX_MOVE(results));
+        }
+
+        /// Copy the values \a vals to the elements with the keys \a keys in
+        /// the unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// keys \a keys in the unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::vector<std::vector<std::size_t>> const batches =
+                get_partition_batches(keys);
+
+            std::vector<future<void>> results;
+            for (std::size_t part : get_batch_order(batches))
+            {
+                partition_data const& part_data = partitions_[part];
+                std::vector<Key> part_keys = gather_batch(keys, batches[part]);
+                std::vector<T> part_vals = gather_batch(vals, batches[part]);
+
+                if (part_data.local_data_)
+                {
+                    try
+                    {
+                        part_data.local_data_->set_values(part_keys, part_vals);
+                    }
+                    catch (...)
+                    {
+                        results.push_back(hpx::make_exceptional_future<void>(
+                            std::current_exception()));
+                    }
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .set_values(part_keys, part_vals));
+                }
+            }
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [start](std::vector<future<void>>&& results) -> void {
+                    for (future<void>& f : results)
+                    {
+                        f.get();    // rethrow exceptions
+                    }
+                    record_batch_latency(start);
+                },
+                HPX_MOVE(results));
+        }
+
+        /// Erase the elements with the given keys from the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(
+            launch::sync_policy, std::vector<Key> const& keys)
+        {
+            return erase_values(keys).get();
+        }
+
+        /// Erase the elements with the given keys from the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         elements erased
+        ///
+        future<std::size_t> erase_values(std::vector<Key> const& keys)
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+
+            std::vector<std::vector<std::size_t>> const batches =
+                get_partition_batches(keys);
+
+            std::vector<future<std::size_t>> results;
+            for (std::size_t part : get_batch_order(batches))
+            {
+                partition_data const& part_data = partitions_[part];
+                std::vector<Key> part_keys = gather_batch(keys, batches[part]);
+
+                if (part_data.local_data_)
+                {
+                    try
+                    {
+                        results.push_back(make_ready_future(
+                            part_data.local_data_->erase_values(part_keys)));
+                    }
+                    catch (...)
+                    {
+                        results.push_back(
+                            hpx::make_exceptional_future<std::size_t>(
+                                std::current_exception()));
+                    }
+                }
+                else
+                {
+                    results.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .erase_values(part_keys));
+                }
+            }
+
+            return hpx::dataflow(
+                hpx::launch::sync,
+                [start](std::vector<future<std::size_t>>&& results)
+                    -> std::size_t {
+                    std::size_t erased = 0;
+                    for (future<std::size_t>& f : results)
+                    {
+                        erased += f.get();
+                    }
+                    record_batch_latency(start);
+                    return erased;
+                },
+                HPX_MOVE(results));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         typedef segmented::segment_unordered_map_iterator<Key, T, Hash,
             KeyEqual, typename partitions_vector_type::iterator>
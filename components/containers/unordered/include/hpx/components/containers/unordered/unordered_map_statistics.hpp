@@ -0,0 +1,85 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/unordered_map_statistics.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components/containers/unordered/export_definitions.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/// The statistics collected by the partitions of all unordered_maps on a
+/// locality. They are exposed as the performance counters
+///
+///   /unordered_map{locality#<*>/total}/count/batches
+///   /unordered_map{locality#<*>/total}/count/average-batch-size
+///   /unordered_map{locality#<*>/total}/time/average-batch-service
+///   /unordered_map{locality#<*>/total}/time/average-batch-latency
+///   /unordered_map{locality#<*>/total}/count/partition-load
+///   /unordered_map{locality#<*>/total}/count/partition-accesses
+
+namespace hpx::server {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The load of a single partition of an unordered_map. Every partition
+    /// registers its instance with the statistics of its locality for the
+    /// lifetime of the partition.
+    class HPX_UNORDERED_EXPORT unordered_map_partition_load
+    {
+    public:
+        unordered_map_partition_load();
+
+        // a copy is a new partition, it has to be registered separately
+        unordered_map_partition_load(unordered_map_partition_load const&)
+          : unordered_map_partition_load()
+        {
+        }
+
+        unordered_map_partition_load& operator=(
+            unordered_map_partition_load const&) noexcept
+        {
+            return *this;
+        }
+
+        ~unordered_map_partition_load();
+
+        void add_elements(std::int64_t count) noexcept
+        {
+            elements_.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        void add_accesses(std::int64_t count) noexcept
+        {
+            accesses_.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::int64_t elements() const noexcept
+        {
+            return elements_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::int64_t accesses(bool reset) noexcept;
+
+    private:
+        std::atomic<std::int64_t> elements_{0};
+        std::atomic<std::int64_t> accesses_{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Record a batch of \a num_keys keys that was handled by a partition on
+    /// this locality in \a elapsed nanoseconds.
+    HPX_UNORDERED_EXPORT void record_unordered_map_batch_service(
+        std::size_t num_keys, std::int64_t elapsed) noexcept;
+
+    /// Record a bulk operation that was issued from this locality and
+    /// completed after \a elapsed nanoseconds.
+    HPX_UNORDERED_EXPORT void record_unordered_map_batch_latency(
+        std::int64_t elapsed) noexcept;
+}    // namespace hpx::server
@@ -0,0 +1,226 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file src/components/containers/unordered/unordered_map_statistics.cpp
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/runtime_local/startup_function.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <hpx/components/containers/unordered/unordered_map_statistics.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx::server {
+
+    namespace {
+
+        struct unordered_map_statistics
+        {
+            // every counter has its own denominator, which allows to reset
+            // the counters independently of each other
+            std::atomic<std::int64_t> batches{0};
+
+            std::atomic<std::int64_t> batch_keys{0};
+            std::atomic<std::int64_t> batch_keys_count{0};
+
+            std::atomic<std::int64_t> service_time{0};
+            std::atomic<std::int64_t> service_count{0};
+
+            std::atomic<std::int64_t> latency_time{0};
+            std::atomic<std::int64_t> latency_count{0};
+
+            // the partitions currently alive on this locality, in the order
+            // of their creation
+            hpx::spinlock mtx;
+            std::vector<unordered_map_partition_load*> partitions;
+        };
+
+        unordered_map_statistics& get_statistics()
+        {
+            static unordered_map_statistics statistics;
+            return statistics;
+        }
+
+        std::int64_t get_average(std::atomic<std::int64_t>& total,
+            std::atomic<std::int64_t>& count, bool reset)
+        {
+            std::int64_t const t = hpx::util::get_and_reset_value(total, reset);
+            std::int64_t const c = hpx::util::get_and_reset_value(count, reset);
+            return c == 0 ? 0 : t / c;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t get_batches(bool reset)
+        {
+            return hpx::util::get_and_reset_value(
+                get_statistics().batches, reset);
+        }
+
+        std::int64_t get_average_batch_size(bool reset)
+        {
+            unordered_map_statistics& s = get_statistics();
+            return get_average(s.batch_keys, s.batch_keys_count, reset);
+        }
+
+        std::int64_t get_average_batch_service(bool reset)
+        {
+            unordered_map_statistics& s = get_statistics();
+            return get_average(s.service_time, s.service_count, reset);
+        }
+
+        std::int64_t get_average_batch_latency(bool reset)
+        {
+            unordered_map_statistics& s = get_statistics();
+            return get_average(s.latency_time, s.latency_count, reset);
+        }
+
+        std::vector<std::int64_t> get_partition_load(bool)
+        {
+            unordered_map_statistics& s = get_statistics();
+
+            std::lock_guard<hpx::spinlock> l(s.mtx);
+
+            std::vector<std::int64_t> result;
+            result.reserve(s.partitions.size());
+            for (unordered_map_partition_load const* p : s.partitions)
+            {
+                result.push_back(p->elements());
+            }
+            return result;
+        }
+
+        std::vector<std::int64_t> get_partition_accesses(bool reset)
+        {
+            unordered_map_statistics& s = get_statistics();
+
+            std::lock_guard<hpx::spinlock> l(s.mtx);
+
+            std::vector<std::int64_t> result;
+            result.reserve(s.partitions.size());
+            for (unordered_map_partition_load* p : s.partitions)
+            {
+                result.push_back(p->accesses(reset));
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void register_counter_types()
+        {
+            namespace pc = hpx::performance_counters;
+
+            pc::install_counter_type("/unordered_map/count/batches",
+                &get_batches,
+                "returns the number of batched operations handled by the "
+                "partitions of all unordered_maps on the referenced locality",
+                "", pc::counter_type::monotonically_increasing);
+            pc::install_counter_type("/unordered_map/count/average-batch-size",
+                &get_average_batch_size,
+                "returns the average number of keys in a batched operation "
+                "handled by the partitions of all unordered_maps on the "
+                "referenced locality",
+                "", pc::counter_type::average_count);
+            pc::install_counter_type(
+                "/unordered_map/time/average-batch-service",
+                &get_average_batch_service,
+                "returns the average time the partitions of all unordered_maps "
+                "on the referenced locality spent on a batched operation",
+                "ns", pc::counter_type::average_timer);
+            pc::install_counter_type(
+                "/unordered_map/time/average-batch-latency",
+                &get_average_batch_latency,
+                "returns the average time it took to complete a bulk "
+                "operation on an unordered_map invoked from the referenced "
+                "locality",
+                "ns", pc::counter_type::average_timer);
+            pc::install_counter_type("/unordered_map/count/partition-load",
+                &get_partition_load,
+                "returns the number of elements held by each of the "
+                "partitions of all unordered_maps on the referenced locality");
+            pc::install_counter_type(
+                "/unordered_map/count/partition-accesses",
+                &get_partition_accesses,
+                "returns the number of keys accessed on each of the "
+                "partitions of all unordered_maps on the referenced locality");
+        }
+
+        bool get_startup(
+            hpx::startup_function_type& startup_func, bool& pre_startup)
+        {
+            startup_func = register_counter_types;
+            pre_startup = true;
+            return true;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    unordered_map_partition_load::unordered_map_partition_load()
+    {
+        unordered_map_statistics& s = get_statistics();
+
+        std::lock_guard<hpx::spinlock> l(s.mtx);
+        s.partitions.push_back(this);
+    }
+
+    unordered_map_partition_load::~unordered_map_partition_load()
+    {
+        unordered_map_statistics& s = get_statistics();
+
+        std::lock_guard<hpx::spinlock> l(s.mtx);
+        auto const it =
+            std::find(s.partitions.begin(), s.partitions.end(), this);
+        if (it != s.partitions.end())
+        {
+            s.partitions.erase(it);
+        }
+    }
+
+    std::int64_t unordered_map_partition_load::accesses(bool reset) noexcept
+    {
+        return hpx::util::get_and_reset_value(accesses_, reset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void record_unordered_map_batch_service(
+        std::size_t num_keys, std::int64_t elapsed) noexcept
+    {
+        unordered_map_statistics& s = get_statistics();
+        s.batches.fetch_add(1, std::memory_order_relaxed);
+
+        s.batch_keys.fetch_add(
+            static_cast<std::int64_t>(num_keys), std::memory_order_relaxed);
+        s.batch_keys_count.fetch_add(1, std::memory_order_relaxed);
+
+        s.service_time.fetch_add(elapsed, std::memory_order_relaxed);
+        s.service_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void record_unordered_map_batch_latency(std::int64_t elapsed) noexcept
+    {
+        unordered_map_statistics& s = get_statistics();
+        s.latency_time.fetch_add(elapsed, std::memory_order_relaxed);
+        s.latency_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}    // namespace hpx::server
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+//
+// Note that this macro can be used not more than once in one module.
+HPX_REGISTER_STARTUP_MODULE(hpx::server::get_startup)
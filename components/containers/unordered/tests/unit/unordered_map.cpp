@@ -153,6 +153,107 @@ void trivial_tests()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename Value, typename DistPolicy>
+void bulk_tests(DistPolicy const& policy)
+{
+    hpx::unordered_map<Key, Value> m(17, policy);
+
+    std::size_t const count = 1007;
+
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        values.push_back(Value(i));
+    }
+
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), count);
+
+    // the values are returned in the order of the keys
+    std::reverse(keys.begin(), keys.end());
+    std::reverse(values.begin(), values.end());
+    HPX_TEST(m.get_values(keys).get() == values);
+
+    for (std::size_t i = 0; i != count; i += 101)
+    {
+        HPX_TEST_EQ(m[std::to_string(i)], Value(i));
+    }
+
+    // overwriting existing elements does not change the size
+    std::vector<Key> odd_keys;
+    std::vector<Value> odd_values;
+    for (std::size_t i = 1; i < count; i += 2)
+    {
+        odd_keys.push_back(std::to_string(i));
+        odd_values.push_back(Value(2 * i));
+    }
+
+    m.set_values(odd_keys, odd_values).get();
+    HPX_TEST_EQ(m.size(), count);
+    HPX_TEST(m.get_values(hpx::launch::sync, odd_keys) == odd_values);
+
+    // keys which are not present are not counted as erased
+    odd_keys.push_back(std::to_string(count));
+    HPX_TEST_EQ(m.erase_values(odd_keys).get(), count / 2);
+    HPX_TEST_EQ(m.size(), count - count / 2);
+    HPX_TEST_EQ(m.erase_values(hpx::launch::sync, odd_keys), std::size_t(0));
+
+    // reading a key which is not present throws
+    bool caught_exception = false;
+    try
+    {
+        m.get_values(hpx::launch::sync, odd_keys);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    HPX_TEST(m.get_values(hpx::launch::sync, std::vector<Key>()).empty());
+}
+
+// Keys which are not present in a local partition are reported through the
+// returned future as well.
+template <typename Key, typename Value>
+void bulk_local_error_tests()
+{
+    // all partitions are placed on this locality
+    hpx::unordered_map<Key, Value> m(17, hpx::container_layout(3));
+
+    std::vector<Key> const keys = {"1", "2", "3"};
+    m.set_values(hpx::launch::sync, keys, std::vector<Value>(3, Value(42)));
+
+    std::vector<Key> const missing_keys = {"1", "4", "3"};
+
+    bool caught_exception = false;
+    hpx::future<std::vector<Value>> f;
+    try
+    {
+        f = m.get_values(missing_keys);
+    }
+    catch (...)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(!caught_exception);
+    HPX_TEST(f.valid());
+    HPX_TEST(f.has_exception());
+
+    try
+    {
+        f.get();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
 int main()
 {
     trivial_tests<std::string, double>();
@@ -164,6 +265,10 @@ int main()
     trivial_tests<std::string, double>(hpx::container_layout(3, localities));
     trivial_tests<std::string, double>(hpx::container_layout(localities));
 
+    bulk_tests<std::string, double>(hpx::container_layout);
+    bulk_tests<std::string, double>(hpx::container_layout(3, localities));
+    bulk_local_error_tests<std::string, double>();
+
     return 0;
 }
 #endif
@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_COALESCING)
+#include <hpx/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::plugins::parcel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Derives the number of parcels to coalesce and the flush interval from
+    // the observed parcel arrival rate and the observed time it takes to send
+    // a message. The coalescing delay added to a parcel is limited to what is
+    // left of the latency budget after the send latency has been accounted
+    // for. The batch size is chosen such that a batch fills up within that
+    // delay at the current arrival rate, i.e. batches grow with the load and
+    // parcels are sent right away if hardly anything arrives in the meantime.
+    //
+    // All times are in nanoseconds. The arrival rate is recorded while the
+    // message handler holds its lock, send latencies are recorded from the
+    // completion handlers of the sent messages.
+    class adaptive_coalescing_policy
+    {
+        // weight of a new sample in the running averages (1/8)
+        static constexpr std::int64_t smoothing_shift = 3;
+
+    public:
+        adaptive_coalescing_policy(std::int64_t latency_budget,
+            std::size_t max_messages, std::int64_t min_interval) noexcept
+          : latency_budget_(latency_budget)
+          , min_interval_(min_interval)
+          , max_messages_((std::max)(max_messages, std::size_t(1)))
+          , arrival_interval_(0)
+          , send_latency_(0)
+        {
+            HPX_ASSERT(latency_budget_ >= 0 && min_interval_ >= 0);
+        }
+
+        // the time since the previous parcel was passed to the handler
+        void record_arrival(std::int64_t time_since_last_parcel) noexcept
+        {
+            arrival_interval_ = smooth(arrival_interval_,
+                (std::max)(time_since_last_parcel, std::int64_t(1)));
+        }
+
+        // the time between handing a message to the parcelport and its
+        // completion
+        void record_send_latency(std::int64_t latency) noexcept
+        {
+            latency = (std::max)(latency, std::int64_t(0));
+
+            std::int64_t current =
+                send_latency_.load(std::memory_order_relaxed);
+            while (!send_latency_.compare_exchange_weak(current,
+                smooth(current, latency), std::memory_order_relaxed))
+            {
+            }
+        }
+
+        // the maximal time a parcel may wait for more parcels to arrive
+        [[nodiscard]] std::int64_t interval() const noexcept
+        {
+            std::int64_t const send_latency =
+                send_latency_.load(std::memory_order_relaxed);
+            if (send_latency >= latency_budget_ - min_interval_)
+            {
+                return min_interval_;
+            }
+            return latency_budget_ - send_latency;
+        }
+
+        // the number of parcels expected to arrive within interval()
+        [[nodiscard]] std::size_t num_messages() const noexcept
+        {
+            if (arrival_interval_ == 0)
+            {
+                return 1;    // nothing is known about the arrival rate yet
+            }
+
+            auto const expected =
+                static_cast<std::size_t>(interval() / arrival_interval_);
+            return (std::clamp)(expected, std::size_t(1), max_messages_);
+        }
+
+        [[nodiscard]] std::int64_t average_arrival_interval() const noexcept
+        {
+            return arrival_interval_;
+        }
+
+        [[nodiscard]] std::int64_t average_send_latency() const noexcept
+        {
+            return send_latency_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        static constexpr std::int64_t smooth(
+            std::int64_t average, std::int64_t sample) noexcept
+        {
+            if (average == 0)
+            {
+                return sample;
+            }
+            return average + ((sample - average) >> smoothing_shift);
+        }
+
+        std::int64_t const latency_budget_;
+        std::int64_t const min_interval_;
+        std::size_t const max_messages_;
+
+        std::int64_t arrival_interval_;
+        std::atomic<std::int64_t> send_latency_;
+    };
+}    // namespace hpx::plugins::parcel::detail
+
+#endif
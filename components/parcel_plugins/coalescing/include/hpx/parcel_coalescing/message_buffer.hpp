@@ -18,6 +18,7 @@
 #include <hpx/parcelset_base/parcelport.hpp>
 
 #include <cstddef>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -164,6 +165,23 @@ namespace hpx::plugins::parcel::detail {
             return max_messages_;
         }
 
+        // invoke the given function once all buffered parcels have been sent,
+        // i.e. after the write handler of the last parcel has returned
+        template <typename F>
+        void on_sent(F&& f)
+        {
+            HPX_ASSERT(!handlers_.empty());
+
+            parcelset::write_handler_type& last = handlers_.back();
+            last = [h = HPX_MOVE(last), f = HPX_FORWARD(F, f)](
+                       std::error_code const& ec,
+                       parcelset::parcel const& p) {
+                if (h)
+                    h(ec, p);
+                f(ec);
+            };
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
@@ -15,6 +15,7 @@
 #include <hpx/modules/statistics.hpp>
 #include <hpx/modules/synchronization.hpp>
 
+#include <hpx/parcel_coalescing/adaptive_policy.hpp>
 #include <hpx/parcel_coalescing/message_buffer.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
@@ -62,6 +63,8 @@ namespace hpx::plugins::parcel {
             std::int64_t min_boundary, std::int64_t max_boundary,
             std::int64_t num_buckets,
             hpx::function<std::vector<std::int64_t>(bool)>& result);
+        std::int64_t get_current_num_messages(bool reset);
+        std::int64_t get_current_interval(bool reset);
 
         // register the given action
         static void register_action(char const* action, error_code& ec);
@@ -74,6 +77,7 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive_parameters_locked();
 
     private:
         mutable mutex_type mtx_;
@@ -86,6 +90,10 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adjusts num_coalesced_parcels_ and interval_ at runtime, empty if
+        // adaptive coalescing is disabled
+        std::shared_ptr<detail::adaptive_coalescing_policy> policy_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -23,11 +23,14 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -41,6 +44,9 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_budget = 1000
+    //      max_messages = 4096
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +55,15 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   // derive num_messages and interval from the observed
+                   // parcel rate and send latency
+                   "adaptive = 0\n"
+                   // maximal latency (coalescing delay and time to send a
+                   // message) added to a parcel, in microseconds
+                   "latency_budget = 1000\n"
+                   // upper limit for the number of parcels per message
+                   "max_messages = 4096";
         }
     };
 }    // namespace hpx::traits
@@ -84,6 +98,29 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        std::shared_ptr<adaptive_coalescing_policy> get_adaptive_policy()
+        {
+            std::string const value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            if (value.empty() || value[0] == '0')
+            {
+                return {};
+            }
+
+            auto const latency_budget =
+                hpx::util::from_string<std::int64_t>(hpx::get_config_entry(
+                    "hpx.plugins.coalescing_message_handler.latency_budget",
+                    std::size_t(1000)));
+            auto const max_messages =
+                hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                    "hpx.plugins.coalescing_message_handler.max_messages",
+                    std::size_t(4096)));
+
+            // the flush timer has a resolution of one microsecond
+            return std::make_shared<adaptive_coalescing_policy>(
+                latency_budget * 1000, max_messages, 1000);
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
@@ -99,6 +136,22 @@ namespace hpx::plugins::parcel {
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive_parameters_locked()
+    {
+        HPX_ASSERT(policy_ && buffer_.empty());
+
+        interval_ = (std::max)(
+            static_cast<std::size_t>(policy_->interval() / 1000),
+            std::size_t(1));
+
+        std::size_t const num_messages = policy_->num_messages();
+        if (num_messages != num_coalesced_parcels_)
+        {
+            num_coalesced_parcels_ = num_messages;
+            buffer_ = detail::message_buffer(num_coalesced_parcels_);
+        }
+    }
+
     coalescing_message_handler::coalescing_message_handler(
         char const* action_name, parcelset::parcelport* pp, std::size_t num,
         std::size_t interval)
@@ -112,6 +165,7 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , policy_(detail::get_adaptive_policy())
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -139,7 +193,11 @@ namespace hpx::plugins::parcel {
                 this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_current_num_messages, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_current_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -165,13 +223,25 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        // the parameters are adjusted only while no parcels are buffered
+        if (policy_)
+        {
+            policy_->record_arrival(time_since_last_parcel);
+            if (buffer_.empty())
+            {
+                update_adaptive_parameters_locked();
+            }
+        }
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or no other parcel is expected to arrive within the interval).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    (policy_ && num_coalesced_parcels_ == 1))))
         {
             ++num_messages_;
             l.unlock();
@@ -277,6 +347,21 @@ namespace hpx::plugins::parcel {
 
         ++num_messages_;
 
+        if (policy_)
+        {
+            // measure the time it takes to send the message
+            buff.on_sent([policy = policy_,
+                             started = static_cast<std::int64_t>(
+                                 hpx::chrono::high_resolution_clock::now())](
+                             std::error_code const&) {
+                policy->record_send_latency(
+                    static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now()) -
+                    started);
+            });
+            update_adaptive_parameters_locked();
+        }
+
         // 26110: Caller failing to hold lock 'l'
 #if defined(HPX_MSVC)
 #pragma warning(push)
@@ -438,6 +523,20 @@ namespace hpx::plugins::parcel {
             this);
     }
 
+    std::int64_t coalescing_message_handler::get_current_num_messages(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(num_coalesced_parcels_);
+    }
+
+    std::int64_t coalescing_message_handler::get_current_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(interval_) * 1000;    // [ns]
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // register the given action (called during startup)
     void coalescing_message_handler::register_action(
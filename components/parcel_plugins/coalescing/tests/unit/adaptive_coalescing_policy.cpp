@@ -0,0 +1,90 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcel_coalescing/adaptive_policy.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using hpx::plugins::parcel::detail::adaptive_coalescing_policy;
+
+// all times in nanoseconds
+constexpr std::int64_t latency_budget = 1000000;    // 1ms
+constexpr std::int64_t min_interval = 1000;         // 1us
+constexpr std::size_t max_messages = 256;
+
+void test_no_samples()
+{
+    adaptive_coalescing_policy policy(
+        latency_budget, max_messages, min_interval);
+
+    HPX_TEST_EQ(policy.interval(), latency_budget);
+    HPX_TEST_EQ(policy.num_messages(), std::size_t(1));
+}
+
+void test_arrival_rate()
+{
+    adaptive_coalescing_policy policy(
+        latency_budget, max_messages, min_interval);
+
+    // a parcel every 10us fills 100 parcels into the budget
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.record_arrival(10000);
+    }
+    HPX_TEST_EQ(policy.average_arrival_interval(), std::int64_t(10000));
+    HPX_TEST_EQ(policy.num_messages(), std::size_t(100));
+
+    // heavy traffic is limited by the maximal number of parcels
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.record_arrival(10);
+    }
+    HPX_TEST_EQ(policy.num_messages(), max_messages);
+
+    // light traffic does not coalesce at all
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.record_arrival(10 * latency_budget);
+    }
+    HPX_TEST_EQ(policy.num_messages(), std::size_t(1));
+}
+
+void test_send_latency()
+{
+    adaptive_coalescing_policy policy(
+        latency_budget, max_messages, min_interval);
+
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.record_arrival(10000);
+        policy.record_send_latency(600000);
+    }
+
+    // what is left of the budget is used for coalescing
+    HPX_TEST_EQ(policy.average_send_latency(), std::int64_t(600000));
+    HPX_TEST_EQ(policy.interval(), std::int64_t(400000));
+    HPX_TEST_EQ(policy.num_messages(), std::size_t(40));
+
+    // the budget is exhausted by sending alone
+    for (int i = 0; i != 100; ++i)
+    {
+        policy.record_send_latency(2 * latency_budget);
+    }
+    HPX_TEST_EQ(policy.interval(), min_interval);
+    HPX_TEST_EQ(policy.num_messages(), std::size_t(1));
+}
+
+int main()
+{
+    test_no_samples();
+    test_arrival_rate();
+    test_send_latency();
+
+    return hpx::util::report_errors();
+}
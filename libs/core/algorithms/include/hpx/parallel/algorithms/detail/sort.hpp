@@ -0,0 +1,117 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/spin_sort.hpp>
+
+#include <algorithm>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // projection used by sort_by_key to order the zipped (key, value) pairs
+    struct extract_key
+    {
+        template <typename Tuple>
+        auto operator()(Tuple&& t) const
+            -> decltype(hpx::get<0>(HPX_FORWARD(Tuple, t)))
+        {
+            return hpx::get<0>(HPX_FORWARD(Tuple, t));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort the range [first, last) in the calling thread. The comparison
+    // function has the projection applied already.
+    struct sequential_sort_t
+      : hpx::functional::detail::tag_fallback<sequential_sort_t>
+    {
+    private:
+        template <typename ExPolicy, typename RandomIt, typename Comp>
+        friend constexpr RandomIt tag_fallback_invoke(sequential_sort_t,
+            ExPolicy&&, RandomIt first, RandomIt last, Comp&& comp)
+        {
+            std::sort(first, last, HPX_FORWARD(Comp, comp));
+            return last;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_sort_t sequential_sort = sequential_sort_t{};
+#else
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    HPX_HOST_DEVICE HPX_FORCEINLINE RandomIt sequential_sort(
+        ExPolicy&& policy, RandomIt first, RandomIt last, Comp&& comp)
+    {
+        return sequential_sort_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            last, HPX_FORWARD(Comp, comp));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Stable sort of the range [first, last) in the calling thread. The
+    // comparison function has the projection applied already.
+    struct sequential_stable_sort_t
+      : hpx::functional::detail::tag_fallback<sequential_stable_sort_t>
+    {
+    private:
+        template <typename ExPolicy, typename RandomIt, typename Comp>
+        friend RandomIt tag_fallback_invoke(sequential_stable_sort_t,
+            ExPolicy&&, RandomIt first, RandomIt last, Comp&& comp)
+        {
+            spin_sort(first, last, HPX_FORWARD(Comp, comp));
+            return last;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_stable_sort_t sequential_stable_sort =
+        sequential_stable_sort_t{};
+#else
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    HPX_HOST_DEVICE HPX_FORCEINLINE RandomIt sequential_stable_sort(
+        ExPolicy&& policy, RandomIt first, RandomIt last, Comp&& comp)
+    {
+        return sequential_stable_sort_t{}(HPX_FORWARD(ExPolicy, policy),
+            first, last, HPX_FORWARD(Comp, comp));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Select a pivot and partition the range [first, last) around it, see
+    // filter(). Returns the position of the pivot.
+    struct sequential_filter_t
+      : hpx::functional::detail::tag_fallback<sequential_filter_t>
+    {
+    private:
+        template <typename ExPolicy, typename RandomIt, typename Comp>
+        friend constexpr RandomIt tag_fallback_invoke(sequential_filter_t,
+            ExPolicy&&, RandomIt first, RandomIt last, Comp&& comp)
+        {
+            return filter(first, last, HPX_FORWARD(Comp, comp));
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    inline constexpr sequential_filter_t sequential_filter =
+        sequential_filter_t{};
+#else
+    template <typename ExPolicy, typename RandomIt, typename Comp>
+    HPX_HOST_DEVICE HPX_FORCEINLINE RandomIt sequential_filter(
+        ExPolicy&& policy, RandomIt first, RandomIt last, Comp&& comp)
+    {
+        return sequential_filter_t{}(HPX_FORWARD(ExPolicy, policy), first,
+            last, HPX_FORWARD(Comp, comp));
+    }
+#endif
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -141,9 +141,11 @@ namespace hpx {
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/partial_sort.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/sender_util.hpp>
 
@@ -168,6 +170,7 @@ namespace hpx::parallel {
         ///          element are less than or equal to the elements after the
         ///          new nth element.
         ///
+        /// \param policy : execution policy used for the sequential steps
         /// \param first : iterator to the first element
         /// \param nth : iterator defining the sort partition point
         /// \param end : iterator to the element after the last in the range
@@ -175,9 +178,11 @@ namespace hpx::parallel {
         /// \param comp : object for to Compare elements
         /// \param proj : projection
         ///
-        template <class RandomIt, typename Compare, typename Proj>
-        static constexpr void nth_element_seq(RandomIt first, RandomIt nth,
-            RandomIt end, std::uint32_t level, Compare&& comp, Proj&& proj)
+        template <typename ExPolicy, class RandomIt, typename Compare,
+            typename Proj>
+        static constexpr void nth_element_seq(ExPolicy&& policy,
+            RandomIt first, RandomIt nth, RandomIt end, std::uint32_t level,
+            Compare&& comp, Proj&& proj)
         {
             constexpr std::uint32_t nmin_sort = 24;
             auto nelem = end - first;
@@ -203,8 +208,8 @@ namespace hpx::parallel {
 
             if (nelem < nmin_sort)
             {
-                detail::sort<RandomIt>().call(hpx::execution::seq, first, end,
-                    HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
+                detail::sequential_sort(policy, first, end,
+                    util::compare_projected<Compare&, Proj&>(comp, proj));
                 return;
             }
             if (level == 0)
@@ -215,20 +220,23 @@ namespace hpx::parallel {
             }
 
             // Filter the range and check which part contains the nth element
-            RandomIt c_last = filter(first, end, comp);
+            RandomIt c_last =
+                detail::sequential_filter(policy, first, end, comp);
 
             if (c_last == nth)
                 return;
 
             if (nth < c_last)
             {
-                nth_element_seq(first, nth, c_last, level - 1,
-                    HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
+                nth_element_seq(HPX_FORWARD(ExPolicy, policy), first, nth,
+                    c_last, level - 1, HPX_FORWARD(Compare, comp),
+                    HPX_FORWARD(Proj, proj));
             }
             else
             {
-                nth_element_seq(c_last + 1, nth, end, level - 1,
-                    HPX_FORWARD(Compare, comp), HPX_FORWARD(Proj, proj));
+                nth_element_seq(HPX_FORWARD(ExPolicy, policy), c_last + 1,
+                    nth, end, level - 1, HPX_FORWARD(Compare, comp),
+                    HPX_FORWARD(Proj, proj));
             }
         }
 
@@ -242,8 +250,9 @@ namespace hpx::parallel {
 
             template <typename ExPolicy, typename RandomIt, typename Sent,
                 typename Pred, typename Proj>
-            static constexpr RandomIt sequential(ExPolicy, RandomIt first,
-                RandomIt nth, Sent last, Pred&& pred, Proj&& proj)
+            static constexpr RandomIt sequential(ExPolicy&& policy,
+                RandomIt first, RandomIt nth, Sent last, Pred&& pred,
+                Proj&& proj)
             {
                 auto end = detail::advance_to_sentinel(first, last);
 
@@ -254,8 +263,9 @@ namespace hpx::parallel {
                     nth - first + 1 <= nelem);
 
                 uint32_t level = detail::nbits64(nelem) * 2;
-                detail::nth_element_seq(first, nth, end, level,
-                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                detail::nth_element_seq(HPX_FORWARD(ExPolicy, policy), first,
+                    nth, end, level, HPX_FORWARD(Pred, pred),
+                    HPX_FORWARD(Proj, proj));
 
                 return end;
             }
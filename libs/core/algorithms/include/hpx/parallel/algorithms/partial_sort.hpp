@@ -186,91 +186,6 @@ namespace hpx::parallel {
             return nb;
         }
 
-        ///////////////////////////////////////////////////////////////////////
-        ///
-        /// Receive a range between first and last, obtain 9 values between the
-        /// elements  including the first and the previous to the last. Obtain
-        /// the iterator to the mid value and swap with the first position
-        //
-        /// \param first    iterator to the first element
-        /// \param last     iterator to the last element
-        /// \param comp     object to Comp two elements
-        ///
-        template <typename Iter, typename Comp>
-        constexpr void pivot3(Iter first, Iter last, Comp&& comp) noexcept
-        {
-            auto n2 = (last - first) / 2;
-            Iter it_val =
-                mid3(first + 1, first + n2, last - 1, HPX_FORWARD(Comp, comp));
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-            std::ranges::iter_swap(first, it_val);
-#else
-            std::iter_swap(first, it_val);
-#endif
-        }
-
-        ///////////////////////////////////////////////////////////////////////
-        ///
-        /// This function obtain a pivot in the range and filter the elements
-        /// according the value of that pivot
-        ///
-        /// \param first : iterator to the first element
-        /// \param end : iterator to the element after the last
-        /// \param comp : object to Comp two elements
-        ///
-        /// \return iterator where is the pivot used in the filtering
-        ///
-        template <typename Iter, typename Comp>
-        constexpr inline Iter filter(Iter first, Iter end, Comp&& comp)
-        {
-            std::int64_t const nelem = end - first;
-            if (nelem > 4096)
-            {
-                pivot9(first, end, comp);
-            }
-            else
-            {
-                pivot3(first, end, comp);
-            }
-
-            typename std::iterator_traits<Iter>::value_type const& pivot =
-                *first;
-
-            Iter c_first = first + 1, c_last = end - 1;
-            while (HPX_INVOKE(comp, *c_first, pivot))
-            {
-                ++c_first;
-            }
-            while (HPX_INVOKE(comp, pivot, *c_last))
-            {
-                --c_last;
-            }
-
-            while (c_first < c_last)
-            {
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                std::ranges::iter_swap(c_first++, c_last--);
-#else
-                std::iter_swap(c_first++, c_last--);
-#endif
-                while (HPX_INVOKE(comp, *c_first, pivot))
-                {
-                    ++c_first;
-                }
-                while (HPX_INVOKE(comp, pivot, *c_last))
-                {
-                    --c_last;
-                }
-            }
-
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-            std::ranges::iter_swap(first, c_last);
-#else
-            std::iter_swap(first, c_last);
-#endif
-            return c_last;
-        }
-
         // Internal function to divide and sort the ranges
         //
         // first : iterator to the first element to be sorted
@@ -468,6 +468,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_and_get_distance.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/partition.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
@@ -754,67 +755,6 @@ namespace hpx::parallel {
     namespace detail {
         /// \cond NOINTERNAL
 
-        // sequential partition with projection function for bidirectional iterator.
-        template <typename BidirIter, typename Pred, typename Proj,
-            HPX_CONCEPT_REQUIRES_(
-                hpx::traits::is_bidirectional_iterator_v<BidirIter>)>
-        constexpr BidirIter sequential_partition(
-            BidirIter first, BidirIter last, Pred&& pred, Proj&& proj)
-        {
-            while (true)
-            {
-                while (
-                    first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
-                {
-                    ++first;
-                }
-                if (first == last)
-                    break;
-
-                while (first != --last &&
-                    !HPX_INVOKE(pred, HPX_INVOKE(proj, *last)))
-                    ;
-                if (first == last)
-                    break;
-
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                std::ranges::iter_swap(first++, last);
-#else
-                std::iter_swap(first++, last);
-#endif
-            }
-
-            return first;
-        }
-
-        // sequential partition with projection function for forward iterator.
-        template <typename FwdIter, typename Pred, typename Proj,
-            HPX_CONCEPT_REQUIRES_(hpx::traits::is_forward_iterator_v<FwdIter> &&
-                !hpx::traits::is_bidirectional_iterator_v<FwdIter>)>
-        constexpr FwdIter sequential_partition(
-            FwdIter first, FwdIter last, Pred&& pred, Proj&& proj)
-        {
-            while (first != last && HPX_INVOKE(pred, HPX_INVOKE(proj, *first)))
-                ++first;
-
-            if (first == last)
-                return first;
-
-            for (FwdIter it = std::next(first); it != last; ++it)
-            {
-                if (HPX_INVOKE(pred, HPX_INVOKE(proj, *it)))
-                {
-#if defined(HPX_HAVE_CXX20_STD_RANGES_ITER_SWAP)
-                    std::ranges::iter_swap(first++, it);
-#else
-                    std::iter_swap(first++, it);
-#endif
-                }
-            }
-
-            return first;
-        }
-
         struct partition_helper
         {
             template <typename FwdIter>
@@ -1402,9 +1342,9 @@ namespace hpx::parallel {
                     merge_remaining_blocks(remaining_blocks, boundary, first);
 
                 // Perform sequential partition to unpartitioned range.
-                FwdIter real_boundary =
-                    sequential_partition(unpartitioned_block.first,
-                        unpartitioned_block.last, pred, proj);
+                FwdIter real_boundary = sequential_partition(policy,
+                    unpartitioned_block.first, unpartitioned_block.last, pred,
+                    proj);
 
                 return real_boundary;
             }
@@ -1442,12 +1382,13 @@ namespace hpx::parallel {
 
             template <typename ExPolicy, typename Sent, typename Pred,
                 typename Proj = hpx::identity>
-            static constexpr FwdIter sequential(
-                ExPolicy, FwdIter first, Sent last, Pred&& pred, Proj&& proj)
+            static constexpr FwdIter sequential(ExPolicy&& policy,
+                FwdIter first, Sent last, Pred&& pred, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
-                return sequential_partition(first, last_iter,
-                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+                return sequential_partition(HPX_FORWARD(ExPolicy, policy),
+                    first, last_iter, HPX_FORWARD(Pred, pred),
+                    HPX_FORWARD(Proj, proj));
             }
 
             template <typename ExPolicy, typename Sent, typename Pred,
@@ -163,6 +163,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -197,9 +198,10 @@ namespace hpx::parallel {
             if (static_cast<std::size_t>(N) <= chunk_size)
             {
                 return execution::async_execute(policy.executor(),
-                    [first, last, comp = HPX_MOVE(comp)]() -> RandomIt {
-                        std::sort(first, last, comp);
-                        return last;
+                    [policy, first, last, comp = HPX_MOVE(comp)]()
+                        -> RandomIt {
+                        return detail::sequential_sort(
+                            policy, first, last, comp);
                     });
             }
 
@@ -313,7 +315,7 @@ namespace hpx::parallel {
 
             if (static_cast<std::size_t>(N) < chunk_size)
             {
-                std::sort(first, last, comp);
+                detail::sequential_sort(policy, first, last, comp);
                 return hpx::make_ready_future(last);
             }
 
@@ -341,13 +343,13 @@ namespace hpx::parallel {
 
             template <typename ExPolicy, typename Sent, typename Comp,
                 typename Proj>
-            static constexpr RandomIt sequential(
-                ExPolicy, RandomIt first, Sent last, Comp&& comp, Proj&& proj)
+            static constexpr RandomIt sequential(ExPolicy&& policy,
+                RandomIt first, Sent last, Comp&& comp, Proj&& proj)
             {
                 auto last_iter = detail::advance_to_sentinel(first, last);
-                std::sort(first, last_iter,
+                return detail::sequential_sort(HPX_FORWARD(ExPolicy, policy),
+                    first, last_iter,
                     util::compare_projected<Comp&, Proj&>(comp, proj));
-                return last_iter;
             }
 
             template <typename ExPolicy, typename Sent, typename Comp,
@@ -99,6 +99,7 @@ namespace hpx { namespace experimental {
 
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -110,23 +111,6 @@ namespace hpx::parallel {
 
     template <typename KeyIter, typename ValueIter>
     using sort_by_key_result = std::pair<KeyIter, ValueIter>;
-
-    ///////////////////////////////////////////////////////////////////////////
-    // sort
-    namespace detail {
-
-        /// \cond NOINTERNAL
-        struct extract_key
-        {
-            template <typename Tuple>
-            auto operator()(Tuple&& t) const
-                -> decltype(hpx::get<0>(HPX_FORWARD(Tuple, t)))
-            {
-                return hpx::get<0>(HPX_FORWARD(Tuple, t));
-            }
-        };
-        /// \endcond
-    }    // namespace detail
 }    // namespace hpx::parallel
 
 namespace hpx::experimental {
@@ -162,6 +162,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/parallel_stable_sort.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
 #include <hpx/parallel/algorithms/detail/spin_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
@@ -194,15 +195,16 @@ namespace hpx::parallel {
 
             template <typename ExPolicy, typename Sentinel, typename Compare,
                 typename Proj>
-            static constexpr RandomIt sequential(ExPolicy, RandomIt first,
-                Sentinel last, Compare&& comp, Proj&& proj)
+            static constexpr RandomIt sequential(ExPolicy&& policy,
+                RandomIt first, Sentinel last, Compare&& comp, Proj&& proj)
             {
                 using compare_type = util::compare_projected<Compare&, Proj&>;
 
                 auto last_iter = detail::advance_to_sentinel(first, last);
 
-                spin_sort(first, last_iter, compare_type(comp, proj));
-                return last_iter;
+                return detail::sequential_stable_sort(
+                    HPX_FORWARD(ExPolicy, policy), first, last_iter,
+                    compare_type(comp, proj));
             }
 
             template <typename ExPolicy, typename Sentinel, typename Compare,
@@ -22,8 +22,10 @@
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
 #include <hpx/parallel/datapar/mismatch.hpp>
+#include <hpx/parallel/datapar/partition.hpp>
 #include <hpx/parallel/datapar/reduce.hpp>
 #include <hpx/parallel/datapar/replace.hpp>
+#include <hpx/parallel/datapar/sort.hpp>
 #include <hpx/parallel/datapar/transfer.hpp>
 #include <hpx/parallel/datapar/transform_loop.hpp>
 #include <hpx/parallel/datapar/zip_iterator.hpp>
@@ -0,0 +1,214 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/partition.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/type_support/identity.hpp>
+#include <hpx/type_support/is_contiguous_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Partitioning of contiguous ranges of arithmetic values in blocks (see
+    // Edelkamp and Weiss, BlockQuicksort). The predicate is evaluated for a
+    // whole block of elements using vector packs. The offsets of the elements
+    // which are on the wrong side are collected without branching on the
+    // results, the misplaced elements of a block on the left and of a block
+    // on the right are then exchanged pairwise.
+    template <typename T>
+    struct datapar_block_partition
+    {
+        using V = traits::vector_pack_type_t<T>;
+
+        static constexpr std::size_t pack_size =
+            traits::vector_pack_size<V>::value;
+        static constexpr std::size_t alignment =
+            traits::vector_pack_alignment<V>::value;
+
+        // number of elements examined at once on either side
+        static constexpr std::size_t block_size =
+            pack_size * ((64 + pack_size - 1) / pack_size);
+
+        // Move the elements for which the predicate holds to the front of
+        // [first, last), pack_pred evaluates the same predicate for all
+        // elements of a vector pack. Returns the end of the first group.
+        template <typename Pred, typename PackPred>
+        static T* call(T* first, T* last, Pred&& pred, PackPred&& pack_pred)
+        {
+            alignas(alignment) T flags[block_size];
+            std::uint16_t offsets_l[block_size];
+            std::uint16_t offsets_r[block_size];
+
+            std::size_t num_l = 0, num_r = 0;
+            std::size_t start_l = 0, start_r = 0;
+
+            while (static_cast<std::size_t>(last - first) >= 2 * block_size)
+            {
+                if (num_l == 0)
+                {
+                    start_l = 0;
+                    num_l =
+                        collect(first, flags, offsets_l, pack_pred, false);
+                }
+                if (num_r == 0)
+                {
+                    start_r = 0;
+                    num_r = collect(
+                        last - block_size, flags, offsets_r, pack_pred, true);
+                }
+
+                T* const block_l = first;
+                T* const block_r = last - block_size;
+
+                std::size_t const num = (std::min)(num_l, num_r);
+                for (std::size_t i = 0; i != num; ++i)
+                {
+                    std::swap(block_l[offsets_l[start_l + i]],
+                        block_r[offsets_r[start_r + i]]);
+                }
+
+                num_l -= num;
+                num_r -= num;
+                start_l += num;
+                start_r += num;
+
+                if (num_l == 0)
+                {
+                    first += block_size;
+                }
+                if (num_r == 0)
+                {
+                    last -= block_size;
+                }
+            }
+
+            // everything in front of first and behind last is in place
+            // now, this includes the blocks which still have misplaced
+            // elements
+            return sequential_partition_helper(
+                first, last, HPX_FORWARD(Pred, pred), hpx::identity_v);
+        }
+
+    private:
+        // collect the offsets of the elements of the block starting at
+        // block for which the predicate yields the given value
+        template <typename PackPred>
+        static std::size_t collect(T* block, T* flags, std::uint16_t* offsets,
+            PackPred& pack_pred, bool value)
+        {
+            T const* src = block;
+            if (!util::detail::is_data_aligned(block))
+            {
+                std::copy(block, block + block_size, flags);
+                src = flags;
+            }
+
+            V const one(T(1));
+            V const zero(T(0));
+            for (std::size_t i = 0; i != block_size; i += pack_size)
+            {
+                T const* load_it = src + i;
+                V const v = traits::vector_pack_load<V, T>::aligned(load_it);
+
+                V result = value ? traits::choose(pack_pred(v), one, zero) :
+                                   traits::choose(pack_pred(v), zero, one);
+
+                T* store_it = flags + i;
+                traits::vector_pack_store<V, T>::aligned(result, store_it);
+            }
+
+            std::size_t num = 0;
+            for (std::size_t i = 0; i != block_size; ++i)
+            {
+                offsets[num] = static_cast<std::uint16_t>(i);
+                num += static_cast<std::size_t>(flags[i] != T(0));
+            }
+            return num;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter>
+    struct datapar_partition_value_compatible
+      : std::conjunction<hpx::traits::is_contiguous_iterator<Iter>,
+            std::is_arithmetic<typename std::iterator_traits<Iter>::value_type>,
+            std::negation<std::is_same<bool,
+                typename std::iterator_traits<Iter>::value_type>>>
+    {
+    };
+
+    // the predicate has to be applicable to vector packs, yielding masks
+    template <typename Pred, typename T, typename Enable = void>
+    struct is_datapar_predicate : std::false_type
+    {
+    };
+
+    template <typename Pred, typename T>
+    struct is_datapar_predicate<Pred, T,
+        std::enable_if_t<
+            std::is_invocable_v<Pred&, traits::vector_pack_type_t<T> const&>>>
+      : std::is_same<
+            std::decay_t<std::invoke_result_t<Pred&,
+                traits::vector_pack_type_t<T> const&>>,
+            traits::vector_pack_mask_type_t<traits::vector_pack_type_t<T>>>
+    {
+    };
+
+    template <typename Iter, typename Pred, typename Proj>
+    struct datapar_partition_compatible
+      : std::conjunction<datapar_partition_value_compatible<Iter>,
+            std::is_same<hpx::identity, std::decay_t<Proj>>,
+            is_datapar_predicate<Pred,
+                typename std::iterator_traits<Iter>::value_type>>
+    {
+    };
+
+    template <typename ExPolicy, typename Iter, typename Pred, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+            datapar_partition_compatible<Iter, Pred, Proj>::value)>
+    Iter tag_invoke(sequential_partition_t, ExPolicy&&, Iter first, Iter last,
+        Pred&& pred, Proj&&)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = traits::vector_pack_type_t<value_type>;
+
+        if (first == last)
+        {
+            return first;
+        }
+
+        value_type* const base = std::addressof(*first);
+        value_type* const mid = datapar_block_partition<value_type>::call(
+            base, base + (last - first), pred,
+            [&pred](V const& v) { return HPX_INVOKE(pred, v); });
+
+        return first + (mid - base);
+    }
+}    // namespace hpx::parallel::detail
+
+#endif
@@ -0,0 +1,521 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/algorithms/detail/insertion_sort.hpp>
+#include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/sort.hpp>
+#include <hpx/parallel/datapar/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/nbits.hpp>
+#include <hpx/type_support/identity.hpp>
+#include <hpx/type_support/is_contiguous_iterator.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Introsort for contiguous ranges of arithmetic values. The partitioning
+    // steps evaluate the comparisons with the pivot using vector packs (see
+    // datapar_block_partition), small ranges are sorted using a sorting
+    // network operating on vector packs. Compare is either std::less<> or
+    // std::greater<>.
+    template <typename T, typename Compare>
+    struct datapar_sort
+    {
+        using V = traits::vector_pack_type_t<T>;
+
+        static constexpr std::size_t pack_size =
+            traits::vector_pack_size<V>::value;
+        static constexpr std::size_t alignment =
+            traits::vector_pack_alignment<V>::value;
+
+        // The sorting network sorts the columns of network_rows vector
+        // packs, the sorted columns are merged afterwards.
+        static constexpr std::size_t network_rows = 8;
+        static constexpr std::size_t network_size = network_rows * pack_size;
+
+        // ranges up to this size are sorted by insertion sort
+        static constexpr std::size_t insertion_sort_limit = 16;
+
+        static void call(T* first, T* last)
+        {
+            auto const count = static_cast<std::uint64_t>(last - first);
+            introsort(first, last, 2 * util::nbits64(count), true);
+        }
+
+        // Select a pivot and partition the range around it, see
+        // detail::filter. Returns the position of the pivot.
+        static T* filter(T* first, T* last)
+        {
+            if (last - first > 4096)
+            {
+                pivot9(first, last, Compare());
+            }
+            else
+            {
+                pivot3(first, last, Compare());
+            }
+
+            T const pivot = *first;
+            V const pivot_pack(pivot);
+
+            T* const mid = datapar_block_partition<T>::call(
+                first + 1, last,
+                [pivot](T val) { return Compare()(val, pivot); },
+                [&pivot_pack](V const& val) {
+                    return Compare()(val, pivot_pack);
+                });
+
+            if (mid != first + 1)
+            {
+                std::swap(*first, mid[-1]);
+                return mid - 1;
+            }
+
+            // None of the elements is ordered before the pivot. Collect the
+            // elements equal to the pivot in front and place the pivot in
+            // the middle of those.
+            T* const equal_last = datapar_block_partition<T>::call(
+                first + 1, last,
+                [pivot](T val) { return !Compare()(pivot, val); },
+                [&pivot_pack](V const& val) {
+                    return !Compare()(pivot_pack, val);
+                });
+
+            return first + (equal_last - first) / 2;
+        }
+
+    private:
+        static void introsort(
+            T* first, T* last, std::size_t depth, bool leftmost)
+        {
+            while (static_cast<std::size_t>(last - first) > network_size)
+            {
+                if (depth == 0)
+                {
+                    std::make_heap(first, last, Compare());
+                    std::sort_heap(first, last, Compare());
+                    return;
+                }
+                --depth;
+
+                pivot3(first, last, Compare());
+
+                T const pivot = *first;
+                V const pivot_pack(pivot);
+
+                // None of the elements of the range is ordered before the
+                // element preceding it. If the pivot is not ordered after
+                // that element either, the elements equal to the pivot are
+                // moved to the front, they are in their final position.
+                if (!leftmost && !Compare()(first[-1], pivot))
+                {
+                    first = datapar_block_partition<T>::call(
+                        first + 1, last,
+                        [pivot](T val) { return !Compare()(pivot, val); },
+                        [&pivot_pack](V const& val) {
+                            return !Compare()(pivot_pack, val);
+                        });
+                    continue;
+                }
+
+                T* const mid = datapar_block_partition<T>::call(
+                    first + 1, last,
+                    [pivot](T val) { return Compare()(val, pivot); },
+                    [&pivot_pack](V const& val) {
+                        return Compare()(val, pivot_pack);
+                    });
+
+                T* const pos = mid - 1;
+                std::swap(*first, *pos);
+
+                // recurse into the smaller part, continue with the larger
+                if (pos - first < last - mid)
+                {
+                    introsort(first, pos, depth, leftmost);
+                    first = mid;
+                    leftmost = false;
+                }
+                else
+                {
+                    introsort(mid, last, depth, false);
+                    last = pos;
+                }
+            }
+
+            small_sort(first, last);
+        }
+
+        static void small_sort(T* first, T* last)
+        {
+            auto const count = static_cast<std::size_t>(last - first);
+            if (count <= insertion_sort_limit)
+            {
+                if (count > 1)
+                {
+                    insertion_sort(first, last, Compare());
+                }
+                return;
+            }
+            network_sort(first, count);
+        }
+
+        // padding values are ordered behind all other values
+        static constexpr T padding() noexcept
+        {
+            using limits = std::numeric_limits<T>;
+            constexpr bool ascending = std::is_same_v<Compare, std::less<>>;
+            if constexpr (limits::has_infinity)
+            {
+                return ascending ? limits::infinity() : -limits::infinity();
+            }
+            else
+            {
+                return ascending ? (limits::max)() : limits::lowest();
+            }
+        }
+
+        static void compare_exchange(V& lhs, V& rhs)
+        {
+            auto const swap = Compare()(rhs, lhs);
+            V const tmp = lhs;
+            traits::mask_assign(swap, lhs, rhs);
+            traits::mask_assign(swap, rhs, tmp);
+        }
+
+        static void network_sort(T* first, std::size_t count)
+        {
+            HPX_ASSERT(count <= network_size);
+
+            alignas(alignment) T buffer[network_size];
+            alignas(alignment) T runs[network_size];
+
+            std::copy(first, first + count, buffer);
+            std::fill(buffer + count, buffer + network_size, padding());
+
+            V rows[network_rows];
+            for (std::size_t i = 0; i != network_rows; ++i)
+            {
+                T const* it = buffer + i * pack_size;
+                rows[i] = traits::vector_pack_load<V, T>::aligned(it);
+            }
+
+            // optimal sorting network for eight inputs, sorts all columns
+            // at the same time
+            static constexpr unsigned char network[][2] = {{0, 2}, {1, 3},
+                {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1}, {2, 3},
+                {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2}, {3, 4},
+                {5, 6}};
+
+            for (auto const& c : network)
+            {
+                compare_exchange(rows[c[0]], rows[c[1]]);
+            }
+
+            for (std::size_t i = 0; i != network_rows; ++i)
+            {
+                T* it = buffer + i * pack_size;
+                traits::vector_pack_store<V, T>::aligned(rows[i], it);
+            }
+
+            // the columns become consecutive sorted runs
+            for (std::size_t col = 0; col != pack_size; ++col)
+            {
+                for (std::size_t row = 0; row != network_rows; ++row)
+                {
+                    runs[col * network_rows + row] =
+                        buffer[row * pack_size + col];
+                }
+            }
+
+            T* src = runs;
+            T* dest = buffer;
+            for (std::size_t run = network_rows; run < network_size; run *= 2)
+            {
+                for (std::size_t i = 0; i < network_size; i += 2 * run)
+                {
+                    std::merge(src + i, src + i + run, src + i + run,
+                        src + i + 2 * run, dest + i, Compare());
+                }
+                std::swap(src, dest);
+            }
+
+            std::copy(src, src + count, first);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Comparison functions which allow for sorting arithmetic values using
+    // vector packs: 1 for ascending, -1 for descending order
+    template <typename Comp, typename T, typename Enable = void>
+    struct datapar_sort_order : std::integral_constant<int, 0>
+    {
+    };
+
+    template <typename T>
+    struct datapar_sort_order<detail::less, T> : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename T>
+    struct datapar_sort_order<std::less<>, T> : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename T>
+    struct datapar_sort_order<std::less<T>, T> : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename T>
+    struct datapar_sort_order<detail::greater, T>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename T>
+    struct datapar_sort_order<std::greater<>, T>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename T>
+    struct datapar_sort_order<std::greater<T>, T>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Comp, typename Proj, typename T>
+    struct datapar_sort_order<util::compare_projected<Comp, Proj>, T,
+        std::enable_if_t<std::is_same_v<hpx::identity, std::decay_t<Proj>>>>
+      : datapar_sort_order<std::decay_t<Comp>, T>
+    {
+    };
+
+    template <typename Comp, typename T>
+    using datapar_sort_compare_t =
+        std::conditional_t<(datapar_sort_order<std::decay_t<Comp>, T>::value >
+                               0),
+            std::less<>, std::greater<>>;
+
+    template <typename Iter, typename Comp>
+    struct datapar_sort_compatible
+      : std::conjunction<datapar_partition_value_compatible<Iter>,
+            std::bool_constant<datapar_sort_order<std::decay_t<Comp>,
+                                   typename std::iterator_traits<
+                                       Iter>::value_type>::value != 0>>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Comp,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+            datapar_sort_compatible<Iter, Comp>::value)>
+    Iter tag_invoke(
+        sequential_sort_t, ExPolicy&&, Iter first, Iter last, Comp&&)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        if (first != last)
+        {
+            value_type* const base = std::addressof(*first);
+            datapar_sort<value_type,
+                datapar_sort_compare_t<Comp, value_type>>::call(base,
+                base + (last - first));
+        }
+        return last;
+    }
+
+    // Equal integral values can't be told apart, an unstable sort is as good
+    // as a stable one.
+    template <typename ExPolicy, typename Iter, typename Comp,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+            datapar_sort_compatible<Iter, Comp>::value &&
+            std::is_integral_v<typename std::iterator_traits<Iter>::value_type>)>
+    Iter tag_invoke(
+        sequential_stable_sort_t, ExPolicy&&, Iter first, Iter last, Comp&&)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        if (first != last)
+        {
+            value_type* const base = std::addressof(*first);
+            datapar_sort<value_type,
+                datapar_sort_compare_t<Comp, value_type>>::call(base,
+                base + (last - first));
+        }
+        return last;
+    }
+
+    template <typename ExPolicy, typename Iter, typename Comp,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+            datapar_sort_compatible<Iter, Comp>::value)>
+    Iter tag_invoke(
+        sequential_filter_t, ExPolicy&&, Iter first, Iter last, Comp&&)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+
+        value_type* const base = std::addressof(*first);
+        value_type* const pos = datapar_sort<value_type,
+            datapar_sort_compare_t<Comp, value_type>>::filter(base,
+            base + (last - first));
+
+        return first + (pos - base);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // sort_by_key for integral keys and values of up to 32 bits: the pairs
+    // are combined into 64 bit integers which are sorted instead.
+    template <typename Key, typename Value, typename Compare>
+    struct datapar_sort_by_key
+    {
+        using key_bits = std::make_unsigned_t<Key>;
+        using value_bits = std::make_unsigned_t<Value>;
+
+        static constexpr key_bits sign_bit = static_cast<key_bits>(
+            key_bits(1) << (sizeof(Key) * CHAR_BIT - 1));
+
+        // map the keys to unsigned values of the same order
+        static constexpr key_bits to_bits(Key key) noexcept
+        {
+            if constexpr (std::is_signed_v<Key>)
+            {
+                return static_cast<key_bits>(
+                    static_cast<key_bits>(key) ^ sign_bit);
+            }
+            else
+            {
+                return key;
+            }
+        }
+
+        static constexpr Key from_bits(key_bits bits) noexcept
+        {
+            if constexpr (std::is_signed_v<Key>)
+            {
+                return static_cast<Key>(
+                    static_cast<key_bits>(bits ^ sign_bit));
+            }
+            else
+            {
+                return bits;
+            }
+        }
+
+        static void call(Key* keys, Value* values, std::size_t count)
+        {
+            std::vector<std::uint64_t> pairs(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                pairs[i] = (static_cast<std::uint64_t>(to_bits(keys[i]))
+                               << 32) |
+                    static_cast<value_bits>(values[i]);
+            }
+
+            datapar_sort<std::uint64_t, Compare>::call(
+                pairs.data(), pairs.data() + count);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                keys[i] = from_bits(static_cast<key_bits>(pairs[i] >> 32));
+                values[i] =
+                    static_cast<Value>(static_cast<value_bits>(pairs[i]));
+            }
+        }
+    };
+
+    template <typename Comp, typename Key, typename Enable = void>
+    struct datapar_sort_by_key_order : std::integral_constant<int, 0>
+    {
+    };
+
+    template <typename Comp, typename Proj, typename Key>
+    struct datapar_sort_by_key_order<util::compare_projected<Comp, Proj>, Key,
+        std::enable_if_t<std::is_same_v<extract_key, std::decay_t<Proj>>>>
+      : datapar_sort_order<std::decay_t<Comp>, Key>
+    {
+    };
+
+    template <typename T>
+    struct datapar_sort_by_key_value_compatible
+      : std::bool_constant<std::is_integral_v<T> &&
+            !std::is_same_v<bool, T> && sizeof(T) <= 4>
+    {
+    };
+
+    template <typename KeyIter, typename ValueIter, typename Comp>
+    struct datapar_sort_by_key_compatible
+      : std::conjunction<hpx::traits::is_contiguous_iterator<KeyIter>,
+            hpx::traits::is_contiguous_iterator<ValueIter>,
+            datapar_sort_by_key_value_compatible<
+                typename std::iterator_traits<KeyIter>::value_type>,
+            datapar_sort_by_key_value_compatible<
+                typename std::iterator_traits<ValueIter>::value_type>,
+            std::bool_constant<datapar_sort_by_key_order<std::decay_t<Comp>,
+                                   typename std::iterator_traits<
+                                       KeyIter>::value_type>::value != 0>>
+    {
+    };
+
+    template <typename ExPolicy, typename KeyIter, typename ValueIter,
+        typename Comp,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy_v<ExPolicy> &&
+            datapar_sort_by_key_compatible<KeyIter, ValueIter, Comp>::value)>
+    hpx::util::zip_iterator<KeyIter, ValueIter> tag_invoke(sequential_sort_t,
+        ExPolicy&&, hpx::util::zip_iterator<KeyIter, ValueIter> first,
+        hpx::util::zip_iterator<KeyIter, ValueIter> last, Comp&&)
+    {
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using value_type =
+            typename std::iterator_traits<ValueIter>::value_type;
+        using compare_type = std::conditional_t<
+            (datapar_sort_by_key_order<std::decay_t<Comp>, key_type>::value >
+                0),
+            std::less<>, std::greater<>>;
+
+        auto const count = static_cast<std::size_t>(last - first);
+        if (count != 0)
+        {
+            auto const& iters = first.get_iterator_tuple();
+            datapar_sort_by_key<key_type, value_type, compare_type>::call(
+                std::addressof(*hpx::get<0>(iters)),
+                std::addressof(*hpx::get<1>(iters)), count);
+        }
+        return last;
+    }
+}    // namespace hpx::parallel::detail
+
+#endif
@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+// Compare the vectorized sort and partition kernels used for the simd and
+// par_simd policies with the scalar implementations used for seq and par.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int const random_fill_range = 1000000;
+unsigned int seed = std::random_device{}();
+
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(
+        -random_fill_range, random_fill_range);
+
+    std::vector<T> v(size);
+    for (auto& e : v)
+    {
+        e = static_cast<T>(dist(gen));
+    }
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Run the given algorithm test_count times on a fresh copy of the original
+// data, returns the average time (in seconds).
+template <typename Data, typename F>
+double run_benchmark_hpx(int test_count, Data const& org, F const& f)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    Data data;
+    for (int i = 0; i < test_count; ++i)
+    {
+        // Restore the original data.
+        data = org;
+
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        f(data);
+        time += hpx::chrono::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+// Run the given algorithm with the scalar and the vectorized policies.
+template <typename Data, typename F>
+void run_benchmark(
+    std::string const& name, int test_count, Data const& org, F const& f)
+{
+    using namespace hpx::execution;
+
+    double const time_seq = run_benchmark_hpx(
+        test_count, org, [&](Data& data) { f(seq, data); });
+    double const time_simd = run_benchmark_hpx(
+        test_count, org, [&](Data& data) { f(simd, data); });
+    double const time_par = run_benchmark_hpx(
+        test_count, org, [&](Data& data) { f(par, data); });
+    double const time_par_simd = run_benchmark_hpx(
+        test_count, org, [&](Data& data) { f(par_simd, data); });
+
+    auto fmt = "{1:-24} : seq {2:.6}(sec), simd {3:.6}(sec), speedup "
+               "{4:.2} | par {5:.6}(sec), par_simd {6:.6}(sec), speedup {7:.2}";
+    hpx::util::format_to(std::cout, fmt, name, time_seq, time_simd,
+        time_seq / time_simd, time_par, time_par_simd,
+        time_par / time_par_simd)
+        << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_benchmarks(
+    std::string const& type, std::size_t vector_size, int test_count)
+{
+    std::vector<T> const org = make_data<T>(vector_size);
+
+    run_benchmark("sort (" + type + ")", test_count, org,
+        [](auto const& policy, std::vector<T>& v) {
+            hpx::sort(policy, v.begin(), v.end());
+        });
+
+    run_benchmark("stable_sort (" + type + ")", test_count, org,
+        [](auto const& policy, std::vector<T>& v) {
+            hpx::stable_sort(policy, v.begin(), v.end());
+        });
+
+    // the predicate can be applied to vector packs as well
+    run_benchmark("partition (" + type + ")", test_count, org,
+        [](auto const& policy, std::vector<T>& v) {
+            hpx::partition(policy, v.begin(), v.end(),
+                [](auto const& t) { return t < T(0); });
+        });
+
+    run_benchmark("nth_element (" + type + ")", test_count, org,
+        [](auto const& policy, std::vector<T>& v) {
+            hpx::nth_element(
+                policy, v.begin(), v.begin() + v.size() / 2, v.end());
+        });
+}
+
+void run_sort_by_key_benchmark(std::size_t vector_size, int test_count)
+{
+    using data_type =
+        std::pair<std::vector<std::int32_t>, std::vector<std::uint32_t>>;
+
+    data_type org;
+    org.first = make_data<std::int32_t>(vector_size);
+    org.second.resize(vector_size);
+    for (std::size_t i = 0; i != vector_size; ++i)
+    {
+        org.second[i] = static_cast<std::uint32_t>(i);
+    }
+
+    run_benchmark("sort_by_key (int/int)", test_count, org,
+        [](auto const& policy, data_type& data) {
+            hpx::experimental::sort_by_key(policy, data.first.begin(),
+                data.first.end(), data.second.begin());
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed            : " << seed << std::endl;
+    std::cout << "vector_size     : " << vector_size << std::endl;
+    std::cout << "rand_fill range : " << random_fill_range << std::endl;
+    std::cout << "test_count      : " << test_count << std::endl;
+    std::cout << "os threads      : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    std::cout << "-------------- Benchmark Result --------------"
+              << std::endl;
+    run_benchmarks<int>("int", vector_size, test_count);
+    run_benchmarks<float>("float", vector_size, test_count);
+    run_sort_by_key_benchmark(vector_size, test_count);
+    std::cout << "----------------------------------------------" << std::endl;
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("vector_size",
+        hpx::program_options::value<std::size_t>()->default_value(1000000),
+        "size of vector (default: 1000000)")("test_count",
+        hpx::program_options::value<int>()->default_value(10),
+        "number of tests to be averaged (default: 10)")("seed,s",
+        hpx::program_options::value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,221 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/datapar.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the sizes exercise the small sorts, the sorting network and the block
+// partitioning (including ranges not ending on a block boundary)
+std::size_t const sizes[] = {0, 1, 7, 16, 17, 100, 257, 4096, 100003};
+
+template <typename T>
+std::vector<T> make_data(std::size_t size, bool few_unique)
+{
+    std::uniform_int_distribution<int> dist(
+        few_unique ? 0 : -100000, few_unique ? 5 : 100000);
+
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = static_cast<T>(dist(gen));
+    }
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_sort(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        for (bool few_unique : {false, true})
+        {
+            std::vector<T> c = make_data<T>(size, few_unique);
+            std::vector<T> d = c;
+
+            hpx::sort(policy, c.begin(), c.end());
+            std::sort(d.begin(), d.end());
+            HPX_TEST(c == d);
+
+            hpx::sort(policy, c.begin(), c.end(), std::greater<>());
+            std::sort(d.begin(), d.end(), std::greater<>());
+            HPX_TEST(c == d);
+
+            // unaligned start of the range
+            if (size > 1)
+            {
+                c = make_data<T>(size, few_unique);
+                d = c;
+
+                hpx::sort(policy, c.begin() + 1, c.end());
+                std::sort(d.begin() + 1, d.end());
+                HPX_TEST(c == d);
+            }
+        }
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_stable_sort(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c = make_data<T>(size, true);
+        std::vector<T> d = c;
+
+        hpx::stable_sort(policy, c.begin(), c.end());
+        std::stable_sort(d.begin(), d.end());
+        HPX_TEST(c == d);
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_partition(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<T> c = make_data<T>(size, false);
+        std::size_t const expected = static_cast<std::size_t>(std::count_if(
+            c.begin(), c.end(), [](T const& v) { return v < T(0); }));
+
+        // the predicate can be applied to vector packs as well
+        auto const pred = [](auto const& v) { return v < T(0); };
+        auto const mid = hpx::partition(policy, c.begin(), c.end(), pred);
+
+        HPX_TEST_EQ(static_cast<std::size_t>(mid - c.begin()), expected);
+        HPX_TEST(std::all_of(
+            c.begin(), mid, [](T const& v) { return v < T(0); }));
+        HPX_TEST(std::none_of(
+            mid, c.end(), [](T const& v) { return v < T(0); }));
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_nth_element(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        if (size == 0)
+            continue;
+
+        std::vector<T> c = make_data<T>(size, false);
+        std::vector<T> d = c;
+        std::sort(d.begin(), d.end());
+
+        std::size_t const nth = size / 3;
+        hpx::nth_element(policy, c.begin(), c.begin() + nth, c.end());
+
+        HPX_TEST_EQ(c[nth], d[nth]);
+        HPX_TEST(std::all_of(c.begin(), c.begin() + nth,
+            [&](T const& v) { return !(d[nth] < v); }));
+        HPX_TEST(std::all_of(c.begin() + nth, c.end(),
+            [&](T const& v) { return !(v < d[nth]); }));
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_by_key(ExPolicy&& policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::int32_t> keys =
+            make_data<std::int32_t>(size, false);
+        std::vector<std::uint32_t> values(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            values[i] = static_cast<std::uint32_t>(keys[i]) * 3u;
+        }
+
+        hpx::experimental::sort_by_key(
+            policy, keys.begin(), keys.end(), values.begin());
+
+        HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            HPX_TEST_EQ(values[i], static_cast<std::uint32_t>(keys[i]) * 3u);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sort_datapar(ExPolicy&& policy)
+{
+    test_sort<ExPolicy, int>(policy);
+    test_sort<ExPolicy, std::uint16_t>(policy);
+    test_sort<ExPolicy, float>(policy);
+    test_sort<ExPolicy, double>(policy);
+
+    test_stable_sort<ExPolicy, int>(policy);
+    test_stable_sort<ExPolicy, float>(policy);
+
+    test_partition<ExPolicy, int>(policy);
+    test_partition<ExPolicy, double>(policy);
+
+    test_nth_element<ExPolicy, int>(policy);
+    test_nth_element<ExPolicy, float>(policy);
+
+    test_sort_by_key(policy);
+}
+
+void sort_datapar_test()
+{
+    using namespace hpx::execution;
+
+    test_sort_datapar(simd);
+    test_sort_datapar(par_simd);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    sort_datapar_test();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,166 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace hpx::util {
+
+    namespace detail {
+
+        // All blocks handed out by the slab allocator are carved from slabs of
+        // this size. Slabs are aligned to their size, which allows to find the
+        // slab (and its owning heap) of any block by masking its address.
+        inline constexpr std::size_t slab_size = 64 * 1024;
+
+        // Blocks are managed in size classes of this granularity, blocks up
+        // to slab_max_block_size bytes are served from slabs.
+        inline constexpr std::size_t slab_granularity = 16;
+        inline constexpr std::size_t slab_max_block_size = 1024;
+
+        [[nodiscard]] constexpr bool is_slab_allocatable(
+            std::size_t size, std::size_t alignment) noexcept
+        {
+            return size != 0 && size <= slab_max_block_size &&
+                alignment <= slab_granularity;
+        }
+
+        // Allocate a block of the given size (which must be slab-allocatable)
+        // from the heap owned by the calling thread.
+        [[nodiscard]] HPX_CORE_EXPORT void* slab_allocate(std::size_t size);
+
+        // Return a block to the heap it was allocated from. Blocks freed by
+        // the owning thread are directly reused, blocks freed by any other
+        // thread are put onto the return queue of the owning heap.
+        HPX_CORE_EXPORT void slab_deallocate(void* p) noexcept;
+    }    // namespace detail
+
+    // performance counter support, all values are aggregated over all heaps
+    //
+    // the overall size of all slabs held by the slab allocator
+    [[nodiscard]] HPX_CORE_EXPORT std::int64_t get_slab_reserved_bytes(
+        bool reset) noexcept;
+
+    // the overall size of all blocks currently handed out
+    [[nodiscard]] HPX_CORE_EXPORT std::int64_t get_slab_allocated_bytes(
+        bool reset) noexcept;
+
+    // the number of blocks that were returned by a thread different from the
+    // one that allocated them
+    [[nodiscard]] HPX_CORE_EXPORT std::int64_t get_slab_remote_free_count(
+        bool reset) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Size-class slab allocator. Small allocations are served from slabs
+    // owned by the calling thread, all other allocations are forwarded to the
+    // upstream allocator.
+    template <typename T = char, typename Upstream = internal_allocator<T>>
+    struct slab_allocator
+    {
+        HPX_NO_UNIQUE_ADDRESS Upstream upstream;
+
+        using traits = std::allocator_traits<Upstream>;
+
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other =
+                slab_allocator<U, typename traits::template rebind_alloc<U>>;
+        };
+
+        using is_always_equal = typename traits::is_always_equal;
+        using propagate_on_container_copy_assignment =
+            typename traits::propagate_on_container_copy_assignment;
+        using propagate_on_container_move_assignment =
+            typename traits::propagate_on_container_move_assignment;
+        using propagate_on_container_swap =
+            typename traits::propagate_on_container_swap;
+
+        explicit slab_allocator(Upstream const& upstream = Upstream{}) noexcept(
+            noexcept(std::is_nothrow_copy_constructible_v<Upstream>))
+          : upstream(upstream)
+        {
+        }
+
+        template <typename U, typename Alloc>
+        explicit slab_allocator(slab_allocator<U, Alloc> const& rhs) noexcept(
+            noexcept(std::is_nothrow_copy_constructible_v<Alloc>))
+          : upstream(rhs.upstream)
+        {
+        }
+
+        [[nodiscard]] pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+
+            if (detail::is_slab_allocatable(n * sizeof(T), alignof(T)))
+            {
+                return static_cast<pointer>(
+                    detail::slab_allocate(n * sizeof(T)));
+            }
+            return traits::allocate(upstream, n);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if (detail::is_slab_allocatable(n * sizeof(T), alignof(T)))
+            {
+                detail::slab_deallocate(p);
+            }
+            else
+            {
+                traits::deallocate(upstream, p, n);
+            }
+        }
+
+        [[nodiscard]] constexpr size_type max_size() noexcept
+        {
+            return traits::max_size(upstream);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            traits::construct(upstream, p, HPX_FORWARD(Args, args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p) noexcept
+        {
+            traits::destroy(upstream, p);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(
+            slab_allocator const& lhs, slab_allocator const& rhs) noexcept
+        {
+            return lhs.upstream == rhs.upstream;
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(
+            slab_allocator const& lhs, slab_allocator const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+}    // namespace hpx::util
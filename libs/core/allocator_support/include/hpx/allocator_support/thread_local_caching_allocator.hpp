@@ -9,6 +9,10 @@
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/config/defines.hpp>
 
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_SLAB)
+#include <hpx/allocator_support/slab_allocator.hpp>
+#endif
+
 #include <cstddef>
 #include <memory>
 #include <new>
@@ -159,11 +163,27 @@ namespace hpx::util {
             {
                 throw std::bad_array_new_length();
             }
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_SLAB)
+            // small blocks (e.g. shared states of futures) are served from
+            // the slabs of the calling thread
+            if (detail::is_slab_allocatable(n * sizeof(T), alignof(T)))
+            {
+                return static_cast<pointer>(
+                    detail::slab_allocate(n * sizeof(T)));
+            }
+#endif
             return cache().allocate(n);
         }
 
         void deallocate(pointer p, size_type n) noexcept
         {
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_SLAB)
+            if (detail::is_slab_allocatable(n * sizeof(T), alignof(T)))
+            {
+                detail::slab_deallocate(p);
+                return;
+            }
+#endif
             cache().deallocate(p, n);
         }
 
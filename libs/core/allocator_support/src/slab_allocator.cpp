@@ -0,0 +1,356 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/slab_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx::util::detail {
+
+    namespace {
+
+        constexpr std::size_t num_size_classes =
+            slab_max_block_size / slab_granularity;
+
+        constexpr std::size_t get_size_class(std::size_t size) noexcept
+        {
+            return (size + slab_granularity - 1) / slab_granularity - 1;
+        }
+
+        constexpr std::size_t get_block_size(std::size_t size_class) noexcept
+        {
+            return (size_class + 1) * slab_granularity;
+        }
+
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        struct heap;
+
+        // The header is placed at the beginning of each slab, the remainder
+        // of the slab is split into blocks of the same size.
+        struct alignas(64) slab_header
+        {
+            heap* owner;
+            slab_header* next;    // next slab owned by the same heap
+            std::size_t size_class;
+        };
+
+        static_assert(sizeof(slab_header) % slab_granularity == 0);
+
+        slab_header* get_slab(void* p) noexcept
+        {
+            return reinterpret_cast<slab_header*>(
+                reinterpret_cast<std::uintptr_t>(p) & ~(slab_size - 1));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A heap is owned by at most one thread at any time. All members
+        // except the return queue are accessed by the owning thread only.
+        // Heaps are never destroyed, heaps of exited threads are handed to
+        // newly started threads instead.
+        struct alignas(64) heap
+        {
+            free_block* allocate_slab(std::size_t size_class)
+            {
+                void* mem = ::operator new(
+                    slab_size, static_cast<std::align_val_t>(slab_size));
+
+                auto* slab = static_cast<slab_header*>(mem);
+                slab->owner = this;
+                slab->next = slabs;
+                slab->size_class = size_class;
+                slabs = slab;
+
+                // thread all blocks of the new slab into a free list
+                std::size_t const block_size = get_block_size(size_class);
+                char* const first =
+                    static_cast<char*>(mem) + sizeof(slab_header);
+                char* const last = static_cast<char*>(mem) + slab_size;
+
+                free_block* head = nullptr;
+                for (char* p = first; p + block_size <= last; p += block_size)
+                {
+                    auto* block = reinterpret_cast<free_block*>(p);
+                    block->next = head;
+                    head = block;
+                }
+
+                store(reserved_bytes,
+                    reserved_bytes.load(std::memory_order_relaxed) +
+                        static_cast<std::int64_t>(slab_size));
+
+                return head;
+            }
+
+            // move all blocks returned by other threads back to the free
+            // lists of this heap
+            void collect_returned_blocks() noexcept
+            {
+                free_block* block =
+                    returned.exchange(nullptr, std::memory_order_acquire);
+
+                std::int64_t count = 0;
+                std::int64_t bytes = 0;
+                while (block != nullptr)
+                {
+                    free_block* next = block->next;
+
+                    std::size_t const size_class =
+                        get_slab(block)->size_class;
+                    block->next = free_lists[size_class];
+                    free_lists[size_class] = block;
+
+                    ++count;
+                    bytes += static_cast<std::int64_t>(
+                        get_block_size(size_class));
+                    block = next;
+                }
+
+                if (count != 0)
+                {
+                    store(allocated_bytes,
+                        allocated_bytes.load(std::memory_order_relaxed) -
+                            bytes);
+                    store(remote_frees,
+                        remote_frees.load(std::memory_order_relaxed) + count);
+                }
+            }
+
+            void* allocate(std::size_t size)
+            {
+                std::size_t const size_class = get_size_class(size);
+
+                free_block* block = free_lists[size_class];
+                if (block == nullptr)
+                {
+                    collect_returned_blocks();
+
+                    block = free_lists[size_class];
+                    if (block == nullptr)
+                    {
+                        block = allocate_slab(size_class);
+                    }
+                }
+
+                free_lists[size_class] = block->next;
+
+                store(allocated_bytes,
+                    allocated_bytes.load(std::memory_order_relaxed) +
+                        static_cast<std::int64_t>(get_block_size(size_class)));
+
+                return block;
+            }
+
+            // deallocate a block owned by this heap from the owning thread
+            void deallocate(void* p, slab_header const* slab) noexcept
+            {
+                auto* block = static_cast<free_block*>(p);
+                block->next = free_lists[slab->size_class];
+                free_lists[slab->size_class] = block;
+
+                store(allocated_bytes,
+                    allocated_bytes.load(std::memory_order_relaxed) -
+                        static_cast<std::int64_t>(
+                            get_block_size(slab->size_class)));
+            }
+
+            // deallocate a block owned by this heap from any other thread
+            void return_block(void* p) noexcept
+            {
+                auto* block = static_cast<free_block*>(p);
+                block->next = returned.load(std::memory_order_relaxed);
+                while (!returned.compare_exchange_weak(block->next, block,
+                    std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            // the statistics are modified by the owning thread only, but may
+            // be read concurrently
+            static void store(
+                std::atomic<std::int64_t>& value, std::int64_t v) noexcept
+            {
+                value.store(v, std::memory_order_relaxed);
+            }
+
+            free_block* free_lists[num_size_classes] = {};
+            slab_header* slabs = nullptr;
+
+            std::atomic<std::int64_t> reserved_bytes{0};
+            std::atomic<std::int64_t> allocated_bytes{0};
+            std::atomic<std::int64_t> remote_frees{0};
+
+            heap* next_orphan = nullptr;
+
+            // blocks returned by other threads, kept on a separate cache line
+            alignas(64) std::atomic<free_block*> returned{nullptr};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct heap_registry
+        {
+            heap* acquire()
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                if (orphans != nullptr)
+                {
+                    heap* h = orphans;
+                    orphans = h->next_orphan;
+                    h->next_orphan = nullptr;
+                    return h;
+                }
+
+                heaps.push_back(new heap());
+                return heaps.back();
+            }
+
+            void release(heap* h) noexcept
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                h->next_orphan = orphans;
+                orphans = h;
+            }
+
+            template <typename F>
+            std::int64_t accumulate(F&& f) noexcept
+            {
+                std::int64_t result = 0;
+
+                std::lock_guard<std::mutex> l(mtx);
+                for (heap* h : heaps)
+                {
+                    result += f(*h);
+                }
+                return result + f(shared_heap);
+            }
+
+            std::mutex mtx;
+            std::vector<heap*> heaps;
+            heap* orphans = nullptr;
+
+            // heap used by threads that are shutting down (i.e. after their
+            // own heap has been released), protected by shared_mtx
+            std::mutex shared_mtx;
+            heap shared_heap;
+        };
+
+        heap_registry& get_registry() noexcept
+        {
+            // the registry is intentionally leaked as blocks might be
+            // returned during static destruction
+            static heap_registry* registry = new heap_registry();
+            return *registry;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        thread_local heap* current_heap = nullptr;
+        thread_local bool heap_released = false;
+
+        struct thread_heap_holder
+        {
+            thread_heap_holder() noexcept = default;
+
+            thread_heap_holder(thread_heap_holder const&) = delete;
+            thread_heap_holder(thread_heap_holder&&) = delete;
+            thread_heap_holder& operator=(thread_heap_holder const&) = delete;
+            thread_heap_holder& operator=(thread_heap_holder&&) = delete;
+
+            ~thread_heap_holder()
+            {
+                if (current_heap != nullptr)
+                {
+                    get_registry().release(current_heap);
+                    current_heap = nullptr;
+                }
+                heap_released = true;
+            }
+        };
+
+        heap* get_thread_heap()
+        {
+            if (current_heap == nullptr && !heap_released)
+            {
+                thread_local thread_heap_holder holder;
+                current_heap = get_registry().acquire();
+            }
+            return current_heap;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* slab_allocate(std::size_t size)
+    {
+        if (heap* h = get_thread_heap(); h != nullptr)
+        {
+            return h->allocate(size);
+        }
+
+        // the calling thread is shutting down
+        auto& registry = get_registry();
+        std::lock_guard<std::mutex> l(registry.shared_mtx);
+        return registry.shared_heap.allocate(size);
+    }
+
+    void slab_deallocate(void* p) noexcept
+    {
+        if (p == nullptr)
+        {
+            return;
+        }
+
+        slab_header const* slab = get_slab(p);
+        if (slab->owner == current_heap)
+        {
+            current_heap->deallocate(p, slab);
+        }
+        else
+        {
+            slab->owner->return_block(p);
+        }
+    }
+}    // namespace hpx::util::detail
+
+namespace hpx::util {
+
+    std::int64_t get_slab_reserved_bytes(bool) noexcept
+    {
+        return detail::get_registry().accumulate([](detail::heap const& h) {
+            return h.reserved_bytes.load(std::memory_order_relaxed);
+        });
+    }
+
+    std::int64_t get_slab_allocated_bytes(bool) noexcept
+    {
+        return detail::get_registry().accumulate([](detail::heap const& h) {
+            return h.allocated_bytes.load(std::memory_order_relaxed);
+        });
+    }
+
+    std::int64_t get_slab_remote_free_count(bool reset) noexcept
+    {
+        static std::atomic<std::int64_t> last_value(0);
+
+        std::int64_t const value =
+            detail::get_registry().accumulate([](detail::heap const& h) {
+                return h.remote_frees.load(std::memory_order_relaxed);
+            });
+
+        if (reset)
+        {
+            return value - last_value.exchange(value);
+        }
+        return value - last_value.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::util
@@ -0,0 +1,138 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/slab_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+void local_allocation_test()
+{
+    std::int64_t const reserved = hpx::util::get_slab_reserved_bytes(false);
+    std::int64_t const allocated = hpx::util::get_slab_allocated_bytes(false);
+
+    std::vector<void*> blocks;
+    std::set<void*> unique_blocks;
+    for (std::size_t size = 1; size <= 1024; size += 7)
+    {
+        void* p = hpx::util::detail::slab_allocate(size);
+        HPX_TEST(p != nullptr);
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % 16,
+            static_cast<std::uintptr_t>(0));
+
+        // the whole block must be usable
+        std::memset(p, 0xcd, size);
+
+        blocks.push_back(p);
+        unique_blocks.insert(p);
+    }
+    HPX_TEST_EQ(blocks.size(), unique_blocks.size());
+    HPX_TEST(hpx::util::get_slab_allocated_bytes(false) > allocated);
+
+    for (void* p : blocks)
+    {
+        hpx::util::detail::slab_deallocate(p);
+    }
+    HPX_TEST_EQ(hpx::util::get_slab_allocated_bytes(false), allocated);
+
+    // blocks freed by the owning thread are reused without reserving new
+    // slabs
+    std::int64_t const steady_reserved =
+        hpx::util::get_slab_reserved_bytes(false);
+    HPX_TEST(steady_reserved > reserved);
+
+    for (int i = 0; i != 100000; ++i)
+    {
+        void* p = hpx::util::detail::slab_allocate(64);
+        hpx::util::detail::slab_deallocate(p);
+    }
+    HPX_TEST_EQ(hpx::util::get_slab_reserved_bytes(false), steady_reserved);
+}
+
+void remote_free_test()
+{
+    constexpr std::size_t num_blocks = 10000;
+
+    std::int64_t const remote_frees =
+        hpx::util::get_slab_remote_free_count(false);
+
+    std::vector<void*> blocks(num_blocks);
+    for (void*& p : blocks)
+    {
+        p = hpx::util::detail::slab_allocate(48);
+    }
+
+    // free all blocks on a different thread
+    std::thread t([&]() {
+        for (void* p : blocks)
+        {
+            hpx::util::detail::slab_deallocate(p);
+        }
+    });
+    t.join();
+
+    // the returned blocks are collected once the local free list runs dry,
+    // which happens at the latest after all blocks of the slab are in use
+    std::set<void*> const returned(blocks.begin(), blocks.end());
+    std::size_t reused = 0;
+    for (std::size_t i = 0; i != 2 * num_blocks; ++i)
+    {
+        void* p = hpx::util::detail::slab_allocate(48);
+        if (returned.count(p) != 0)
+        {
+            ++reused;
+        }
+        blocks.push_back(p);
+    }
+    HPX_TEST_EQ(reused, num_blocks);
+    HPX_TEST_EQ(hpx::util::get_slab_remote_free_count(false) - remote_frees,
+        static_cast<std::int64_t>(num_blocks));
+
+    for (std::size_t i = num_blocks; i != blocks.size(); ++i)
+    {
+        hpx::util::detail::slab_deallocate(blocks[i]);
+    }
+}
+
+void allocator_test()
+{
+    hpx::util::slab_allocator<int> alloc;
+
+    // small allocations are served from slabs, large ones by the upstream
+    // allocator
+    int* small = alloc.allocate(16);
+    int* large = alloc.allocate(4096);
+
+    small[15] = 42;
+    large[4095] = 42;
+
+    alloc.deallocate(small, 16);
+    alloc.deallocate(large, 4096);
+
+    std::vector<int, hpx::util::slab_allocator<int>> v;
+    for (int i = 0; i != 1000; ++i)
+    {
+        v.push_back(i);
+    }
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST_EQ(v[i], i);
+    }
+}
+
+int main()
+{
+    local_allocation_test();
+    remote_free_test();
+    allocator_test();
+
+    return hpx::util::report_errors();
+}
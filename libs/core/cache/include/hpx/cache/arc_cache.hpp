@@ -0,0 +1,398 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    namespace engines {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief The \a arc_engine implements the Adaptive Replacement Cache
+        ///        (Megiddo and Modha, FAST'03).
+        ///
+        /// The cached entries are kept in two LRU lists: T1 holds entries
+        /// that were referenced once, T2 entries that were referenced at
+        /// least twice. Two ghost lists (B1 and B2) remember the keys that
+        /// were recently evicted from T1 and T2. A hit in one of the ghost
+        /// lists adapts the target size of T1, which balances recency
+        /// against frequency depending on the access pattern.
+        ///
+        /// This type is not thread-safe, see \a arc_cache.
+        template <typename Key, typename Entry, typename Hash = std::hash<Key>>
+        class arc_engine
+        {
+        public:
+            using key_type = Key;
+            using entry_type = Entry;
+            using hasher = Hash;
+            using entry_pair = std::pair<key_type, entry_type>;
+            using size_type = std::size_t;
+
+        private:
+            using value_list = std::list<entry_pair>;
+            using key_list = std::list<key_type>;
+
+            enum class list_type : std::uint8_t
+            {
+                t1 = 0,
+                t2 = 1,
+                b1 = 2,
+                b2 = 3
+            };
+
+            struct node
+            {
+                list_type where;
+                typename value_list::iterator value;
+                typename key_list::iterator ghost;
+            };
+
+            using index_type = std::unordered_map<key_type, node, hasher>;
+
+            [[nodiscard]] static constexpr bool is_ghost(
+                node const& n) noexcept
+            {
+                return n.where == list_type::b1 || n.where == list_type::b2;
+            }
+
+        public:
+            arc_engine() = default;
+
+            [[nodiscard]] size_type size() const noexcept
+            {
+                return t1_.size() + t2_.size();
+            }
+
+            [[nodiscard]] constexpr size_type capacity() const noexcept
+            {
+                return max_size_;
+            }
+
+            template <typename Statistics>
+            void reserve(size_type max_size, Statistics& stats)
+            {
+                max_size_ = max_size;
+                p_ = (std::min)(p_, max_size_);
+
+                while (size() > max_size_)
+                {
+                    replace(false, stats);
+                }
+                while (t1_.size() + b1_.size() > max_size_ && !b1_.empty())
+                {
+                    drop_ghost(b1_);
+                }
+                while (size() + b1_.size() + b2_.size() > 2 * max_size_ &&
+                    !b2_.empty())
+                {
+                    drop_ghost(b2_);
+                }
+            }
+
+            [[nodiscard]] bool holds_key(key_type const& key) const
+            {
+                auto it = index_.find(key);
+                return it != index_.end() && !is_ghost(it->second);
+            }
+
+            template <typename Statistics>
+            bool get_entry(
+                key_type const& key, entry_type& entry, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end() || is_ghost(it->second))
+                {
+                    stats.got_miss();
+                    return false;
+                }
+
+                touch(it->second);
+                entry = it->second.value->second;
+
+                stats.got_hit();
+                return true;
+            }
+
+            template <typename Entry_, typename Statistics>
+            bool insert(key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it != index_.end() && !is_ghost(it->second))
+                {
+                    return false;
+                }
+
+                insert_nonexist(it, key, HPX_FORWARD(Entry_, entry), stats);
+                return true;
+            }
+
+            template <typename Entry_, typename Statistics>
+            void update(key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end() || is_ghost(it->second))
+                {
+                    stats.got_miss();
+                    insert_nonexist(
+                        it, key, HPX_FORWARD(Entry_, entry), stats);
+                    return;
+                }
+
+                it->second.value->second = HPX_FORWARD(Entry_, entry);
+                touch(it->second);
+
+                stats.got_hit();
+            }
+
+            template <typename Statistics>
+            bool erase(key_type const& key, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    return false;
+                }
+
+                node const& n = it->second;
+                bool const cached = !is_ghost(n);
+                switch (n.where)
+                {
+                case list_type::t1:
+                    t1_.erase(n.value);
+                    break;
+                case list_type::t2:
+                    t2_.erase(n.value);
+                    break;
+                case list_type::b1:
+                    b1_.erase(n.ghost);
+                    break;
+                case list_type::b2:
+                    b2_.erase(n.ghost);
+                    break;
+                }
+                index_.erase(it);
+
+                if (cached)
+                {
+                    stats.got_eviction();
+                }
+                return cached;
+            }
+
+            template <typename Func, typename Statistics>
+            size_type erase_if(Func const& ep, Statistics& stats)
+            {
+                return erase_from(t1_, ep, stats) + erase_from(t2_, ep, stats);
+            }
+
+            size_type clear()
+            {
+                size_type const erased = size();
+                index_.clear();
+                t1_.clear();
+                t2_.clear();
+                b1_.clear();
+                b2_.clear();
+                p_ = 0;
+                return erased;
+            }
+
+        private:
+            // move the entry to the MRU position of T2
+            void touch(node& n)
+            {
+                if (n.where == list_type::t1)
+                {
+                    t2_.splice(t2_.begin(), t1_, n.value);
+                    n.where = list_type::t2;
+                }
+                else
+                {
+                    t2_.splice(t2_.begin(), t2_, n.value);
+                }
+            }
+
+            template <typename Entry_, typename Statistics>
+            void insert_nonexist(typename index_type::iterator it,
+                key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                if (max_size_ == 0)
+                {
+                    return;    // nothing is cached
+                }
+
+                if (it != index_.end())
+                {
+                    // hit in one of the ghost lists, adapt the target size of
+                    // T1 and insert the entry into T2
+                    node& n = it->second;
+                    if (n.where == list_type::b1)
+                    {
+                        size_type const delta =
+                            (std::max)(b2_.size() / b1_.size(), size_type(1));
+                        p_ = (std::min)(max_size_, p_ + delta);
+
+                        make_room(false, stats);
+                        b1_.erase(n.ghost);
+                    }
+                    else
+                    {
+                        size_type const delta =
+                            (std::max)(b1_.size() / b2_.size(), size_type(1));
+                        p_ = p_ > delta ? p_ - delta : 0;
+
+                        make_room(true, stats);
+                        b2_.erase(n.ghost);
+                    }
+
+                    t2_.emplace_front(key, HPX_FORWARD(Entry_, entry));
+                    n.where = list_type::t2;
+                    n.value = t2_.begin();
+
+                    stats.got_insertion();
+                    return;
+                }
+
+                // completely new entry
+                if (t1_.size() + b1_.size() >= max_size_)
+                {
+                    if (t1_.size() < max_size_)
+                    {
+                        drop_ghost(b1_);
+                        make_room(false, stats);
+                    }
+                    else
+                    {
+                        // B1 is empty, evict the LRU entry of T1 entirely
+                        index_.erase(t1_.back().first);
+                        t1_.pop_back();
+                        stats.got_eviction();
+                    }
+                }
+                else if (size() + b1_.size() + b2_.size() >= max_size_)
+                {
+                    if (size() + b1_.size() + b2_.size() >= 2 * max_size_)
+                    {
+                        drop_ghost(b2_);
+                    }
+                    make_room(false, stats);
+                }
+
+                t1_.emplace_front(key, HPX_FORWARD(Entry_, entry));
+                index_.emplace(key,
+                    node{list_type::t1, t1_.begin(),
+                        typename key_list::iterator()});
+
+                stats.got_insertion();
+            }
+
+            template <typename Statistics>
+            void make_room(bool in_b2, Statistics& stats)
+            {
+                if (size() >= max_size_)
+                {
+                    replace(in_b2, stats);
+                }
+            }
+
+            // evict the LRU entry of either T1 or T2 (depending on the target
+            // size of T1) and remember its key in the corresponding ghost list
+            template <typename Statistics>
+            void replace(bool in_b2, Statistics& stats)
+            {
+                bool const from_t1 = !t1_.empty() &&
+                    (t1_.size() > p_ || (in_b2 && t1_.size() == p_) ||
+                        t2_.empty());
+
+                value_list& from = from_t1 ? t1_ : t2_;
+                key_list& to = from_t1 ? b1_ : b2_;
+
+                node& n = index_.find(from.back().first)->second;
+                to.push_front(HPX_MOVE(from.back().first));
+                from.pop_back();
+
+                n.where = from_t1 ? list_type::b1 : list_type::b2;
+                n.ghost = to.begin();
+
+                stats.got_eviction();
+            }
+
+            void drop_ghost(key_list& ghosts)
+            {
+                if (!ghosts.empty())
+                {
+                    index_.erase(ghosts.back());
+                    ghosts.pop_back();
+                }
+            }
+
+            template <typename Func, typename Statistics>
+            size_type erase_from(
+                value_list& l, Func const& ep, Statistics& stats)
+            {
+                size_type erased = 0;
+                for (auto it = l.begin(); it != l.end();)
+                {
+                    if (ep(*it))
+                    {
+                        index_.erase(it->first);
+                        it = l.erase(it);
+                        ++erased;
+
+                        stats.got_eviction();
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                return erased;
+            }
+
+            size_type max_size_ = 0;
+            size_type p_ = 0;    // target size of T1
+
+            value_list t1_;
+            value_list t2_;
+            key_list b1_;
+            key_list b2_;
+            index_type index_;
+        };
+    }    // namespace engines
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A thread-safe cache using the ARC eviction algorithm for each of
+    ///        its shards.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance (see \a concurrent_cache).
+    /// \tparam Hash          The hash function used for the keys.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename Mutex = hpx::util::spinlock>
+    using arc_cache = concurrent_cache<engines::arc_engine<Key, Entry, Hash>,
+        Statistics, Mutex>;
+}    // namespace hpx::util::cache
@@ -0,0 +1,277 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    namespace engines {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief The \a clock_engine approximates LRU using the CLOCK
+        ///        algorithm: a hit only sets the reference bit of the entry,
+        ///        the entries are never reordered. On eviction the clock hand
+        ///        sweeps over the entries, clearing the reference bits, until
+        ///        it finds an entry that was not referenced since the last
+        ///        sweep.
+        ///
+        /// This type is not thread-safe, see \a clock_cache.
+        template <typename Key, typename Entry, typename Hash = std::hash<Key>>
+        class clock_engine
+        {
+        public:
+            using key_type = Key;
+            using entry_type = Entry;
+            using hasher = Hash;
+            using entry_pair = std::pair<key_type, entry_type>;
+            using size_type = std::size_t;
+
+        private:
+            struct slot
+            {
+                std::optional<entry_pair> value;
+                bool referenced = false;
+            };
+
+        public:
+            clock_engine() = default;
+
+            [[nodiscard]] size_type size() const noexcept
+            {
+                return index_.size();
+            }
+
+            [[nodiscard]] constexpr size_type capacity() const noexcept
+            {
+                return max_size_;
+            }
+
+            template <typename Statistics>
+            void reserve(size_type max_size, Statistics& stats)
+            {
+                max_size_ = max_size;
+                while (index_.size() > max_size_)
+                {
+                    free_.push_back(evict(stats));
+                }
+            }
+
+            [[nodiscard]] bool holds_key(key_type const& key) const
+            {
+                return index_.find(key) != index_.end();
+            }
+
+            template <typename Statistics>
+            bool get_entry(
+                key_type const& key, entry_type& entry, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    stats.got_miss();
+                    return false;
+                }
+
+                slot& s = slots_[it->second];
+                s.referenced = true;
+                entry = s.value->second;
+
+                stats.got_hit();
+                return true;
+            }
+
+            template <typename Entry_, typename Statistics>
+            bool insert(key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                if (index_.find(key) != index_.end())
+                {
+                    return false;
+                }
+
+                insert_nonexist(key, HPX_FORWARD(Entry_, entry), stats);
+                return true;
+            }
+
+            template <typename Entry_, typename Statistics>
+            void update(key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    stats.got_miss();
+                    insert_nonexist(key, HPX_FORWARD(Entry_, entry), stats);
+                    return;
+                }
+
+                slot& s = slots_[it->second];
+                s.value->second = HPX_FORWARD(Entry_, entry);
+                s.referenced = true;
+
+                stats.got_hit();
+            }
+
+            template <typename Statistics>
+            bool erase(key_type const& key, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    return false;
+                }
+
+                release(it->second);
+                index_.erase(it);
+
+                stats.got_eviction();
+                return true;
+            }
+
+            template <typename Func, typename Statistics>
+            size_type erase_if(Func const& ep, Statistics& stats)
+            {
+                size_type erased = 0;
+                for (size_type i = 0; i != slots_.size(); ++i)
+                {
+                    slot& s = slots_[i];
+                    if (s.value && ep(*s.value))
+                    {
+                        index_.erase(s.value->first);
+                        release(i);
+                        ++erased;
+
+                        stats.got_eviction();
+                    }
+                }
+                return erased;
+            }
+
+            size_type clear()
+            {
+                size_type const erased = index_.size();
+                index_.clear();
+                slots_.clear();
+                free_.clear();
+                hand_ = 0;
+                return erased;
+            }
+
+        private:
+            template <typename Entry_, typename Statistics>
+            void insert_nonexist(
+                key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                if (max_size_ == 0)
+                {
+                    return;    // nothing is cached
+                }
+
+                size_type pos;
+                if (index_.size() >= max_size_)
+                {
+                    pos = evict(stats);
+                }
+                else if (!free_.empty())
+                {
+                    pos = free_.back();
+                    free_.pop_back();
+                }
+                else
+                {
+                    pos = slots_.size();
+                    slots_.emplace_back();
+                }
+
+                slot& s = slots_[pos];
+                s.value.emplace(key, HPX_FORWARD(Entry_, entry));
+                s.referenced = false;
+                index_.emplace(key, pos);
+
+                stats.got_insertion();
+            }
+
+            // Advance the clock hand to the next entry that was not
+            // referenced recently, remove it, and return its position. This
+            // terminates after at most two sweeps as the hand clears the
+            // reference bits while advancing.
+            template <typename Statistics>
+            size_type evict(Statistics& stats)
+            {
+                for (;;)
+                {
+                    size_type const pos = hand_;
+                    if (++hand_ == slots_.size())
+                    {
+                        hand_ = 0;
+                    }
+
+                    slot& s = slots_[pos];
+                    if (!s.value)
+                    {
+                        continue;
+                    }
+
+                    if (s.referenced)
+                    {
+                        s.referenced = false;
+                        continue;
+                    }
+
+                    index_.erase(s.value->first);
+                    s.value.reset();
+
+                    stats.got_eviction();
+                    return pos;
+                }
+            }
+
+            void release(size_type pos)
+            {
+                slots_[pos].value.reset();
+                slots_[pos].referenced = false;
+                free_.push_back(pos);
+            }
+
+            size_type max_size_ = 0;
+            size_type hand_ = 0;
+
+            std::vector<slot> slots_;
+            std::vector<size_type> free_;
+            std::unordered_map<key_type, size_type, hasher> index_;
+        };
+    }    // namespace engines
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A thread-safe cache using the CLOCK eviction algorithm for each
+    ///        of its shards.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance (see \a concurrent_cache).
+    /// \tparam Hash          The hash function used for the keys.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename Mutex = hpx::util::spinlock>
+    using clock_cache =
+        concurrent_cache<engines::clock_engine<Key, Entry, Hash>, Statistics,
+            Mutex>;
+}    // namespace hpx::util::cache
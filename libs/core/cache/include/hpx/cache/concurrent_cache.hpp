@@ -0,0 +1,368 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    namespace detail {
+
+        [[nodiscard]] constexpr std::size_t next_power_of_two(
+            std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t mix_hash(std::uint64_t h) noexcept
+        {
+            // finalizer of MurmurHash3, spreads the entropy of the low bits
+            // of the hash value over all bits
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp hpx/cache/concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache is a thread-safe local (non-distributed)
+    ///        cache. The keys are distributed over a number of shards, each
+    ///        of which is protected by its own lock and manages its entries
+    ///        using the given eviction engine.
+    ///
+    /// \tparam Engine        The eviction algorithm used for every shard (see
+    ///                       \a clock_cache, \a arc_cache, and
+    ///                       \a tinylfu_cache).
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. Every shard maintains
+    ///                       its own instance of this type, see
+    ///                       \a for_each_statistics.
+    /// \tparam Mutex         The type of the lock protecting a shard.
+    template <typename Engine, typename Statistics = statistics::no_statistics,
+        typename Mutex = hpx::util::spinlock>
+    class concurrent_cache
+    {
+    public:
+        using engine_type = Engine;
+        using key_type = typename engine_type::key_type;
+        using entry_type = typename engine_type::entry_type;
+        using hasher = typename engine_type::hasher;
+        using statistics_type = Statistics;
+        using mutex_type = Mutex;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            engine_type engine_;
+            statistics_type statistics_;
+        };
+
+        // Every shard should be able to hold at least this many entries if
+        // the number of shards is selected automatically.
+        static constexpr size_type min_shard_capacity = 64;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold at any time. The capacity is
+        ///                   distributed evenly over the shards.
+        /// \param num_shards [in] The number of shards to use, this is
+        ///                   rounded up to the next power of two. The default
+        ///                   (zero) selects a number based on the hardware
+        ///                   concurrency and the capacity of the cache.
+        ///
+        explicit concurrent_cache(
+            size_type max_size = 0, size_type num_shards = 0)
+          : num_shards_(select_num_shards(max_size, num_shards))
+          , shard_shift_(compute_shard_shift(num_shards_))
+          , max_size_(0)
+          , shards_(
+                new hpx::util::cache_aligned_data_derived<shard>[num_shards_])
+        {
+            reserve(max_size);
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache(concurrent_cache&&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache&&) = delete;
+
+        ~concurrent_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current number of entries held by the cache. The
+        ///        returned value is a snapshot only if the cache is modified
+        ///        concurrently.
+        [[nodiscard]] size_type size() const
+        {
+            size_type result = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                std::lock_guard<mutex_type> l(shards_[i].mtx_);
+                result += shards_[i].engine_.size();
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum number of entries the cache is allowed
+        ///        to hold.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Return the number of shards used by this cache.
+        [[nodiscard]] constexpr size_type num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum number of entries this cache can hold.
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            size_type const per_shard = max_size / num_shards_;
+            size_type const remainder = max_size % num_shards_;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.engine_.reserve(
+                    per_shard + (i < remainder ? 1 : 0), s.statistics_);
+            }
+            max_size_.store(max_size, std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key. This does not mark the entry as being
+        ///        used.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            shard const& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.engine_.holds_key(key);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(s.statistics_, statistics::method::get_entry);
+
+            return s.engine_.get_entry(key, entry, s.statistics_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the cache already
+        ///               holds an entry for the given key, otherwise it
+        ///               returns \a true. Note that the eviction engine may
+        ///               decide not to keep the new entry.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        bool insert(key_type const& key, Entry_&& entry)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::insert_entry);
+
+            return s.engine_.insert(
+                key, HPX_FORWARD(Entry_, entry), s.statistics_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache or insert it if
+        ///        it is not held by the cache.
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        void update(key_type const& key, Entry_&& entry)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::update_entry);
+
+            s.engine_.update(key, HPX_FORWARD(Entry_, entry), s.statistics_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove the entry identified by the given key.
+        ///
+        /// \returns      This function returns \a true if an entry was removed.
+        bool erase(key_type const& key)
+        {
+            shard& s = get_shard(key);
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::erase_entry);
+
+            return s.engine_.erase(key, s.statistics_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               (\a entry_pair) currently held in the cache while
+        ///               the lock of the corresponding shard is held.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase_if(Func const& ep)
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                update_on_exit update(
+                    s.statistics_, statistics::method::erase_entry);
+
+                erased += s.engine_.erase_if(ep, s.statistics_);
+            }
+            return erased;
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                erased += s.engine_.clear();
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Invoke the given function for the statistics instance of
+        ///        every shard (while holding the lock of the shard). This
+        ///        allows to accumulate (and reset) the statistics of the
+        ///        whole cache.
+        template <typename F>
+        void for_each_statistics(F&& f)
+        {
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i];
+                std::lock_guard<mutex_type> l(s.mtx_);
+                f(s.statistics_);
+            }
+        }
+
+    private:
+        [[nodiscard]] static size_type select_num_shards(
+            size_type max_size, size_type num_shards) noexcept
+        {
+            if (num_shards == 0)
+            {
+                size_type const concurrency =
+                    2 * (std::max)(std::thread::hardware_concurrency(), 1U);
+                size_type const by_size =
+                    (std::max)(max_size / min_shard_capacity, size_type(1));
+                num_shards = (std::min)(concurrency, by_size);
+            }
+            return detail::next_power_of_two(num_shards);
+        }
+
+        [[nodiscard]] static constexpr unsigned compute_shard_shift(
+            size_type num_shards) noexcept
+        {
+            unsigned bits = 0;
+            while ((size_type(1) << bits) < num_shards)
+                ++bits;
+            return 64 - bits;
+        }
+
+        [[nodiscard]] shard& get_shard(key_type const& key) const
+        {
+            if (num_shards_ == 1)
+                return shards_[0];
+
+            // select the shard using the upper bits of the hash such that
+            // the engines (which hash the same key) don't see a constant
+            // value in the lower bits
+            std::uint64_t const h =
+                detail::mix_hash(static_cast<std::uint64_t>(hasher()(key)));
+            return shards_[static_cast<size_type>(h >> shard_shift_)];
+        }
+
+        size_type const num_shards_;
+        unsigned const shard_shift_;
+        std::atomic<size_type> max_size_;
+
+        std::unique_ptr<hpx::util::cache_aligned_data_derived<shard>[]>
+            shards_;
+    };
+}    // namespace hpx::util::cache
@@ -0,0 +1,469 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    namespace engines {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief The \a count_min_sketch estimates the access frequency of
+        ///        (hashed) keys using a fixed amount of memory. The counters
+        ///        saturate at 15 and are halved periodically such that the
+        ///        estimates reflect the recent history only.
+        class count_min_sketch
+        {
+        public:
+            static constexpr std::size_t depth = 4;
+            static constexpr std::uint8_t max_count = 15;
+
+            count_min_sketch() = default;
+
+            // Size the sketch for a cache holding the given number of
+            // entries, this resets all counters.
+            void resize(std::size_t max_size)
+            {
+                std::size_t const width = detail::next_power_of_two(
+                    (std::max)(max_size, std::size_t(16)));
+                mask_ = width - 1;
+                counters_.assign(depth * width, 0);
+                sample_size_ = 10 * (std::max)(max_size, std::size_t(1));
+                additions_ = 0;
+            }
+
+            void increment(std::uint64_t hash) noexcept
+            {
+                if (counters_.empty())
+                    return;
+
+                bool added = false;
+                for (std::size_t i = 0; i != depth; ++i)
+                {
+                    std::uint8_t& counter = counters_[index_of(hash, i)];
+                    if (counter < max_count)
+                    {
+                        ++counter;
+                        added = true;
+                    }
+                }
+
+                if (added && ++additions_ == sample_size_)
+                {
+                    reset();
+                }
+            }
+
+            [[nodiscard]] std::uint8_t estimate(
+                std::uint64_t hash) const noexcept
+            {
+                if (counters_.empty())
+                    return 0;
+
+                std::uint8_t result = max_count;
+                for (std::size_t i = 0; i != depth; ++i)
+                {
+                    result = (std::min)(result, counters_[index_of(hash, i)]);
+                }
+                return result;
+            }
+
+        private:
+            [[nodiscard]] std::size_t index_of(
+                std::uint64_t hash, std::size_t row) const noexcept
+            {
+                constexpr std::array<std::uint64_t, depth> seeds = {
+                    0x97cb3127a9b9d8d5ULL, 0xc2b2ae3d27d4eb4fULL,
+                    0x165667b19e3779f9ULL, 0x85ebca77c2b2ae63ULL};
+
+                return row * (mask_ + 1) +
+                    static_cast<std::size_t>(
+                        detail::mix_hash(hash ^ seeds[row]) & mask_);
+            }
+
+            // age all counters by halving them
+            void reset() noexcept
+            {
+                for (auto& counter : counters_)
+                {
+                    counter >>= 1;
+                }
+                additions_ /= 2;
+            }
+
+            std::vector<std::uint8_t> counters_;
+            std::size_t mask_ = 0;
+            std::size_t sample_size_ = 0;
+            std::size_t additions_ = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief The \a tinylfu_engine implements the W-TinyLFU eviction
+        ///        algorithm (Einziger, Friedman, and Manes, ACM ToS 2017).
+        ///
+        /// New entries are admitted to a small LRU window (1% of the
+        /// capacity). Entries leaving the window compete with the eviction
+        /// candidate of the main segmented LRU: the one with the higher
+        /// estimated access frequency (as recorded by a count-min sketch for
+        /// all accesses, including misses) is kept. The main cache is split
+        /// into a probationary and a protected segment (80% of the main
+        /// capacity), entries are promoted to the protected segment on their
+        /// first hit in the probationary segment.
+        ///
+        /// This type is not thread-safe, see \a tinylfu_cache.
+        template <typename Key, typename Entry, typename Hash = std::hash<Key>>
+        class tinylfu_engine
+        {
+        public:
+            using key_type = Key;
+            using entry_type = Entry;
+            using hasher = Hash;
+            using entry_pair = std::pair<key_type, entry_type>;
+            using size_type = std::size_t;
+
+        private:
+            using value_list = std::list<entry_pair>;
+
+            enum class region : std::uint8_t
+            {
+                window = 0,
+                probation = 1,
+                protected_ = 2
+            };
+
+            struct node
+            {
+                region where;
+                typename value_list::iterator value;
+            };
+
+            [[nodiscard]] static std::uint64_t hash_of(key_type const& key)
+            {
+                return static_cast<std::uint64_t>(hasher()(key));
+            }
+
+        public:
+            tinylfu_engine() = default;
+
+            [[nodiscard]] size_type size() const noexcept
+            {
+                return index_.size();
+            }
+
+            [[nodiscard]] constexpr size_type capacity() const noexcept
+            {
+                return max_size_;
+            }
+
+            template <typename Statistics>
+            void reserve(size_type max_size, Statistics& stats)
+            {
+                max_size_ = max_size;
+                window_size_ = max_size == 0 ?
+                    0 :
+                    (std::max)(max_size / 100, size_type(1));
+                protected_size_ = (max_size - window_size_) * 4 / 5;
+
+                sketch_.resize(max_size);
+
+                while (index_.size() > max_size_)
+                {
+                    value_list& l = !probation_.empty() ? probation_ :
+                        !protected_.empty()             ? protected_ :
+                                                          window_;
+                    evict(l, stats);
+                }
+                while (window_.size() > window_size_)
+                {
+                    demote(window_);
+                }
+                while (protected_.size() > protected_size_)
+                {
+                    demote(protected_);
+                }
+            }
+
+            [[nodiscard]] bool holds_key(key_type const& key) const
+            {
+                return index_.find(key) != index_.end();
+            }
+
+            template <typename Statistics>
+            bool get_entry(
+                key_type const& key, entry_type& entry, Statistics& stats)
+            {
+                sketch_.increment(hash_of(key));
+
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    stats.got_miss();
+                    return false;
+                }
+
+                touch(it->second);
+                entry = it->second.value->second;
+
+                stats.got_hit();
+                return true;
+            }
+
+            template <typename Entry_, typename Statistics>
+            bool insert(key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                if (index_.find(key) != index_.end())
+                {
+                    return false;
+                }
+
+                insert_nonexist(key, HPX_FORWARD(Entry_, entry), stats);
+                return true;
+            }
+
+            template <typename Entry_, typename Statistics>
+            void update(key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    stats.got_miss();
+                    insert_nonexist(key, HPX_FORWARD(Entry_, entry), stats);
+                    return;
+                }
+
+                sketch_.increment(hash_of(key));
+
+                it->second.value->second = HPX_FORWARD(Entry_, entry);
+                touch(it->second);
+
+                stats.got_hit();
+            }
+
+            template <typename Statistics>
+            bool erase(key_type const& key, Statistics& stats)
+            {
+                auto it = index_.find(key);
+                if (it == index_.end())
+                {
+                    return false;
+                }
+
+                get_list(it->second.where).erase(it->second.value);
+                index_.erase(it);
+
+                stats.got_eviction();
+                return true;
+            }
+
+            template <typename Func, typename Statistics>
+            size_type erase_if(Func const& ep, Statistics& stats)
+            {
+                return erase_from(window_, ep, stats) +
+                    erase_from(probation_, ep, stats) +
+                    erase_from(protected_, ep, stats);
+            }
+
+            size_type clear()
+            {
+                size_type const erased = index_.size();
+                index_.clear();
+                window_.clear();
+                probation_.clear();
+                protected_.clear();
+                sketch_.resize(max_size_);
+                return erased;
+            }
+
+        private:
+            value_list& get_list(region r) noexcept
+            {
+                switch (r)
+                {
+                case region::window:
+                    break;
+                case region::probation:
+                    return probation_;
+                case region::protected_:
+                    return protected_;
+                }
+                return window_;
+            }
+
+            void touch(node& n)
+            {
+                switch (n.where)
+                {
+                case region::window:
+                    window_.splice(window_.begin(), window_, n.value);
+                    break;
+
+                case region::probation:
+                    // promote to the protected segment, this may demote the
+                    // least recently used protected entry
+                    protected_.splice(protected_.begin(), probation_, n.value);
+                    n.where = region::protected_;
+                    if (protected_.size() > protected_size_)
+                    {
+                        demote(protected_);
+                    }
+                    break;
+
+                case region::protected_:
+                    protected_.splice(protected_.begin(), protected_, n.value);
+                    break;
+                }
+            }
+
+            // move the LRU entry of the given list to the MRU position of the
+            // probationary segment
+            void demote(value_list& from)
+            {
+                index_.find(from.back().first)->second.where =
+                    region::probation;
+                probation_.splice(
+                    probation_.begin(), from, std::prev(from.end()));
+            }
+
+            template <typename Statistics>
+            void evict(value_list& from, Statistics& stats)
+            {
+                index_.erase(from.back().first);
+                from.pop_back();
+                stats.got_eviction();
+            }
+
+            template <typename Entry_, typename Statistics>
+            void insert_nonexist(
+                key_type const& key, Entry_&& entry, Statistics& stats)
+            {
+                if (max_size_ == 0)
+                {
+                    return;    // nothing is cached
+                }
+
+                sketch_.increment(hash_of(key));
+
+                window_.emplace_front(key, HPX_FORWARD(Entry_, entry));
+                index_.emplace(key, node{region::window, window_.begin()});
+
+                stats.got_insertion();
+
+                if (window_.size() > window_size_)
+                {
+                    evict_from_window(stats);
+                }
+            }
+
+            // The LRU entry of the window is admitted to the main cache if
+            // there is room or if it is accessed more frequently than the
+            // entry the main cache would evict.
+            template <typename Statistics>
+            void evict_from_window(Statistics& stats)
+            {
+                size_type const main_size = max_size_ - window_size_;
+                if (probation_.size() + protected_.size() < main_size)
+                {
+                    demote(window_);
+                    return;
+                }
+
+                value_list* victims = !probation_.empty() ? &probation_ :
+                    !protected_.empty()                   ? &protected_ :
+                                                            nullptr;
+                if (victims == nullptr)
+                {
+                    evict(window_, stats);
+                    return;
+                }
+
+                std::uint8_t const candidate_freq =
+                    sketch_.estimate(hash_of(window_.back().first));
+                std::uint8_t const victim_freq =
+                    sketch_.estimate(hash_of(victims->back().first));
+
+                if (candidate_freq > victim_freq)
+                {
+                    evict(*victims, stats);
+                    demote(window_);
+                }
+                else
+                {
+                    evict(window_, stats);
+                }
+            }
+
+            template <typename Func, typename Statistics>
+            size_type erase_from(
+                value_list& l, Func const& ep, Statistics& stats)
+            {
+                size_type erased = 0;
+                for (auto it = l.begin(); it != l.end();)
+                {
+                    if (ep(*it))
+                    {
+                        index_.erase(it->first);
+                        it = l.erase(it);
+                        ++erased;
+
+                        stats.got_eviction();
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+                return erased;
+            }
+
+            size_type max_size_ = 0;
+            size_type window_size_ = 0;
+            size_type protected_size_ = 0;
+
+            value_list window_;
+            value_list probation_;
+            value_list protected_;
+            std::unordered_map<key_type, node, hasher> index_;
+
+            count_min_sketch sketch_;
+        };
+    }    // namespace engines
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A thread-safe cache using the W-TinyLFU eviction algorithm for
+    ///        each of its shards.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance (see \a concurrent_cache).
+    /// \tparam Hash          The hash function used for the keys.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename Mutex = hpx::util::spinlock>
+    using tinylfu_cache =
+        concurrent_cache<engines::tinylfu_engine<Key, Entry, Hash>, Statistics,
+            Mutex>;
+}    // namespace hpx::util::cache
@@ -0,0 +1,232 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure hit rate and throughput of the cache engines for a read-through
+// access pattern (look up the key, insert it on a miss) with keys drawn from
+// a Zipfian distribution. The locked lru_cache serves as the baseline.
+
+#include <hpx/config.hpp>
+#include <hpx/cache/arc_cache.hpp>
+#include <hpx/cache/clock_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/tinylfu_cache.hpp>
+#include <hpx/init.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Generate keys in [0, num_keys) where key k is drawn with a probability
+// proportional to 1 / (k + 1)^exponent.
+std::vector<std::uint64_t> zipf_trace(std::size_t num_keys, double exponent,
+    std::size_t length, std::uint32_t seed)
+{
+    std::vector<double> cdf(num_keys);
+    double sum = 0.0;
+    for (std::size_t k = 0; k != num_keys; ++k)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(k + 1), exponent);
+        cdf[k] = sum;
+    }
+
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<double> dist(0.0, sum);
+
+    // scramble the ranks such that popular keys don't hash to neighboring
+    // buckets
+    std::vector<std::uint64_t> trace(length);
+    for (auto& key : trace)
+    {
+        auto const rank = static_cast<std::uint64_t>(
+            std::lower_bound(cdf.begin(), cdf.end(), dist(gen)) - cdf.begin());
+        key = rank * 0x9e3779b97f4a7c15ULL;
+    }
+    return trace;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// lru_cache does not support concurrent accesses, protect it with a lock
+class locked_lru_cache
+{
+public:
+    explicit locked_lru_cache(std::size_t max_size)
+      : cache_(max_size)
+    {
+    }
+
+    bool get_entry(std::uint64_t key, std::uint64_t& value)
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        std::uint64_t realkey;
+        return cache_.get_entry(key, realkey, value);
+    }
+
+    void insert(std::uint64_t key, std::uint64_t value)
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        cache_.insert(key, value);
+    }
+
+private:
+    std::mutex mtx_;
+    hpx::util::cache::lru_cache<std::uint64_t, std::uint64_t> cache_;
+};
+
+struct result
+{
+    double hit_rate;
+    double ops_per_second;
+};
+
+template <typename Cache>
+result run(Cache& cache, std::vector<std::vector<std::uint64_t>> const& traces)
+{
+    std::vector<std::size_t> hits(traces.size(), 0);
+    std::vector<std::thread> threads;
+    threads.reserve(traces.size());
+
+    auto const start = std::chrono::steady_clock::now();
+
+    for (std::size_t t = 0; t != traces.size(); ++t)
+    {
+        threads.emplace_back([&, t]() {
+            std::size_t local_hits = 0;
+            for (std::uint64_t const key : traces[t])
+            {
+                std::uint64_t value = 0;
+                if (cache.get_entry(key, value))
+                {
+                    ++local_hits;
+                }
+                else
+                {
+                    cache.insert(key, key);
+                }
+            }
+            hits[t] = local_hits;
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    std::chrono::duration<double> const elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::size_t total_hits = 0, total_accesses = 0;
+    for (std::size_t t = 0; t != traces.size(); ++t)
+    {
+        total_hits += hits[t];
+        total_accesses += traces[t].size();
+    }
+
+    return result{static_cast<double>(total_hits) / total_accesses,
+        total_accesses / elapsed.count()};
+}
+
+void print(char const* name, std::size_t num_threads, result const& r)
+{
+    std::cout << std::left << std::setw(10) << name << std::right
+              << std::setw(8) << num_threads << std::setw(12) << std::fixed
+              << std::setprecision(4) << r.hit_rate << std::setw(16)
+              << std::setprecision(0) << r.ops_per_second << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const cache_size = vm["cache_size"].as<std::size_t>();
+    std::size_t const num_keys = vm["num_keys"].as<std::size_t>();
+    std::size_t const num_accesses = vm["num_accesses"].as<std::size_t>();
+    double const exponent = vm["exponent"].as<double>();
+    std::size_t max_threads = vm["max_threads"].as<std::size_t>();
+    if (max_threads == 0)
+    {
+        max_threads = (std::max)(std::thread::hardware_concurrency(), 1U);
+    }
+
+    std::cout << "cache size: " << cache_size << ", keys: " << num_keys
+              << ", zipf exponent: " << exponent << "\n";
+    std::cout << "cache      threads    hit rate      ops/second\n";
+
+    for (std::size_t num_threads = 1; num_threads <= max_threads;
+        num_threads *= 2)
+    {
+        // every thread performs the same number of accesses
+        std::vector<std::vector<std::uint64_t>> traces;
+        for (std::size_t t = 0; t != num_threads; ++t)
+        {
+            traces.push_back(zipf_trace(num_keys, exponent,
+                num_accesses / num_threads, static_cast<std::uint32_t>(t)));
+        }
+
+        {
+            locked_lru_cache cache(cache_size);
+            print("lru", num_threads, run(cache, traces));
+        }
+        {
+            hpx::util::cache::clock_cache<std::uint64_t, std::uint64_t> cache(
+                cache_size);
+            print("clock", num_threads, run(cache, traces));
+        }
+        {
+            hpx::util::cache::arc_cache<std::uint64_t, std::uint64_t> cache(
+                cache_size);
+            print("arc", num_threads, run(cache, traces));
+        }
+        {
+            hpx::util::cache::tinylfu_cache<std::uint64_t, std::uint64_t>
+                cache(cache_size);
+            print("tinylfu", num_threads, run(cache, traces));
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // the benchmark runs its own threads
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("cache_size", value<std::size_t>()->default_value(10000),
+            "maximal number of entries held by the caches")
+        ("num_keys", value<std::size_t>()->default_value(1000000),
+            "number of distinct keys")
+        ("num_accesses", value<std::size_t>()->default_value(4000000),
+            "overall number of accesses (distributed over the threads)")
+        ("exponent", value<double>()->default_value(0.9),
+            "exponent of the Zipfian distribution of the keys")
+        ("max_threads", value<std::size_t>()->default_value(0),
+            "maximal number of threads to use (default: all cores)")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,269 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/arc_cache.hpp>
+#include <hpx/cache/clock_cache.hpp>
+#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/cache/tinylfu_cache.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+void test_insert_get()
+{
+    using size_type = typename Cache::size_type;
+
+    Cache c(100, 1);
+    HPX_TEST_EQ(c.capacity(), static_cast<size_type>(100));
+    HPX_TEST_EQ(c.num_shards(), static_cast<size_type>(1));
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+        HPX_TEST_LTE(c.size(), static_cast<size_type>(100));
+    }
+
+    // inserting an existing key fails
+    HPX_TEST(!c.insert(999, std::string("duplicate")));
+
+    // all entries still held by the cache have the correct value
+    std::size_t found = 0;
+    for (int i = 0; i != 1000; ++i)
+    {
+        std::string value;
+        if (c.get_entry(i, value))
+        {
+            HPX_TEST_EQ(value, std::to_string(i));
+            ++found;
+        }
+    }
+    HPX_TEST_EQ(found, c.size());
+    HPX_TEST_LTE(found, static_cast<std::size_t>(100));
+    HPX_TEST_LT(static_cast<std::size_t>(0), found);
+}
+
+template <typename Cache>
+void test_update_erase()
+{
+    using size_type = typename Cache::size_type;
+
+    Cache c(10, 1);
+
+    c.update(1, std::string("one"));
+    c.update(2, std::string("two"));
+    HPX_TEST_EQ(c.size(), static_cast<size_type>(2));
+
+    c.update(1, std::string("uno"));
+    HPX_TEST_EQ(c.size(), static_cast<size_type>(2));
+
+    std::string value;
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("uno"));
+
+    HPX_TEST(c.erase(1));
+    HPX_TEST(!c.erase(1));
+    HPX_TEST(!c.holds_key(1));
+    HPX_TEST(c.holds_key(2));
+
+    for (int i = 10; i != 15; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+
+    size_type const erased = c.erase_if(
+        [](auto const& p) { return p.first >= 10 && p.first % 2 == 0; });
+    HPX_TEST_EQ(erased, static_cast<size_type>(3));
+    HPX_TEST_EQ(c.size(), static_cast<size_type>(3));
+
+    HPX_TEST_EQ(c.clear(), static_cast<size_type>(3));
+    HPX_TEST_EQ(c.size(), static_cast<size_type>(0));
+
+    // shrinking the cache evicts entries
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+    c.reserve(4);
+    HPX_TEST_EQ(c.capacity(), static_cast<size_type>(4));
+    HPX_TEST_LTE(c.size(), static_cast<size_type>(4));
+}
+
+template <typename Cache>
+void test_statistics()
+{
+    Cache c(8, 2);
+
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.insert(i, std::to_string(i)));
+    }
+
+    std::string value;
+    HPX_TEST(c.get_entry(0, value));
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST(!c.get_entry(42, value));
+
+    std::size_t hits = 0, misses = 0, insertions = 0;
+    std::int64_t get_count = 0, insert_count = 0;
+    c.for_each_statistics([&](auto& stats) {
+        hits += stats.hits(true);
+        misses += stats.misses(true);
+        insertions += stats.insertions(true);
+        get_count += stats.get_get_entry_count(true);
+        insert_count += stats.get_insert_entry_count(true);
+    });
+
+    HPX_TEST_EQ(hits, static_cast<std::size_t>(2));
+    HPX_TEST_EQ(misses, static_cast<std::size_t>(1));
+    HPX_TEST_EQ(insertions, static_cast<std::size_t>(4));
+    HPX_TEST_EQ(get_count, static_cast<std::int64_t>(3));
+    HPX_TEST_EQ(insert_count, static_cast<std::int64_t>(4));
+
+    // the statistics were reset
+    hits = 0;
+    c.for_each_statistics([&](auto& stats) { hits += stats.hits(); });
+    HPX_TEST_EQ(hits, static_cast<std::size_t>(0));
+}
+
+// A small set of frequently used keys survives a scan over many keys that
+// are used only once.
+template <typename Cache>
+void test_scan_resistance()
+{
+    Cache c(100, 1);
+
+    for (int round = 0; round != 10; ++round)
+    {
+        for (int i = 0; i != 10; ++i)
+        {
+            std::string value;
+            if (!c.get_entry(i, value))
+            {
+                c.insert(i, std::to_string(i));
+            }
+        }
+    }
+
+    for (int i = 1000; i != 1500; ++i)
+    {
+        c.insert(i, std::to_string(i));
+
+        // keep accessing the hot keys while scanning
+        std::string value;
+        c.get_entry(i % 10, value);
+    }
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(c.holds_key(i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+void test_concurrent()
+{
+    using size_type = typename Cache::size_type;
+
+    constexpr int num_keys = 2000;
+    constexpr int num_operations = 20000;
+
+    Cache c(512);
+
+    std::size_t const num_threads =
+        (std::max)(std::thread::hardware_concurrency(), 4U);
+
+    std::atomic<std::size_t> errors(0);
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen(static_cast<std::uint32_t>(t));
+            std::uniform_int_distribution<int> dist(0, num_keys - 1);
+
+            for (int i = 0; i != num_operations; ++i)
+            {
+                int const key = dist(gen);
+                std::int64_t value = 0;
+                if (c.get_entry(key, value))
+                {
+                    if (value != 2 * static_cast<std::int64_t>(key))
+                        ++errors;
+                }
+                else if (i % 3 == 0)
+                {
+                    c.update(key, 2 * static_cast<std::int64_t>(key));
+                }
+                else
+                {
+                    c.insert(key, 2 * static_cast<std::int64_t>(key));
+                }
+
+                if (i % 1000 == 0)
+                {
+                    c.erase(dist(gen));
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(errors.load(), static_cast<std::size_t>(0));
+    HPX_TEST_LTE(c.size(), static_cast<size_type>(512));
+
+    std::size_t accesses = 0;
+    c.for_each_statistics(
+        [&](auto& stats) { accesses += stats.hits() + stats.misses(); });
+    HPX_TEST_LTE(num_threads * num_operations, accesses);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <template <typename...> typename Cache>
+void test_cache()
+{
+    using statistics = hpx::util::cache::statistics::local_statistics;
+    using full_statistics =
+        hpx::util::cache::statistics::local_full_statistics;
+
+    test_insert_get<Cache<int, std::string>>();
+    test_update_erase<Cache<int, std::string>>();
+    test_statistics<Cache<int, std::string, full_statistics>>();
+    test_concurrent<Cache<int, std::int64_t, statistics>>();
+}
+
+int main()
+{
+    using namespace hpx::util::cache;
+
+    test_cache<clock_cache>();
+    test_cache<arc_cache>();
+    test_cache<tinylfu_cache>();
+
+    // LRU-like policies can't protect the hot keys against the scan if the
+    // scanned keys are inserted faster than the hot keys are referenced,
+    // here the hot keys are referenced on every insertion.
+    test_scan_resistance<clock_cache<int, std::string>>();
+    test_scan_resistance<arc_cache<int, std::string>>();
+    test_scan_resistance<tinylfu_cache<int, std::string>>();
+
+    return hpx::util::report_errors();
+}
@@ -490,6 +490,7 @@ namespace hpx::local::detail {
                     "--hpx:queuing=local-workrequesting-fifo, "
                     "--hpx:queuing=local-workrequesting-lifo, "
                     "--hpx:queuing=local-workrequesting-mc, "
+                    "--hpx:queuing=local-workrequesting-chase-lev, "
                     "and --hpx:queuing=abp-priority only");
             }
 
@@ -517,6 +517,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workrequesting-chase-lev, "
                 "and --hpx:queuing=local-priority only")
             ("hpx:pu-step", value<std::size_t>(),
                 "the step between used processing unit numbers for this "
@@ -526,6 +527,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workrequesting-chase-lev, "
                 "and --hpx:queuing=local-priority only")
             ("hpx:affinity", value<std::string>(),
                 "the affinity domain the OS threads will be confined to, "
@@ -535,6 +537,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workrequesting-chase-lev, "
                 " and --hpx:queuing=local-priority only")
             ("hpx:bind", value<std::vector<std::string> >()->composing(),
                 "the detailed affinity description for the OS threads, see "
@@ -559,9 +562,11 @@ namespace hpx::local::detail {
             ("hpx:queuing", value<argument_string>(),
                 "the queue scheduling policy to use, options are "
                 "'local', 'local-priority-fifo','local-priority-lifo', "
-                "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
-                "'static-priority', 'local-workrequesting-fifo',"
-                "'local-workrequesting-lifo', and 'local-workrequesting-mc' "
+                "'local-priority-chase-lev', 'abp-priority-fifo', "
+                "'abp-priority-lifo', 'static', 'static-priority', "
+                "'local-workrequesting-fifo', 'local-workrequesting-lifo', "
+                "'local-workrequesting-mc', and "
+                "'local-workrequesting-chase-lev' "
                 "(default: 'local-priority'; all option values can be "
                 "abbreviated)")
             ("hpx:high-priority-threads", value<std::size_t>(),
@@ -571,6 +576,7 @@ namespace hpx::local::detail {
                 "--hpx:queuing=local-workrequesting-fifo, "
                 "--hpx:queuing=local-workrequesting-lifo, "
                 "--hpx:queuing=local-workrequesting-mc, "
+                "--hpx:queuing=local-workrequesting-chase-lev, "
                 " and --hpx:queuing=abp-priority only)")
             ("hpx:numa-sensitive", value<std::size_t>()->implicit_value(0),
                 "makes the local-priority scheduler NUMA sensitive ("
@@ -0,0 +1,284 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  lock-free work-stealing deque from
+//  Chase, D. and Lev, Y.,
+//  "Dynamic circular work-stealing deque", SPAA 2005
+//
+//  using the memory orderings for weak memory models from
+//  Le, N. M., Pop, A., Cohen, A., and Zappa Nardelli, F.,
+//  "Correct and efficient work-stealing for weak memory models", PPoPP 2013
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::lockfree {
+
+    /**
+     * The chase_lev_deque class provides a single-owner/multi-thief deque.
+     * Only the owning thread may push and pop items at the bottom end of the
+     * deque (LIFO), any other thread may steal items from the top end of the
+     * deque (FIFO). All operations are lock-free, the owner operations do not
+     * need any atomic read-modify-write operation unless the deque holds a
+     * single item.
+     *
+     * The deque is backed by a circular array that is grown by the owner
+     * whenever it runs full. Arrays that have been replaced are released by
+     * the owner as soon as no thief is in the middle of reading an item (the
+     * thieves announce themselves in a counter while doing so).
+     *
+     *  \b Requirements:
+     *   - T must be trivially copyable
+     *   - T must have a trivial destructor
+     */
+    template <typename T>
+    class chase_lev_deque
+    {
+    private:
+        static_assert(std::is_trivially_destructible_v<T>);
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        using index_type = std::int64_t;
+
+        class array
+        {
+        public:
+            explicit array(std::size_t capacity)
+              : mask_(capacity - 1)
+              , items_(new std::atomic<T>[capacity])
+            {
+                // the capacity must be a power of two
+                HPX_ASSERT(capacity != 0 && (capacity & mask_) == 0);
+            }
+
+            [[nodiscard]] std::size_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            void put(index_type i, T val) noexcept
+            {
+                items_[static_cast<std::size_t>(i) & mask_].store(
+                    val, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] T get(index_type i) const noexcept
+            {
+                return items_[static_cast<std::size_t>(i) & mask_].load(
+                    std::memory_order_relaxed);
+            }
+
+            // create an array of twice the capacity holding the items [top,
+            // bottom)
+            [[nodiscard]] array* grow(index_type top, index_type bottom) const
+            {
+                auto* a = new array(2 * capacity());
+                for (index_type i = top; i != bottom; ++i)
+                {
+                    a->put(i, get(i));
+                }
+                return a;
+            }
+
+        private:
+            std::size_t mask_;
+            std::unique_ptr<std::atomic<T>[]> items_;
+        };
+
+        static constexpr std::size_t round_up_capacity(
+            std::size_t capacity) noexcept
+        {
+            std::size_t result = 2;
+            while (result < capacity)
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(std::size_t initial_capacity = 128)
+          : array_(new array(round_up_capacity(initial_capacity)))
+        {
+            arrays_.emplace_back(array_.load(std::memory_order_relaxed));
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque() = default;
+
+        // push an item at the bottom end of the deque, may be called by the
+        // owning thread only
+        void push_bottom(T val)
+        {
+            index_type const b = bottom_.data_.load(std::memory_order_relaxed);
+            index_type const t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+
+            if (b - t > static_cast<index_type>(a->capacity()) - 1)
+            {
+                // the deque is full, replace the array by a larger one
+                arrays_.emplace_back(a->grow(t, b));
+                a = arrays_.back().get();
+                array_.store(a, std::memory_order_seq_cst);
+            }
+
+            if (arrays_.size() != 1)
+            {
+                reclaim();
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // pop an item from the bottom end of the deque, may be called by the
+        // owning thread only
+        bool pop_bottom(T& val) noexcept
+        {
+            index_type const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array const* a = array_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            index_type t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                if (arrays_.size() != 1)
+                {
+                    reclaim();
+                }
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this was the last item, race against the thieves for it
+                bool const success = top_.data_.compare_exchange_strong(t,
+                    t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return success;
+            }
+            return true;
+        }
+
+        // result of an attempt to steal an item
+        enum class steal_result
+        {
+            success,
+            empty,
+            aborted    // lost a race with another thread, may be retried
+        };
+
+        // steal an item from the top end of the deque, may be called by any
+        // thread
+        steal_result try_steal(T& val) noexcept
+        {
+            index_type t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            index_type const b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return steal_result::empty;
+            }
+
+            // the array may not be released while the item is read from it
+            thieves_.data_.fetch_add(1, std::memory_order_seq_cst);
+            array const* a = array_.load(std::memory_order_seq_cst);
+            T const item = a->get(t);
+            thieves_.data_.fetch_sub(1, std::memory_order_release);
+
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return steal_result::aborted;
+            }
+
+            val = item;
+            return steal_result::success;
+        }
+
+        // steal an item from the top end of the deque, retries until either
+        // an item was stolen or the deque was found to be empty
+        bool steal(T& val) noexcept
+        {
+            steal_result result;
+            while ((result = try_steal(val)) == steal_result::aborted)
+            {
+            }
+            return result == steal_result::success;
+        }
+
+        // returns the (approximate) number of items in the deque
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            index_type const b = bottom_.data_.load(std::memory_order_relaxed);
+            index_type const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        // returns the current capacity of the deque
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return array_.load(std::memory_order_relaxed)->capacity();
+        }
+
+    private:
+        // Release the arrays that have been replaced if no thief is reading
+        // from any of them. A thief announcing itself after the counter was
+        // found to be zero is guaranteed to see the current array, as both
+        // the replacement of the array and the announcement are sequentially
+        // consistent.
+        void reclaim() noexcept
+        {
+            if (thieves_.data_.load(std::memory_order_seq_cst) == 0)
+            {
+                arrays_.erase(arrays_.begin(), arrays_.end() - 1);
+            }
+        }
+
+        // top_ is modified by the thieves, bottom_ by the owner only
+        util::cache_line_data<std::atomic<index_type>> top_{0};
+        util::cache_line_data<std::atomic<index_type>> bottom_{0};
+
+        // the number of thieves currently reading an item
+        util::cache_line_data<std::atomic<std::size_t>> thieves_{0};
+
+        std::atomic<array*> array_;
+
+        // the current array (last) and the replaced arrays that have not
+        // been released yet, accessed by the owner only
+        std::vector<std::unique_ptr<array>> arrays_;
+    };
+}    // namespace hpx::lockfree
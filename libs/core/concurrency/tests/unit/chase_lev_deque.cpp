@@ -0,0 +1,133 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+void simple_deque_test()
+{
+    hpx::lockfree::chase_lev_deque<int> d(64);
+
+    HPX_TEST(d.empty());
+    d.push_bottom(1);
+    d.push_bottom(2);
+    d.push_bottom(3);
+    HPX_TEST_EQ(d.size(), static_cast<std::size_t>(3));
+
+    int i1(0), i2(0), i3(0);
+
+    // the owner pops LIFO
+    HPX_TEST(d.pop_bottom(i1));
+    HPX_TEST_EQ(i1, 3);
+
+    // thieves steal FIFO
+    HPX_TEST(d.steal(i2));
+    HPX_TEST_EQ(i2, 1);
+
+    HPX_TEST(d.pop_bottom(i3));
+    HPX_TEST_EQ(i3, 2);
+
+    HPX_TEST(d.empty());
+    HPX_TEST(!d.pop_bottom(i1));
+    HPX_TEST(!d.steal(i1));
+}
+
+void grow_deque_test()
+{
+    hpx::lockfree::chase_lev_deque<int> d(2);
+    HPX_TEST_EQ(d.capacity(), static_cast<std::size_t>(2));
+
+    for (int i = 0; i != 100; ++i)
+    {
+        d.push_bottom(i);
+    }
+    HPX_TEST_EQ(d.size(), static_cast<std::size_t>(100));
+    HPX_TEST(d.capacity() >= static_cast<std::size_t>(100));
+
+    int val = 0;
+    HPX_TEST(d.steal(val));
+    HPX_TEST_EQ(val, 0);
+
+    for (int i = 99; i != 0; --i)
+    {
+        HPX_TEST(d.pop_bottom(val));
+        HPX_TEST_EQ(val, i);
+    }
+    HPX_TEST(d.empty());
+}
+
+// a small initial capacity makes the deque grow (and release the replaced
+// arrays) while the thieves are stealing
+void concurrent_steal_test(std::size_t initial_capacity)
+{
+    constexpr int num_items = 100000;
+    constexpr int num_thieves = 3;
+
+    hpx::lockfree::chase_lev_deque<int> d(initial_capacity);
+
+    std::vector<std::atomic<int>> seen(num_items);
+    for (auto& s : seen)
+    {
+        s.store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    for (int i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            int val = 0;
+            while (!done.load() || !d.empty())
+            {
+                if (d.steal(val))
+                {
+                    ++seen[val];
+                }
+            }
+        });
+    }
+
+    int val = 0;
+    for (int i = 0; i != num_items; ++i)
+    {
+        d.push_bottom(i);
+        if (i % 3 == 0 && d.pop_bottom(val))
+        {
+            ++seen[val];
+        }
+    }
+    while (d.pop_bottom(val))
+    {
+        ++seen[val];
+    }
+
+    done = true;
+    for (auto& t : thieves)
+    {
+        t.join();
+    }
+
+    // every item was retrieved exactly once
+    for (auto const& s : seen)
+    {
+        HPX_TEST_EQ(s.load(), 1);
+    }
+}
+
+int main()
+{
+    simple_deque_test();
+    grow_deque_test();
+    concurrent_steal_test(16);
+    concurrent_steal_test(2);
+
+    return hpx::util::report_errors();
+}
@@ -96,6 +96,19 @@
 #  define HPX_PARCEL_IPC_DATA_BUFFER_CACHE_SIZE 512
 #endif
 
+/// This defines the maximum overall size (in bytes) of the unused buffers the
+/// TCP parcelport keeps for receiving the zero-copy chunks of incoming
+/// messages. This value can be changed at runtime by setting the
+/// configuration parameter:
+///
+///   hpx.parcel.tcp.receive_buffer_pool_size = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_TCP_RECEIVE_BUFFER_POOL_SIZE).
+#if !defined(HPX_PARCELPORT_TCP_RECEIVE_BUFFER_POOL_SIZE)
+#  define HPX_PARCELPORT_TCP_RECEIVE_BUFFER_POOL_SIZE 268435456
+#endif
+
 /// This defines the number of MPI requests in flight
 /// This value can be changed at runtime by setting the configuration parameter:
 ///
@@ -204,6 +217,14 @@
 #  define HPX_NUM_TIMER_POOL_SIZE 2
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the size (in bytes) of the inline storage of the functions HPX
+/// threads are created from. Task closures up to this size are stored inside
+/// the thread object without allocating memory.
+#if !defined(HPX_TASK_FUNCTION_STORAGE_SIZE)
+#  define HPX_TASK_FUNCTION_STORAGE_SIZE (8 * sizeof(void*))
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// By default, enable minimal thread deadlock detection in debug builds only.
 #if !defined(HPX_SPINLOCK_DEADLOCK_DETECTION_LIMIT)
@@ -161,6 +161,18 @@ namespace hpx::threads::coroutines::detail {
             HPX_ASSERT(is_ready());
             do_invoke();
 
+            // if stacks are bound lazily, a thread that has terminated hands
+            // back its stack right away while a suspended thread holds on to
+            // it (see stack_pool_parameters::lazy_binding_)
+            if (m_state == context_state::exited)
+            {
+                base_type::release_stack();
+            }
+            else
+            {
+                base_type::promote_stack();
+            }
+
             if (m_exit_status != context_exit_status::not_exited)
             {
                 if (m_exit_status == context_exit_status::exited_return)
@@ -26,6 +26,7 @@
 #if defined(_POSIX_VERSION) &&                                                 \
     !(defined(__ARM64_ARCH_8__) && defined(__APPLE__))
 #include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 
 #define HPX_USE_POSIX_STACK_UTILITIES
 #endif
@@ -101,7 +102,7 @@ namespace hpx::threads::coroutines {
             {
                 // Condition excludes MacOS/M1 from using posix mmap
 #if defined(HPX_USE_POSIX_STACK_UTILITIES)
-                void* limit = posix::alloc_stack(size);
+                void* limit = stack_pool::get().allocate(size);
                 posix::watermark_stack(limit, size);
 #else
                 void* limit = std::calloc(size, sizeof(char));
@@ -116,7 +117,7 @@ namespace hpx::threads::coroutines {
                 HPX_ASSERT(vp);
                 void* limit = static_cast<char*>(vp) - size;
 #if defined(HPX_USE_POSIX_STACK_UTILITIES)
-                posix::free_stack(limit, size);
+                stack_pool::get().deallocate(limit, size);
 #else
                 std::free(limit);
 #endif
@@ -207,6 +208,7 @@ namespace hpx::threads::coroutines {
                         alloc_.minimum_stacksize() :
                         static_cast<std::size_t>(stack_size))
               , stack_pointer_(nullptr)
+              , promoted_(false)
             {
             }
 
@@ -233,6 +235,36 @@ namespace hpx::threads::coroutines {
                 }
             }
 
+            // return the stack to the pool if stacks are lazily bound, the
+            // next invocation will bind a new one
+            void release_stack() noexcept
+            {
+#if defined(HPX_USE_POSIX_STACK_UTILITIES)
+                if (stack_pointer_ == nullptr ||
+                    !stack_pool::get().lazy_binding())
+                {
+                    return;
+                }
+
+                alloc_.deallocate(stack_pointer_, stack_size_);
+                stack_pointer_ = nullptr;
+                ctx_ = nullptr;
+                promoted_ = false;
+#endif
+            }
+
+            // the thread was suspended and keeps its stack until it terminates
+            void promote_stack() noexcept
+            {
+#if defined(HPX_USE_POSIX_STACK_UTILITIES)
+                if (!promoted_ && stack_pool::get().lazy_binding())
+                {
+                    promoted_ = true;
+                    stack_pool::get().count_promotion();
+                }
+#endif
+            }
+
             // Return the size of the reserved stack address space.
             constexpr std::ptrdiff_t get_stacksize() const noexcept
             {
@@ -351,6 +383,7 @@ namespace hpx::threads::coroutines {
             stack_allocator alloc_;
             std::size_t stack_size_;
             void* stack_pointer_;
+            bool promoted_;
         };
     }    // namespace detail::generic_context
 }    // namespace hpx::threads::coroutines
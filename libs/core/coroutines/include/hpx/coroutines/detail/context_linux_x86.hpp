@@ -18,6 +18,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
 #include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/coroutines/detail/swap_context.hpp>
 #include <hpx/coroutines/signal_handler_debugging.hpp>
 #include <hpx/debugging/attach_debugger.hpp>
@@ -289,6 +290,7 @@ namespace hpx::threads::coroutines::detail::lx {
                     static_cast<std::ptrdiff_t>(default_stack_size) :
                     stack_size)
           , m_stack(nullptr)
+          , m_promoted(false)
         {
         }
 
@@ -311,8 +313,8 @@ namespace hpx::threads::coroutines::detail::lx {
                     "stack size of {1} is invalid", m_stack_size));
             }
 
-            m_stack =
-                posix::alloc_stack(static_cast<std::size_t>(m_stack_size));
+            m_stack = stack_pool::get().allocate(
+                static_cast<std::size_t>(m_stack_size));
             if (m_stack == nullptr)
             {
                 throw std::runtime_error("could not allocate memory for stack");
@@ -354,11 +356,38 @@ namespace hpx::threads::coroutines::detail::lx {
                 VALGRIND_STACK_DEREGISTER(
                     reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
 #endif
-                posix::free_stack(
+                stack_pool::get().deallocate(
                     m_stack, static_cast<std::size_t>(m_stack_size));
             }
         }
 
+        // return the stack to the pool if stacks are lazily bound, the next
+        // invocation will bind a new one
+        void release_stack() noexcept
+        {
+            if (m_stack == nullptr || !stack_pool::get().lazy_binding())
+                return;
+
+#if defined(HPX_HAVE_VALGRIND) && !defined(NVALGRIND)
+            VALGRIND_STACK_DEREGISTER(
+                reinterpret_cast<std::size_t>(m_sp[valgrind_id_idx]));
+#endif
+            stack_pool::get().deallocate(
+                m_stack, static_cast<std::size_t>(m_stack_size));
+            m_stack = nullptr;
+            m_promoted = false;
+        }
+
+        // the thread was suspended and keeps its stack until it terminates
+        void promote_stack() noexcept
+        {
+            if (!m_promoted && stack_pool::get().lazy_binding())
+            {
+                m_promoted = true;
+                stack_pool::get().count_promotion();
+            }
+        }
+
         // Return the size of the reserved stack address space.
         std::ptrdiff_t get_stacksize() const
         {
@@ -466,12 +495,19 @@ namespace hpx::threads::coroutines::detail::lx {
             // https://rethinkdb.com/blog/handling-stack-overflow-on-custom-stacks/
             // http://www.evanjones.ca/software/threading.html
             //
-            if (register_signal_handler)
+            // The alternate signal stack belongs to the OS thread, install it
+            // only once per thread instead of every time a stack is bound.
+            static thread_local bool installed = false;
+            if (register_signal_handler && !installed)
             {
+                installed = true;
+
+                stack_t segv_stack;
                 segv_stack.ss_sp = valloc(SEGV_STACK_SIZE);
                 segv_stack.ss_flags = 0;
                 segv_stack.ss_size = SEGV_STACK_SIZE;
 
+                struct sigaction action;
                 std::memset(&action, '\0', sizeof(action));
                 action.sa_flags = SA_SIGINFO | SA_ONSTACK;
                 action.sa_sigaction = &sigsegv_handler;
@@ -525,12 +561,7 @@ namespace hpx::threads::coroutines::detail::lx {
 
         std::ptrdiff_t m_stack_size;
         void* m_stack;
-
-#if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
-    !defined(HPX_HAVE_ADDRESS_SANITIZER)
-        struct sigaction action;
-        stack_t segv_stack;
-#endif
+        bool m_promoted;
     };
 
     // Free function. Saves the current context in @p from and restores the
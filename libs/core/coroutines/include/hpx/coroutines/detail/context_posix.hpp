@@ -385,6 +385,10 @@ namespace hpx::threads::coroutines {
                 }
             }
 
+            // stacks are always bound for the lifetime of the context
+            static constexpr void release_stack() noexcept {}
+            static constexpr void promote_stack() noexcept {}
+
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             using counter_type = std::atomic<std::int64_t>;
 
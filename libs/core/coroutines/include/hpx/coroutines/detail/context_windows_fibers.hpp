@@ -292,6 +292,10 @@ namespace hpx::threads::coroutines {
             static constexpr void rebind_stack() noexcept {}
 #endif
 
+            // fibers are always bound for the lifetime of the context
+            static constexpr void release_stack() noexcept {}
+            static constexpr void promote_stack() noexcept {}
+
             static std::ptrdiff_t get_available_stack_space() noexcept
             {
                 // Detect remaining stack space (approximate), taken from here:
@@ -78,6 +78,10 @@ namespace hpx::threads::coroutines::detail::posix {
 
     HPX_CORE_EXPORT extern bool use_guard_pages;
 
+    // controls whether the pages of recycled stacks that were used beyond
+    // their first page are given back to the operating system
+    HPX_CORE_EXPORT extern bool release_stacks_on_reset;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
@@ -147,7 +151,8 @@ namespace hpx::threads::coroutines::detail::posix {
 
         // If the watermark has been overwritten, then we've gone past the first
         // page.
-        if ((reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) != *watermark)
+        if (release_stacks_on_reset &&
+            (reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) != *watermark)
         {
             // We never free up the first page, as it's initialized only when the
             // stack is created.
@@ -0,0 +1,174 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/config/cache_line_size.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::coroutines::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Configuration of the coroutine stack pool, initialized from the
+    // [hpx.stacks.pool] configuration section.
+    struct stack_pool_parameters
+    {
+        // the pool is disabled by default, all stacks are directly allocated
+        // from and returned to the operating system
+        bool enabled_ = false;
+
+        // number of stacks per stack class that will be allocated and
+        // pre-faulted for each NUMA domain as soon as the first worker thread
+        // of that domain starts running, the per-domain free lists are trimmed
+        // down to this size whenever they overflow
+        std::size_t low_watermark_ = 0;
+
+        // maximal number of stacks per stack class kept in the free list of
+        // each NUMA domain
+        std::size_t high_watermark_ = 256;
+
+        // maximal number of stacks per stack class each worker thread keeps
+        // without synchronizing with other threads
+        std::size_t thread_cache_size_ = 16;
+
+        // advise the kernel to back pooled stacks with transparent huge pages
+        bool use_huge_pages_ = false;
+
+        // give pages of recycled stacks back to the operating system if the
+        // stack was used beyond its first page (see posix::reset_stack)
+        bool release_on_reset_ = false;
+
+        // bind stacks to threads only while they are running: a thread that
+        // terminates without ever having been suspended hands its stack back
+        // to the pool right away, so that the next thread scheduled on the
+        // same worker runs on the very same (cache-hot) stack. Threads that
+        // suspend are promoted, i.e. they keep their stack until they
+        // terminate. This implies enabled_.
+        bool lazy_binding_ = false;
+
+        // the sizes of the small, medium, large, and huge stacks
+        std::array<std::ptrdiff_t, 4> stack_sizes_ = {{HPX_SMALL_STACK_SIZE,
+            HPX_MEDIUM_STACK_SIZE, HPX_LARGE_STACK_SIZE, HPX_HUGE_STACK_SIZE}};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The stack pool keeps pre-faulted coroutine stacks for reuse. Stacks are
+    // managed per stack class (small/medium/large/huge). Each worker thread
+    // owns a small cache of stacks that is accessed without synchronization,
+    // overflowing caches are spilled to (and empty caches are refilled from)
+    // a free list shared by all worker threads running on the same NUMA
+    // domain.
+    class stack_pool
+    {
+    public:
+        static constexpr std::size_t num_stack_classes = 4;
+
+        HPX_CORE_EXPORT static stack_pool& get() noexcept;
+
+        // (re-)initialize the pool, this releases all currently pooled stacks
+        HPX_CORE_EXPORT void configure(stack_pool_parameters const& params);
+
+        // release all pooled stacks back to the operating system
+        HPX_CORE_EXPORT void clear() noexcept;
+
+        [[nodiscard]] bool enabled() const noexcept
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool lazy_binding() const noexcept
+        {
+            return lazy_binding_.load(std::memory_order_relaxed);
+        }
+
+        // associate the calling (worker) thread with the given NUMA domain,
+        // this pre-faults the free lists of the domain up to the configured
+        // low watermark if this is the first thread bound to it
+        HPX_CORE_EXPORT void bind_thread(std::size_t numa_domain);
+
+        // allocate a stack of the given size, falls back to allocating
+        // directly from the operating system if the pool is disabled or if
+        // the size does not correspond to a known stack class
+        HPX_CORE_EXPORT void* allocate(std::size_t size);
+
+        // return a stack of the given size to the pool
+        HPX_CORE_EXPORT void deallocate(void* stack, std::size_t size) noexcept;
+
+        // record that a thread running on a lazily bound stack was suspended
+        // and therefore keeps its stack
+        HPX_CORE_EXPORT void count_promotion() noexcept;
+
+        // performance counter support
+        HPX_CORE_EXPORT std::int64_t get_hit_count(bool reset) noexcept;
+        HPX_CORE_EXPORT std::int64_t get_miss_count(bool reset) noexcept;
+        HPX_CORE_EXPORT std::int64_t get_resident_bytes(bool reset) noexcept;
+        HPX_CORE_EXPORT std::int64_t get_promotion_count(bool reset) noexcept;
+
+    private:
+        struct thread_cache;
+        friend struct thread_cache;
+
+        stack_pool() = default;
+        ~stack_pool();
+
+        stack_pool(stack_pool const&) = delete;
+        stack_pool(stack_pool&&) = delete;
+        stack_pool& operator=(stack_pool const&) = delete;
+        stack_pool& operator=(stack_pool&&) = delete;
+
+        // returns nullptr if the cache of the calling thread was already
+        // destroyed (i.e. during thread shutdown)
+        static thread_cache* get_thread_cache() noexcept;
+
+        [[nodiscard]] std::size_t get_stack_class(
+            std::size_t size) const noexcept;
+
+        void* allocate_stack(std::size_t size) const;
+        static void free_stack(void* stack, std::size_t size) noexcept;
+
+        void refill(thread_cache& cache, std::size_t stack_class);
+        void spill(thread_cache& cache, std::size_t stack_class,
+            std::size_t count) noexcept;
+        void prefault_domain(std::size_t domain);
+
+        void register_thread_cache(thread_cache* cache) noexcept;
+        void unregister_thread_cache(thread_cache* cache) noexcept;
+
+        struct alignas(threads::get_cache_line_size()) domain_data
+        {
+            hpx::util::detail::spinlock mtx_;
+            std::array<std::vector<void*>, num_stack_classes> stacks_;
+            std::atomic<std::int64_t> resident_bytes_{0};
+            std::atomic<bool> prefaulted_{false};
+        };
+
+        stack_pool_parameters params_;
+        std::atomic<bool> enabled_{false};
+        std::atomic<bool> lazy_binding_{false};
+
+        // incremented on each reconfiguration, thread caches holding stacks
+        // of an older generation release those directly
+        std::atomic<std::size_t> generation_{0};
+
+        std::array<domain_data, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> domains_;
+
+        // all live thread caches, used for collecting the counter values, the
+        // counters of exited threads are accumulated separately
+        hpx::util::detail::spinlock caches_mtx_;
+        thread_cache* caches_ = nullptr;
+        std::atomic<std::int64_t> retired_hits_{0};
+        std::atomic<std::int64_t> retired_misses_{0};
+        std::atomic<std::int64_t> retired_promotions_{0};
+    };
+}    // namespace hpx::threads::coroutines::detail
@@ -18,6 +18,10 @@ namespace hpx::threads::coroutines::detail::posix {
     // this global variable is used to control whether guard pages will be used
     // or not
     bool use_guard_pages = true;
+
+    // this global variable is used to control whether stacks of recycled
+    // threads will be given back to the operating system (madvise)
+    bool release_stacks_on_reset = true;
 }    // namespace hpx::threads::coroutines::detail::posix
 
 #endif
@@ -0,0 +1,578 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+// include unistd.h conditionally to check for POSIX version. Not all OSs have
+// the unistd header...
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#if defined(_POSIX_VERSION) &&                                                 \
+    !(defined(__ARM64_ARCH_8__) && defined(__APPLE__))
+#include <hpx/coroutines/detail/posix_utility.hpp>
+
+#define HPX_STACK_POOL_USE_POSIX_STACK_UTILITIES
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx::threads::coroutines::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct stack_pool::thread_cache
+    {
+        thread_cache() noexcept
+        {
+            stack_pool::get().register_thread_cache(this);
+        }
+
+        thread_cache(thread_cache const&) = delete;
+        thread_cache(thread_cache&&) = delete;
+        thread_cache& operator=(thread_cache const&) = delete;
+        thread_cache& operator=(thread_cache&&) = delete;
+
+        ~thread_cache()
+        {
+            flush();
+            stack_pool::get().unregister_thread_cache(this);
+            destroyed_ = true;
+        }
+
+        // return all cached stacks to the free lists of our NUMA domain
+        void flush() noexcept
+        {
+            stack_pool& pool = stack_pool::get();
+            synchronize(pool);
+            for (std::size_t i = 0; i != num_stack_classes; ++i)
+            {
+                if (!stacks_[i].empty())
+                {
+                    pool.spill(*this, i, stacks_[i].size());
+                }
+            }
+        }
+
+        // release all stacks of a previous configuration generation
+        void synchronize(stack_pool& pool) noexcept
+        {
+            std::size_t const generation =
+                pool.generation_.load(std::memory_order_acquire);
+            if (generation_ == generation)
+                return;
+
+            std::int64_t released = 0;
+            for (std::size_t i = 0; i != num_stack_classes; ++i)
+            {
+                for (void* stack : stacks_[i])
+                {
+                    stack_pool::free_stack(stack, sizes_[i]);
+                    released += static_cast<std::int64_t>(sizes_[i]);
+                }
+                stacks_[i].clear();
+                sizes_[i] = static_cast<std::size_t>(pool.params_.stack_sizes_[i]);
+            }
+            if (released != 0)
+            {
+                resident_bytes_.fetch_sub(released, std::memory_order_relaxed);
+            }
+            generation_ = generation;
+        }
+
+        std::size_t domain_ = 0;
+        std::size_t generation_ = (std::numeric_limits<std::size_t>::max)();
+        std::array<std::size_t, num_stack_classes> sizes_ = {};
+        std::array<std::vector<void*>, num_stack_classes> stacks_;
+
+        // the counters are modified by the owning thread only, they are
+        // atomic to allow for them to be concurrently queried and reset
+        std::atomic<std::int64_t> hits_{0};
+        std::atomic<std::int64_t> misses_{0};
+        std::atomic<std::int64_t> promotions_{0};
+        std::atomic<std::int64_t> resident_bytes_{0};
+
+        // intrusive list of all live thread caches
+        thread_cache* prev_ = nullptr;
+        thread_cache* next_ = nullptr;
+
+        static thread_local bool destroyed_;
+    };
+
+    thread_local bool stack_pool::thread_cache::destroyed_ = false;
+
+    ///////////////////////////////////////////////////////////////////////////
+    stack_pool& stack_pool::get() noexcept
+    {
+        static stack_pool pool;
+        return pool;
+    }
+
+    stack_pool::~stack_pool()
+    {
+        clear();
+    }
+
+    stack_pool::thread_cache* stack_pool::get_thread_cache() noexcept
+    {
+        if (thread_cache::destroyed_)
+            return nullptr;
+
+        thread_local thread_cache cache;
+        return &cache;
+    }
+
+    void stack_pool::register_thread_cache(thread_cache* cache) noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(caches_mtx_);
+        cache->next_ = caches_;
+        if (caches_ != nullptr)
+        {
+            caches_->prev_ = cache;
+        }
+        caches_ = cache;
+    }
+
+    void stack_pool::unregister_thread_cache(thread_cache* cache) noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(caches_mtx_);
+        if (cache->prev_ != nullptr)
+        {
+            cache->prev_->next_ = cache->next_;
+        }
+        else
+        {
+            caches_ = cache->next_;
+        }
+        if (cache->next_ != nullptr)
+        {
+            cache->next_->prev_ = cache->prev_;
+        }
+
+        retired_hits_.fetch_add(
+            cache->hits_.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+        retired_misses_.fetch_add(
+            cache->misses_.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+        retired_promotions_.fetch_add(
+            cache->promotions_.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void stack_pool::configure(stack_pool_parameters const& params)
+    {
+        enabled_.store(false, std::memory_order_release);
+        lazy_binding_.store(false, std::memory_order_release);
+
+        clear();
+
+        params_ = params;
+        if (params_.lazy_binding_)
+        {
+            params_.enabled_ = true;
+        }
+        if (params_.thread_cache_size_ == 0)
+        {
+            params_.thread_cache_size_ = 1;
+        }
+        if (params_.high_watermark_ < params_.low_watermark_)
+        {
+            params_.high_watermark_ = params_.low_watermark_;
+        }
+
+#if defined(HPX_STACK_POOL_USE_POSIX_STACK_UTILITIES)
+        // recycled threads keep their stacks resident if the pool is active
+        posix::release_stacks_on_reset =
+            !params_.enabled_ || params_.release_on_reset_;
+#endif
+
+        for (domain_data& d : domains_)
+        {
+            d.prefaulted_.store(false, std::memory_order_relaxed);
+        }
+
+        generation_.fetch_add(1, std::memory_order_release);
+
+        // the cache of the calling thread can be released right away
+        if (thread_cache* cache = get_thread_cache(); cache != nullptr)
+        {
+            cache->synchronize(*this);
+        }
+
+        enabled_.store(params_.enabled_, std::memory_order_release);
+        lazy_binding_.store(params_.lazy_binding_, std::memory_order_release);
+    }
+
+    void stack_pool::clear() noexcept
+    {
+        for (domain_data& d : domains_)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(d.mtx_);
+            for (std::size_t i = 0; i != num_stack_classes; ++i)
+            {
+                auto const size =
+                    static_cast<std::size_t>(params_.stack_sizes_[i]);
+                for (void* stack : d.stacks_[i])
+                {
+                    free_stack(stack, size);
+                    d.resident_bytes_.fetch_sub(
+                        static_cast<std::int64_t>(size),
+                        std::memory_order_relaxed);
+                }
+                d.stacks_[i].clear();
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void stack_pool::bind_thread(std::size_t numa_domain)
+    {
+        thread_cache* cache = get_thread_cache();
+        if (cache == nullptr)
+            return;
+
+        numa_domain = (std::min)(numa_domain,
+            static_cast<std::size_t>(HPX_HAVE_MAX_NUMA_DOMAIN_COUNT - 1));
+
+        if (cache->domain_ != numa_domain)
+        {
+            cache->flush();
+            cache->domain_ = numa_domain;
+        }
+
+        if (enabled() && params_.low_watermark_ != 0 &&
+            !domains_[numa_domain].prefaulted_.exchange(true))
+        {
+            prefault_domain(numa_domain);
+        }
+    }
+
+    // Fill the free lists of the given domain up to the low watermark. This is
+    // executed by the first worker thread bound to the domain, which makes
+    // sure the stack memory is first touched (and therefore placed) on that
+    // domain.
+    void stack_pool::prefault_domain(std::size_t domain)
+    {
+        domain_data& d = domains_[domain];
+        for (std::size_t i = 0; i != num_stack_classes; ++i)
+        {
+            auto const size = static_cast<std::size_t>(params_.stack_sizes_[i]);
+
+            std::vector<void*> stacks;
+            stacks.reserve(params_.low_watermark_);
+            for (std::size_t j = 0; j != params_.low_watermark_; ++j)
+            {
+                stacks.push_back(allocate_stack(size));
+            }
+
+            std::lock_guard<hpx::util::detail::spinlock> l(d.mtx_);
+            d.stacks_[i].insert(d.stacks_[i].end(), stacks.begin(), stacks.end());
+            d.resident_bytes_.fetch_add(
+                static_cast<std::int64_t>(size * stacks.size()),
+                std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t stack_pool::get_stack_class(std::size_t size) const noexcept
+    {
+        for (std::size_t i = 0; i != num_stack_classes; ++i)
+        {
+            if (static_cast<std::size_t>(params_.stack_sizes_[i]) == size)
+                return i;
+        }
+        return num_stack_classes;
+    }
+
+    void* stack_pool::allocate(std::size_t size)
+    {
+        std::size_t const stack_class = get_stack_class(size);
+        thread_cache* cache = nullptr;
+        if (!enabled() || stack_class == num_stack_classes ||
+            (cache = get_thread_cache()) == nullptr)
+        {
+#if defined(HPX_STACK_POOL_USE_POSIX_STACK_UTILITIES)
+            return posix::alloc_stack(size);
+#else
+            return allocate_stack(size);
+#endif
+        }
+
+        cache->synchronize(*this);
+
+        std::vector<void*>& stacks = cache->stacks_[stack_class];
+        if (stacks.empty())
+        {
+            refill(*cache, stack_class);
+        }
+
+        if (!stacks.empty())
+        {
+            void* stack = stacks.back();
+            stacks.pop_back();
+
+            cache->hits_.fetch_add(1, std::memory_order_relaxed);
+            cache->resident_bytes_.fetch_sub(
+                static_cast<std::int64_t>(size), std::memory_order_relaxed);
+            return stack;
+        }
+
+        cache->misses_.fetch_add(1, std::memory_order_relaxed);
+        return allocate_stack(size);
+    }
+
+    void stack_pool::deallocate(void* stack, std::size_t size) noexcept
+    {
+        HPX_ASSERT(stack != nullptr);
+
+        std::size_t const stack_class = get_stack_class(size);
+        thread_cache* cache = nullptr;
+        if (!enabled() || stack_class == num_stack_classes ||
+            (cache = get_thread_cache()) == nullptr)
+        {
+            free_stack(stack, size);
+            return;
+        }
+
+        cache->synchronize(*this);
+
+        std::vector<void*>& stacks = cache->stacks_[stack_class];
+        if (stacks.size() >= params_.thread_cache_size_)
+        {
+            // keep half of the cached stacks to avoid ping-ponging between
+            // the thread cache and the domain free list
+            spill(*cache, stack_class, stacks.size() - stacks.size() / 2);
+        }
+
+        // reserve the capacity up front such that the push_back below never
+        // needs to allocate
+        if (stacks.capacity() < params_.thread_cache_size_)
+        {
+            try
+            {
+                stacks.reserve(params_.thread_cache_size_);
+            }
+            catch (std::bad_alloc const&)
+            {
+                free_stack(stack, size);
+                return;
+            }
+        }
+
+        stacks.push_back(stack);
+        cache->resident_bytes_.fetch_add(
+            static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    }
+
+    void stack_pool::count_promotion() noexcept
+    {
+        if (thread_cache* cache = get_thread_cache(); cache != nullptr)
+        {
+            cache->promotions_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // move up to half of a thread cache's capacity from the domain free list
+    // to the thread cache
+    void stack_pool::refill(thread_cache& cache, std::size_t stack_class)
+    {
+        std::vector<void*>& stacks = cache.stacks_[stack_class];
+        stacks.reserve(params_.thread_cache_size_);
+
+        std::size_t const count =
+            (std::max)(params_.thread_cache_size_ / 2, std::size_t(1));
+
+        domain_data& d = domains_[cache.domain_];
+
+        std::lock_guard<hpx::util::detail::spinlock> l(d.mtx_);
+
+        std::vector<void*>& domain_stacks = d.stacks_[stack_class];
+        std::size_t const num_stacks = (std::min)(count, domain_stacks.size());
+
+        stacks.insert(
+            stacks.end(), domain_stacks.end() - num_stacks, domain_stacks.end());
+        domain_stacks.resize(domain_stacks.size() - num_stacks);
+
+        auto const moved = static_cast<std::int64_t>(
+            cache.sizes_[stack_class] * num_stacks);
+        d.resident_bytes_.fetch_sub(moved, std::memory_order_relaxed);
+        cache.resident_bytes_.fetch_add(moved, std::memory_order_relaxed);
+    }
+
+    // move the given number of stacks from the thread cache to the domain
+    // free list, if the domain free list grows beyond the high watermark,
+    // it is trimmed down to the low watermark
+    void stack_pool::spill(thread_cache& cache, std::size_t stack_class,
+        std::size_t count) noexcept
+    {
+        std::vector<void*>& stacks = cache.stacks_[stack_class];
+        HPX_ASSERT(count <= stacks.size());
+
+        auto const size = cache.sizes_[stack_class];
+        domain_data& d = domains_[cache.domain_];
+
+        std::lock_guard<hpx::util::detail::spinlock> l(d.mtx_);
+
+        std::vector<void*>& domain_stacks = d.stacks_[stack_class];
+        cache.resident_bytes_.fetch_sub(
+            static_cast<std::int64_t>(size * count), std::memory_order_relaxed);
+        d.resident_bytes_.fetch_add(
+            static_cast<std::int64_t>(size * count), std::memory_order_relaxed);
+
+        std::size_t released = 0;
+        while (count-- != 0)
+        {
+            void* stack = stacks.back();
+            stacks.pop_back();
+
+            if (domain_stacks.size() < params_.high_watermark_)
+            {
+                try
+                {
+                    domain_stacks.push_back(stack);
+                    continue;
+                }
+                // NOLINTNEXTLINE(bugprone-empty-catch)
+                catch (std::bad_alloc const&)
+                {
+                }
+            }
+
+            free_stack(stack, size);
+            ++released;
+        }
+
+        if (domain_stacks.size() >= params_.high_watermark_)
+        {
+            while (domain_stacks.size() > params_.low_watermark_)
+            {
+                free_stack(domain_stacks.back(), size);
+                domain_stacks.pop_back();
+                ++released;
+            }
+        }
+
+        if (released != 0)
+        {
+            d.resident_bytes_.fetch_sub(
+                static_cast<std::int64_t>(size * released),
+                std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* stack_pool::allocate_stack(std::size_t size) const
+    {
+#if defined(HPX_STACK_POOL_USE_POSIX_STACK_UTILITIES)
+        void* stack = posix::alloc_stack(size);
+
+#if defined(MADV_HUGEPAGE)
+        if (params_.use_huge_pages_)
+        {
+            ::madvise(stack, size, MADV_HUGEPAGE);
+        }
+#endif
+
+        // Pre-fault the top of the stack (where the coroutine starts
+        // executing) up to the size of a small stack, this avoids taking page
+        // faults while running the first few tasks on a pooled stack.
+        std::size_t const page_size = EXEC_PAGESIZE;
+        std::size_t const prefault_size = (std::min)(
+            size, static_cast<std::size_t>(params_.stack_sizes_[0]));
+
+        char* const top = static_cast<char*>(stack) + size;
+        for (std::size_t offset = page_size; offset <= prefault_size;
+            offset += page_size)
+        {
+            *static_cast<char volatile*>(top - offset) = 0;
+        }
+        return stack;
+#else
+        void* stack = std::calloc(size, sizeof(char));
+        if (stack == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return stack;
+#endif
+    }
+
+    void stack_pool::free_stack(void* stack, std::size_t size) noexcept
+    {
+#if defined(HPX_STACK_POOL_USE_POSIX_STACK_UTILITIES)
+        posix::free_stack(stack, size);
+#else
+        (void) size;
+        std::free(stack);
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t stack_pool::get_hit_count(bool reset) noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(caches_mtx_);
+        std::int64_t result = util::get_and_reset_value(retired_hits_, reset);
+        for (thread_cache* c = caches_; c != nullptr; c = c->next_)
+        {
+            result += util::get_and_reset_value(c->hits_, reset);
+        }
+        return result;
+    }
+
+    std::int64_t stack_pool::get_miss_count(bool reset) noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(caches_mtx_);
+        std::int64_t result = util::get_and_reset_value(retired_misses_, reset);
+        for (thread_cache* c = caches_; c != nullptr; c = c->next_)
+        {
+            result += util::get_and_reset_value(c->misses_, reset);
+        }
+        return result;
+    }
+
+    std::int64_t stack_pool::get_promotion_count(bool reset) noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(caches_mtx_);
+        std::int64_t result =
+            util::get_and_reset_value(retired_promotions_, reset);
+        for (thread_cache* c = caches_; c != nullptr; c = c->next_)
+        {
+            result += util::get_and_reset_value(c->promotions_, reset);
+        }
+        return result;
+    }
+
+    std::int64_t stack_pool::get_resident_bytes(bool) noexcept
+    {
+        std::int64_t result = 0;
+        for (domain_data const& d : domains_)
+        {
+            result += d.resident_bytes_.load(std::memory_order_relaxed);
+        }
+
+        std::lock_guard<hpx::util::detail::spinlock> l(caches_mtx_);
+        for (thread_cache* c = caches_; c != nullptr; c = c->next_)
+        {
+            result += c->resident_bytes_.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+}    // namespace hpx::threads::coroutines::detail
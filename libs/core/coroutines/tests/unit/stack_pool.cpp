@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using hpx::threads::coroutines::detail::stack_pool;
+using hpx::threads::coroutines::detail::stack_pool_parameters;
+
+constexpr std::size_t small_size = HPX_SMALL_STACK_SIZE;
+
+void test_disabled()
+{
+    stack_pool& pool = stack_pool::get();
+
+    stack_pool_parameters params;
+    params.enabled_ = false;
+    pool.configure(params);
+
+    void* stack = pool.allocate(small_size);
+    HPX_TEST(stack != nullptr);
+    pool.deallocate(stack, small_size);
+
+    HPX_TEST_EQ(pool.get_hit_count(true), 0);
+    HPX_TEST_EQ(pool.get_miss_count(true), 0);
+    HPX_TEST_EQ(pool.get_resident_bytes(false), 0);
+}
+
+void test_reuse()
+{
+    stack_pool& pool = stack_pool::get();
+
+    stack_pool_parameters params;
+    params.enabled_ = true;
+    params.thread_cache_size_ = 4;
+    params.high_watermark_ = 8;
+    pool.configure(params);
+
+    // the pool is empty, the first allocation is a miss
+    void* stack = pool.allocate(small_size);
+    HPX_TEST(stack != nullptr);
+    HPX_TEST_EQ(pool.get_miss_count(true), 1);
+
+    pool.deallocate(stack, small_size);
+    HPX_TEST_EQ(pool.get_resident_bytes(false),
+        static_cast<std::int64_t>(small_size));
+
+    // the stack is handed out again from the thread cache
+    void* reused = pool.allocate(small_size);
+    HPX_TEST_EQ(reused, stack);
+    HPX_TEST_EQ(pool.get_hit_count(true), 1);
+    HPX_TEST_EQ(pool.get_resident_bytes(false), 0);
+
+    // stacks of unknown sizes bypass the pool
+    void* other = pool.allocate(2 * small_size + 4096);
+    pool.deallocate(other, 2 * small_size + 4096);
+    HPX_TEST_EQ(pool.get_miss_count(true), 0);
+    HPX_TEST_EQ(pool.get_resident_bytes(false), 0);
+
+    pool.deallocate(reused, small_size);
+}
+
+void test_watermarks()
+{
+    stack_pool& pool = stack_pool::get();
+
+    stack_pool_parameters params;
+    params.enabled_ = true;
+    params.thread_cache_size_ = 2;
+    params.low_watermark_ = 1;
+    params.high_watermark_ = 4;
+    pool.configure(params);
+
+    std::vector<void*> stacks;
+    for (std::size_t i = 0; i != 16; ++i)
+    {
+        stacks.push_back(pool.allocate(small_size));
+    }
+    HPX_TEST_EQ(pool.get_miss_count(true), 16);
+
+    for (void* stack : stacks)
+    {
+        pool.deallocate(stack, small_size);
+    }
+
+    // the thread cache and the domain free list are bounded
+    std::int64_t const max_resident =
+        static_cast<std::int64_t>((2 + 4) * small_size);
+    HPX_TEST_LTE(pool.get_resident_bytes(false), max_resident);
+    HPX_TEST_LT(0, pool.get_resident_bytes(false));
+
+    // stacks are handed to other threads through the domain free list
+    std::thread t([&]() {
+        void* stack = pool.allocate(small_size);
+        pool.deallocate(stack, small_size);
+    });
+    t.join();
+    HPX_TEST_EQ(pool.get_hit_count(true), 1);
+
+    pool.clear();
+}
+
+void test_prefault()
+{
+    stack_pool& pool = stack_pool::get();
+
+    stack_pool_parameters params;
+    params.enabled_ = true;
+    params.low_watermark_ = 2;
+    pool.configure(params);
+
+    std::thread t([&]() {
+        pool.bind_thread(0);
+
+        void* stack = pool.allocate(small_size);
+        pool.deallocate(stack, small_size);
+    });
+    t.join();
+
+    HPX_TEST_EQ(pool.get_hit_count(true), 1);
+    HPX_TEST_EQ(pool.get_miss_count(true), 0);
+
+    params.enabled_ = false;
+    pool.configure(params);
+    HPX_TEST_EQ(pool.get_resident_bytes(false), 0);
+}
+
+void test_lazy_binding()
+{
+    stack_pool& pool = stack_pool::get();
+
+    // lazily binding stacks implies enabling the pool
+    stack_pool_parameters params;
+    params.lazy_binding_ = true;
+    pool.configure(params);
+
+    HPX_TEST(pool.enabled());
+    HPX_TEST(pool.lazy_binding());
+
+    pool.count_promotion();
+    pool.count_promotion();
+
+    // the counts of exited threads are retained
+    std::thread t([&]() { pool.count_promotion(); });
+    t.join();
+
+    HPX_TEST_EQ(pool.get_promotion_count(true), 3);
+    HPX_TEST_EQ(pool.get_promotion_count(false), 0);
+
+    params.lazy_binding_ = false;
+    pool.configure(params);
+    HPX_TEST(!pool.enabled());
+    HPX_TEST(!pool.lazy_binding());
+}
+
+int main()
+{
+    test_disabled();
+    test_reuse();
+    test_watermarks();
+    test_prefault();
+    test_lazy_binding();
+
+    return hpx::util::report_errors();
+}
@@ -14,13 +14,16 @@
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/threading_base/detail/get_default_pool.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::detail {
 
@@ -206,4 +209,97 @@ namespace hpx::detail {
                 HPX_FORWARD(Ts, ts)...);
         }
     };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Collects tasks which are posted with an asynchronous launch policy and
+    // submits them to their thread pool at once (see
+    // threads::register_bulk_work), which requires only a single
+    // synchronization operation on each of the targeted queues. Tasks posted
+    // with any other launch policy are dispatched right away.
+    template <typename Launch>
+    class post_policy_batch
+    {
+        template <typename Policy>
+        static constexpr bool is_async(Policy const& policy) noexcept
+        {
+            if constexpr (std::is_same_v<Launch, launch::async_policy>)
+            {
+                return true;
+            }
+            else if constexpr (std::is_same_v<Launch, launch::sync_policy> ||
+                std::is_same_v<Launch, launch::deferred_policy> ||
+                std::is_same_v<Launch, launch::fork_policy>)
+            {
+                return false;
+            }
+            else
+            {
+                return !(policy == launch::sync || policy == launch::deferred ||
+                    policy == launch::fork);
+            }
+        }
+
+    public:
+        explicit post_policy_batch(std::size_t capacity = 0)
+        {
+            data_.reserve(capacity);
+        }
+
+        post_policy_batch(post_policy_batch const&) = delete;
+        post_policy_batch(post_policy_batch&&) = delete;
+        post_policy_batch& operator=(post_policy_batch const&) = delete;
+        post_policy_batch& operator=(post_policy_batch&&) = delete;
+
+        ~post_policy_batch() = default;
+
+        template <typename Policy, typename F, typename... Ts>
+        void post(Policy&& policy,
+            hpx::threads::thread_description const& desc,
+            threads::thread_pool_base* pool, F&& f, Ts&&... ts)
+        {
+            HPX_ASSERT(pool != nullptr);
+            HPX_ASSERT(pool_ == nullptr || pool_ == pool);
+
+            if (!is_async(policy))
+            {
+                post_policy_dispatch<Launch>::call(HPX_FORWARD(Policy, policy),
+                    desc, pool, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+                return;
+            }
+
+            // run_as_child doesn't make sense if we _post_ a tasks
+            auto hint = policy.hint();
+            if (hint.runs_as_child_mode() ==
+                hpx::threads::thread_execution_hint::run_as_child)
+            {
+                hint.runs_as_child_mode(
+                    hpx::threads::thread_execution_hint::none);
+            }
+
+            data_.emplace_back(
+                threads::make_thread_function_nullary(hpx::util::deferred_call(
+                    HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...)),
+                desc, policy.priority(), hint, policy.stacksize(),
+                threads::thread_schedule_state::pending);
+            pool_ = pool;
+        }
+
+        // create the threads for all collected tasks
+        void submit()
+        {
+            if (data_.size() == 1)
+            {
+                threads::register_work(data_.front(), pool_);
+            }
+            else if (!data_.empty())
+            {
+                threads::register_bulk_work(data_, pool_);
+            }
+            data_.clear();
+        }
+
+    private:
+        std::vector<threads::thread_init_data> data_;
+        threads::thread_pool_base* pool_ = nullptr;
+    };
 }    // namespace hpx::detail
@@ -0,0 +1,334 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+/// \page hpx::execution::experimental::adaptive_chunk_size
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assertion/source_location.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The ways \a adaptive_chunk_size can partition the iterations of a
+    /// loop.
+    enum class adaptive_schedule : std::uint8_t
+    {
+        /// one chunk per core, used for loops with uniform iteration cost
+        static_chunks = 0,
+
+        /// four chunks per core, leaving some room for work stealing to
+        /// compensate for moderate imbalance
+        balanced_chunks = 1,
+
+        /// many small chunks (but none running for less than the minimal
+        /// chunk time), relying on work stealing to balance skewed loops
+        stealing_chunks = 2
+    };
+
+    /// Return a readable name for the given schedule
+    HPX_CORE_EXPORT char const* get_adaptive_schedule_name(
+        adaptive_schedule schedule) noexcept;
+
+    /// The schedule \a adaptive_chunk_size has chosen for the last
+    /// invocation of a loop, together with the data it based its decision
+    /// on.
+    struct adaptive_schedule_info
+    {
+        adaptive_schedule schedule = adaptive_schedule::balanced_chunks;
+        std::size_t cores = 0;
+        std::size_t chunk_size = 0;
+
+        // estimated execution time of one iteration
+        std::chrono::nanoseconds iteration_time{0};
+
+        // coefficient of variation of the sampled iteration times
+        double skew = 0.0;
+
+        // number of loop invocations seen so far
+        std::size_t invocations = 0;
+    };
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Timing history of one loop, shared by all copies of an
+        // adaptive_chunk_size object (and by all objects constructed with
+        // the same name).
+        class HPX_CORE_EXPORT adaptive_chunk_size_history
+        {
+        public:
+            static constexpr std::size_t num_schedules = 3;
+
+            // Record the per-iteration times (in nanoseconds) measured for
+            // num_samples chunks of the current invocation, covering
+            // num_iterations iterations overall. Returns the estimated
+            // execution time of one iteration.
+            std::uint64_t record_samples(std::uint64_t const* samples,
+                std::size_t num_samples, std::size_t num_iterations);
+
+            // Return the learned execution time of one iteration (in
+            // nanoseconds), zero if nothing is known yet.
+            std::uint64_t iteration_time() const;
+
+            // Return the number of cores to use for count iterations
+            std::size_t select_cores(std::uint64_t iteration_time,
+                std::size_t available_cores, std::size_t count) const;
+
+            // Choose the schedule for the current invocation and return the
+            // resulting chunk size
+            std::size_t select_chunk_size(std::uint64_t iteration_time,
+                std::size_t cores, std::size_t count);
+
+            void begin_execution();
+            void end_execution();
+
+            adaptive_schedule_info get_info() const;
+
+        private:
+            adaptive_schedule select_schedule() const;
+
+            using mutex_type = hpx::util::spinlock;
+            mutable mutex_type mtx_;
+
+            // exponentially weighted averages of the measurements
+            double iteration_time_ = 0.0;    // nanoseconds
+            double skew_ = 0.0;
+
+            // observed wall clock time per iteration for each schedule
+            std::array<double, num_schedules> cost_ = {};
+            std::array<std::size_t, num_schedules> trials_ = {};
+
+            std::size_t invocations_ = 0;
+
+            // the state of the current (most recent) invocation
+            adaptive_schedule schedule_ = adaptive_schedule::balanced_chunks;
+            std::size_t cores_ = 0;
+            std::size_t chunk_size_ = 0;
+            std::size_t count_ = 0;
+            std::uint64_t start_ = 0;
+        };
+
+        // Return the history registered for the given name, creating it if
+        // necessary. Named histories live until the end of the program.
+        HPX_CORE_EXPORT std::shared_ptr<adaptive_chunk_size_history>
+        get_adaptive_chunk_size_history(std::string const& name);
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces based on a timing history
+    /// which is kept across invocations of the same loop. Every invocation
+    /// measures a few small chunks at the beginning of the iteration space
+    /// to estimate the cost of one iteration and its variation (skew). The
+    /// overall execution time of each invocation is recorded for the
+    /// schedule which was used.
+    ///
+    /// Based on this, the number of cores is limited such that every core
+    /// receives a reasonable amount of work, and the loop is partitioned
+    /// statically (one chunk per core), into four chunks per core, or into
+    /// many small chunks balanced by work stealing. Schedules which were not
+    /// tried yet are explored first (starting with the one suggested by the
+    /// measured skew), afterwards the schedule with the lowest observed
+    /// execution time is used, re-validating the runner-up from time to
+    /// time.
+    ///
+    /// All copies of an \a adaptive_chunk_size object share their history.
+    /// Objects constructed with the same name (or source location) share
+    /// their history as well, even if they are created anew for every
+    /// invocation of the loop.
+    ///
+    /// \note Concurrent invocations of the same loop are supported, but the
+    ///       overall execution times recorded for them are less accurate.
+    ///
+    struct adaptive_chunk_size
+    {
+    public:
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        /// with a history which is shared by all of its copies.
+        adaptive_chunk_size()
+          : history_(std::make_shared<detail::adaptive_chunk_size_history>())
+        {
+        }
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        /// using the history registered for the given name.
+        ///
+        /// \param name     [in] The name identifying the loop.
+        ///
+        explicit adaptive_chunk_size(std::string name)
+          : history_(detail::get_adaptive_chunk_size_history(name))
+          , name_(HPX_MOVE(name))
+        {
+        }
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        /// using the history registered for the given source location,
+        /// for instance HPX_CURRENT_SOURCE_LOCATION().
+        ///
+        /// \param loc      [in] The source location identifying the loop.
+        ///
+        explicit adaptive_chunk_size(hpx::source_location const& loc)
+          : adaptive_chunk_size(std::string(loc.file_name()) + ":" +
+                std::to_string(loc.line()))
+        {
+        }
+
+        /// Return the schedule chosen for the most recent invocation of the
+        /// loop.
+        adaptive_schedule_info get_schedule() const
+        {
+            return history_->get_info();
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type synchronously invokes the provided
+        // testing function in order to sample the iteration times.
+        using invokes_testing_function = std::true_type;
+
+        // Number of chunks to sample for each invocation, and once enough
+        // is known about the loop.
+        static constexpr std::size_t num_samples = 8;
+        static constexpr std::size_t num_samples_trained = 2;
+
+        // Estimate execution time for one iteration and its skew
+        template <typename Executor, typename F>
+        friend std::chrono::nanoseconds tag_override_invoke(
+            hpx::execution::experimental::measure_iteration_t,
+            adaptive_chunk_size const& this_, Executor&&, F&& f,
+            std::size_t count)
+        {
+            detail::adaptive_chunk_size_history& history = *this_.history_;
+
+            // sample 1% of the iterations, split into several chunks
+            std::size_t const samples = history.iteration_time() == 0 ?
+                num_samples :
+                num_samples_trained;
+            std::size_t const sample_size = count / (100 * samples);
+            if (sample_size == 0)
+            {
+                return std::chrono::nanoseconds(history.iteration_time());
+            }
+
+            std::array<std::uint64_t, num_samples> times;
+            std::size_t measured = 0;
+            std::size_t iterations = 0;
+
+            using hpx::chrono::high_resolution_clock;
+            for (std::size_t i = 0; i != samples; ++i)
+            {
+                std::uint64_t const t = high_resolution_clock::now();
+                std::size_t const n = f(sample_size);
+                if (n == 0)
+                {
+                    break;
+                }
+
+                times[measured++] = (high_resolution_clock::now() - t) / n;
+                iterations += n;
+            }
+
+            return std::chrono::nanoseconds(
+                history.record_samples(times.data(), measured, iterations));
+        }
+
+        // Limit the number of cores to use based on the overall amount of
+        // work.
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::execution::experimental::processing_units_count_t,
+            adaptive_chunk_size const& this_, Executor&& exec,
+            hpx::chrono::steady_duration const& iteration_duration,
+            std::size_t count)
+        {
+            std::size_t const available_cores =
+                hpx::execution::experimental::processing_units_count(
+                    exec, iteration_duration, count);
+
+            auto const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    iteration_duration.value());
+            return this_.history_->select_cores(
+                ns.count(), available_cores, count);
+        }
+
+        // Choose the schedule and return the corresponding chunk size
+        template <typename Executor>
+        friend std::size_t tag_override_invoke(
+            hpx::execution::experimental::get_chunk_size_t,
+            adaptive_chunk_size const& this_, Executor&,
+            hpx::chrono::steady_duration const& iteration_duration,
+            std::size_t cores, std::size_t count)
+        {
+            auto const ns =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    iteration_duration.value());
+            return this_.history_->select_chunk_size(ns.count(), cores, count);
+        }
+
+        // Record the overall execution time of the loop
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::execution::experimental::mark_begin_execution_t,
+            adaptive_chunk_size const& this_, Executor&&)
+        {
+            this_.history_->begin_execution();
+        }
+
+        template <typename Executor>
+        friend void tag_override_invoke(
+            hpx::execution::experimental::mark_end_execution_t,
+            adaptive_chunk_size const& this_, Executor&&)
+        {
+            this_.history_->end_execution();
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        // The history itself is local to a process, only named histories
+        // are reconnected after deserialization.
+        HPX_CORE_EXPORT void load(serialization::input_archive& ar, unsigned);
+        HPX_CORE_EXPORT void save(
+            serialization::output_archive& ar, unsigned) const;
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::shared_ptr<detail::adaptive_chunk_size_history> history_;
+        std::string name_;
+        /// \endcond
+    };
+
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::adaptive_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,345 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace hpx::execution::experimental {
+
+    char const* get_adaptive_schedule_name(adaptive_schedule schedule) noexcept
+    {
+        switch (schedule)
+        {
+        case adaptive_schedule::static_chunks:
+            return "static";
+
+        case adaptive_schedule::balanced_chunks:
+            return "balanced";
+
+        case adaptive_schedule::stealing_chunks:
+            return "stealing";
+
+        default:
+            break;
+        }
+        return "unknown";
+    }
+
+    namespace detail {
+
+        namespace {
+
+            // weight of a new measurement in the running averages
+            constexpr double alpha = 0.5;
+
+            // a sampled skew below these limits suggests the static
+            // (balanced) schedule
+            constexpr double static_skew_limit = 0.1;
+            constexpr double balanced_skew_limit = 0.5;
+
+            // every core should receive at least this much work
+            constexpr double min_core_time = 100000.0;    // nanoseconds
+
+            // chunks of the stealing schedule should run at least this long
+            // to amortize the overhead of creating them
+            constexpr double min_chunk_time = 20000.0;    // nanoseconds
+
+            // re-validate the second best schedule every so many invocations
+            constexpr std::size_t explore_interval = 16;
+
+            constexpr std::size_t chunks_per_core(
+                adaptive_schedule schedule) noexcept
+            {
+                switch (schedule)
+                {
+                case adaptive_schedule::static_chunks:
+                    return 1;
+
+                case adaptive_schedule::balanced_chunks:
+                    return 4;    // -V112
+
+                case adaptive_schedule::stealing_chunks:
+                    [[fallthrough]];
+                default:
+                    break;
+                }
+                return 16;
+            }
+
+            double update(double average, double value, bool first) noexcept
+            {
+                return first ? value : (1.0 - alpha) * average + alpha * value;
+            }
+        }    // namespace
+
+        ///////////////////////////////////////////////////////////////////////
+        std::uint64_t adaptive_chunk_size_history::record_samples(
+            std::uint64_t const* samples, std::size_t num_samples,
+            std::size_t num_iterations)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            if (num_samples == 0)
+            {
+                return static_cast<std::uint64_t>(iteration_time_);
+            }
+
+            double mean = 0.0;
+            for (std::size_t i = 0; i != num_samples; ++i)
+            {
+                mean += static_cast<double>(samples[i]);
+            }
+            mean /= static_cast<double>(num_samples);
+
+            bool const first = iteration_time_ == 0.0;
+            if (num_samples > 1 && mean != 0.0)
+            {
+                double variance = 0.0;
+                for (std::size_t i = 0; i != num_samples; ++i)
+                {
+                    double const d = static_cast<double>(samples[i]) - mean;
+                    variance += d * d;
+                }
+                variance /= static_cast<double>(num_samples - 1);
+
+                skew_ = update(skew_, std::sqrt(variance) / mean, first);
+            }
+
+            iteration_time_ = update(iteration_time_, mean, first);
+            count_ += num_iterations;
+
+            return static_cast<std::uint64_t>(iteration_time_);
+        }
+
+        std::uint64_t adaptive_chunk_size_history::iteration_time() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return static_cast<std::uint64_t>(iteration_time_);
+        }
+
+        std::size_t adaptive_chunk_size_history::select_cores(
+            std::uint64_t iteration_time, std::size_t available_cores,
+            std::size_t count) const
+        {
+            if (iteration_time == 0)
+            {
+                iteration_time = this->iteration_time();
+                if (iteration_time == 0)
+                {
+                    return available_cores;
+                }
+            }
+
+            double const work = static_cast<double>(iteration_time) *
+                static_cast<double>(count);
+            auto const cores = static_cast<std::size_t>(work / min_core_time);
+
+            return (std::clamp)(cores, std::size_t(1),
+                (std::max)(available_cores, std::size_t(1)));
+        }
+
+        std::size_t adaptive_chunk_size_history::select_chunk_size(
+            std::uint64_t iteration_time, std::size_t cores, std::size_t count)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            if (iteration_time == 0)
+            {
+                iteration_time = static_cast<std::uint64_t>(iteration_time_);
+            }
+            if (cores == 0)
+            {
+                cores = 1;
+            }
+
+            adaptive_schedule const schedule = cores == 1 ?
+                adaptive_schedule::static_chunks :
+                select_schedule();
+
+            std::size_t const num_chunks = chunks_per_core(schedule) * cores;
+            std::size_t chunk_size = (count + num_chunks - 1) / num_chunks;
+
+            if (schedule == adaptive_schedule::stealing_chunks &&
+                iteration_time != 0)
+            {
+                // don't create chunks which are too small to amortize their
+                // overheads, but not larger than the balanced ones either
+                auto const min_chunk_size = static_cast<std::size_t>(
+                    std::ceil(min_chunk_time /
+                        static_cast<double>(iteration_time)));
+
+                std::size_t const num_balanced = cores *
+                    chunks_per_core(adaptive_schedule::balanced_chunks);
+
+                chunk_size = (std::min)((std::max)(chunk_size, min_chunk_size),
+                    (count + num_balanced - 1) / num_balanced);
+            }
+
+            chunk_size = (std::max)(chunk_size, std::size_t(1));
+
+            ++invocations_;
+            schedule_ = schedule;
+            cores_ = cores;
+            chunk_size_ = chunk_size;
+            count_ += count;
+
+            return chunk_size;
+        }
+
+        adaptive_schedule adaptive_chunk_size_history::select_schedule() const
+        {
+            // nothing is known about this loop yet
+            if (iteration_time_ == 0.0)
+            {
+                return adaptive_schedule::balanced_chunks;
+            }
+
+            // start with the schedule suggested by the sampled skew
+            std::size_t guess = 2;
+            if (skew_ < static_skew_limit)
+            {
+                guess = 0;
+            }
+            else if (skew_ < balanced_skew_limit)
+            {
+                guess = 1;
+            }
+
+            if (trials_[guess] == 0)
+            {
+                return static_cast<adaptive_schedule>(guess);
+            }
+
+            // explore the remaining schedules, closest to the guess first
+            for (std::size_t d = 1; d != num_schedules; ++d)
+            {
+                if (guess >= d && trials_[guess - d] == 0)
+                {
+                    return static_cast<adaptive_schedule>(guess - d);
+                }
+                if (guess + d < num_schedules && trials_[guess + d] == 0)
+                {
+                    return static_cast<adaptive_schedule>(guess + d);
+                }
+            }
+
+            // use the fastest schedule observed so far, occasionally giving
+            // the runner-up a chance as the behavior of the loop may change
+            std::array<std::size_t, num_schedules> order = {0, 1, 2};
+            std::sort(order.begin(), order.end(),
+                [&](std::size_t lhs, std::size_t rhs) {
+                    return cost_[lhs] < cost_[rhs];
+                });
+
+            if (invocations_ % explore_interval == explore_interval - 1)
+            {
+                return static_cast<adaptive_schedule>(order[1]);
+            }
+            return static_cast<adaptive_schedule>(order[0]);
+        }
+
+        void adaptive_chunk_size_history::begin_execution()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            start_ = hpx::chrono::high_resolution_clock::now();
+            count_ = 0;
+        }
+
+        void adaptive_chunk_size_history::end_execution()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            if (start_ == 0 || count_ == 0)
+            {
+                return;
+            }
+
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - start_;
+
+            // the schedule does not matter if only one core was used
+            if (cores_ > 1)
+            {
+                auto const index = static_cast<std::size_t>(schedule_);
+                cost_[index] = update(cost_[index],
+                    static_cast<double>(elapsed) / static_cast<double>(count_),
+                    trials_[index] == 0);
+                ++trials_[index];
+            }
+
+            start_ = 0;
+            count_ = 0;
+        }
+
+        adaptive_schedule_info adaptive_chunk_size_history::get_info() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            adaptive_schedule_info info;
+            info.schedule = schedule_;
+            info.cores = cores_;
+            info.chunk_size = chunk_size_;
+            info.iteration_time = std::chrono::nanoseconds(
+                static_cast<std::int64_t>(iteration_time_));
+            info.skew = skew_;
+            info.invocations = invocations_;
+            return info;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::shared_ptr<adaptive_chunk_size_history>
+        get_adaptive_chunk_size_history(std::string const& name)
+        {
+            static std::mutex mtx;
+            static std::unordered_map<std::string,
+                std::shared_ptr<adaptive_chunk_size_history>>
+                histories;
+
+            std::lock_guard<std::mutex> l(mtx);
+
+            auto& history = histories[name];
+            if (!history)
+            {
+                history = std::make_shared<adaptive_chunk_size_history>();
+            }
+            return history;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_chunk_size::load(serialization::input_archive& ar, unsigned)
+    {
+        // clang-format off
+        ar >> name_;
+        // clang-format on
+
+        history_ = name_.empty() ?
+            std::make_shared<detail::adaptive_chunk_size_history>() :
+            detail::get_adaptive_chunk_size_history(name_);
+    }
+
+    void adaptive_chunk_size::save(
+        serialization::output_archive& ar, unsigned) const
+    {
+        // clang-format off
+        ar << name_;
+        // clang-format on
+    }
+}    // namespace hpx::execution::experimental
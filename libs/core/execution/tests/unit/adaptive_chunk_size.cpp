@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "foreach_tests.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t count = 80000;
+
+std::uint64_t work(std::size_t amount)
+{
+    std::uint64_t volatile result = 0;
+    for (std::size_t i = 0; i != amount; ++i)
+    {
+        result = result + i;
+    }
+    return result;
+}
+
+// run a loop whose iterations cost light units of work, except for the very
+// first ones which cost heavy units of work
+void run_loop(hpx::execution::experimental::adaptive_chunk_size const& acs,
+    std::size_t light, std::size_t heavy)
+{
+    std::vector<std::atomic<int>> visited(count);
+
+    hpx::experimental::for_loop(
+        hpx::execution::par.with(acs), std::size_t(0), count,
+        [&](std::size_t i) {
+            work(i < 100 ? heavy : light);
+            ++visited[i];
+        });
+
+    for (auto const& v : visited)
+    {
+        HPX_TEST_EQ(v.load(), 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_algorithms()
+{
+    using iterator_tag = std::random_access_iterator_tag;
+
+    hpx::execution::experimental::adaptive_chunk_size acs;
+    test_for_each(hpx::execution::par.with(acs), iterator_tag());
+    test_for_each_async(
+        hpx::execution::par(hpx::execution::task).with(acs), iterator_tag());
+
+    hpx::execution::parallel_executor par_exec;
+    test_for_each(
+        hpx::execution::par.on(par_exec).with(std::ref(acs)), iterator_tag());
+    test_for_each_async(hpx::execution::par(hpx::execution::task)
+                            .on(par_exec)
+                            .with(std::ref(acs)),
+        iterator_tag());
+}
+
+void test_uniform_loop()
+{
+    hpx::execution::experimental::adaptive_chunk_size acs;
+
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        run_loop(acs, 100, 100);
+    }
+
+    auto const info = acs.get_schedule();
+    HPX_TEST_EQ(info.invocations, std::size_t(10));
+    HPX_TEST(info.iteration_time.count() != 0);
+    HPX_TEST_LTE(info.cores, hpx::get_num_worker_threads());
+    HPX_TEST_LTE(std::size_t(1), info.cores);
+    HPX_TEST_LTE(std::size_t(1), info.chunk_size);
+}
+
+void test_skewed_loop()
+{
+    hpx::execution::experimental::adaptive_chunk_size acs;
+
+    // the sampled chunks expose the skew, which makes the first invocation
+    // use small chunks
+    run_loop(acs, 10, 10000);
+
+    auto const info = acs.get_schedule();
+    HPX_TEST_EQ(info.invocations, std::size_t(1));
+    HPX_TEST_LT(0.5, info.skew);
+    if (info.cores > 1)
+    {
+        HPX_TEST(info.schedule ==
+            hpx::execution::experimental::adaptive_schedule::stealing_chunks);
+    }
+
+    // all schedules are explored during the next invocations
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        run_loop(acs, 10, 10000);
+    }
+    HPX_TEST_EQ(acs.get_schedule().invocations, std::size_t(11));
+}
+
+void test_named_history()
+{
+    using hpx::execution::experimental::adaptive_chunk_size;
+
+    run_loop(adaptive_chunk_size(std::string("named")), 100, 100);
+    run_loop(adaptive_chunk_size(std::string("named")), 100, 100);
+
+    HPX_TEST_EQ(adaptive_chunk_size(std::string("named"))
+                    .get_schedule()
+                    .invocations,
+        std::size_t(2));
+
+    // different names use separate histories
+    HPX_TEST_EQ(adaptive_chunk_size(std::string("other"))
+                    .get_schedule()
+                    .invocations,
+        std::size_t(0));
+
+    // objects constructed for the same source location share their history
+    auto const loc = HPX_CURRENT_SOURCE_LOCATION();
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        run_loop(adaptive_chunk_size(loc), 100, 100);
+    }
+    HPX_TEST_EQ(
+        adaptive_chunk_size(loc).get_schedule().invocations, std::size_t(3));
+}
+
+void test_schedule_names()
+{
+    using hpx::execution::experimental::adaptive_schedule;
+    using hpx::execution::experimental::get_adaptive_schedule_name;
+
+    HPX_TEST_EQ(std::string(get_adaptive_schedule_name(
+                    adaptive_schedule::static_chunks)),
+        std::string("static"));
+    HPX_TEST_EQ(std::string(get_adaptive_schedule_name(
+                    adaptive_schedule::balanced_chunks)),
+        std::string("balanced"));
+    HPX_TEST_EQ(std::string(get_adaptive_schedule_name(
+                    adaptive_schedule::stealing_chunks)),
+        std::string("stealing"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_algorithms();
+    test_uniform_loop();
+    test_skewed_loop();
+    test_named_history();
+    test_schedule_names();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
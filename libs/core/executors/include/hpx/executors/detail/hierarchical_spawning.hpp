@@ -171,15 +171,19 @@ namespace hpx::parallel::execution::detail {
 
                     auto&& launcher = [&, wrapped, begin, end, it](
                                           bool direct) mutable {
-                        // launch N-1 tasks
+                        // launch N-1 tasks, all of them are submitted to the
+                        // targeted queue at once
+                        hpx::detail::post_policy_batch<Launch> batch(
+                            end - begin);
+
                         auto iter = it;
                         for (std::size_t i = begin + direct; i != end;
                              (void) ++iter, ++i)
                         {
-                            hpx::detail::post_policy_dispatch<Launch>::call(
-                                inner_post_policy, desc, pool, wrapped, *iter,
-                                ts...);
+                            batch.post(inner_post_policy, desc, pool, wrapped,
+                                *iter, ts...);
                         }
+                        batch.submit();
 
                         // execute last task directly, if needed
                         if (direct)
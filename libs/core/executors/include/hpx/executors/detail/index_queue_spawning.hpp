@@ -309,7 +309,8 @@ namespace hpx::parallel::execution::detail {
         // Spawn a task which will process a number of chunks. If the queue
         // contains no chunks no task will be spawned.
         template <typename Task>
-        void do_work_task(hpx::threads::thread_description const& desc,
+        void do_work_task(hpx::detail::post_policy_batch<Launch>& batch,
+            hpx::threads::thread_description const& desc,
             threads::thread_pool_base* pool, bool const dont_bind_to_core,
             bool const needs_wraparound, Task&& task_f) const
         {
@@ -351,14 +352,13 @@ namespace hpx::parallel::execution::detail {
                     wrapped_pu_num(worker_thread, needs_wraparound) +
                     first_thread);
 
-                hpx::detail::post_policy_dispatch<Launch>::call(
+                batch.post(
                     hpx::execution::experimental::with_hint(post_policy, hint),
                     desc, pool, HPX_FORWARD(Task, task_f));
             }
             else
             {
-                hpx::detail::post_policy_dispatch<Launch>::call(
-                    post_policy, desc, pool, HPX_FORWARD(Task, task_f));
+                batch.post(post_policy, desc, pool, HPX_FORWARD(Task, task_f));
             }
         }
 
@@ -434,7 +434,9 @@ namespace hpx::parallel::execution::detail {
                 }
             }
 
-            // Spawn the worker threads for all except the local queue.
+            // Spawn the worker threads for all except the local queue. All
+            // threads are submitted to the thread pool at once.
+            hpx::detail::post_policy_batch<Launch> batch(num_threads);
             auto local_worker_thread =
                 static_cast<std::uint32_t>(hpx::get_local_worker_thread_num());
             std::uint32_t worker_thread = 0;
@@ -498,7 +500,7 @@ namespace hpx::parallel::execution::detail {
                 }
 
                 // Schedule task for this worker thread
-                do_work_task(desc, pool, false, needs_wraparound,
+                do_work_task(batch, desc, pool, false, needs_wraparound,
                     task_function<index_queue_bulk_state>{
                         hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
                         chunk_size, worker_thread, reverse_placement,
@@ -515,12 +517,14 @@ namespace hpx::parallel::execution::detail {
             if (main_thread_ok)
             {
                 // Handle the queue for the local thread.
-                do_work_task(desc, pool, true, needs_wraparound,
+                do_work_task(batch, desc, pool, true, needs_wraparound,
                     task_function<index_queue_bulk_state>{
                         hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
                         chunk_size, local_worker_thread, reverse_placement,
                         allow_stealing});
             }
+
+            batch.submit();
         }
 
         std::uint32_t first_thread;
@@ -233,6 +233,22 @@ namespace hpx::execution::experimental {
             execute(HPX_FORWARD(F, f), policy_);
         }
 
+        // add the task to the given batch instead of creating it right away
+        template <typename F>
+        void execute(F&& f, Policy const& policy,
+            hpx::detail::post_policy_batch<Policy>& batch) const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            hpx::threads::thread_description desc(f, annotation_);
+#else
+            hpx::threads::thread_description desc(f);
+#endif
+            auto pool =
+                pool_ ? pool_ : threads::detail::get_self_or_default_pool();
+
+            batch.post(policy, desc, pool, HPX_FORWARD(F, f));
+        }
+
         template <typename Scheduler, typename Receiver>
         struct operation_state
         {
@@ -389,8 +389,8 @@ namespace hpx::execution::experimental::detail {
 
         // Spawn a task which will process a number of chunks. If the queue
         // contains no chunks no task will be spawned.
-        template <typename Task>
-        void do_work_task(Task&& task_f) const
+        template <typename Batch, typename Task>
+        void do_work_task(Batch& batch, Task&& task_f) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
             auto& queue = op_state->queues[worker_thread].data_;
@@ -414,11 +414,13 @@ namespace hpx::execution::experimental::detail {
                 auto policy = hpx::execution::experimental::with_hint(
                     op_state->scheduler.policy(), hint);
 
-                op_state->scheduler.execute(HPX_FORWARD(Task, task_f), policy);
+                op_state->scheduler.execute(
+                    HPX_FORWARD(Task, task_f), policy, batch);
             }
             else
             {
-                op_state->scheduler.execute(HPX_FORWARD(Task, task_f));
+                op_state->scheduler.execute(HPX_FORWARD(Task, task_f),
+                    op_state->scheduler.policy(), batch);
             }
         }
 
@@ -532,6 +534,11 @@ namespace hpx::execution::experimental::detail {
             bool allow_stealing =
                 !hpx::threads::do_not_share_function(hint.sharing_mode());
 
+            // all worker threads are submitted to the thread pool at once
+            hpx::detail::post_policy_batch<
+                std::decay_t<decltype(op_state->scheduler.policy())>>
+                batch(op_state->num_worker_threads);
+
             for (std::uint32_t pu = 0;
                  worker_thread != op_state->num_worker_threads && pu != num_pus;
                  ++pu)
@@ -564,7 +571,7 @@ namespace hpx::execution::experimental::detail {
                 }
 
                 // Schedule task for this worker thread
-                do_work_task(
+                do_work_task(batch,
                     task_function<OperationState>{op_state, size, chunk_size,
                         worker_thread, reverse_placement, allow_stealing});
 
@@ -575,6 +582,8 @@ namespace hpx::execution::experimental::detail {
             // the PU-mask
             HPX_ASSERT(worker_thread == op_state->num_worker_threads);
 
+            batch.submit();
+
             // Handle the queue for the local thread.
             if (main_thread_ok)
             {
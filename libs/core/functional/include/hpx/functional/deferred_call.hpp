@@ -130,7 +130,7 @@ namespace hpx::util {
 
         private:
             F _f;
-            util::member_pack_for<Ts...> _args;
+            HPX_NO_UNIQUE_ADDRESS util::member_pack_for<Ts...> _args;
         };
     }    // namespace detail
 
@@ -29,9 +29,18 @@
 
 namespace hpx::util::detail {
 
+    // default size of the inline storage of function and move_only_function
     inline constexpr std::size_t function_storage_size = 3 * sizeof(void*);
 
+    // size of the inline storage of the functions HPX threads are created
+    // from, large enough to hold typical task closures
+    inline constexpr std::size_t task_function_storage_size =
+        HPX_TASK_FUNCTION_STORAGE_SIZE;
+
     ///////////////////////////////////////////////////////////////////////////
+    // The part of the type-erased function which does not depend on the size
+    // of the inline storage. All operations that may touch the inline storage
+    // are passed a pointer to it and its size.
     class HPX_CORE_EXPORT function_base
     {
         using vtable = function_base_vtable;
@@ -41,23 +50,9 @@ namespace hpx::util::detail {
             function_base_vtable const* empty_vptr) noexcept
           : vptr(empty_vptr)
           , object(nullptr)
-          , storage_init()
         {
         }
 
-        function_base(function_base const& other, vtable const* empty_vtable);
-        function_base(function_base&& other, vtable const* empty_vptr) noexcept;
-
-        ~function_base();
-
-        void op_assign(function_base const& other, vtable const* empty_vtable);
-        void op_assign(
-            function_base&& other, vtable const* empty_vtable) noexcept;
-
-        void destroy() const noexcept;
-        void reset(vtable const* empty_vptr) noexcept;
-        void swap(function_base& f) noexcept;
-
         [[nodiscard]] constexpr bool empty() const noexcept
         {
             return object == nullptr;
@@ -74,12 +69,105 @@ namespace hpx::util::detail {
             const;
 
     protected:
+        void copy_construct(function_base const& other, void* storage,
+            std::size_t storage_size);
+        void move_construct(function_base& other, void* storage,
+            void* other_storage, std::size_t storage_size,
+            vtable const* empty_vptr) noexcept;
+
+        void op_assign(function_base const& other, void* storage,
+            std::size_t storage_size);
+
+        void destroy(std::size_t storage_size) const noexcept;
+        void reset(
+            vtable const* empty_vptr, std::size_t storage_size) noexcept;
+        void swap(function_base& f, void* storage, void* f_storage,
+            std::size_t storage_size) noexcept;
+
         vtable const* vptr;
         void* object;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Type-erased function with StorageSize bytes of inline storage. Callables
+    // which don't fit are allocated on the heap.
+    template <std::size_t StorageSize>
+    class function_storage : public function_base
+    {
+        using base_type = function_base;
+        using vtable = function_base_vtable;
+
+        static_assert(StorageSize >= sizeof(void*),
+            "the inline storage must be able to hold at least a pointer");
+
+    public:
+        static constexpr std::size_t storage_size = StorageSize;
+
+        explicit constexpr function_storage(
+            function_base_vtable const* empty_vptr) noexcept
+          : base_type(empty_vptr)
+          , storage_init()
+        {
+        }
+
+        function_storage(
+            function_storage const& other, vtable const* /* empty_vtable */)
+          : base_type(other.vptr)
+          , storage_init()
+        {
+            base_type::copy_construct(other, storage, StorageSize);
+        }
+
+        function_storage(
+            function_storage&& other, vtable const* empty_vptr) noexcept
+          : base_type(other.vptr)
+          , storage_init()
+        {
+            base_type::move_construct(
+                other, storage, other.storage, StorageSize, empty_vptr);
+        }
+
+        ~function_storage()
+        {
+            destroy();
+        }
+
+        void op_assign(
+            function_storage const& other, vtable const* /* empty_vtable */)
+        {
+            base_type::op_assign(other, storage, StorageSize);
+        }
+
+        void op_assign(
+            function_storage&& other, vtable const* empty_vtable) noexcept
+        {
+            if (this != &other)
+            {
+                swap(other);
+                other.reset(empty_vtable);
+            }
+        }
+
+        void destroy() const noexcept
+        {
+            base_type::destroy(StorageSize);
+        }
+
+        void reset(vtable const* empty_vptr) noexcept
+        {
+            base_type::reset(empty_vptr, StorageSize);
+        }
+
+        void swap(function_storage& f) noexcept
+        {
+            base_type::swap(f, storage, f.storage, StorageSize);
+        }
+
+    protected:
         union
         {
             char storage_init;
-            mutable unsigned char storage[function_storage_size];
+            mutable unsigned char storage[StorageSize];
         };
     };
 
@@ -121,14 +209,16 @@ namespace hpx::util::detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Sig, bool Copyable, bool Serializable>
+    template <typename Sig, bool Copyable, bool Serializable,
+        std::size_t StorageSize = function_storage_size>
     class basic_function;
 
-    template <bool Copyable, typename R, typename... Ts>
-    class basic_function<R(Ts...), Copyable, /*Serializable*/ false>
-      : public function_base
+    template <bool Copyable, std::size_t StorageSize, typename R,
+        typename... Ts>
+    class basic_function<R(Ts...), Copyable, /*Serializable*/ false,
+        StorageSize> : public function_storage<StorageSize>
     {
-        using base_type = function_base;
+        using base_type = function_storage<StorageSize>;
         using vtable = function_vtable<R(Ts...), Copyable>;
 
     public:
@@ -188,10 +278,10 @@ namespace hpx::util::detail {
                 }
                 else
                 {
-                    destroy();
+                    base_type::destroy();
                     vptr = f_vptr;
-                    buffer = vtable::template allocate<T>(
-                        storage, function_storage_size);
+                    buffer =
+                        vtable::template allocate<T>(storage, StorageSize);
                 }
                 object = ::new (buffer) T(HPX_FORWARD(F, f));
             }
@@ -9,16 +9,19 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/functional/move_only_function.hpp>
 
+#include <cstddef>
+
 namespace hpx::util::detail {
 
-    template <typename Sig, bool Serializable>
-    void reset_function(hpx::function<Sig, Serializable>& f)
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    void reset_function(hpx::function<Sig, Serializable, StorageSize>& f)
     {
         f.reset();
     }
 
-    template <typename Sig, bool Serializable>
-    void reset_function(hpx::move_only_function<Sig, Serializable>& f)
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    void reset_function(
+        hpx::move_only_function<Sig, Serializable, StorageSize>& f)
     {
         f.reset();
     }
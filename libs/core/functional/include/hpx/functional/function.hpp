@@ -36,15 +36,21 @@ namespace hpx {
     /// hpx::function results in \a hpx#error#bad_function_call exception being
     /// thrown. hpx::function satisfies the requirements of CopyConstructible
     /// and CopyAssignable.
-    template <typename Sig, bool Serializable = false>
+    ///
+    /// Targets of up to \a StorageSize bytes are stored inside the
+    /// hpx::function object itself, larger targets are allocated on the heap.
+    template <typename Sig, bool Serializable = false,
+        std::size_t StorageSize = util::detail::function_storage_size>
     class function;
 
-    template <typename R, typename... Ts, bool Serializable>
-    class function<R(Ts...), Serializable>
-      : public util::detail::basic_function<R(Ts...), true, Serializable>
+    template <typename R, typename... Ts, bool Serializable,
+        std::size_t StorageSize>
+    class function<R(Ts...), Serializable, StorageSize>
+      : public util::detail::basic_function<R(Ts...), true, Serializable,
+            StorageSize>
     {
-        using base_type =
-            util::detail::basic_function<R(Ts...), true, Serializable>;
+        using base_type = util::detail::basic_function<R(Ts...), true,
+            Serializable, StorageSize>;
 
     public:
         using result_type = R;
@@ -111,32 +117,35 @@ namespace hpx::util {
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::traits {
 
-    template <typename Sig, bool Serializable>
-    struct get_function_address<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_address<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
         [[nodiscard]] static constexpr std::size_t call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+            hpx::function<Sig, Serializable, StorageSize> const& f) noexcept
         {
             return f.get_function_address();
         }
     };
 
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
         [[nodiscard]] static constexpr char const* call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+            hpx::function<Sig, Serializable, StorageSize> const& f) noexcept
         {
             return f.get_function_annotation();
         }
     };
 
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation_itt<hpx::function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation_itt<
+        hpx::function<Sig, Serializable, StorageSize>>
     {
         [[nodiscard]] static util::itt::string_handle call(
-            hpx::function<Sig, Serializable> const& f) noexcept
+            hpx::function<Sig, Serializable, StorageSize> const& f) noexcept
         {
             return f.get_function_annotation_itt();
         }
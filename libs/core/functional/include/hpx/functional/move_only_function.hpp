@@ -44,15 +44,22 @@ namespace hpx {
     /// specifier (if any) are added to its operator(). hpx::move_only_function
     /// satisfies the requirements of MoveConstructible and MoveAssignable, but
     /// does not satisfy CopyConstructible or CopyAssignable.
-    template <typename Sig, bool Serializable = false>
+    ///
+    /// Targets of up to \a StorageSize bytes are stored inside the
+    /// hpx::move_only_function object itself, larger targets are allocated on
+    /// the heap.
+    template <typename Sig, bool Serializable = false,
+        std::size_t StorageSize = util::detail::function_storage_size>
     class move_only_function;
 
-    template <typename R, typename... Ts, bool Serializable>
-    class move_only_function<R(Ts...), Serializable>
-      : public util::detail::basic_function<R(Ts...), false, Serializable>
+    template <typename R, typename... Ts, bool Serializable,
+        std::size_t StorageSize>
+    class move_only_function<R(Ts...), Serializable, StorageSize>
+      : public util::detail::basic_function<R(Ts...), false, Serializable,
+            StorageSize>
     {
-        using base_type =
-            util::detail::basic_function<R(Ts...), false, Serializable>;
+        using base_type = util::detail::basic_function<R(Ts...), false,
+            Serializable, StorageSize>;
 
     public:
         using result_type = R;
@@ -105,6 +112,16 @@ namespace hpx {
     }    // namespace distributed
 }    // namespace hpx
 
+namespace hpx::util::detail {
+
+    // The callable type HPX threads are created from. Its inline storage is
+    // large enough for typical task closures, which avoids allocating those
+    // when creating a thread.
+    template <typename Sig>
+    using task_function =
+        hpx::move_only_function<Sig, false, task_function_storage_size>;
+}    // namespace hpx::util::detail
+
 namespace hpx::util {
 
     template <typename Sig, bool Serializable = true>
@@ -123,33 +140,38 @@ namespace hpx::util {
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::traits {
 
-    template <typename Sig, bool Serializable>
-    struct get_function_address<hpx::move_only_function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_address<
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
         [[nodiscard]] static constexpr std::size_t call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+            hpx::move_only_function<Sig, Serializable, StorageSize> const&
+                f) noexcept
         {
             return f.get_function_address();
         }
     };
 
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation<hpx::move_only_function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation<
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
         [[nodiscard]] static constexpr char const* call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+            hpx::move_only_function<Sig, Serializable, StorageSize> const&
+                f) noexcept
         {
             return f.get_function_annotation();
         }
     };
 
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-    template <typename Sig, bool Serializable>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
     struct get_function_annotation_itt<
-        hpx::move_only_function<Sig, Serializable>>
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
         [[nodiscard]] static util::itt::string_handle call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+            hpx::move_only_function<Sig, Serializable, StorageSize> const&
+                f) noexcept
         {
             return f.get_function_annotation_itt();
         }
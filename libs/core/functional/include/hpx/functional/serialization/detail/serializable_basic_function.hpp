@@ -16,19 +16,24 @@
 #include <hpx/functional/serialization/detail/vtable/serializable_vtable.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
 #include <utility>
 
 namespace hpx::util::detail {
 
-    template <bool Copyable, typename R, typename... Ts>
-    class basic_function<R(Ts...), Copyable, /*Serializable*/ true>
-      : public basic_function<R(Ts...), Copyable, /*Serializable*/ false>
+    template <bool Copyable, std::size_t StorageSize, typename R,
+        typename... Ts>
+    class basic_function<R(Ts...), Copyable, /*Serializable*/ true,
+        StorageSize>
+      : public basic_function<R(Ts...), Copyable, /*Serializable*/ false,
+            StorageSize>
     {
         using vtable = function_vtable<R(Ts...), Copyable>;
         using serializable_vtable = serializable_function_vtable<vtable>;
-        using base_type = basic_function<R(Ts...), Copyable, false>;
+        using base_type =
+            basic_function<R(Ts...), Copyable, false, StorageSize>;
 
     public:
         constexpr basic_function() noexcept
@@ -85,7 +90,7 @@ namespace hpx::util::detail {
 
                 vptr = serializable_vptr->vptr;
                 object = serializable_vptr->load_object(
-                    storage, function_storage_size, ar, version);
+                    storage, StorageSize, ar, version);
             }
         }
 
@@ -17,6 +17,7 @@
 #include <hpx/functional/traits/is_invocable.hpp>
 #include <hpx/modules/itt_notify.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <new>
@@ -27,42 +28,35 @@
 namespace hpx::util::detail {
 
     ///////////////////////////////////////////////////////////////////////////
-    function_base::function_base(
-        function_base const& other, vtable const* /* empty_vtable */)
-      : vptr(other.vptr)
-      , object(other.object)
-      , storage_init()
+    void function_base::copy_construct(
+        function_base const& other, void* storage, std::size_t storage_size)
     {
+        HPX_ASSERT(vptr == other.vptr);
         if (other.object != nullptr)
         {
-            object = vptr->copy(storage, detail::function_storage_size,
-                other.object, /*destroy*/ false);
+            object = vptr->copy(
+                storage, storage_size, other.object, /*destroy*/ false);
         }
     }
 
-    function_base::function_base(
-        function_base&& other, vtable const* empty_vptr) noexcept
-      : vptr(other.vptr)
-      , object(other.object)
-      , storage_init()
+    void function_base::move_construct(function_base& other, void* storage,
+        void* other_storage, std::size_t storage_size,
+        vtable const* empty_vptr) noexcept
     {
-        if (object == &other.storage)
+        HPX_ASSERT(vptr == other.vptr);
+        object = other.object;
+        if (object == other_storage)
         {
-            std::memcpy(storage, other.storage, function_storage_size);
-            object = &storage;
+            std::memcpy(storage, other_storage, storage_size);
+            object = storage;
         }
 
         other.vptr = empty_vptr;
         other.object = nullptr;
     }
 
-    function_base::~function_base()
-    {
-        destroy();
-    }
-
     void function_base::op_assign(
-        function_base const& other, vtable const* /* empty_vtable */)
+        function_base const& other, void* storage, std::size_t storage_size)
     {
         if (vptr == other.vptr)
         {
@@ -77,12 +71,12 @@ namespace hpx::util::detail {
         }
         else
         {
-            destroy();
+            destroy(storage_size);
             vptr = other.vptr;
             if (other.object != nullptr)
             {
-                object = vptr->copy(storage, detail::function_storage_size,
-                    other.object, /*destroy*/ false);
+                object = vptr->copy(
+                    storage, storage_size, other.object, /*destroy*/ false);
             }
             else
             {
@@ -91,40 +85,34 @@ namespace hpx::util::detail {
         }
     }
 
-    void function_base::op_assign(
-        function_base&& other, vtable const* empty_vtable) noexcept
-    {
-        if (this != &other)
-        {
-            swap(other);
-            other.reset(empty_vtable);
-        }
-    }
-
-    void function_base::destroy() const noexcept
+    void function_base::destroy(std::size_t storage_size) const noexcept
     {
         if (object != nullptr)
         {
-            vptr->deallocate(object, function_storage_size, /*destroy*/ true);
+            vptr->deallocate(object, storage_size, /*destroy*/ true);
         }
     }
 
-    void function_base::reset(vtable const* empty_vptr) noexcept
+    void function_base::reset(
+        vtable const* empty_vptr, std::size_t storage_size) noexcept
     {
-        destroy();
+        destroy(storage_size);
         vptr = empty_vptr;
         object = nullptr;
     }
 
-    void function_base::swap(function_base& f) noexcept
+    void function_base::swap(function_base& f, void* storage, void* f_storage,
+        std::size_t storage_size) noexcept
     {
         std::swap(vptr, f.vptr);
         std::swap(object, f.object);
-        std::swap(storage, f.storage);
-        if (object == &f.storage)
-            object = &storage;
-        if (f.object == &storage)
-            f.object = &f.storage;
+        std::swap_ranges(static_cast<unsigned char*>(storage),
+            static_cast<unsigned char*>(storage) + storage_size,
+            static_cast<unsigned char*>(f_storage));
+        if (object == f_storage)
+            object = storage;
+        if (f.object == storage)
+            f.object = f_storage;
     }
 
     std::size_t function_base::get_function_address() const
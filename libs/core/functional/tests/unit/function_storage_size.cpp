@@ -0,0 +1,195 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional/deferred_call.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+template <std::size_t N>
+struct words
+{
+    std::uintptr_t values[N] = {};
+
+    std::uintptr_t operator()() const
+    {
+        std::uintptr_t sum = 0;
+        for (std::uintptr_t v : values)
+        {
+            sum += v;
+        }
+        return sum;
+    }
+};
+
+template <std::size_t N>
+words<N> make_words()
+{
+    words<N> w;
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        w.values[i] = i + 1;
+    }
+    return w;
+}
+
+// return whether the target of the given function is stored inline
+template <typename T, typename F>
+bool is_stored_inline(F const& f)
+{
+    auto const* target = reinterpret_cast<unsigned char const*>(
+        f.template target<T>());
+    auto const* begin = reinterpret_cast<unsigned char const*>(&f);
+    return target >= begin && target < begin + sizeof(F);
+}
+
+constexpr std::uintptr_t sum_of(std::size_t n)
+{
+    return n * (n + 1) / 2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_default_storage()
+{
+    using small = words<2>;
+    using large = words<6>;
+
+    hpx::function<std::uintptr_t()> f1 = make_words<2>();
+    HPX_TEST(is_stored_inline<small>(f1));
+    HPX_TEST_EQ(f1(), sum_of(2));
+
+    hpx::function<std::uintptr_t()> f2 = make_words<6>();
+    HPX_TEST(!is_stored_inline<large>(f2));
+    HPX_TEST_EQ(f2(), sum_of(6));
+}
+
+template <std::size_t StorageSize>
+void test_custom_storage()
+{
+    using function = hpx::function<std::uintptr_t(), false, StorageSize>;
+
+    constexpr std::size_t fits = StorageSize / sizeof(std::uintptr_t);
+    using small = words<fits>;
+    using large = words<fits + 1>;
+
+    static_assert(sizeof(function) >= StorageSize + 2 * sizeof(void*));
+
+    function f1 = make_words<fits>();
+    HPX_TEST(is_stored_inline<small>(f1));
+    HPX_TEST_EQ(f1(), sum_of(fits));
+
+    function f2 = make_words<fits + 1>();
+    HPX_TEST(!is_stored_inline<large>(f2));
+    HPX_TEST_EQ(f2(), sum_of(fits + 1));
+
+    // copies keep the target inline
+    function f3(f1);
+    HPX_TEST(is_stored_inline<small>(f3));
+    HPX_TEST_EQ(f3(), sum_of(fits));
+
+    // moving an inline target relocates it into the new object
+    function f4(std::move(f3));
+    HPX_TEST(f3.empty());    //-V586
+    HPX_TEST(is_stored_inline<small>(f4));
+    HPX_TEST_EQ(f4(), sum_of(fits));
+
+    // swapping an inline and a heap allocated target
+    f4.swap(f2);
+    HPX_TEST(!is_stored_inline<large>(f4));
+    HPX_TEST(is_stored_inline<small>(f2));
+    HPX_TEST_EQ(f4(), sum_of(fits + 1));
+    HPX_TEST_EQ(f2(), sum_of(fits));
+
+    // assignment between targets of different types
+    f2 = f4;
+    HPX_TEST(!is_stored_inline<large>(f2));
+    HPX_TEST_EQ(f2(), sum_of(fits + 1));
+
+    f4 = f1;
+    HPX_TEST(is_stored_inline<small>(f4));
+    HPX_TEST_EQ(f4(), sum_of(fits));
+
+    f4 = nullptr;
+    HPX_TEST(f4.empty());
+}
+
+template <std::size_t StorageSize>
+void test_move_only_storage()
+{
+    using function =
+        hpx::move_only_function<std::uintptr_t(), false, StorageSize>;
+
+    constexpr std::size_t fits = StorageSize / sizeof(std::uintptr_t);
+
+    std::unique_ptr<int> p(new int(42));
+
+    // a move-only target
+    function f1 = [p = std::move(p), w = make_words<fits - 1>()]() {
+        return static_cast<std::uintptr_t>(*p) + w();
+    };
+    HPX_TEST_EQ(f1(), std::uintptr_t(42) + sum_of(fits - 1));
+
+    function f2(std::move(f1));
+    HPX_TEST(f1.empty());    //-V586
+    HPX_TEST_EQ(f2(), std::uintptr_t(42) + sum_of(fits - 1));
+
+    function f3;
+    f3 = std::move(f2);
+    HPX_TEST(f2.empty());    //-V586
+    HPX_TEST_EQ(f3(), std::uintptr_t(42) + sum_of(fits - 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_task_function()
+{
+    using hpx::util::detail::task_function_storage_size;
+
+    constexpr std::size_t fits =
+        task_function_storage_size / sizeof(std::uintptr_t);
+
+#if defined(HPX_HAVE_CXX20_NO_UNIQUE_ADDRESS_ATTRIBUTE) ||                     \
+    defined(HPX_HAVE_MSVC_NO_UNIQUE_ADDRESS_ATTRIBUTE)
+    // a deferred call without arguments is no larger than the callable
+    static_assert(
+        sizeof(decltype(hpx::util::deferred_call(make_words<fits>()))) ==
+        sizeof(words<fits>));
+#endif
+
+    using deferred =
+        decltype(hpx::util::deferred_call(make_words<fits - 1>()));
+
+    hpx::util::detail::task_function<std::uintptr_t()> f =
+        hpx::util::deferred_call(make_words<fits - 1>());
+    HPX_TEST(is_stored_inline<deferred>(f));
+    HPX_TEST_EQ(f(), sum_of(fits - 1));
+
+    hpx::util::detail::task_function<std::uintptr_t()> f2(std::move(f));
+    HPX_TEST(is_stored_inline<deferred>(f2));
+    HPX_TEST_EQ(f2(), sum_of(fits - 1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_default_storage();
+
+    test_custom_storage<4 * sizeof(void*)>();
+    test_custom_storage<8 * sizeof(void*)>();
+    test_custom_storage<16 * sizeof(void*)>();
+
+    test_move_only_storage<4 * sizeof(void*)>();
+    test_move_only_storage<8 * sizeof(void*)>();
+
+    test_task_function();
+
+    return hpx::util::report_errors();
+}
@@ -22,6 +22,7 @@
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 #include <hpx/type_support/construct_at.hpp>
@@ -492,6 +493,13 @@ namespace hpx::lcos::detail {
             // alive as long as the future
             this->base_type::runs_child_.reset();
 
+            // the waiting threads are resumed by the calling thread
+            if (HPX_UNLIKELY(threads::tracing::is_recording_dependencies()))
+            {
+                threads::tracing::detail::record_ready(
+                    static_cast<base_type const*>(this));
+            }
+
             // 26111: Caller failing to release lock 'this->mtx_'
             // 26115: Failing to release lock 'this->mtx_'
             // 26800: Use of a moved from object 'l'
@@ -574,6 +582,13 @@ namespace hpx::lcos::detail {
             // alive as long as the future
             this->base_type::runs_child_.reset();
 
+            // the waiting threads are resumed by the calling thread
+            if (HPX_UNLIKELY(threads::tracing::is_recording_dependencies()))
+            {
+                threads::tracing::detail::record_ready(
+                    static_cast<base_type const*>(this));
+            }
+
             // 26111: Caller failing to release lock 'this->mtx_'
             // 26115: Failing to release lock 'this->mtx_'
             // 26800: Use of a moved from object 'l'
@@ -19,6 +19,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
 
 #include <cstddef>
 #include <exception>
@@ -369,6 +370,9 @@ namespace hpx::lcos::detail {
                     return s;
                 }
 
+                if (HPX_UNLIKELY(threads::tracing::is_recording_dependencies()))
+                    threads::tracing::detail::record_wait(this);
+
                 // reload the state, it's not empty anymore
                 s = state_.load(std::memory_order_relaxed);
             }
@@ -400,6 +404,9 @@ namespace hpx::lcos::detail {
                     return hpx::future_status::uninitialized;
                 }
 
+                if (HPX_UNLIKELY(threads::tracing::is_recording_dependencies()))
+                    threads::tracing::detail::record_wait(this);
+
                 if (reason == threads::thread_restart_state::timeout &&
                     state_.load(std::memory_order_acquire) == empty)
                 {
@@ -0,0 +1,1235 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos_local/ring_channel.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/execution_base/completion_signatures.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::lcos::local {
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // An operation (receive or send) that could not complete right away
+        // and waits for an item (or a free slot) to become available.
+        struct ring_channel_waiter
+        {
+            virtual ~ring_channel_waiter() = default;
+
+            // Invoked once the operation should try again, either because
+            // the channel changed or because it was closed. The operation
+            // may complete (and be destroyed) during this call, errors are
+            // reported through the operation.
+            virtual void retry() noexcept = 0;
+
+            ring_channel_waiter* next = nullptr;
+        };
+
+        // intrusive FIFO list of waiting operations
+        class ring_channel_waiters
+        {
+        public:
+            void push(ring_channel_waiter* w) noexcept
+            {
+                w->next = nullptr;
+                if (tail_ == nullptr)
+                {
+                    head_ = w;
+                }
+                else
+                {
+                    tail_->next = w;
+                }
+                tail_ = w;
+                ++size_;
+            }
+
+            // detach up to count waiters, returns the first of them
+            ring_channel_waiter* pop(std::size_t count) noexcept
+            {
+                ring_channel_waiter* first = head_;
+                ring_channel_waiter* last = nullptr;
+                while (count-- != 0 && head_ != nullptr)
+                {
+                    last = head_;
+                    head_ = head_->next;
+                    --size_;
+                }
+
+                if (last != nullptr)
+                {
+                    last->next = nullptr;
+                }
+                if (head_ == nullptr)
+                {
+                    tail_ = nullptr;
+                }
+                return last != nullptr ? first : nullptr;
+            }
+
+            // append a list of waiters linked through their next pointers
+            void push_all(ring_channel_waiter* first) noexcept
+            {
+                while (first != nullptr)
+                {
+                    ring_channel_waiter* next = first->next;
+                    push(first);
+                    first = next;
+                }
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+        private:
+            ring_channel_waiter* head_ = nullptr;
+            ring_channel_waiter* tail_ = nullptr;
+            std::size_t size_ = 0;
+        };
+
+        // Output iterator appending to a vector which has enough capacity
+        // reserved, appending a nothrow move constructible value never
+        // throws in this case.
+        template <typename T>
+        class ring_channel_reserved_inserter
+        {
+        public:
+            using iterator_category = std::output_iterator_tag;
+            using value_type = void;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = void;
+
+            explicit ring_channel_reserved_inserter(
+                std::vector<T>& values) noexcept
+              : values_(&values)
+            {
+            }
+
+            ring_channel_reserved_inserter& operator=(T&& t) noexcept
+            {
+                HPX_ASSERT(values_->size() < values_->capacity());
+                values_->push_back(HPX_MOVE(t));
+                return *this;
+            }
+
+            ring_channel_reserved_inserter& operator*() noexcept
+            {
+                return *this;
+            }
+
+            ring_channel_reserved_inserter& operator++() noexcept
+            {
+                return *this;
+            }
+
+            ring_channel_reserved_inserter operator++(int) noexcept
+            {
+                return *this;
+            }
+
+        private:
+            std::vector<T>* values_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A bounded channel supporting multiple producers and multiple consumers
+    // which is lock-free as long as it is neither empty nor full. The items
+    // are stored in a ring of cells, each carrying a sequence number which
+    // tells producers and consumers whether the cell is free or filled for
+    // the current round (D. Vyukov's bounded MPMC queue). Producers and
+    // consumers claim cells by advancing their position counter with a
+    // single compare-and-swap, the batch operations claim several adjacent
+    // cells at once.
+    //
+    // Only if the channel is empty (or full) an operation is suspended: the
+    // future and sender based operations register themselves with the
+    // channel and are resumed by the next producer (or consumer), the
+    // synchronous operations suspend the calling HPX thread on a future.
+    // The waiting operations are kept in a list which is protected by a
+    // spinlock, the fast path touches it only if there are waiting
+    // operations.
+    //
+    // Resuming a waiting operation may complete further operations, which
+    // in turn resume other waiting operations. Operations are resumed by a
+    // single thread at a time in a loop, which bounds the stack depth.
+    //
+    // The capacity of the channel is rounded up to the next power of two.
+    template <typename T>
+    class ring_channel
+    {
+    private:
+        // A cell is claimed before the value is moved into (or out of) it,
+        // a throwing move would leave the claimed cell behind.
+        static_assert(std::is_nothrow_move_constructible_v<T>,
+            "the value type of a ring_channel must be nothrow move "
+            "constructible");
+
+        using mutex_type = hpx::spinlock;
+
+        struct cell
+        {
+            std::atomic<std::size_t> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T* get() noexcept
+            {
+                return std::launder(reinterpret_cast<T*>(&storage));
+            }
+        };
+
+        static std::size_t round_up_capacity(std::size_t size) noexcept
+        {
+            std::size_t capacity = 2;
+            while (capacity < size)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        static std::exception_ptr closed_error(char const* function)
+        {
+            return HPX_GET_EXCEPTION(hpx::error::invalid_status, function,
+                "the channel was closed");
+        }
+
+    public:
+        explicit ring_channel(std::size_t size)
+          : mask_(round_up_capacity(size) - 1)
+          , buffer_(new cell[mask_ + 1])
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+            {
+                buffer_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            enqueue_pos_.data_.store(0, std::memory_order_relaxed);
+            dequeue_pos_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        ring_channel(ring_channel const&) = delete;
+        ring_channel(ring_channel&&) = delete;
+        ring_channel& operator=(ring_channel const&) = delete;
+        ring_channel& operator=(ring_channel&&) = delete;
+
+        ~ring_channel()
+        {
+            HPX_ASSERT_MSG(receivers_.size() == 0 && senders_.size() == 0 &&
+                    resumed_.size() == 0,
+                "ring_channel destroyed while operations are pending");
+
+            hpx::optional<T> value;
+            while (try_pop(value))
+            {
+                value.reset();
+            }
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+        // Return whether the channel was closed.
+        [[nodiscard]] bool is_closed() const noexcept
+        {
+            return closed_.load(std::memory_order_acquire);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Non-blocking operations
+
+        // Send the given value, returns false if the channel is full or was
+        // closed (the value is left untouched in this case).
+        bool try_send(T& t)
+        {
+            if (is_closed() || !try_push(t))
+            {
+                return false;
+            }
+            after_push(1);
+            return true;
+        }
+
+        bool try_send(T&& t)
+        {
+            return try_send(t);
+        }
+
+        // Receive a value, returns false if the channel is empty.
+        bool try_receive(T& t)
+        {
+            hpx::optional<T> value;
+            if (!try_pop(value))
+            {
+                return false;
+            }
+            after_pop(1);
+
+            t = HPX_MOVE(*value);
+            return true;
+        }
+
+        // Send (move) up to count values starting at first, returns how
+        // many values were sent.
+        template <typename Iterator>
+        std::size_t try_send_n(Iterator first, std::size_t count)
+        {
+            if (is_closed())
+            {
+                return 0;
+            }
+
+            std::size_t const sent = push_n(first, count);
+            if (sent != 0)
+            {
+                after_push(sent);
+            }
+            return sent;
+        }
+
+        // Receive up to count values into dest, returns how many values
+        // were received. If writing a value to dest throws, that value is
+        // lost, the values received before are kept.
+        template <typename OutputIterator>
+        std::size_t try_receive_n(OutputIterator dest, std::size_t count)
+        {
+            std::size_t const received = pop_n(dest, count);
+            if (received != 0)
+            {
+                after_pop(received);
+            }
+            return received;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Future based operations
+
+        // Send the given value. The returned future becomes ready once the
+        // value was stored in the channel.
+        hpx::future<void> send(T t)
+        {
+            if (try_send(t))
+            {
+                return hpx::make_ready_future();
+            }
+
+            auto* op = new send_promise(*this, HPX_MOVE(t));
+            hpx::future<void> f = op->promise.get_future();
+            do_send(*op);
+            return f;
+        }
+
+        void send(hpx::launch::sync_policy, T t)
+        {
+            if (!try_send(t))
+            {
+                send(HPX_MOVE(t)).get();
+            }
+        }
+
+        // Receive a value. The returned future holds an exception if the
+        // channel is empty and was closed.
+        hpx::future<T> receive()
+        {
+            hpx::optional<T> value;
+            if (try_pop(value))
+            {
+                after_pop(1);
+                return hpx::make_ready_future(HPX_MOVE(*value));
+            }
+
+            auto* op = new receive_promise(*this);
+            hpx::future<T> f = op->promise.get_future();
+            do_receive(*op);
+            return f;
+        }
+
+        T receive(hpx::launch::sync_policy)
+        {
+            hpx::optional<T> value;
+            if (try_pop(value))
+            {
+                after_pop(1);
+                return HPX_MOVE(*value);
+            }
+            return receive().get();
+        }
+
+        // Send all given values, suspending whenever the channel is full.
+        hpx::future<void> send_n(std::vector<T> values)
+        {
+            auto* op = new send_n_promise(*this, HPX_MOVE(values));
+            hpx::future<void> f = op->promise.get_future();
+            do_send_n(*op);
+            return f;
+        }
+
+        void send_n(hpx::launch::sync_policy, std::vector<T> values)
+        {
+            send_n(HPX_MOVE(values)).get();
+        }
+
+        // Receive count values, suspending whenever the channel is empty.
+        // If the channel is closed before all values were received, the
+        // result holds the values received up to this point.
+        hpx::future<std::vector<T>> receive_n(std::size_t count)
+        {
+            auto* op = new receive_n_promise(*this, count);
+            hpx::future<std::vector<T>> f = op->promise.get_future();
+            do_receive_n(*op);
+            return f;
+        }
+
+        std::vector<T> receive_n(hpx::launch::sync_policy, std::size_t count)
+        {
+            return receive_n(count).get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Sender based operations
+
+    private:
+        struct send_sender;
+        struct receive_sender;
+
+    public:
+        // Return a sender which stores the given value in the channel once
+        // it is started. It completes with set_value() or, if the channel
+        // was closed, with set_error().
+        send_sender async_send(T t)
+        {
+            return send_sender{this, HPX_MOVE(t)};
+        }
+
+        // Return a sender which completes with the next value received from
+        // the channel, or with set_error() if the channel is empty and was
+        // closed.
+        receive_sender async_receive()
+        {
+            return receive_sender{this};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Close the channel. All pending and future send operations fail,
+        // receive operations fail once the channel is empty.
+        void close()
+        {
+            if (closed_.exchange(true, std::memory_order_acq_rel))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::lcos::local::ring_channel::close",
+                    "attempting to close an already closed channel");
+            }
+
+            notify(receivers_mtx_.data_, receivers_, receivers_waiting_,
+                std::size_t(-1));
+            notify(senders_mtx_.data_, senders_, senders_waiting_,
+                std::size_t(-1));
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // Claim up to count adjacent cells starting at the current position
+        // given by pos_counter. A cell at position p is ready if its
+        // sequence number is p + offset. Returns the number of claimed cells
+        // (zero if the first cell is not ready) and the first claimed
+        // position in pos.
+        std::size_t claim(std::atomic<std::size_t>& pos_counter,
+            std::size_t offset, std::size_t count, std::size_t& pos) noexcept
+        {
+            pos = pos_counter.load(std::memory_order_relaxed);
+            while (true)
+            {
+                std::size_t n = 0;
+                while (n != count)
+                {
+                    std::size_t const seq =
+                        buffer_[(pos + n) & mask_].sequence.load(
+                            std::memory_order_acquire);
+
+                    if (seq != pos + n + offset)
+                    {
+                        if (n == 0)
+                        {
+                            auto const diff = static_cast<std::intptr_t>(
+                                seq - (pos + offset));
+                            if (diff < 0)
+                            {
+                                return 0;    // empty or full
+                            }
+
+                            // another thread claimed this cell already
+                            pos = pos_counter.load(std::memory_order_relaxed);
+                            continue;
+                        }
+                        break;
+                    }
+                    ++n;
+                }
+
+                if (n == 0)
+                {
+                    return 0;    // count was zero
+                }
+
+                if (pos_counter.compare_exchange_weak(
+                        pos, pos + n, std::memory_order_relaxed))
+                {
+                    return n;
+                }
+            }
+        }
+
+        bool try_push(T& t)
+        {
+            std::size_t pos = 0;
+            if (claim(enqueue_pos_.data_, 0, 1, pos) == 0)
+            {
+                return false;
+            }
+
+            cell& c = buffer_[pos & mask_];
+            ::new (static_cast<void*>(&c.storage)) T(HPX_MOVE(t));
+            c.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool try_pop(hpx::optional<T>& value)
+        {
+            std::size_t pos = 0;
+            if (claim(dequeue_pos_.data_, 1, 1, pos) == 0)
+            {
+                return false;
+            }
+
+            cell& c = buffer_[pos & mask_];
+            value.emplace(HPX_MOVE(*c.get()));
+            std::destroy_at(c.get());
+            c.sequence.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+        template <typename Iterator>
+        std::size_t push_n(Iterator& first, std::size_t count)
+        {
+            std::size_t sent = 0;
+            while (sent != count)
+            {
+                std::size_t pos = 0;
+                std::size_t const n =
+                    claim(enqueue_pos_.data_, 0, count - sent, pos);
+                if (n == 0)
+                {
+                    break;
+                }
+
+                for (std::size_t i = 0; i != n; ++i, ++first)
+                {
+                    cell& c = buffer_[(pos + i) & mask_];
+                    ::new (static_cast<void*>(&c.storage)) T(HPX_MOVE(*first));
+                    c.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+                sent += n;
+            }
+            return sent;
+        }
+
+        // Every value is moved out of its cell and the cell is released
+        // before the value is written to dest. Several cells are claimed at
+        // once only if writing to dest can't throw, otherwise an exception
+        // would leave the remaining claimed cells behind.
+        template <typename OutputIterator>
+        std::size_t pop_n(OutputIterator& dest, std::size_t count)
+        {
+            constexpr bool nothrow_output =
+                noexcept(*std::declval<OutputIterator&>() =
+                             std::declval<T&&>()) &&
+                noexcept(++std::declval<OutputIterator&>());
+
+            std::size_t received = 0;
+            while (received != count)
+            {
+                std::size_t pos = 0;
+                std::size_t const n = claim(dequeue_pos_.data_, 1,
+                    nothrow_output ? count - received : 1, pos);
+                if (n == 0)
+                {
+                    break;
+                }
+
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    cell& c = buffer_[(pos + i) & mask_];
+                    T value(HPX_MOVE(*c.get()));
+                    std::destroy_at(c.get());
+                    c.sequence.store(
+                        pos + i + mask_ + 1, std::memory_order_release);
+
+                    if constexpr (nothrow_output)
+                    {
+                        *dest = HPX_MOVE(value);
+                        ++dest;
+                    }
+                    else
+                    {
+                        // the waiting senders have to be notified about the
+                        // released cells even if writing the value fails
+                        hpx::detail::try_catch_exception_ptr(
+                            [&]() {
+                                *dest = HPX_MOVE(value);
+                                ++dest;
+                            },
+                            [&](std::exception_ptr ep) {
+                                after_pop(received + 1);
+                                std::rethrow_exception(HPX_MOVE(ep));
+                            });
+                    }
+                }
+                received += n;
+            }
+            return received;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Resume up to count waiting operations of the given list.
+        void notify(mutex_type& mtx, detail::ring_channel_waiters& waiters,
+            std::atomic<std::size_t>& waiting, std::size_t count)
+        {
+            detail::ring_channel_waiter* w = nullptr;
+            {
+                std::lock_guard<mutex_type> l(mtx);
+                w = waiters.pop(count);
+                waiting.store(waiters.size(), std::memory_order_relaxed);
+            }
+
+            if (w != nullptr)
+            {
+                resume(w);
+            }
+        }
+
+        // Resume the given operations. Operations resumed while another
+        // thread (or an enclosing invocation on this thread) is resuming
+        // operations are handed over to that thread instead of being
+        // resumed recursively.
+        void resume(detail::ring_channel_waiter* w)
+        {
+            {
+                std::lock_guard<mutex_type> l(resumed_mtx_.data_);
+                resumed_.push_all(w);
+                if (resuming_)
+                {
+                    return;
+                }
+                resuming_ = true;
+            }
+
+            while (true)
+            {
+                {
+                    std::lock_guard<mutex_type> l(resumed_mtx_.data_);
+                    w = resumed_.pop(std::size_t(-1));
+                    if (w == nullptr)
+                    {
+                        resuming_ = false;
+                        break;
+                    }
+                }
+
+                while (w != nullptr)
+                {
+                    // the operation may be destroyed by retry()
+                    detail::ring_channel_waiter* next = w->next;
+                    w->retry();
+                    w = next;
+                }
+            }
+        }
+
+        // The fences in after_push/after_pop and in wait_for_item/
+        // wait_for_slot guarantee that either the producer (consumer) sees
+        // the waiting operation or the waiting operation sees the item
+        // (free slot), which prevents lost wake-ups.
+        void after_push(std::size_t count)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (receivers_waiting_.load(std::memory_order_relaxed) != 0)
+            {
+                notify(receivers_mtx_.data_, receivers_, receivers_waiting_,
+                    count);
+            }
+        }
+
+        void after_pop(std::size_t count)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (senders_waiting_.load(std::memory_order_relaxed) != 0)
+            {
+                notify(
+                    senders_mtx_.data_, senders_, senders_waiting_, count);
+            }
+        }
+
+        // Register a receive operation, returns false if the operation has
+        // to try again right away as an item became available or the channel
+        // was closed in the meantime.
+        bool wait_for_item(detail::ring_channel_waiter& w)
+        {
+            std::lock_guard<mutex_type> l(receivers_mtx_.data_);
+
+            receivers_waiting_.store(
+                receivers_.size() + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::size_t const pos =
+                dequeue_pos_.data_.load(std::memory_order_relaxed);
+            std::size_t const seq =
+                buffer_[pos & mask_].sequence.load(std::memory_order_acquire);
+
+            if (is_closed() ||
+                static_cast<std::intptr_t>(seq - (pos + 1)) >= 0)
+            {
+                receivers_waiting_.store(
+                    receivers_.size(), std::memory_order_relaxed);
+                return false;
+            }
+
+            receivers_.push(&w);
+            return true;
+        }
+
+        // Register a send operation, returns false if the operation has to
+        // try again right away as a slot became available or the channel was
+        // closed in the meantime.
+        bool wait_for_slot(detail::ring_channel_waiter& w)
+        {
+            std::lock_guard<mutex_type> l(senders_mtx_.data_);
+
+            senders_waiting_.store(
+                senders_.size() + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::size_t const pos =
+                enqueue_pos_.data_.load(std::memory_order_relaxed);
+            std::size_t const seq =
+                buffer_[pos & mask_].sequence.load(std::memory_order_acquire);
+
+            if (is_closed() || static_cast<std::intptr_t>(seq - pos) >= 0)
+            {
+                senders_waiting_.store(
+                    senders_.size(), std::memory_order_relaxed);
+                return false;
+            }
+
+            senders_.push(&w);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The operations invoke set_value()/set_closed() on Operation exactly
+        // once, the operation must not be accessed afterwards. If they throw,
+        // the operation was not completed yet.
+        template <typename Operation>
+        void do_send(Operation& op)
+        {
+            do
+            {
+                if (is_closed())
+                {
+                    op.set_closed();
+                    return;
+                }
+
+                if (try_push(op.value))
+                {
+                    after_push(1);
+                    op.set_value();
+                    return;
+                }
+            } while (!wait_for_slot(op));
+        }
+
+        template <typename Operation>
+        void do_receive(Operation& op)
+        {
+            do
+            {
+                // all items sent before the channel was closed are visible
+                // once the closed flag was observed
+                bool const closed = is_closed();
+
+                hpx::optional<T> value;
+                if (try_pop(value))
+                {
+                    after_pop(1);
+                    op.set_value(HPX_MOVE(*value));
+                    return;
+                }
+
+                if (closed)
+                {
+                    op.set_closed();
+                    return;
+                }
+            } while (!wait_for_item(op));
+        }
+
+        template <typename Operation>
+        void do_send_n(Operation& op)
+        {
+            do
+            {
+                if (is_closed())
+                {
+                    op.set_closed();
+                    return;
+                }
+
+                auto it = op.values.begin() + op.sent;
+                std::size_t const sent =
+                    push_n(it, op.values.size() - op.sent);
+                if (sent != 0)
+                {
+                    after_push(sent);
+                    op.sent += sent;
+                }
+
+                if (op.sent == op.values.size())
+                {
+                    op.set_value();
+                    return;
+                }
+            } while (!wait_for_slot(op));
+        }
+
+        template <typename Operation>
+        void do_receive_n(Operation& op)
+        {
+            do
+            {
+                bool const closed = is_closed();
+
+                detail::ring_channel_reserved_inserter<T> it(op.values);
+                std::size_t const received =
+                    pop_n(it, op.count - op.values.size());
+                if (received != 0)
+                {
+                    after_pop(received);
+                }
+
+                if (op.values.size() == op.count || closed)
+                {
+                    op.set_value();
+                    return;
+                }
+            } while (!wait_for_item(op));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct send_promise final : detail::ring_channel_waiter
+        {
+            send_promise(ring_channel& ch, T&& t)
+              : channel(ch)
+              , value(HPX_MOVE(t))
+            {
+            }
+
+            void retry() noexcept override
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [this]() { channel.do_send(*this); },
+                    [this](std::exception_ptr ep) { set_error(HPX_MOVE(ep)); });
+            }
+
+            void set_value()
+            {
+                promise.set_value();
+                delete this;
+            }
+
+            void set_closed()
+            {
+                set_error(
+                    closed_error("hpx::lcos::local::ring_channel::send"));
+            }
+
+            void set_error(std::exception_ptr ep)
+            {
+                promise.set_exception(HPX_MOVE(ep));
+                delete this;
+            }
+
+            ring_channel& channel;
+            T value;
+            hpx::promise<void> promise;
+        };
+
+        struct receive_promise final : detail::ring_channel_waiter
+        {
+            explicit receive_promise(ring_channel& ch)
+              : channel(ch)
+            {
+            }
+
+            void retry() noexcept override
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [this]() { channel.do_receive(*this); },
+                    [this](std::exception_ptr ep) { set_error(HPX_MOVE(ep)); });
+            }
+
+            void set_value(T&& t)
+            {
+                promise.set_value(HPX_MOVE(t));
+                delete this;
+            }
+
+            void set_closed()
+            {
+                set_error(
+                    closed_error("hpx::lcos::local::ring_channel::receive"));
+            }
+
+            void set_error(std::exception_ptr ep)
+            {
+                promise.set_exception(HPX_MOVE(ep));
+                delete this;
+            }
+
+            ring_channel& channel;
+            hpx::promise<T> promise;
+        };
+
+        struct send_n_promise final : detail::ring_channel_waiter
+        {
+            send_n_promise(ring_channel& ch, std::vector<T>&& v)
+              : channel(ch)
+              , values(HPX_MOVE(v))
+            {
+            }
+
+            void retry() noexcept override
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [this]() { channel.do_send_n(*this); },
+                    [this](std::exception_ptr ep) { set_error(HPX_MOVE(ep)); });
+            }
+
+            void set_value()
+            {
+                promise.set_value();
+                delete this;
+            }
+
+            void set_closed()
+            {
+                set_error(
+                    closed_error("hpx::lcos::local::ring_channel::send_n"));
+            }
+
+            void set_error(std::exception_ptr ep)
+            {
+                promise.set_exception(HPX_MOVE(ep));
+                delete this;
+            }
+
+            ring_channel& channel;
+            std::vector<T> values;
+            std::size_t sent = 0;
+            hpx::promise<void> promise;
+        };
+
+        struct receive_n_promise final : detail::ring_channel_waiter
+        {
+            receive_n_promise(ring_channel& ch, std::size_t n)
+              : channel(ch)
+              , count(n)
+            {
+                values.reserve(count);
+            }
+
+            void retry() noexcept override
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [this]() { channel.do_receive_n(*this); },
+                    [this](std::exception_ptr ep) { set_error(HPX_MOVE(ep)); });
+            }
+
+            void set_value()
+            {
+                promise.set_value(HPX_MOVE(values));
+                delete this;
+            }
+
+            void set_error(std::exception_ptr ep)
+            {
+                promise.set_exception(HPX_MOVE(ep));
+                delete this;
+            }
+
+            ring_channel& channel;
+            std::size_t count;
+            std::vector<T> values;
+            hpx::promise<std::vector<T>> promise;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct send_sender
+        {
+            ring_channel* channel;
+            T value;
+
+#if defined(HPX_HAVE_STDEXEC)
+            using sender_concept = hpx::execution::experimental::sender_t;
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                send_sender const&, Env const&)
+                -> hpx::execution::experimental::completion_signatures<
+                    hpx::execution::experimental::set_value_t(),
+                    hpx::execution::experimental::set_error_t(
+                        std::exception_ptr)>;
+#else
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                send_sender const&, Env) -> generate_completion_signatures<Env>;
+#endif
+
+            template <typename R>
+            struct operation_state final : detail::ring_channel_waiter
+            {
+                template <typename R_>
+                operation_state(R_&& r, ring_channel* ch, T&& t)
+                  : receiver(HPX_FORWARD(R_, r))
+                  , channel(ch)
+                  , value(HPX_MOVE(t))
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void retry() noexcept override
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [this]() { channel->do_send(*this); },
+                        [this](std::exception_ptr ep) {
+                            set_error(HPX_MOVE(ep));
+                        });
+                }
+
+                void set_value()
+                {
+                    hpx::execution::experimental::set_value(
+                        HPX_MOVE(receiver));
+                }
+
+                void set_closed()
+                {
+                    set_error(closed_error(
+                        "hpx::lcos::local::ring_channel::async_send"));
+                }
+
+                void set_error(std::exception_ptr ep)
+                {
+                    hpx::execution::experimental::set_error(
+                        HPX_MOVE(receiver), HPX_MOVE(ep));
+                }
+
+                // the first attempt is the same as any later one
+                friend void tag_invoke(hpx::execution::experimental::start_t,
+                    operation_state& os) noexcept
+                {
+                    os.retry();
+                }
+
+                std::decay_t<R> receiver;
+                ring_channel* channel;
+                T value;
+            };
+
+            template <typename R>
+            friend auto tag_invoke(hpx::execution::experimental::connect_t,
+                send_sender&& s, R&& r)
+            {
+                return operation_state<R>{
+                    HPX_FORWARD(R, r), s.channel, HPX_MOVE(s.value)};
+            }
+        };
+
+        struct receive_sender
+        {
+            ring_channel* channel;
+
+#if defined(HPX_HAVE_STDEXEC)
+            using sender_concept = hpx::execution::experimental::sender_t;
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                receive_sender const&, Env const&)
+                -> hpx::execution::experimental::completion_signatures<
+                    hpx::execution::experimental::set_value_t(T),
+                    hpx::execution::experimental::set_error_t(
+                        std::exception_ptr)>;
+#else
+            template <typename Env>
+            struct generate_completion_signatures
+            {
+                template <template <typename...> typename Tuple,
+                    template <typename...> typename Variant>
+                using value_types = Variant<Tuple<T>>;
+
+                template <template <typename...> typename Variant>
+                using error_types = Variant<std::exception_ptr>;
+
+                static constexpr bool sends_stopped = false;
+            };
+
+            template <typename Env>
+            friend auto tag_invoke(
+                hpx::execution::experimental::get_completion_signatures_t,
+                receive_sender const&, Env)
+                -> generate_completion_signatures<Env>;
+#endif
+
+            template <typename R>
+            struct operation_state final : detail::ring_channel_waiter
+            {
+                template <typename R_>
+                operation_state(R_&& r, ring_channel* ch)
+                  : receiver(HPX_FORWARD(R_, r))
+                  , channel(ch)
+                {
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void retry() noexcept override
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [this]() { channel->do_receive(*this); },
+                        [this](std::exception_ptr ep) {
+                            set_error(HPX_MOVE(ep));
+                        });
+                }
+
+                void set_value(T&& t)
+                {
+                    hpx::execution::experimental::set_value(
+                        HPX_MOVE(receiver), HPX_MOVE(t));
+                }
+
+                void set_closed()
+                {
+                    set_error(closed_error(
+                        "hpx::lcos::local::ring_channel::async_receive"));
+                }
+
+                void set_error(std::exception_ptr ep)
+                {
+                    hpx::execution::experimental::set_error(
+                        HPX_MOVE(receiver), HPX_MOVE(ep));
+                }
+
+                // the first attempt is the same as any later one
+                friend void tag_invoke(hpx::execution::experimental::start_t,
+                    operation_state& os) noexcept
+                {
+                    os.retry();
+                }
+
+                std::decay_t<R> receiver;
+                ring_channel* channel;
+            };
+
+            template <typename R>
+            friend auto tag_invoke(hpx::execution::experimental::connect_t,
+                receive_sender&& s, R&& r)
+            {
+                return operation_state<R>{HPX_FORWARD(R, r), s.channel};
+            }
+        };
+
+    private:
+        // keep the positions and the waiting operations in separate cache
+        // lines
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> enqueue_pos_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> dequeue_pos_;
+
+        mutable hpx::util::cache_aligned_data<mutex_type> receivers_mtx_;
+        detail::ring_channel_waiters receivers_;
+        std::atomic<std::size_t> receivers_waiting_{0};
+
+        mutable hpx::util::cache_aligned_data<mutex_type> senders_mtx_;
+        detail::ring_channel_waiters senders_;
+        std::atomic<std::size_t> senders_waiting_{0};
+
+        // operations which are about to be resumed
+        mutable hpx::util::cache_aligned_data<mutex_type> resumed_mtx_;
+        detail::ring_channel_waiters resumed_;
+        bool resuming_ = false;
+
+        std::atomic<bool> closed_{false};
+
+        std::size_t mask_;
+        std::unique_ptr<cell[]> buffer_;
+    };
+}    // namespace hpx::lcos::local
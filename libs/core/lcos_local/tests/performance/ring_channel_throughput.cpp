@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of ring_channel with the existing local channels
+// using multiple producers and consumers.
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/lcos_local/channel.hpp>
+#include <hpx/lcos_local/ring_channel.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data() = default;
+
+    explicit data(int d)
+    {
+        data_[0] = d;
+    }
+
+    int data_[8];
+};
+
+#if HPX_DEBUG
+constexpr int NUM_TESTS = 100000;
+#else
+constexpr int NUM_TESTS = 10000000;
+#endif
+
+constexpr std::size_t capacity = 1024;
+constexpr std::size_t batch_size = 64;
+
+///////////////////////////////////////////////////////////////////////////////
+// Number of values transferred by task i out of num_tasks
+int share(std::size_t i, std::size_t num_tasks)
+{
+    int const n = static_cast<int>(num_tasks);
+    return NUM_TESTS / n + (static_cast<int>(i) < NUM_TESTS % n ? 1 : 0);
+}
+
+// Run num_producers instances of produce(count) and num_consumers instances
+// of consume(count), each transferring its share of NUM_TESTS values, and
+// print the resulting throughput.
+template <typename Produce, typename Consume>
+void measure(std::string const& name, std::size_t num_producers,
+    std::size_t num_consumers, Produce&& produce, Consume&& consume)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_producers + num_consumers);
+
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        tasks.push_back(hpx::async(produce, share(i, num_producers)));
+    }
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        tasks.push_back(hpx::async(consume, share(i, num_consumers)));
+    }
+
+    hpx::wait_all(tasks);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    double elapsed = static_cast<double>(end - start) / 1e9;
+    std::cout << name << " (" << num_producers << "x" << num_consumers
+              << "): " << (NUM_TESTS / elapsed) << " [op/s] ("
+              << (elapsed / NUM_TESTS) << " [s/op])\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void channel_mpmc_yield(std::size_t num_producers, std::size_t num_consumers)
+{
+    hpx::lcos::local::channel_mpmc<data> c(capacity);
+
+    measure(
+        "channel_mpmc (yield)", num_producers, num_consumers,
+        [&c](int count) {
+            for (int i = 0; i != count; ++i)
+            {
+                data d{i};
+                while (!c.set(std::move(d)))    // NOLINT
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+        },
+        [&c](int count) {
+            data d;
+            for (int i = 0; i != count; ++i)
+            {
+                while (!c.get(&d))
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+        });
+}
+
+void local_channel(std::size_t num_producers, std::size_t num_consumers)
+{
+    // note: this channel is unbounded, producers never have to wait
+    hpx::lcos::local::channel<data> c;
+
+    measure(
+        "channel", num_producers, num_consumers,
+        [&c](int count) {
+            for (int i = 0; i != count; ++i)
+            {
+                c.set(hpx::launch::sync, data{i});
+            }
+        },
+        [&c](int count) {
+            for (int i = 0; i != count; ++i)
+            {
+                c.get(hpx::launch::sync);
+            }
+        });
+}
+
+void ring_channel_sync(std::size_t num_producers, std::size_t num_consumers)
+{
+    hpx::lcos::local::ring_channel<data> c(capacity);
+
+    measure(
+        "ring_channel (sync)", num_producers, num_consumers,
+        [&c](int count) {
+            for (int i = 0; i != count; ++i)
+            {
+                c.send(hpx::launch::sync, data{i});
+            }
+        },
+        [&c](int count) {
+            for (int i = 0; i != count; ++i)
+            {
+                c.receive(hpx::launch::sync);
+            }
+        });
+}
+
+void ring_channel_batch(std::size_t num_producers, std::size_t num_consumers)
+{
+    hpx::lcos::local::ring_channel<data> c(capacity);
+
+    measure(
+        "ring_channel (batch)", num_producers, num_consumers,
+        [&c](int count) {
+            std::vector<data> values(batch_size);
+            for (int i = 0; i < count; i += static_cast<int>(batch_size))
+            {
+                std::size_t n =
+                    (std::min)(batch_size, static_cast<std::size_t>(count - i));
+                values.resize(n);
+                c.send_n(hpx::launch::sync, std::move(values));
+            }
+        },
+        [&c](int count) {
+            for (int i = 0; i < count; i += static_cast<int>(batch_size))
+            {
+                std::size_t n =
+                    (std::min)(batch_size, static_cast<std::size_t>(count - i));
+                c.receive_n(hpx::launch::sync, n);
+            }
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    std::size_t const half = (std::max)(num_threads / 2, std::size_t(1));
+
+    std::vector<std::pair<std::size_t, std::size_t>> configurations = {
+        {1, 1}, {half, 1}, {1, half}, {half, half}};
+
+    for (auto const& config : configurations)
+    {
+        channel_mpmc_yield(config.first, config.second);
+        local_channel(config.first, config.second);
+        ring_channel_sync(config.first, config.second);
+        ring_channel_batch(config.first, config.second);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
@@ -0,0 +1,343 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/lcos_local/ring_channel.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::execution::experimental::then;
+using hpx::this_thread::experimental::sync_wait;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_operations()
+{
+    hpx::lcos::local::ring_channel<std::string> c(3);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.try_send(std::to_string(i)));
+    }
+
+    std::string rejected("rejected");
+    HPX_TEST(!c.try_send(rejected));
+    HPX_TEST_EQ(rejected, std::string("rejected"));
+
+    for (int i = 0; i != 4; ++i)
+    {
+        std::string value;
+        HPX_TEST(c.try_receive(value));
+        HPX_TEST_EQ(value, std::to_string(i));
+    }
+
+    std::string value;
+    HPX_TEST(!c.try_receive(value));
+
+    // batches wrap around the end of the ring
+    std::vector<std::string> values = {"a", "b", "c", "d", "e"};
+    HPX_TEST_EQ(c.try_send_n(values.begin(), values.size()), std::size_t(4));
+
+    std::vector<std::string> received;
+    HPX_TEST_EQ(c.try_receive_n(std::back_inserter(received), 10),
+        std::size_t(4));
+    HPX_TEST(received == std::vector<std::string>(values.begin(),
+                             values.begin() + 4));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// output iterator which throws when writing the value with the given index
+struct throwing_output_iterator
+{
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    throwing_output_iterator& operator=(int value)
+    {
+        if (values->size() == throw_at)
+        {
+            throw std::runtime_error("throwing_output_iterator");
+        }
+        values->push_back(value);
+        return *this;
+    }
+
+    throwing_output_iterator& operator*()
+    {
+        return *this;
+    }
+
+    throwing_output_iterator& operator++()
+    {
+        return *this;
+    }
+
+    std::vector<int>* values;
+    std::size_t throw_at;
+};
+
+void test_throwing_output_iterator()
+{
+    hpx::lcos::local::ring_channel<int> c(4);
+
+    std::vector<int> values = {0, 1, 2, 3};
+    HPX_TEST_EQ(c.try_send_n(values.begin(), values.size()), std::size_t(4));
+
+    // the value which could not be written is lost, all others are kept
+    std::vector<int> received;
+    bool caught = false;
+    try
+    {
+        c.try_receive_n(throwing_output_iterator{&received, 1}, 4);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught = true;
+    }
+    HPX_TEST(caught);
+    HPX_TEST(received == std::vector<int>{0});
+
+    HPX_TEST_EQ(c.try_receive_n(std::back_inserter(received), 4),
+        std::size_t(2));
+    HPX_TEST((received == std::vector<int>{0, 2, 3}));
+
+    // the released cells can be used again
+    values = {4, 5, 6, 7};
+    HPX_TEST_EQ(c.try_send_n(values.begin(), values.size()), std::size_t(4));
+    HPX_TEST_EQ(c.receive(hpx::launch::sync), 4);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_future_operations()
+{
+    hpx::lcos::local::ring_channel<int> c(2);
+
+    // receiving from an empty channel suspends until a value is sent
+    hpx::future<int> f = c.receive();
+    HPX_TEST(!f.is_ready());
+
+    c.send(hpx::launch::sync, 42);
+    HPX_TEST_EQ(f.get(), 42);
+
+    // sending to a full channel suspends until a value is received
+    c.send(hpx::launch::sync, 1);
+    c.send(hpx::launch::sync, 2);
+    hpx::future<void> s = c.send(3);
+    HPX_TEST(!s.is_ready());
+
+    HPX_TEST_EQ(c.receive(hpx::launch::sync), 1);
+    s.get();
+    HPX_TEST_EQ(c.receive(hpx::launch::sync), 2);
+    HPX_TEST_EQ(c.receive(hpx::launch::sync), 3);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_batch_operations()
+{
+    hpx::lcos::local::ring_channel<int> c(4);
+
+    constexpr int count = 1000;
+
+    std::vector<int> values;
+    for (int i = 0; i != count; ++i)
+    {
+        values.push_back(i);
+    }
+
+    hpx::future<void> sent = c.send_n(std::move(values));
+    std::vector<int> received = c.receive_n(hpx::launch::sync, count);
+    sent.get();
+
+    HPX_TEST_EQ(received.size(), std::size_t(count));
+    for (int i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(received[i], i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sender_operations()
+{
+    hpx::lcos::local::ring_channel<int> c(2);
+
+    sync_wait(c.async_send(1));
+
+    int value = 0;
+    sync_wait(c.async_receive() | then([&](int v) { value = v; }));
+    HPX_TEST_EQ(value, 1);
+
+    // a receive which is started on an empty channel completes once a value
+    // is sent
+    hpx::future<void> f = hpx::async([&] {
+        sync_wait(c.async_receive() | then([&](int v) { value = v; }));
+    });
+
+    c.send(hpx::launch::sync, 2);
+    f.get();
+    HPX_TEST_EQ(value, 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Every received value completes an operation which sends the next value,
+// which resumes the next waiting receive operation. The waiting operations
+// must not be resumed recursively, otherwise the stack overflows.
+void test_resume_chain()
+{
+    hpx::lcos::local::ring_channel<int> c(2);
+
+    constexpr int count = 10000;
+
+    std::vector<hpx::future<void>> chain;
+    chain.reserve(count);
+    for (int i = 0; i != count; ++i)
+    {
+        chain.push_back(
+            c.receive().then(hpx::launch::sync, [&c](hpx::future<int>&& f) {
+                c.send(hpx::launch::sync, f.get() + 1);
+            }));
+    }
+
+    c.send(hpx::launch::sync, 0);
+
+    for (auto& f : chain)
+    {
+        f.get();
+    }
+    HPX_TEST_EQ(c.receive(hpx::launch::sync), count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_close()
+{
+    hpx::lcos::local::ring_channel<int> c(4);
+
+    hpx::future<int> pending = c.receive();
+
+    c.send(hpx::launch::sync, 1);
+    HPX_TEST_EQ(pending.get(), 1);
+
+    c.send(hpx::launch::sync, 2);
+
+    pending = c.receive();
+    HPX_TEST_EQ(pending.get(), 2);
+
+    pending = c.receive();
+    c.close();
+
+    // pending and new receive operations fail once the channel is empty
+    bool caught_exception = false;
+    try
+    {
+        pending.get();
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        c.send(hpx::launch::sync, 3);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    HPX_TEST(c.receive_n(hpx::launch::sync, 10).empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_mpmc(std::size_t num_producers, std::size_t num_consumers)
+{
+    // a small capacity to make producers and consumers wait
+    hpx::lcos::local::ring_channel<std::int64_t> c(8);
+
+    constexpr std::int64_t count = 10000;
+
+    std::vector<hpx::future<void>> producers;
+    for (std::size_t p = 0; p != num_producers; ++p)
+    {
+        producers.push_back(hpx::async([&c]() {
+            for (std::int64_t i = 0; i != count; ++i)
+            {
+                if (i % 2 == 0)
+                    c.send(hpx::launch::sync, i);
+                else
+                    c.send(i).get();
+            }
+        }));
+    }
+
+    std::int64_t const total = count * std::int64_t(num_producers);
+    std::atomic<std::int64_t> received(0);
+    std::atomic<std::int64_t> sum(0);
+
+    std::vector<hpx::future<void>> consumers;
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async([&]() {
+            while (received.fetch_add(1) < total)
+            {
+                sum += c.receive(hpx::launch::sync);
+            }
+        }));
+    }
+
+    hpx::wait_all(producers);
+    hpx::wait_all(consumers);
+
+    HPX_TEST_EQ(
+        sum.load(), std::int64_t(num_producers) * count * (count - 1) / 2);
+
+    std::int64_t value = 0;
+    HPX_TEST(!c.try_receive(value));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_try_operations();
+    test_throwing_output_iterator();
+    test_future_operations();
+    test_batch_operations();
+    test_sender_operations();
+    test_resume_chain();
+    test_close();
+
+    test_mpmc(1, 1);
+    test_mpmc(4, 1);
+    test_mpmc(1, 4);
+    test_mpmc(4, 4);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
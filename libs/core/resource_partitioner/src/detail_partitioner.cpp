@@ -142,6 +142,9 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::local_priority_lifo:
             sched = "local_priority_lifo";
             break;
+        case resource::scheduling_policy::local_priority_chase_lev:
+            sched = "local_priority_chase_lev";
+            break;
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         case resource::scheduling_policy::local_workrequesting_fifo:
             sched = "local_workrequesting_fifo";
@@ -152,10 +155,14 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::local_workrequesting_mc:
             sched = "local_workrequesting_mc";
             break;
+        case resource::scheduling_policy::local_workrequesting_chase_lev:
+            sched = "local_workrequesting_chase_lev";
+            break;
 #else
         case resource::scheduling_policy::local_workrequesting_fifo:
         case resource::scheduling_policy::local_workrequesting_lifo:
         case resource::scheduling_policy::local_workrequesting_mc:
+        case resource::scheduling_policy::local_workrequesting_chase_lev:
             sched = "unknown";
             break;
 #endif
@@ -493,6 +500,12 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::local_priority_lifo;
         }
+        else if (0 ==
+            std::string("local-priority-chase-lev")
+                .find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_priority_chase_lev;
+        }
 #if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
         else if (0 ==
             std::string("local-workrequesting-fifo")
@@ -511,6 +524,13 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::local_workrequesting_mc;
         }
+        else if (0 ==
+            std::string("local-workrequesting-chase-lev")
+                .find(default_scheduler_str))
+        {
+            default_scheduler =
+                scheduling_policy::local_workrequesting_chase_lev;
+        }
 #endif
         else if (0 == std::string("static").find(default_scheduler_str))
         {
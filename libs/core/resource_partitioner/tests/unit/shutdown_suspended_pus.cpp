@@ -79,6 +79,7 @@ int main(int argc, char* argv[])
         std::vector<hpx::resource::scheduling_policy> schedulers = {
             hpx::resource::scheduling_policy::local,
             hpx::resource::scheduling_policy::local_priority_fifo,
+            hpx::resource::scheduling_policy::local_priority_chase_lev,
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
             hpx::resource::scheduling_policy::local_priority_lifo,
 #endif
@@ -98,6 +99,7 @@ int main(int argc, char* argv[])
             hpx::resource::scheduling_policy::local_workrequesting_lifo,
 #endif
             hpx::resource::scheduling_policy::local_workrequesting_mc,
+            hpx::resource::scheduling_policy::local_workrequesting_chase_lev,
 #endif
         };
 
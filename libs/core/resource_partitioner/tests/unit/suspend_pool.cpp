@@ -183,6 +183,7 @@ int main(int argc, char* argv[])
     std::vector<hpx::resource::scheduling_policy> const schedulers = {
         hpx::resource::scheduling_policy::local,
         hpx::resource::scheduling_policy::local_priority_fifo,
+        hpx::resource::scheduling_policy::local_priority_chase_lev,
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
         hpx::resource::scheduling_policy::local_priority_lifo,
 #endif
@@ -200,6 +201,7 @@ int main(int argc, char* argv[])
         hpx::resource::scheduling_policy::local_workrequesting_lifo,
 #endif
         hpx::resource::scheduling_policy::local_workrequesting_mc,
+        hpx::resource::scheduling_policy::local_workrequesting_chase_lev,
 #endif
     };
 
@@ -199,6 +199,7 @@ int main(int argc, char* argv[])
     std::vector<hpx::resource::scheduling_policy> schedulers = {
         hpx::resource::scheduling_policy::local,
         hpx::resource::scheduling_policy::local_priority_fifo,
+        hpx::resource::scheduling_policy::local_priority_chase_lev,
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
         hpx::resource::scheduling_policy::local_priority_lifo,
         hpx::resource::scheduling_policy::abp_priority_fifo,
@@ -214,6 +215,7 @@ int main(int argc, char* argv[])
         hpx::resource::scheduling_policy::local_workrequesting_lifo,
 #endif
         hpx::resource::scheduling_policy::local_workrequesting_mc,
+        hpx::resource::scheduling_policy::local_workrequesting_chase_lev,
 #endif
     };
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/ini/ini.hpp>
 #include <hpx/modules/filesystem.hpp>
@@ -112,6 +113,10 @@ namespace hpx::util {
         bool use_stack_guard_pages() const;
 #endif
 
+        // Return the configuration of the coroutine stack pool
+        threads::coroutines::detail::stack_pool_parameters
+        get_stack_pool_parameters() const;
+
         // return trace_depth for stack-backtraces
         std::size_t trace_depth() const;
 
@@ -191,6 +191,16 @@ namespace hpx::util {
             "[hpx.lcos.collectives]",
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
             "cut_off = ${HPX_LCOS_COLLECTIVES_CUT_OFF:-1}",
+            "p2p_threshold = ${HPX_LCOS_COLLECTIVES_P2P_THRESHOLD:32}",
+            "segmented_threshold = "
+            "${HPX_LCOS_COLLECTIVES_SEGMENTED_THRESHOLD:65536}",
+
+            "[hpx.lcos.collectives.algorithm]",
+            "all_gather = ${HPX_LCOS_COLLECTIVES_ALL_GATHER:automatic}",
+            "all_reduce = ${HPX_LCOS_COLLECTIVES_ALL_REDUCE:automatic}",
+            "all_to_all = ${HPX_LCOS_COLLECTIVES_ALL_TO_ALL:automatic}",
+            "broadcast = ${HPX_LCOS_COLLECTIVES_BROADCAST:automatic}",
+            "reduce = ${HPX_LCOS_COLLECTIVES_REDUCE:automatic}",
 
             // connect back to the given latch if specified
             "[hpx.on_startup]",
@@ -216,6 +226,15 @@ namespace hpx::util {
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
 #endif
 
+            "[hpx.stacks.pool]",
+            "enable = ${HPX_STACK_POOL:0}",
+            "low_watermark = ${HPX_STACK_POOL_LOW_WATERMARK:0}",
+            "high_watermark = ${HPX_STACK_POOL_HIGH_WATERMARK:256}",
+            "thread_cache_size = ${HPX_STACK_POOL_THREAD_CACHE_SIZE:16}",
+            "use_huge_pages = ${HPX_STACK_POOL_USE_HUGE_PAGES:0}",
+            "release_on_reset = ${HPX_STACK_POOL_RELEASE_ON_RESET:0}",
+            "lazy_binding = ${HPX_STACK_POOL_LAZY_BINDING:0}",
+
             "[hpx.threadpools]",
 #if defined(HPX_HAVE_IO_POOL)
             "io_pool_size = ${HPX_NUM_IO_POOL_SIZE:" HPX_PP_STRINGIZE(
@@ -258,6 +277,22 @@ namespace hpx::util {
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
 
+            "[hpx.scheduler]",
+            "hierarchical_stealing = ${HPX_SCHEDULER_HIERARCHICAL_STEALING:1}",
+            "steal_cache_level = ${HPX_SCHEDULER_STEAL_CACHE_LEVEL:3}",
+            "min_remote_steal_backoff = "
+            "${HPX_SCHEDULER_MIN_REMOTE_STEAL_BACKOFF:2}",
+            "max_remote_steal_backoff = "
+            "${HPX_SCHEDULER_MAX_REMOTE_STEAL_BACKOFF:64}",
+
+            "[hpx.trace]",
+            "enabled = ${HPX_TRACE_ENABLED:0}",
+            "destination = "
+            "${HPX_TRACE_DESTINATION:hpx_trace.$[system.pid].bin}",
+            "buffer_size = ${HPX_TRACE_BUFFER_SIZE:65536}",
+            "flush_interval = ${HPX_TRACE_FLUSH_INTERVAL:100}",
+            "dependencies = ${HPX_TRACE_DEPENDENCIES:0}",
+
             "[hpx.commandline]",
             // enable aliasing
             "aliasing = ${HPX_COMMANDLINE_ALIASING:1}",
@@ -1103,6 +1138,34 @@ namespace hpx::util {
     }
 #endif
 
+    threads::coroutines::detail::stack_pool_parameters
+    runtime_configuration::get_stack_pool_parameters() const
+    {
+        threads::coroutines::detail::stack_pool_parameters params;
+        params.stack_sizes_ = {{small_stacksize, medium_stacksize,
+            large_stacksize, huge_stacksize}};
+
+        if (util::section const* sec = get_section("hpx.stacks.pool");
+            nullptr != sec)
+        {
+            params.enabled_ =
+                hpx::util::get_entry_as<int>(*sec, "enable", 0) != 0;
+            params.low_watermark_ = hpx::util::get_entry_as<std::size_t>(
+                *sec, "low_watermark", params.low_watermark_);
+            params.high_watermark_ = hpx::util::get_entry_as<std::size_t>(
+                *sec, "high_watermark", params.high_watermark_);
+            params.thread_cache_size_ = hpx::util::get_entry_as<std::size_t>(
+                *sec, "thread_cache_size", params.thread_cache_size_);
+            params.use_huge_pages_ =
+                hpx::util::get_entry_as<int>(*sec, "use_huge_pages", 0) != 0;
+            params.release_on_reset_ =
+                hpx::util::get_entry_as<int>(*sec, "release_on_reset", 0) != 0;
+            params.lazy_binding_ =
+                hpx::util::get_entry_as<int>(*sec, "lazy_binding", 0) != 0;
+        }
+        return params;
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
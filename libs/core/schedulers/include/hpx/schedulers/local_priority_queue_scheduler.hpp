@@ -653,6 +653,90 @@ namespace hpx::threads::policies {
             }
         }
 
+        // Create new threads for all given work items. Work items of normal
+        // priority without a hint are split into (at most) num_queues_
+        // contiguous batches which are assigned round-robin to the queues.
+        // Consecutive work items targeting the same queue are handed to that
+        // queue at once.
+        void create_threads(thread_init_data* first, thread_init_data* last,
+            error_code& ec) override
+        {
+            auto const count = static_cast<std::size_t>(last - first);
+            std::size_t const batch_size =
+                (count + num_queues_ - 1) / num_queues_;
+            std::size_t const start_queue = curr_queue_++;
+
+            thread_queue_type* batch_queue = nullptr;
+            thread_init_data* batch_first = first;
+            std::size_t num_unhinted = 0;
+
+            auto const flush_batch = [&](thread_init_data* batch_last) {
+                if (batch_queue != nullptr && batch_first != batch_last)
+                {
+                    batch_queue->create_threads(batch_first, batch_last, ec);
+                }
+            };
+
+            for (auto* it = first; it != last; ++it)
+            {
+                thread_queue_type* q = nullptr;
+                if (it->priority == thread_priority::normal ||
+                    it->priority == thread_priority::default_)
+                {
+                    // NOTE: This scheduler ignores NUMA hints.
+                    std::size_t num_thread = it->schedulehint.mode ==
+                            thread_schedule_hint_mode::thread ?
+                        it->schedulehint.hint :
+                        static_cast<std::size_t>(-1);
+
+                    if (static_cast<std::size_t>(-1) == num_thread)
+                    {
+                        num_thread =
+                            (start_queue + num_unhinted++ / batch_size) %
+                            num_queues_;
+                    }
+                    else if (num_thread >= num_queues_)
+                    {
+                        num_thread %= num_queues_;
+                    }
+
+                    num_thread = select_active_pu(num_thread);
+
+                    it->schedulehint.mode = thread_schedule_hint_mode::thread;
+                    it->schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+
+                    q = queues_[num_thread].data_;
+                }
+
+                if (q != batch_queue || q == nullptr)
+                {
+                    flush_batch(it);
+                    if (ec)
+                        return;
+
+                    batch_queue = q;
+                    batch_first = it;
+                }
+
+                // all other work items are created one by one
+                if (q == nullptr)
+                {
+                    create_thread(*it, nullptr, ec);
+                    if (ec)
+                        return;
+
+                    batch_first = it + 1;
+                }
+            }
+            flush_batch(last);
+
+            LTM_(debug).format(
+                "local_priority_queue_scheduler::create_threads: pool({}), "
+                "scheduler({}), created {} threads",
+                *this->get_parent_pool(), *this, count);
+        }
+
         bool attempt_stealing_pending(std::size_t num_thread,
             threads::thread_id_ref_type& thrd,
             [[maybe_unused]] thread_queue_type* this_high_priority_queue,
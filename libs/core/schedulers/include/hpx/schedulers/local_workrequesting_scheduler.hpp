@@ -20,14 +20,18 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <random>
@@ -108,6 +112,29 @@ namespace hpx::threads::policies {
             return rd();
         }
 
+        ////////////////////////////////////////////////////////////////////////
+        // Parameters controlling the victim selection, initialized from the
+        // [hpx.scheduler] configuration section.
+        struct workrequesting_steal_parameters
+        {
+            // select victims based on their topological distance to the thief:
+            // cores sharing a cache first, then cores in the same NUMA domain,
+            // and cores in other NUMA domains only after an adaptive back-off
+            bool hierarchical_ = true;
+
+            // cores sharing the cache of this level with the thief are asked
+            // first (0 disables this tier)
+            int cache_level_ = 3;
+
+            // number of unsuccessful steal rounds inside the NUMA domain of
+            // the thief before remote NUMA domains are asked for work. The
+            // back-off is doubled (up to the maximum) after each unsuccessful
+            // remote round and halved (down to the minimum) after each
+            // successful one.
+            std::uint16_t min_remote_backoff_ = 2;
+            std::uint16_t max_remote_backoff_ = 64;
+        };
+
         ////////////////////////////////////////////////////////////////////////
         struct workrequesting_init_parameter
         {
@@ -117,7 +144,9 @@ namespace hpx::threads::policies {
                     -1),
                 thread_queue_init_parameters const& thread_queue_init =
                     thread_queue_init_parameters{},
-                char const* description = "local_workrequesting_scheduler")
+                char const* description = "local_workrequesting_scheduler",
+                workrequesting_steal_parameters const& steal_parameters =
+                    workrequesting_steal_parameters{})
               : num_queues_(num_queues)
               , num_high_priority_queues_(
                     num_high_priority_queues == static_cast<std::size_t>(-1) ?
@@ -126,6 +155,7 @@ namespace hpx::threads::policies {
               , thread_queue_init_(thread_queue_init)
               , affinity_data_(affinity_data)
               , description_(description)
+              , steal_parameters_(steal_parameters)
             {
             }
 
@@ -144,6 +174,7 @@ namespace hpx::threads::policies {
             thread_queue_init_parameters thread_queue_init_;
             detail::affinity_data const& affinity_data_;
             char const* description_;
+            workrequesting_steal_parameters steal_parameters_;
         };
 
         struct workrequesting_task_data
@@ -178,13 +209,15 @@ namespace hpx::threads::policies {
 
             workrequesting_steal_request(std::size_t const num_thread,
                 workrequesting_task_channel* channel, mask_cref_type victims,
-                bool idle, bool const stealhalf)
+                bool idle, bool const stealhalf,
+                steal_distance const max_distance = steal_distance::remote)
               : channel_(channel)
               , victims_(victims)
               , num_thread_(static_cast<std::uint16_t>(num_thread))
               , attempt_(static_cast<std::uint16_t>(count(victims) - 1))
               , state_(idle ? state::idle : state::working)
               , stealhalf_(stealhalf)
+              , max_distance_(max_distance)
             {
             }
 
@@ -195,6 +228,8 @@ namespace hpx::threads::policies {
             state state_ = state::failed;
             // true ? attempt steal-half : attempt steal-one
             bool stealhalf_ = true;
+            // the farthest (relative to the thief) this request may travel
+            steal_distance max_distance_ = steal_distance::remote;
         };
 
         using workrequesting_steal_request_channel =
@@ -251,6 +286,9 @@ namespace hpx::threads::policies {
             // one task or half of what's available
             static constexpr std::uint16_t num_steal_adaptive_interval_ = 25;
 
+            static constexpr std::size_t num_steal_distances =
+                static_cast<std::size_t>(steal_distance::remote) + 1;
+
             void init(std::size_t num_thread, std::size_t size,
                 thread_queue_init_parameters const& queue_init,
                 bool need_high_priority_queue)
@@ -310,6 +348,20 @@ namespace hpx::threads::policies {
             std::uint32_t steal_requests_received_ = 0;
             std::uint32_t steal_requests_discarded_ = 0;
 #endif
+
+            // hierarchical stealing: the topological distance of all other
+            // cores to this one and the cores grouped by their distance
+            std::vector<steal_distance> distances_;
+            std::array<std::vector<std::uint16_t>, num_steal_distances>
+                victims_at_distance_;
+
+            // adaptive back-off for stealing from remote NUMA domains
+            std::uint16_t num_failed_steal_rounds_ = 0;
+            std::uint16_t remote_backoff_ = 0;
+
+            // number of tasks stolen from cores at each distance
+            std::array<std::atomic<std::int64_t>, num_steal_distances>
+                num_stolen_at_distance_ = {};
         };
 
     public:
@@ -325,6 +377,7 @@ namespace hpx::threads::policies {
           , affinity_data_(init.affinity_data_)
           , num_queues_(init.num_queues_)
           , num_high_priority_queues_(init.num_high_priority_queues_)
+          , steal_parameters_(init.steal_parameters_)
         {
             HPX_ASSERT(init.num_queues_ != 0);
             HPX_ASSERT(num_high_priority_queues_ != 0);
@@ -617,6 +670,27 @@ namespace hpx::threads::policies {
         }
 #endif
 
+        std::int64_t get_num_stolen_at_distance(steal_distance distance,
+            std::size_t num_thread, bool reset) override
+        {
+            auto const index = static_cast<std::size_t>(distance);
+            if (num_thread != static_cast<std::size_t>(-1))
+            {
+                HPX_ASSERT(num_thread < num_queues_);
+                return util::get_and_reset_value(
+                    data_[num_thread].data_.num_stolen_at_distance_[index],
+                    reset);
+            }
+
+            std::int64_t count = 0;
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                count += util::get_and_reset_value(
+                    data_[i].data_.num_stolen_at_distance_[index], reset);
+            }
+            return count;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void abort_all_suspended_threads() override
         {
@@ -744,6 +818,84 @@ namespace hpx::threads::policies {
             }
         }
 
+        // Create new threads for all given work items. Work items of normal
+        // priority without a hint are split into (at most) num_queues_
+        // contiguous batches which are assigned round-robin to the queues.
+        // Consecutive work items targeting the same queue are handed to that
+        // queue at once.
+        void create_threads(thread_init_data* first, thread_init_data* last,
+            error_code& ec) override
+        {
+            auto const count = static_cast<std::size_t>(last - first);
+            std::size_t const batch_size =
+                (count + num_queues_ - 1) / num_queues_;
+            std::size_t const start_queue = curr_queue_++;
+
+            thread_queue_type* batch_queue = nullptr;
+            thread_init_data* batch_first = first;
+            std::size_t num_unhinted = 0;
+
+            auto const flush_batch = [&](thread_init_data* batch_last) {
+                if (batch_queue != nullptr && batch_first != batch_last)
+                {
+                    batch_queue->create_threads(batch_first, batch_last, ec);
+                }
+            };
+
+            for (auto* it = first; it != last; ++it)
+            {
+                thread_queue_type* q = nullptr;
+                if (it->priority == thread_priority::normal ||
+                    it->priority == thread_priority::default_)
+                {
+                    std::size_t num_thread = it->schedulehint.mode ==
+                            thread_schedule_hint_mode::thread ?
+                        it->schedulehint.hint :
+                        static_cast<std::size_t>(-1);
+
+                    if (static_cast<std::size_t>(-1) == num_thread)
+                    {
+                        num_thread =
+                            (start_queue + num_unhinted++ / batch_size) %
+                            num_queues_;
+                    }
+                    else if (num_thread >= num_queues_)
+                    {
+                        num_thread %= num_queues_;
+                    }
+
+                    num_thread = select_active_pu(num_thread);
+
+                    it->schedulehint.mode = thread_schedule_hint_mode::thread;
+                    it->schedulehint.hint =
+                        static_cast<std::int16_t>(num_thread);
+
+                    q = data_[num_thread].data_.queue_;
+                }
+
+                if (q != batch_queue || q == nullptr)
+                {
+                    flush_batch(it);
+                    if (ec)
+                        return;
+
+                    batch_queue = q;
+                    batch_first = it;
+                }
+
+                // all other work items are created one by one
+                if (q == nullptr)
+                {
+                    create_thread(*it, nullptr, ec);
+                    if (ec)
+                        return;
+
+                    batch_first = it + 1;
+                }
+            }
+            flush_batch(last);
+        }
+
         // Retrieve the next viable steal request from our channel
         bool try_receiving_steal_request(
             scheduler_data& d, steal_request& req) noexcept
@@ -814,11 +966,27 @@ namespace hpx::threads::policies {
                 }
                 else
                 {
+                    // The steal request went unanswered, an unsuccessful
+                    // remote round lengthens the back-off.
+                    if (req.max_distance_ == steal_distance::remote)
+                    {
+                        d.num_failed_steal_rounds_ = 0;
+                        d.remote_backoff_ = (std::min)(
+                            static_cast<std::uint16_t>(d.remote_backoff_ * 2),
+                            steal_parameters_.max_remote_backoff_);
+                    }
+                    else if (d.num_failed_steal_rounds_ !=
+                        (std::numeric_limits<std::uint16_t>::max)())
+                    {
+                        ++d.num_failed_steal_rounds_;
+                    }
+
                     // Continue circulating the steal request if it makes sense
                     req.state_ = steal_request::state::idle;
                     req.victims_ = d.victims_;
                     req.attempt_ =
                         static_cast<std::uint16_t>(count(d.victims_) - 1);
+                    req.max_distance_ = max_steal_distance(d);
 
                     std::size_t victim = next_victim(d, req);
                     data_[victim].data_.requests_->set(HPX_MOVE(req));
@@ -1523,6 +1691,123 @@ namespace hpx::threads::policies {
             return result;
         }
 
+        // return a victim for the current stealing operation, preferring
+        // cores that are topologically close to the thief, returns -1 if all
+        // cores within the allowed distance have been asked already
+        std::size_t hierarchical_victim(steal_request const& req) noexcept
+        {
+            auto const& thief = data_[req.num_thread_].data_;
+            auto const max_distance =
+                static_cast<std::size_t>(req.max_distance_);
+
+            for (std::size_t i = 0; i <= max_distance; ++i)
+            {
+                auto const& candidates = thief.victims_at_distance_[i];
+
+                std::size_t num_candidates = 0;
+                for (std::uint16_t const victim : candidates)
+                {
+                    if (!test(req.victims_, victim))
+                        ++num_candidates;
+                }
+
+                if (num_candidates == 0)
+                    continue;
+
+                std::uniform_int_distribution<std::size_t> uniform(
+                    0, num_candidates - 1);
+                std::size_t selected_victim = uniform(gen_);
+                for (std::uint16_t const victim : candidates)
+                {
+                    if (!test(req.victims_, victim) && selected_victim-- == 0)
+                    {
+                        HPX_ASSERT(victim != req.num_thread_);
+                        return victim;
+                    }
+                }
+            }
+            return static_cast<std::size_t>(-1);
+        }
+
+        // return the farthest distance the next steal request of the given
+        // core may travel
+        steal_distance max_steal_distance(
+            scheduler_data const& d) const noexcept
+        {
+            if (!steal_parameters_.hierarchical_)
+                return steal_distance::remote;
+
+            std::size_t distance =
+                d.num_failed_steal_rounds_ >= d.remote_backoff_ ?
+                static_cast<std::size_t>(steal_distance::remote) :
+                static_cast<std::size_t>(steal_distance::numa_domain);
+
+            // make sure there is at least one core to ask
+            std::size_t num_victims = 0;
+            for (std::size_t i = 0; i <= distance; ++i)
+            {
+                num_victims += d.victims_at_distance_[i].size();
+            }
+            while (num_victims == 0 &&
+                distance < static_cast<std::size_t>(steal_distance::remote))
+            {
+                num_victims += d.victims_at_distance_[++distance].size();
+            }
+
+            return static_cast<steal_distance>(distance);
+        }
+
+        // determine the topological distance of all other cores to the given
+        // one
+        void init_steal_distances(scheduler_data& d, std::size_t num_thread)
+        {
+            d.distances_.assign(num_queues_, steal_distance::remote);
+            for (auto& victims : d.victims_at_distance_)
+            {
+                victims.clear();
+            }
+            d.num_failed_steal_rounds_ = 0;
+            d.remote_backoff_ = steal_parameters_.min_remote_backoff_;
+
+            auto const& topo = create_topology();
+
+            std::size_t const num_pu = affinity_data_.get_pu_num(num_thread);
+            std::size_t const numa_node = topo.get_numa_node_number(num_pu);
+
+            mask_type cache_mask = mask_type();
+            if (steal_parameters_.hierarchical_ &&
+                steal_parameters_.cache_level_ != 0)
+            {
+                error_code ec(throwmode::lightweight);
+                cache_mask = topo.get_cache_affinity_mask(
+                    num_pu, steal_parameters_.cache_level_, ec);
+            }
+
+            for (std::size_t i = 0; i != num_queues_; ++i)
+            {
+                if (i == num_thread)
+                    continue;
+
+                std::size_t const other_num_pu = affinity_data_.get_pu_num(i);
+
+                steal_distance distance = steal_distance::remote;
+                if (any(cache_mask) &&
+                    any(cache_mask &
+                        topo.get_thread_affinity_mask(other_num_pu)))
+                {
+                    distance = steal_distance::shared_cache;
+                }
+                else if (topo.get_numa_node_number(other_num_pu) == numa_node)
+                {
+                    distance = steal_distance::numa_domain;
+                }
+
+                d.distances_[i] = distance;
+                d.victims_at_distance_[static_cast<std::size_t>(distance)]
+                    .push_back(static_cast<std::uint16_t>(i));
+            }
+        }
+
         // return the number of the next victim core
         std::size_t next_victim([[maybe_unused]] scheduler_data& d,
             steal_request const& req) noexcept
@@ -1549,7 +1834,9 @@ namespace hpx::threads::policies {
                 else
 #endif
                 {
-                    victim = random_victim(req);
+                    victim = steal_parameters_.hierarchical_ ?
+                        hierarchical_victim(req) :
+                        random_victim(req);
                 }
             }
 
@@ -1604,8 +1891,8 @@ namespace hpx::threads::policies {
                     }
                 }
 
-                steal_request req(
-                    d.num_thread_, d.tasks_, d.victims_, idle, d.stealhalf_);
+                steal_request req(d.num_thread_, d.tasks_, d.victims_, idle,
+                    d.stealhalf_, max_steal_distance(d));
                 std::size_t victim = next_victim(d, req);
 
                 ++d.requested_;
@@ -1619,7 +1906,7 @@ namespace hpx::threads::policies {
         // Try receiving tasks that are sent by another core as a response to
         // one of our steal requests. This returns true if new tasks were
         // received.
-        static bool try_receiving_tasks(scheduler_data& d, std::size_t& added,
+        bool try_receiving_tasks(scheduler_data& d, std::size_t& added,
             thread_id_ref_type* next_thrd)
         {
             task_data thrds{};
@@ -1674,6 +1961,27 @@ namespace hpx::threads::policies {
                         ++added;
                     }
 
+                    // keep track of the distance the tasks were stolen from
+                    steal_distance distance = steal_distance::remote;
+                    if (thrds.num_thread_ < d.distances_.size())
+                    {
+                        distance = d.distances_[thrds.num_thread_];
+                    }
+                    d.num_stolen_at_distance_[static_cast<std::size_t>(
+                                                  distance)]
+                        .fetch_add(static_cast<std::int64_t>(
+                                       thrds.tasks_.size()),
+                            std::memory_order_relaxed);
+
+                    // a successful remote steal shortens the back-off
+                    d.num_failed_steal_rounds_ = 0;
+                    if (distance == steal_distance::remote)
+                    {
+                        d.remote_backoff_ = (std::max)(
+                            static_cast<std::uint16_t>(d.remote_backoff_ / 2),
+                            steal_parameters_.min_remote_backoff_);
+                    }
+
                     ++d.num_recent_steals_;
                     return true;
                 }
@@ -1807,6 +2115,8 @@ namespace hpx::threads::policies {
             resize(d.victims_, num_queues_);
             reset(d.victims_);
             set(d.victims_, num_thread);
+
+            init_steal_distances(d, num_thread);
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1876,6 +2186,7 @@ namespace hpx::threads::policies {
         detail::affinity_data const& affinity_data_;
         std::size_t const num_queues_;
         std::size_t const num_high_priority_queues_;
+        detail::workrequesting_steal_parameters const steal_parameters_;
     };
 }    // namespace hpx::threads::policies
 
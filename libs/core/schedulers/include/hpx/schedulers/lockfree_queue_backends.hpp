@@ -18,12 +18,15 @@
 #endif
 
 #include <hpx/allocator_support/aligned_allocator.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -50,6 +53,7 @@ namespace hpx::threads::policies {
         using rvalue_reference = T&&;
         using size_type = std::uint64_t;
 
+        static constexpr bool support_bulk_enqueue = false;
         static constexpr bool support_bulk_dequeue = false;
 
         explicit lockfree_fifo_backend(size_type initial_size = 0,
@@ -116,6 +120,7 @@ namespace hpx::threads::policies {
         using rvalue_reference = T&&;
         using size_type = std::uint64_t;
 
+        static constexpr bool support_bulk_enqueue = true;
         static constexpr bool support_bulk_dequeue = true;
 
         explicit moodycamel_fifo_backend(size_type initial_size = 0,
@@ -134,6 +139,12 @@ namespace hpx::threads::policies {
             return queue_.enqueue(HPX_MOVE(val));
         }
 
+        template <typename Iterator>
+        bool push_bulk(Iterator it, std::size_t count)
+        {
+            return queue_.enqueue_bulk(it, count);
+        }
+
         bool pop(reference val, bool /* steal */ = true) noexcept(
             noexcept(std::is_nothrow_copy_constructible_v<T>))
         {
@@ -182,6 +193,7 @@ namespace hpx::threads::policies {
         using rvalue_reference = T&&;
         using size_type = std::uint64_t;
 
+        static constexpr bool support_bulk_enqueue = false;
         static constexpr bool support_bulk_dequeue = false;
 
         explicit lockfree_lifo_backend(size_type initial_size = 0,
@@ -244,6 +256,7 @@ namespace hpx::threads::policies {
         using rvalue_reference = T&&;
         using size_type = std::uint64_t;
 
+        static constexpr bool support_bulk_enqueue = false;
         static constexpr bool support_bulk_dequeue = false;
 
         explicit lockfree_abp_fifo_backend(size_type initial_size = 0,
@@ -303,6 +316,7 @@ namespace hpx::threads::policies {
         using rvalue_reference = T&&;
         using size_type = std::uint64_t;
 
+        static constexpr bool support_bulk_enqueue = false;
         static constexpr bool support_bulk_dequeue = false;
 
         explicit lockfree_abp_lifo_backend(size_type initial_size = 0,
@@ -351,4 +365,102 @@ namespace hpx::threads::policies {
     };
 
 #endif    // HPX_HAVE_CXX11_STD_ATOMIC_128BIT
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque (owner LIFO, thieves FIFO)
+    //
+    // The deque itself allows only a single thread to push and pop at its
+    // bottom end. The owner is the first thread popping items without
+    // stealing (i.e. the worker thread the queue is associated with). Items
+    // pushed by any other thread (or pushed before the owner was determined)
+    // are put into a separate multi-producer inbox that is drained after the
+    // deque has run empty. Threads other than the owner always steal.
+    template <typename T>
+    struct chase_lev_lifo_backend
+    {
+        using container_type = hpx::lockfree::chase_lev_deque<T>;
+        using inbox_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        static constexpr bool support_bulk_enqueue = false;
+        static constexpr bool support_bulk_dequeue = false;
+
+        explicit chase_lev_lifo_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = static_cast<size_type>(-1))
+          : queue_(static_cast<std::size_t>(initial_size))
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)    //-V659
+        {
+            // items to be scheduled last are put into the inbox as well
+            if (!other_end && is_owner())
+            {
+                queue_.push_bottom(val);
+                return true;
+            }
+            return inbox_.enqueue(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push_bottom(val);
+                return true;
+            }
+            return inbox_.enqueue(HPX_MOVE(val));
+        }
+
+        bool pop(reference val, bool steal = true) noexcept
+        {
+            if (!steal && (is_owner() || try_become_owner()))
+            {
+                if (queue_.pop_bottom(val))
+                    return true;
+            }
+            else if (queue_.steal(val))
+            {
+                return true;
+            }
+            return inbox_.try_dequeue(val);
+        }
+
+        bool empty() noexcept
+        {
+            return queue_.empty() && inbox_.size_approx() == 0;
+        }
+
+    private:
+        bool is_owner() const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        bool try_become_owner() noexcept
+        {
+            std::thread::id expected;
+            return owner_.compare_exchange_strong(
+                expected, std::this_thread::get_id(), std::memory_order_relaxed);
+        }
+
+        container_type queue_;
+        inbox_type inbox_;
+        std::atomic<std::thread::id> owner_{};
+    };
+
+    struct chase_lev_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = chase_lev_lifo_backend<T>;
+        };
+    };
 }    // namespace hpx::threads::policies
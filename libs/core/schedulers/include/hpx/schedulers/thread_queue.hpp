@@ -208,6 +208,19 @@ namespace hpx::threads::policies {
         static util::internal_allocator<task_description>
             task_description_alloc_;
 
+        static task_description* create_task_description(
+            threads::thread_init_data& data)
+        {
+            task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            new (td) task_description{
+                HPX_MOVE(data), hpx::chrono::high_resolution_clock::now()};
+#else
+            new (td) task_description{HPX_MOVE(data)};    //-V106
+#endif
+            return td;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // add new threads if there is some amount of work available
         std::size_t add_new(std::int64_t add_count, thread_queue* addfrom,
@@ -771,14 +784,103 @@ namespace hpx::threads::policies {
             // later thread creation
             ++new_tasks_count_.data_;
 
-            task_description* td = task_description_alloc_.allocate(1);
-#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
-            new (td) task_description{
-                HPX_MOVE(data), hpx::chrono::high_resolution_clock::now()};
-#else
-            new (td) task_description{HPX_MOVE(data)};    //-V106
-#endif
-            new_tasks_.push(td);
+            new_tasks_.push(create_task_description(data));
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create new threads for all of the given work items and schedule
+        // them, all work items must have 'pending' as their initial state
+        void create_threads(
+            thread_init_data* first, thread_init_data* last, error_code& ec)
+        {
+            std::size_t num_staged = 0;
+            std::size_t num_run_now = 0;
+            for (auto* it = first; it != last; ++it)
+            {
+                if (it->stacksize == threads::thread_stacksize::current)
+                {
+                    it->stacksize = get_self_stacksize_enum();
+                }
+
+                HPX_ASSERT(it->stacksize != threads::thread_stacksize::current);
+
+                // the ids of the new threads are not returned, all of them
+                // have to be scheduled right away
+                if (it->initial_state != thread_schedule_state::pending)
+                {
+                    HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                        "thread_queue::create_threads",
+                        "bulk created threads must have 'pending' as their "
+                        "initial state");
+                    return;
+                }
+
+                if (it->run_now)
+                    ++num_run_now;
+                else
+                    ++num_staged;
+            }
+
+            if (num_run_now != 0)
+            {
+                // create all thread objects while holding the lock once
+                std::unique_lock<mutex_type> lk(mtx_);
+                for (auto* it = first; it != last; ++it)
+                {
+                    if (!it->run_now)
+                        continue;
+
+                    threads::thread_id_ref_type thrd;
+                    create_thread_object(thrd, *it, lk);
+
+                    // add a new entry in the map for this thread
+                    std::pair<thread_map_type::iterator, bool> const p =
+                        thread_map_.emplace(thrd.noref());
+
+                    if (HPX_UNLIKELY(!p.second))
+                    {
+                        lk.unlock();
+                        HPX_THROWS_BAD_ALLOC_IF(
+                            ec, "thread_queue::create_threads");
+                        return;
+                    }
+                    ++thread_map_count_;
+
+                    schedule_thread(HPX_MOVE(thrd));
+                }
+            }
+
+            if (num_staged != 0)
+            {
+                // register task descriptions for later thread creation, the
+                // staged task count is updated only once for all of them
+                new_tasks_count_.data_.fetch_add(
+                    static_cast<std::int64_t>(num_staged),
+                    std::memory_order_relaxed);
+
+                if constexpr (task_items_type::support_bulk_enqueue)
+                {
+                    std::vector<task_description*> tasks;
+                    tasks.reserve(num_staged);
+                    for (auto* it = first; it != last; ++it)
+                    {
+                        if (!it->run_now)
+                            tasks.push_back(create_task_description(*it));
+                    }
+                    new_tasks_.push_bulk(tasks.begin(), tasks.size());
+                }
+                else
+                {
+                    for (auto* it = first; it != last; ++it)
+                    {
+                        if (!it->run_now)
+                            new_tasks_.push(create_task_description(*it));
+                    }
+                }
+            }
+
             if (&ec != &throws)
                 ec = make_success_code();
         }
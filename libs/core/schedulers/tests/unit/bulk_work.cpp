@@ -0,0 +1,152 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+
+// needed for instantiating the thread pool for the scheduler using bulk
+// insertion into its staged queues
+#include <hpx/thread_pools/scheduled_thread_pool_impl.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+constexpr std::size_t num_tasks = 1000;
+
+void test_bulk_work(hpx::threads::thread_priority priority, bool use_hint)
+{
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::threads::thread_schedule_hint hint;
+        if (use_hint)
+        {
+            hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(i % num_threads));
+        }
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary([&]() {
+            ++count;
+            l.count_down(1);
+        }),
+            "test_bulk_work", priority, hint);
+    }
+
+    hpx::threads::register_bulk_work(data);
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+}
+
+void test_bulk_work_invalid_state()
+{
+    std::vector<hpx::threads::thread_init_data> data;
+    data.emplace_back(hpx::threads::make_thread_function_nullary([]() {}),
+        "test_bulk_work_invalid_state", hpx::threads::thread_priority::normal,
+        hpx::threads::thread_schedule_hint(),
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_state::suspended);
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    hpx::threads::register_bulk_work(data, ec);
+    HPX_TEST(ec);
+}
+
+int hpx_main()
+{
+    test_bulk_work(hpx::threads::thread_priority::normal, false);
+    test_bulk_work(hpx::threads::thread_priority::normal, true);
+    test_bulk_work(hpx::threads::thread_priority::high, false);
+    test_bulk_work(hpx::threads::thread_priority::low, false);
+    test_bulk_work(hpx::threads::thread_priority::bound, true);
+
+    // empty batches are accepted
+    std::vector<hpx::threads::thread_init_data> data;
+    hpx::threads::register_bulk_work(data);
+
+    test_bulk_work_invalid_state();
+
+    return hpx::local::finalize();
+}
+
+template <typename Scheduler>
+void test_scheduler(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            [](hpx::threads::thread_pool_init_parameters thread_pool_init,
+                hpx::threads::policies::thread_queue_init_parameters
+                    thread_queue_init)
+                -> std::unique_ptr<hpx::threads::thread_pool_base> {
+                typename Scheduler::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, std::size_t(-1),
+                    thread_queue_init);
+                std::unique_ptr<Scheduler> scheduler(new Scheduler(init));
+
+                thread_pool_init.mode_ = hpx::threads::policies::scheduler_mode(
+                    hpx::threads::policies::scheduler_mode::do_background_work |
+                    hpx::threads::policies::scheduler_mode::
+                        reduce_thread_priority |
+                    hpx::threads::policies::scheduler_mode::delay_exit);
+
+                std::unique_ptr<hpx::threads::thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<Scheduler>(
+                        std::move(scheduler), thread_pool_init));
+
+                return pool;
+            });
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    // the staged queues of this scheduler support bulk insertion
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo,
+                hpx::threads::policies::concurrentqueue_fifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_fifo>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+#endif
+
+    return hpx::util::report_errors();
+}
@@ -46,5 +46,16 @@ namespace hpx::serialization {
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(
             void* address, std::size_t count, bool allow_zero_copy_receive) = 0;
+
+        // return the address of the data of the next zero-copy chunk if it
+        // holds exactly count bytes, nullptr otherwise
+        [[nodiscard]] virtual void* peek_binary_chunk(
+            std::size_t /* count */) const noexcept
+        {
+            return nullptr;
+        }
+
+        // skip the next zero-copy chunk (after its data has been adopted)
+        virtual void skip_binary_chunk(std::size_t /* count */) {}
     };
 }    // namespace hpx::serialization
@@ -0,0 +1,69 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/type_support/extra_data.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    // Reference counted ownership of the buffers a parcelport has received
+    // the zero-copy chunks of a message into. If an input archive carries
+    // this information, types able to share the received memory (e.g.
+    // serialize_buffer) take a reference to the buffer instead of copying
+    // the chunk data.
+    struct received_chunks
+    {
+        using handle_type = std::shared_ptr<void>;
+
+        void add(void const* data, handle_type handle)
+        {
+            chunks_.emplace_back(data, HPX_MOVE(handle));
+        }
+
+        [[nodiscard]] handle_type find(void const* data) const noexcept
+        {
+            for (auto const& chunk : chunks_)
+            {
+                if (chunk.first == data)
+                {
+                    return chunk.second;
+                }
+            }
+            return handle_type();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return chunks_.empty();
+        }
+
+        void clear() noexcept
+        {
+            chunks_.clear();
+        }
+
+        std::vector<std::pair<void const*, handle_type>> chunks_;
+    };
+}    // namespace hpx::serialization::detail
+
+// This is explicitly instantiated to ensure that the id is stable across shared
+// libraries.
+template <>
+struct hpx::util::extra_data_helper<
+    hpx::serialization::detail::received_chunks>
+{
+    HPX_CORE_EXPORT static extra_data_id_type id() noexcept;
+    static void reset(serialization::detail::received_chunks* data) noexcept
+    {
+        data->clear();
+    }
+};
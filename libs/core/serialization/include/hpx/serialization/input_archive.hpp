@@ -17,6 +17,7 @@
 #include <hpx/serialization/basic_archive.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
+#include <hpx/serialization/detail/received_chunks.hpp>
 #include <hpx/serialization/input_container.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
@@ -308,6 +309,45 @@ namespace hpx::serialization {
             size_ += count;
         }
 
+        // Take shared ownership of the data of the next zero-copy chunk
+        // instead of copying it. This is possible only if the chunk holds
+        // exactly count bytes, is suitably aligned, and the parcelport has
+        // attached the owner of the received buffer to this archive. Returns
+        // nullptr if the data has to be loaded using load_binary_chunk.
+        [[nodiscard]] void* try_adopt_binary_chunk(std::size_t count,
+            std::size_t alignment, std::shared_ptr<void>& owner)
+        {
+            if (HPX_UNLIKELY(0 == count) || disable_data_chunking())
+            {
+                return nullptr;
+            }
+
+            auto const* received =
+                try_get_extra_data<detail::received_chunks>();
+            if (received == nullptr || received->empty())
+            {
+                return nullptr;
+            }
+
+            void* data = buffer_->peek_binary_chunk(count);
+            if (data == nullptr ||
+                reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+            {
+                return nullptr;
+            }
+
+            owner = received->find(data);
+            if (!owner)
+            {
+                return nullptr;
+            }
+
+            buffer_->skip_binary_chunk(count);
+            size_ += count;
+
+            return data;
+        }
+
     private:
         std::unique_ptr<erased_input_container> buffer_;
     };
@@ -212,6 +212,27 @@ namespace hpx::serialization {
             }
         }
 
+        [[nodiscard]] void* peek_binary_chunk(
+            std::size_t count) const noexcept override
+        {
+            if (chunks_ == nullptr ||
+                count < zero_copy_serialization_threshold_ ||
+                filter_ != nullptr || current_chunk_ >= get_num_chunks() ||
+                get_chunk_type(current_chunk_) !=
+                    chunk_type::chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count)
+            {
+                return nullptr;
+            }
+            return get_chunk_data(current_chunk_).pos_;
+        }
+
+        void skip_binary_chunk([[maybe_unused]] std::size_t count) override
+        {
+            HPX_ASSERT(peek_binary_chunk(count) != nullptr);
+            ++current_chunk_;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 namespace hpx::serialization {
 
@@ -390,6 +391,30 @@ namespace hpx::serialization {
         {
             ar >> size_ >> alloc_;    // -V128
 
+            if constexpr (std::is_same_v<Archive, input_archive> &&
+                std::is_same_v<allocator_type, std::allocator<T>> &&
+                std::is_trivially_copyable_v<T>)
+            {
+                // share the buffer the data was received into, if possible
+                if (size_ != 0 && !ar.disable_array_optimization() &&
+                    !ar.endianess_differs())
+                {
+                    std::shared_ptr<void> owner;
+                    if (void* data = ar.try_adopt_binary_chunk(
+                            size_ * sizeof(T), alignof(T), owner);
+                        data != nullptr)
+                    {
+#if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
+                        data_ = buffer_type(owner, static_cast<T*>(data));
+#else
+                        data_ = buffer_type(static_cast<T*>(data),
+                            [owner = HPX_MOVE(owner)](T*) noexcept {});
+#endif
+                        return;
+                    }
+                }
+            }
+
             data_ = buffer_type(
                 detail::array_allocator<allocator_type>()(alloc_, size_),
                 [alloc = this->alloc_, size = this->size_](T* p) noexcept {
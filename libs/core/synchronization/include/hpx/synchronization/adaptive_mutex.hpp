@@ -0,0 +1,209 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \page hpx::adaptive_mutex
+/// \headerfile hpx/mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx {
+
+    namespace lcos::local::detail {
+
+        /// \cond NOINTERNAL
+        // Contention statistics collected for all adaptive_mutex instances
+        // constructed with the same description (the lock site). All times
+        // are in nanoseconds.
+        struct lock_site_statistics
+        {
+            // number of acquisitions (counted in batches of the sampling
+            // interval)
+            std::atomic<std::int64_t> acquisitions{0};
+
+            // number of acquisitions which found the mutex locked and the
+            // overall time spent waiting in those
+            std::atomic<std::int64_t> contended{0};
+            std::atomic<std::int64_t> wait_time{0};
+
+            // number of sampled hold times and their sum
+            std::atomic<std::int64_t> hold_samples{0};
+            std::atomic<std::int64_t> hold_time{0};
+        };
+
+        enum class lock_statistic : std::uint8_t
+        {
+            acquisitions = 0,
+            contended = 1,
+            wait_time = 2,
+            hold_time = 3
+        };
+
+        // Return the statistics object for the given lock site, creating it
+        // if necessary. The returned object lives until the end of the
+        // program.
+        HPX_CORE_EXPORT lock_site_statistics& get_lock_site_statistics(
+            char const* site);
+
+        // Return the names of all lock sites seen so far
+        HPX_CORE_EXPORT std::vector<std::string> get_lock_sites();
+
+        // Return the requested value for the given lock site (or the sum over
+        // all lock sites if site is empty), optionally resetting it. The
+        // hold time is reported as the average of the sampled hold times.
+        HPX_CORE_EXPORT std::int64_t query_lock_statistics(
+            std::string const& site, lock_statistic which, bool reset);
+        /// \endcond
+    }    // namespace lcos::local::detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The \a adaptive_mutex class is a synchronization primitive with
+    ///        the same semantics as \a hpx::mutex. Threads which find the
+    ///        \a adaptive_mutex locked spin for a while before they are
+    ///        suspended. The spin budget is learned for each lock from the
+    ///        recently observed hold times: a lock which is held for short
+    ///        periods of time only is spun on (like \a hpx::spinlock), while
+    ///        threads waiting for a lock held for longer periods are
+    ///        suspended right away (like \a hpx::mutex).
+    ///
+    ///        Contention statistics (number of acquisitions, contended
+    ///        acquisitions, time spent waiting, and sampled hold times) are
+    ///        recorded per lock site, which is identified by the description
+    ///        passed to the constructor. These are exposed through the
+    ///        performance counters \a /synchronization/count/acquisitions,
+    ///        \a /synchronization/count/contended,
+    ///        \a /synchronization/time/wait, and
+    ///        \a /synchronization/time/hold (with the lock site as the counter
+    ///        parameter).
+    ///
+    ///        \a hpx::adaptive_mutex is neither copyable nor movable.
+    ///
+    class adaptive_mutex
+    {
+    public:
+        /// \brief \a hpx::adaptive_mutex is neither copyable nor movable
+        HPX_NON_COPYABLE(adaptive_mutex);
+
+    public:
+        ///
+        /// \brief Constructs the \a adaptive_mutex. The \a adaptive_mutex is
+        ///        in unlocked state after the constructor completes.
+        ///
+        /// \param site Name of the lock site the contention statistics of
+        ///             this \a adaptive_mutex are accounted for. The string
+        ///             must outlive the \a adaptive_mutex (usually, this is
+        ///             a string literal).
+        ///
+#if defined(HPX_HAVE_ITTNOTIFY)
+        HPX_CORE_EXPORT adaptive_mutex(char const* const site = "");
+#else
+        HPX_HOST_DEVICE_CONSTEXPR adaptive_mutex(
+            char const* const site = "") noexcept
+          : state_(0)
+          , hold_time_(0)
+          , owner_id_(nullptr)
+          , site_(site)
+          , statistics_(nullptr)
+        {
+        }
+#endif
+
+        /// \brief Destroys the \a adaptive_mutex.
+        HPX_CORE_EXPORT ~adaptive_mutex();
+
+        ///
+        /// \brief Locks the \a adaptive_mutex, blocking until the lock is
+        ///        acquired. Throws a \a hpx::exception with the error code
+        ///        \a deadlock if the calling thread already owns the
+        ///        \a adaptive_mutex.
+        ///
+        /// \param description Description of the operation
+        /// \param ec          Used to hold error code value originated during
+        ///                    the operation. Defaults to \a throws -- A
+        ///                    special 'throw on error' \a error_code.
+        ///
+        HPX_CORE_EXPORT
+        void lock(char const* description, error_code& ec = throws);
+
+        /// \copydoc lock(char const*, error_code&)
+        void lock(error_code& ec = throws)
+        {
+            return lock("adaptive_mutex::lock", ec);
+        }
+
+        ///
+        /// \brief Tries to lock the \a adaptive_mutex. Returns immediately.
+        ///        On successful lock acquisition returns \a true, otherwise
+        ///        returns \a false.
+        ///
+        /// \param description Description of the operation
+        /// \param ec          Used to hold error code value originated during
+        ///                    the operation. Defaults to \a throws -- A
+        ///                    special 'throw on error' \a error_code.
+        ///
+        HPX_CORE_EXPORT bool try_lock(
+            char const* description, error_code& ec = throws);
+
+        /// \copydoc try_lock(char const*, error_code&)
+        bool try_lock(error_code& ec = throws)
+        {
+            return try_lock("adaptive_mutex::try_lock", ec);
+        }
+
+        ///
+        /// \brief Unlocks the \a adaptive_mutex. Throws a \a hpx::exception
+        ///        with the error code \a lock_error if the calling thread
+        ///        does not own the \a adaptive_mutex.
+        ///
+        /// \param ec Used to hold error code value originated during the
+        ///           operation. Defaults to \a throws -- A special
+        ///           'throw on error' \a error_code.
+        ///
+        HPX_CORE_EXPORT void unlock(error_code& ec = throws);
+
+        /// \brief Return the average hold time (in nanoseconds) observed for
+        ///        this \a adaptive_mutex, zero if nothing is known yet.
+        std::uint32_t hold_time() const noexcept
+        {
+            return hold_time_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /// \cond NOINTERNAL
+        void lock_contended(char const* description);
+        void unlock_slow();
+
+        void acquired(void* self_id);
+        void released();
+
+        lcos::local::detail::lock_site_statistics& statistics();
+
+        static constexpr std::uint8_t locked_bit = 0x01;
+        static constexpr std::uint8_t parked_bit = 0x02;
+
+        std::atomic<std::uint8_t> state_;
+
+        // exponentially weighted average of the sampled hold times
+        std::atomic<std::uint32_t> hold_time_;
+
+        std::atomic<void*> owner_id_;
+
+        // the following members are accessed by the owning thread only
+        std::uint32_t acquisitions_ = 0;
+        std::uint64_t hold_start_ = 0;
+
+        char const* site_;
+        std::atomic<lcos::local::detail::lock_site_statistics*> statistics_;
+        /// \endcond
+    };
+}    // namespace hpx
@@ -16,7 +16,6 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/errors.hpp>
-#include <hpx/modules/memory.hpp>
 #include <hpx/synchronization/detail/condition_variable.hpp>
 #include <hpx/synchronization/mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
@@ -25,6 +24,7 @@
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
@@ -103,19 +103,9 @@ namespace hpx {
     ///
     class condition_variable
     {
-    private:
-        using mutex_type =
-            lcos::local::detail::condition_variable_data::mutex_type;
-        using data_type =
-            hpx::intrusive_ptr<lcos::local::detail::condition_variable_data>;
-
     public:
         /// \brief Construct an object of type \a hpx::condition_variable.
-        condition_variable()
-          : data_(data_type(
-                new lcos::local::detail::condition_variable_data, false))
-        {
-        }
+        constexpr condition_variable() noexcept = default;
 
         ///
         /// \brief Destroys the object of type \a hpx::condition_variable.
@@ -136,11 +126,8 @@ namespace hpx {
         ///                      \a wait_until that take a predicate. end note]
         ///
         /// IOW, \a ~condition_variable() can execute before a signaled thread
-        /// returns from a wait. If this happens with \a condition_variable,
-        /// that waiting thread will attempt to lock the destructed mutex.
-        /// To fix this, there must be shared ownership of the data members
-        /// between the \a condition_variable object and the member
-        /// functions \a wait (\a wait_for, etc.).
+        /// returns from a wait. This is safe, as a waiting thread does not
+        /// access the \a condition_variable anymore once it was notified.
         ///
         ~condition_variable() = default;
 
@@ -161,8 +148,9 @@ namespace hpx {
         ///
         void notify_one(error_code& ec = throws) const
         {
-            std::unique_lock<mutex_type> l(data_->mtx_);
-            data_->cond_.notify_one(HPX_MOVE(l), ec);
+            state_.notify_one();
+            if (&ec != &throws)
+                ec = make_success_code();
         }
 
         ///
@@ -176,8 +164,9 @@ namespace hpx {
         ///
         void notify_all(error_code& ec = throws) const
         {
-            std::unique_lock<mutex_type> l(data_->mtx_);
-            data_->cond_.notify_all(HPX_MOVE(l), ec);
+            state_.notify_all();
+            if (&ec != &throws)
+                ec = make_success_code();
         }
 
         ///
@@ -213,19 +202,16 @@ namespace hpx {
         {
             HPX_ASSERT_OWNS_LOCK(lock);
 
-            auto const data = data_;    // keep data alive
-
             [[maybe_unused]] util::ignore_all_while_checking const ignore_lock;
 
-            std::unique_lock<mutex_type> l(data->mtx_);
+            // the condition variable must not be accessed after the thread
+            // was woken up, it may have been destroyed already
+            std::uint32_t const seq = state_.prepare_wait();
             unlock_guard<std::unique_lock<Mutex>> unlock(lock);
 
-            // The following ensures that the inner lock will be unlocked
-            // before the outer to avoid deadlock (fixes issue #3608)
-            std::lock_guard<std::unique_lock<mutex_type>> unlock_next(
-                l, std::adopt_lock);
-
-            data->cond_.wait(l, ec);
+            state_.wait(seq, "condition_variable::wait");
+            if (&ec != &throws)
+                ec = make_success_code();
         }
 
         ///
@@ -319,29 +305,18 @@ namespace hpx {
         {
             HPX_ASSERT_OWNS_LOCK(lock);
 
-            auto const data = data_;    // keep data alive
-
             [[maybe_unused]] util::ignore_all_while_checking const ignore_lock;
 
-            std::unique_lock<mutex_type> l(data->mtx_);
+            std::uint32_t const seq = state_.prepare_wait();
             unlock_guard<std::unique_lock<Mutex>> unlock(lock);
 
-            // The following ensures that the inner lock will be unlocked
-            // before the outer to avoid deadlock (fixes issue #3608)
-            std::lock_guard<std::unique_lock<mutex_type>> unlock_next(
-                l, std::adopt_lock);
-
-            threads::thread_restart_state const reason =
-                data->cond_.wait_until(l, abs_time, ec);
-
-            if (ec)
-                return cv_status::error;
+            bool const notified = state_.wait(
+                seq, "condition_variable::wait_until", &abs_time);
+            if (&ec != &throws)
+                ec = make_success_code();
 
             // if the timer has hit, the waiting period timed out
-            return (reason ==
-                       threads::thread_restart_state::timeout) ?    //-V110
-                cv_status::timeout :
-                cv_status::no_timeout;
+            return notified ? cv_status::no_timeout : cv_status::timeout;
         }
 
         ///
@@ -503,7 +478,7 @@ namespace hpx {
         }
 
     private:
-        hpx::util::cache_aligned_data_derived<data_type> data_;
+        mutable lcos::local::detail::condition_variable_state state_;
     };
 
     ///
@@ -522,21 +497,11 @@ namespace hpx {
     ///
     class condition_variable_any
     {
-    private:
-        using mutex_type =
-            lcos::local::detail::condition_variable_data::mutex_type;
-        using data_type =
-            hpx::intrusive_ptr<lcos::local::detail::condition_variable_data>;
-
     public:
         ///
         /// \brief Constructs an object of type \a hpx::condition_variable_any
         ///
-        condition_variable_any()
-          : data_(data_type(
-                new lcos::local::detail::condition_variable_data, false))
-        {
-        }
+        constexpr condition_variable_any() noexcept = default;
 
         ///
         /// \brief Destroys the object of type \a hpx::condition_variable_any.
@@ -566,11 +531,8 @@ namespace hpx {
         ///                predicate. end note]
         ///
         /// IOW, \a ~condition_variable_any() can execute before a signaled thread
-        /// returns from a wait. If this happens with \a condition_variable_any, that
-        /// waiting thread will attempt to lock the destructed mutex.
-        /// To fix this, there must be shared ownership of the data members
-        /// between the \a condition_variable_any object and the member functions
-        /// wait (\a wait_for, etc.).
+        /// returns from a wait. This is safe, as a waiting thread does not
+        /// access the \a condition_variable_any anymore once it was notified.
         ///
         ~condition_variable_any() = default;
 
@@ -621,8 +583,9 @@ namespace hpx {
         ///
         void notify_one(error_code& ec = throws) const
         {
-            std::unique_lock<mutex_type> l(data_->mtx_);
-            data_->cond_.notify_one(HPX_MOVE(l), ec);
+            state_.notify_one();
+            if (&ec != &throws)
+                ec = make_success_code();
         }
 
         ///
@@ -652,8 +615,9 @@ namespace hpx {
         ///
         void notify_all(error_code& ec = throws) const
         {
-            std::unique_lock<mutex_type> l(data_->mtx_);
-            data_->cond_.notify_all(HPX_MOVE(l), ec);
+            state_.notify_all();
+            if (&ec != &throws)
+                ec = make_success_code();
         }
 
         ///
@@ -699,19 +663,16 @@ namespace hpx {
         {
             HPX_ASSERT_OWNS_LOCK(lock);
 
-            auto const data = data_;    // keep data alive
-
             [[maybe_unused]] util::ignore_all_while_checking const ignore_lock;
 
-            std::unique_lock<mutex_type> l(data->mtx_);
+            // the condition variable must not be accessed after the thread
+            // was woken up, it may have been destroyed already
+            std::uint32_t const seq = state_.prepare_wait();
             unlock_guard<Lock> unlock(lock);
 
-            // The following ensures that the inner lock will be unlocked
-            // before the outer to avoid deadlock (fixes issue #3608)
-            std::lock_guard<std::unique_lock<mutex_type>> unlock_next(
-                l, std::adopt_lock);
-
-            data->cond_.wait(l, ec);
+            state_.wait(seq, "condition_variable_any::wait");
+            if (&ec != &throws)
+                ec = make_success_code();
         }
 
         ///
@@ -815,29 +776,18 @@ namespace hpx {
         {
             HPX_ASSERT_OWNS_LOCK(lock);
 
-            auto const data = data_;    // keep data alive
-
             [[maybe_unused]] util::ignore_all_while_checking const ignore_lock;
 
-            std::unique_lock<mutex_type> l(data->mtx_);
+            std::uint32_t const seq = state_.prepare_wait();
             unlock_guard<Lock> unlock(lock);
 
-            // The following ensures that the inner lock will be unlocked
-            // before the outer to avoid deadlock (fixes issue #3608)
-            std::lock_guard<std::unique_lock<mutex_type>> unlock_next(
-                l, std::adopt_lock);
-
-            threads::thread_restart_state const reason =
-                data->cond_.wait_until(l, abs_time, ec);
-
-            if (ec)
-                return cv_status::error;
+            bool const notified = state_.wait(
+                seq, "condition_variable_any::wait_until", &abs_time);
+            if (&ec != &throws)
+                ec = make_success_code();
 
             // if the timer has hit, the waiting period timed out
-            return (reason ==
-                       threads::thread_restart_state::timeout) ?    //-V110
-                cv_status::timeout :
-                cv_status::no_timeout;
+            return notified ? cv_status::no_timeout : cv_status::timeout;
         }
 
         ///
@@ -1049,19 +999,14 @@ namespace hpx {
         ///
         template <typename Lock, typename Predicate>
         bool wait(Lock& lock, stop_token stoken, Predicate pred,
-            error_code& ec = throws)
+            error_code& /* ec */ = throws)
         {
             if (stoken.stop_requested())
             {
                 return pred();
             }
 
-            auto data = data_;    // keep data alive
-
-            auto f = [&data, &ec] {
-                std::unique_lock<mutex_type> l(data->mtx_);
-                data->cond_.notify_all(HPX_MOVE(l), ec);
-            };
+            auto f = [this] { state_.notify_all(); };
             stop_callback<decltype(f)> cb(stoken, HPX_MOVE(f));
 
             while (!pred())
@@ -1069,7 +1014,8 @@ namespace hpx {
                 [[maybe_unused]] util::ignore_all_while_checking const
                     ignore_lock;
 
-                std::unique_lock<mutex_type> l(data->mtx_);
+                // a stop request issued after this is seen as a notification
+                std::uint32_t const seq = state_.prepare_wait();
                 if (stoken.stop_requested())
                 {
                     // pred() has already evaluated to false since we last
@@ -1078,13 +1024,7 @@ namespace hpx {
                 }
 
                 unlock_guard<Lock> unlock(lock);
-
-                // The following ensures that the inner lock will be unlocked
-                // before the outer to avoid deadlock (fixes issue #3608)
-                std::lock_guard<std::unique_lock<mutex_type>> unlock_next(
-                    l, std::adopt_lock);
-
-                data->cond_.wait(l, ec);
+                state_.wait(seq, "condition_variable_any::wait");
             }
 
             return true;
@@ -1142,19 +1082,14 @@ namespace hpx {
         template <typename Lock, typename Predicate>
         bool wait_until(Lock& lock, stop_token stoken,
             hpx::chrono::steady_time_point const& abs_time, Predicate pred,
-            error_code& ec = throws)
+            error_code& /* ec */ = throws)
         {
             if (stoken.stop_requested())
             {
                 return pred();
             }
 
-            auto data = data_;    // keep data alive
-
-            auto f = [&data, &ec] {
-                std::unique_lock<mutex_type> l(data->mtx_);
-                data->cond_.notify_all(HPX_MOVE(l), ec);
-            };
+            auto f = [this] { state_.notify_all(); };
             stop_callback<decltype(f)> cb(stoken, HPX_MOVE(f));
 
             while (!pred())
@@ -1164,7 +1099,7 @@ namespace hpx {
                     [[maybe_unused]] util::ignore_all_while_checking const
                         ignore_lock;
 
-                    std::unique_lock<mutex_type> l(data->mtx_);
+                    std::uint32_t const seq = state_.prepare_wait();
                     if (stoken.stop_requested())
                     {
                         // pred() has already evaluated to false since we last
@@ -1174,19 +1109,9 @@ namespace hpx {
 
                     unlock_guard<Lock> unlock(lock);
 
-                    // The following ensures that the inner lock will be unlocked
-                    // before the outer to avoid deadlock (fixes issue #3608)
-                    std::lock_guard<std::unique_lock<mutex_type>> unlock_next(
-                        l, std::adopt_lock);
-
-                    threads::thread_restart_state const reason =
-                        data->cond_.wait_until(l, abs_time, ec);
-
-                    if (ec)
-                        return false;
-
-                    should_stop =
-                        (reason == threads::thread_restart_state::timeout) ||
+                    should_stop = !state_.wait(seq,
+                                      "condition_variable_any::wait_until",
+                                      &abs_time) ||
                         stoken.stop_requested();
                 }
 
@@ -1249,7 +1174,7 @@ namespace hpx {
         }
 
     private:
-        hpx::util::cache_aligned_data_derived<data_type> data_;
+        mutable lcos::local::detail::condition_variable_state state_;
     };
 }    // namespace hpx
 
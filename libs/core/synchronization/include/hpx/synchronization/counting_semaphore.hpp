@@ -13,15 +13,13 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/modules/memory.hpp>
 #include <hpx/synchronization/detail/counting_semaphore.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <mutex>
-#include <utility>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -342,6 +340,8 @@ namespace hpx {
 
     namespace detail {
 
+        // The Mutex template parameter is not used anymore, waiting threads
+        // are parked in the global parking lot instead.
         template <std::ptrdiff_t LeastMaxValue = PTRDIFF_MAX,
             typename Mutex = hpx::spinlock>
         class counting_semaphore
@@ -352,19 +352,15 @@ namespace hpx {
             counting_semaphore(counting_semaphore&&) = delete;
             counting_semaphore& operator=(counting_semaphore&&) = delete;
 
-        protected:
-            using mutex_type = Mutex;
-            using data_type =
-                lcos::local::detail::counting_semaphore_data<mutex_type>;
-
         public:
             static constexpr std::ptrdiff_t(max)() noexcept
             {
-                return LeastMaxValue;
+                return (std::min)(LeastMaxValue,
+                    lcos::local::detail::counting_semaphore::max_value);
             }
 
-            explicit counting_semaphore(std::ptrdiff_t value) noexcept
-              : data_(new data_type(value), false)
+            explicit constexpr counting_semaphore(std::ptrdiff_t value) noexcept
+              : sem_(value)
             {
             }
 
@@ -372,31 +368,23 @@ namespace hpx {
 
             void release(std::ptrdiff_t update = 1)
             {
-                auto data = data_;    //keep alive
-                std::unique_lock<mutex_type> l(data->mtx_);
-                data->sem_.signal(HPX_MOVE(l), update);
+                sem_.signal(update);
             }
 
             bool try_acquire() noexcept
             {
-                auto data = data_;    //keep alive
-                std::unique_lock<mutex_type> l(data->mtx_);
-                return data->sem_.try_acquire(l);
+                return sem_.try_acquire();
             }
 
             void acquire()
             {
-                auto data = data_;    //keep alive
-                std::unique_lock<mutex_type> l(data->mtx_);
-                data->sem_.wait(l, 1);
+                sem_.wait(1);
             }
 
             bool try_acquire_until(
                 hpx::chrono::steady_time_point const& abs_time)
             {
-                auto data = data_;    //keep alive
-                std::unique_lock<mutex_type> l(data->mtx_);
-                return data->sem_.wait_until(l, abs_time, 1);
+                return sem_.wait_until(abs_time, 1);
             }
 
             bool try_acquire_for(hpx::chrono::steady_duration const& rel_time)
@@ -405,7 +393,7 @@ namespace hpx {
             }
 
         protected:
-            hpx::intrusive_ptr<data_type> data_;
+            lcos::local::detail::counting_semaphore sem_;
         };
     }    // namespace detail
 
@@ -418,11 +406,11 @@ namespace hpx {
       : public detail::counting_semaphore<PTRDIFF_MAX, Mutex>
     {
     private:
-        using mutex_type = Mutex;
-        using detail::counting_semaphore<PTRDIFF_MAX, Mutex>::data_;
+        using detail::counting_semaphore<PTRDIFF_MAX, Mutex>::sem_;
 
     public:
-        explicit counting_semaphore_var(std::ptrdiff_t value = N) noexcept
+        explicit constexpr counting_semaphore_var(
+            std::ptrdiff_t value = N) noexcept
           : detail::counting_semaphore<PTRDIFF_MAX, Mutex>(value)
         {
         }
@@ -435,30 +423,22 @@ namespace hpx {
 
         void wait(std::ptrdiff_t count = 1)
         {
-            auto data = data_;    //keep alive
-            std::unique_lock<mutex_type> l(data->mtx_);
-            data->sem_.wait(l, count);
+            sem_.wait(count);
         }
 
         bool try_wait(std::ptrdiff_t count = 1)
         {
-            auto data = data_;    //keep alive
-            std::unique_lock<mutex_type> l(data->mtx_);
-            return data->sem_.try_wait(l, count);
+            return sem_.try_wait(count);
         }
 
         void signal(std::ptrdiff_t count = 1)
         {
-            auto data = data_;    //keep alive
-            std::unique_lock<mutex_type> l(data->mtx_);
-            data->sem_.signal(HPX_MOVE(l), count);
+            sem_.signal(count);
         }
 
         std::ptrdiff_t signal_all()
         {
-            auto data = data_;    //keep alive
-            std::unique_lock<mutex_type> l(data->mtx_);
-            return data->sem_.signal_all(HPX_MOVE(l));
+            return sem_.signal_all();
         }
     };
 }    // namespace hpx
@@ -13,10 +13,11 @@
 #include <hpx/datastructures/detail/intrusive_list.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/synchronization/spinlock.hpp>
-#include <hpx/thread_support/atomic_count.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
@@ -153,31 +154,60 @@ namespace hpx::lcos::local::detail {
     };
 
     ///////////////////////////////////////////////////////////////////////////
-    struct condition_variable_data;
+    // The state of hpx::condition_variable and hpx::condition_variable_any: a
+    // single atomic word holding a sequence number which is incremented by
+    // every notification (shifted left by one) and a bit which is set if
+    // threads may be parked on the condition variable. Waiting threads are
+    // suspended in the global parking lot, using the address of the state as
+    // the key.
+    class condition_variable_state
+    {
+    public:
+        constexpr condition_variable_state() noexcept
+          : state_(0)
+        {
+        }
 
-    HPX_CORE_EXPORT void intrusive_ptr_add_ref(
-        condition_variable_data* p) noexcept;
-    HPX_CORE_EXPORT void intrusive_ptr_release(
-        condition_variable_data* p) noexcept;
+        condition_variable_state(condition_variable_state const&) = delete;
+        condition_variable_state(condition_variable_state&&) = delete;
+        condition_variable_state& operator=(
+            condition_variable_state const&) = delete;
+        condition_variable_state& operator=(
+            condition_variable_state&&) = delete;
 
-    struct condition_variable_data
-    {
-        using mutex_type = hpx::spinlock;
+        ~condition_variable_state() = default;
 
-        HPX_HOST_DEVICE_CONSTEXPR condition_variable_data() noexcept
-          : count_(1)
+        // Return the current sequence number. This has to be called before
+        // the lock protecting the waited-for condition is released, any
+        // notification issued after this will make wait return.
+        std::uint32_t prepare_wait() const noexcept
         {
+            return state_.load(std::memory_order_acquire) & ~parked_bit;
         }
 
-        util::cache_aligned_data_derived<mutex_type> mtx_;
-        util::cache_aligned_data_derived<detail::condition_variable> cond_;
+        // Park the calling thread unless a notification was issued since
+        // prepare_wait returned the given sequence number. Returns false if
+        // the thread was woken up because abs_time (if given) was reached.
+        HPX_CORE_EXPORT bool wait(std::uint32_t seq, char const* description,
+            hpx::chrono::steady_time_point const* abs_time = nullptr);
+
+        void notify_one()
+        {
+            if (state_.fetch_add(sequence, std::memory_order_release) &
+                parked_bit)
+            {
+                notify_one_slow();
+            }
+        }
+
+        HPX_CORE_EXPORT void notify_all();
 
     private:
-        friend HPX_CORE_EXPORT void intrusive_ptr_add_ref(
-            condition_variable_data*) noexcept;
-        friend HPX_CORE_EXPORT void intrusive_ptr_release(
-            condition_variable_data*) noexcept;
+        HPX_CORE_EXPORT void notify_one_slow();
+
+        static constexpr std::uint32_t parked_bit = 0x01;
+        static constexpr std::uint32_t sequence = 0x02;
 
-        hpx::util::atomic_count count_;
+        std::atomic<std::uint32_t> state_;
     };
 }    // namespace hpx::lcos::local::detail
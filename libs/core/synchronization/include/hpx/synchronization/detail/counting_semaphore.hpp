@@ -8,86 +8,96 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/synchronization/detail/condition_variable.hpp>
-#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <mutex>
-
-#if defined(HPX_MSVC_WARNING_PRAGMA)
-#pragma warning(push)
-#pragma warning(disable : 4251)
-#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::lcos::local::detail {
 
+    // The counting semaphore consists of a single atomic word holding the
+    // number of available credits (shifted left by one) and a bit which is
+    // set if threads may be parked on the semaphore. Waiting threads are
+    // suspended in the global parking lot, using the address of the
+    // semaphore as the key.
     class counting_semaphore
     {
-    private:
-        using mutex_type = hpx::spinlock;
-
     public:
-        HPX_CORE_EXPORT explicit counting_semaphore(
-            std::ptrdiff_t value = 0) noexcept;
-        HPX_CORE_EXPORT ~counting_semaphore();
-
-        HPX_CORE_EXPORT void wait(
-            std::unique_lock<mutex_type>& l, std::ptrdiff_t count);
+        // the largest number of credits the semaphore can hold
+        static constexpr std::ptrdiff_t max_value = PTRDIFF_MAX >> 1;
 
-        HPX_CORE_EXPORT bool wait_until(std::unique_lock<mutex_type>& l,
-            hpx::chrono::steady_time_point const& abs_time,
-            std::ptrdiff_t count);
-
-        HPX_CORE_EXPORT bool try_wait(
-            std::unique_lock<mutex_type>& l, std::ptrdiff_t count = 1);
-
-        HPX_CORE_EXPORT bool try_acquire(std::unique_lock<mutex_type>& l);
+        explicit constexpr counting_semaphore(std::ptrdiff_t value = 0) noexcept
+          : state_(value * credit)
+        {
+        }
 
-        HPX_CORE_EXPORT void signal(
-            std::unique_lock<mutex_type> l, std::ptrdiff_t count);
+        counting_semaphore(counting_semaphore const&) = delete;
+        counting_semaphore(counting_semaphore&&) = delete;
+        counting_semaphore& operator=(counting_semaphore const&) = delete;
+        counting_semaphore& operator=(counting_semaphore&&) = delete;
 
-        HPX_CORE_EXPORT std::ptrdiff_t signal_all(
-            std::unique_lock<mutex_type> l);
+        ~counting_semaphore() = default;
 
-    private:
-        std::ptrdiff_t value_;
-        local::detail::condition_variable cond_;
-    };
+        void wait(std::ptrdiff_t count)
+        {
+            if (!try_wait(count))
+            {
+                wait_slow(count, nullptr);
+            }
+        }
 
-    template <typename Mutex>
-    struct counting_semaphore_data
-    {
-        explicit counting_semaphore_data(std::ptrdiff_t value) noexcept
-          : sem_(value)
-          , count_(1)
+        bool wait_until(hpx::chrono::steady_time_point const& abs_time,
+            std::ptrdiff_t count)
         {
+            return try_wait(count) || wait_slow(count, &abs_time);
         }
 
-        mutable Mutex mtx_;
-        detail::counting_semaphore sem_;
+        bool try_wait(std::ptrdiff_t count = 1) noexcept
+        {
+            std::ptrdiff_t state = state_.load(std::memory_order_relaxed);
+            while ((state >> 1) >= count)
+            {
+                if (state_.compare_exchange_weak(state, state - count * credit,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
 
-    private:
-        friend void intrusive_ptr_add_ref(
-            counting_semaphore_data<Mutex>* p) noexcept
+        bool try_acquire() noexcept
         {
-            ++p->count_;
+            return try_wait(1);
         }
 
-        friend void intrusive_ptr_release(
-            counting_semaphore_data<Mutex>* p) noexcept
+        void signal(std::ptrdiff_t count)
         {
-            if (0 == --p->count_)
+            if (state_.fetch_add(count * credit, std::memory_order_release) &
+                parked_bit)
             {
-                delete p;
+                signal_slow(count);
             }
         }
 
-        hpx::util::atomic_count count_;
+        // Wake up all threads currently parked on the semaphore, handing out
+        // one credit to each of them. Returns the number of woken threads.
+        HPX_CORE_EXPORT std::ptrdiff_t signal_all();
+
+    private:
+        // Park the calling thread until count credits can be acquired.
+        // Returns false if abs_time (if given) was reached first.
+        HPX_CORE_EXPORT bool wait_slow(std::ptrdiff_t count,
+            hpx::chrono::steady_time_point const* abs_time);
+
+        // Wake up no more threads than credits were released
+        HPX_CORE_EXPORT void signal_slow(std::ptrdiff_t count);
+
+        static constexpr std::ptrdiff_t parked_bit = 0x01;
+        static constexpr std::ptrdiff_t credit = 0x02;
+
+        std::atomic<std::ptrdiff_t> state_;
     };
 }    // namespace hpx::lcos::local::detail
-
-#if defined(HPX_MSVC_WARNING_PRAGMA)
-#pragma warning(pop)
-#endif
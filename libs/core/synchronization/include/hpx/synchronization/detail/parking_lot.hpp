@@ -0,0 +1,81 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/functional/function_ref.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+// The parking lot is a global hash table of wait queues keyed by the address
+// of a synchronization primitive. This allows for primitives which consist of
+// nothing but an atomic state word: threads which have to wait for such a
+// primitive are parked in the queue associated with its address instead of a
+// queue embedded into the primitive itself.
+//
+// All operations on the queue of a given address are serialized by a
+// spinlock which is shared by all addresses that hash into the same bucket.
+// The validation function passed to park and the callback passed to
+// unpark_one are invoked while this lock is held, which allows to update the
+// state of the primitive atomically with respect to parking threads.
+namespace hpx::lcos::local::detail::parking_lot {
+
+    enum class park_result : std::uint8_t
+    {
+        // the validation function returned false, the thread was not parked
+        invalid = 0,
+
+        // the thread was woken up by unpark_one or unpark_all
+        unparked = 1,
+
+        // the timeout expired before the thread was woken up
+        timed_out = 2
+    };
+
+    struct unpark_result
+    {
+        // a thread was removed from the queue and will be woken up
+        bool unparked_thread = false;
+
+        // there are more threads parked on the same address (this may
+        // include threads parked on other addresses sharing the bucket)
+        bool may_have_more_threads = false;
+    };
+
+    // Park the calling thread on the given address if validate() returns
+    // true. The thread is suspended until it is woken by a call to
+    // unpark_one or unpark_all for the same address.
+    HPX_CORE_EXPORT park_result park(void const* address,
+        hpx::function_ref<bool()> validate,
+        char const* description = "parking_lot::park");
+
+    // Park the calling thread on the given address if validate() returns
+    // true. The thread is suspended until it is woken by a call to
+    // unpark_one or unpark_all for the same address, or until abs_time has
+    // been reached.
+    HPX_CORE_EXPORT park_result park_until(void const* address,
+        hpx::function_ref<bool()> validate,
+        hpx::chrono::steady_time_point const& abs_time,
+        char const* description = "parking_lot::park_until");
+
+    // Wake up the first thread parked on the given address, if any. The
+    // callback is invoked before the thread is resumed, regardless of
+    // whether a thread was found.
+    HPX_CORE_EXPORT unpark_result unpark_one(void const* address,
+        hpx::function_ref<void(unpark_result)> callback,
+        threads::thread_priority priority =
+            threads::thread_priority::default_);
+
+    // Wake up all threads parked on the given address, return their number.
+    HPX_CORE_EXPORT std::size_t unpark_all(void const* address,
+        threads::thread_priority priority =
+            threads::thread_priority::default_);
+}    // namespace hpx::lcos::local::detail::parking_lot
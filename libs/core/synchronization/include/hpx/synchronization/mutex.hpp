@@ -15,11 +15,13 @@
 #include <hpx/coroutines/coroutine_fwd.hpp>
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/modules/errors.hpp>
-#include <hpx/synchronization/detail/condition_variable.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
+#include <cstdint>
+
 namespace hpx::threads {
 
     using thread_id_ref_type = thread_id_ref;
@@ -60,17 +62,18 @@ namespace hpx {
     ///
     ///        \a hpx::mutex is neither copyable nor movable.
     ///
+    ///        An \a hpx::mutex consists of an atomic state and the id of its
+    ///        owner only. Threads which have to wait for the \a mutex spin
+    ///        for a short while and are then suspended in a global table of
+    ///        wait queues (a parking lot) keyed by the address of the
+    ///        \a mutex.
+    ///
     class mutex
     {
     public:
         /// \brief \a hpx::mutex is neither copyable nor movable
         HPX_NON_COPYABLE(mutex);
 
-    protected:
-        /// \cond NOPROTECTED
-        using mutex_type = hpx::spinlock;
-        /// \endcond NOPROTECTED
-
     public:
         ///
         /// \brief Constructs the \a mutex. The \a mutex is in unlocked state
@@ -88,7 +91,8 @@ namespace hpx {
         HPX_CORE_EXPORT mutex(char const* const description = "");
 #else
         HPX_HOST_DEVICE_CONSTEXPR mutex(char const* const = "") noexcept
-          : owner_id_(threads::invalid_thread_id)
+          : state_(0)
+          , owner_id_(nullptr)
         {
         }
 #endif
@@ -237,9 +241,24 @@ namespace hpx {
 
     protected:
         /// \cond NOPROTECTED
-        mutable mutex_type mtx_;
-        threads::thread_id_type owner_id_;
-        hpx::lcos::local::detail::condition_variable cond_;
+        // Acquire the lock once the fast path has failed, spinning for a
+        // short while before parking the calling thread. Returns false if
+        // abs_time (if given) was reached before the lock was acquired.
+        HPX_CORE_EXPORT bool lock_slow(char const* description,
+            hpx::chrono::steady_time_point const* abs_time = nullptr);
+
+        // Wake up one of the parked threads
+        HPX_CORE_EXPORT void unlock_slow();
+
+        // The mutex is locked
+        static constexpr std::uint8_t locked_bit = 0x01;
+
+        // There may be threads parked on the mutex (in the global parking
+        // lot, using the address of the mutex as the key)
+        static constexpr std::uint8_t parked_bit = 0x02;
+
+        std::atomic<std::uint8_t> state_;
+        std::atomic<void*> owner_id_;
         /// \endcond NOPROTECTED
     };
 
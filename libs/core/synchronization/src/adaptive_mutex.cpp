@@ -0,0 +1,401 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/itt_notify.hpp>
+#include <hpx/synchronization/adaptive_mutex.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hpx {
+
+    namespace lcos::local::detail {
+
+        namespace {
+
+            struct lock_site_registry
+            {
+                std::mutex mtx_;
+                std::map<std::string, std::unique_ptr<lock_site_statistics>>
+                    sites_;
+            };
+
+            lock_site_registry& get_lock_site_registry()
+            {
+                static lock_site_registry registry;
+                return registry;
+            }
+
+            std::int64_t query(std::atomic<std::int64_t>& value, bool reset)
+            {
+                return reset ? value.exchange(0, std::memory_order_relaxed) :
+                               value.load(std::memory_order_relaxed);
+            }
+        }    // namespace
+
+        lock_site_statistics& get_lock_site_statistics(char const* site)
+        {
+            lock_site_registry& registry = get_lock_site_registry();
+            std::lock_guard<std::mutex> l(registry.mtx_);
+
+            auto& statistics =
+                registry.sites_[(site == nullptr || *site == '\0') ?
+                        std::string("unnamed") :
+                        std::string(site)];
+            if (!statistics)
+            {
+                statistics = std::make_unique<lock_site_statistics>();
+            }
+            return *statistics;
+        }
+
+        std::vector<std::string> get_lock_sites()
+        {
+            lock_site_registry& registry = get_lock_site_registry();
+            std::lock_guard<std::mutex> l(registry.mtx_);
+
+            std::vector<std::string> sites;
+            sites.reserve(registry.sites_.size());
+            for (auto const& site : registry.sites_)
+            {
+                sites.push_back(site.first);
+            }
+            return sites;
+        }
+
+        std::int64_t query_lock_statistics(
+            std::string const& site, lock_statistic which, bool reset)
+        {
+            lock_site_registry& registry = get_lock_site_registry();
+            std::lock_guard<std::mutex> l(registry.mtx_);
+
+            std::int64_t result = 0;
+            std::int64_t samples = 0;
+            for (auto const& s : registry.sites_)
+            {
+                if (!site.empty() && s.first != site)
+                {
+                    continue;
+                }
+
+                lock_site_statistics& statistics = *s.second;
+                switch (which)
+                {
+                case lock_statistic::acquisitions:
+                    result += query(statistics.acquisitions, reset);
+                    break;
+
+                case lock_statistic::contended:
+                    result += query(statistics.contended, reset);
+                    break;
+
+                case lock_statistic::wait_time:
+                    result += query(statistics.wait_time, reset);
+                    break;
+
+                case lock_statistic::hold_time:
+                    result += query(statistics.hold_time, reset);
+                    samples += query(statistics.hold_samples, reset);
+                    break;
+
+                default:
+                    break;
+                }
+            }
+
+            if (which == lock_statistic::hold_time)
+            {
+                return samples == 0 ? 0 : result / samples;
+            }
+            return result;
+        }
+    }    // namespace lcos::local::detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // sample the hold time of every so many acquisitions
+        constexpr std::uint32_t sample_interval = 16;
+
+        // spin budget used as long as no hold times were sampled
+        constexpr std::uint64_t default_spin_time = 1000;    // nanoseconds
+
+        // never spin longer than this, suspending a thread is cheaper
+        constexpr std::uint64_t max_spin_time = 20000;    // nanoseconds
+
+        // maximal number of pause instructions between two attempts
+        constexpr std::size_t max_backoff = 64;
+
+        std::uint64_t spin_budget(std::uint32_t hold_time) noexcept
+        {
+            // a waiting thread arrives at some random point during the
+            // current hold time, spinning for twice the average hold time
+            // covers most of the acquisitions which can succeed by spinning
+            if (hold_time == 0)
+            {
+                return default_spin_time;
+            }
+            return (std::min)(2 * std::uint64_t(hold_time), max_spin_time);
+        }
+    }    // namespace
+
+#if HPX_HAVE_ITTNOTIFY != 0
+    adaptive_mutex::adaptive_mutex(char const* const site)
+      : state_(0)
+      , hold_time_(0)
+      , owner_id_(nullptr)
+      , site_(site)
+      , statistics_(nullptr)
+    {
+        HPX_ITT_SYNC_CREATE(this, "hpx::adaptive_mutex", site);
+        HPX_ITT_SYNC_RENAME(this, "hpx::adaptive_mutex");
+    }
+#endif
+
+#if HPX_HAVE_ITTNOTIFY != 0
+    adaptive_mutex::~adaptive_mutex()
+    {
+        HPX_ITT_SYNC_DESTROY(this);
+    }
+#else
+    adaptive_mutex::~adaptive_mutex() = default;
+#endif
+
+    lcos::local::detail::lock_site_statistics& adaptive_mutex::statistics()
+    {
+        auto* statistics = statistics_.load(std::memory_order_acquire);
+        if (statistics == nullptr)
+        {
+            // concurrent lookups return the same object
+            statistics = &lcos::local::detail::get_lock_site_statistics(site_);
+            statistics_.store(statistics, std::memory_order_release);
+        }
+        return *statistics;
+    }
+
+    void adaptive_mutex::lock(char const* description, error_code& ec)
+    {
+        HPX_ASSERT(threads::get_self_ptr() != nullptr);
+
+        HPX_ITT_SYNC_PREPARE(this);
+
+        void* const self_id = threads::get_self_id().get();
+
+        std::uint8_t state = 0;
+        if (!state_.compare_exchange_strong(
+                state, locked_bit, std::memory_order_acquire))
+        {
+            // only the calling thread could have stored its own id
+            if (owner_id_.load(std::memory_order_relaxed) == self_id)
+            {
+                HPX_ITT_SYNC_CANCEL(this);
+                HPX_THROWS_IF(ec, hpx::error::deadlock, description,
+                    "The calling thread already owns the mutex");
+                return;
+            }
+
+            lock_contended(description);
+        }
+
+        acquired(self_id);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    bool adaptive_mutex::try_lock(char const* /* description */, error_code& ec)
+    {
+        HPX_ASSERT(threads::get_self_ptr() != nullptr);
+
+        HPX_ITT_SYNC_PREPARE(this);
+
+        std::uint8_t state = state_.load(std::memory_order_relaxed);
+        do
+        {
+            if (state & locked_bit)
+            {
+                HPX_ITT_SYNC_CANCEL(this);
+                return false;
+            }
+        } while (!state_.compare_exchange_weak(state, state | locked_bit,
+            std::memory_order_acquire, std::memory_order_relaxed));
+
+        acquired(threads::get_self_id().get());
+
+        if (&ec != &throws)
+            ec = make_success_code();
+        return true;
+    }
+
+    void adaptive_mutex::unlock(error_code& ec)
+    {
+        HPX_ASSERT(threads::get_self_ptr() != nullptr);
+
+        HPX_ITT_SYNC_RELEASING(this);
+        util::unregister_lock(this);
+
+        if (HPX_UNLIKELY(owner_id_.load(std::memory_order_relaxed) !=
+                threads::get_self_id().get()))
+        {
+            HPX_THROWS_IF(ec, hpx::error::lock_error, "adaptive_mutex::unlock",
+                "The calling thread does not own the mutex");
+            return;
+        }
+
+        released();
+
+        HPX_ITT_SYNC_RELEASED(this);
+        owner_id_.store(nullptr, std::memory_order_relaxed);
+
+        std::uint8_t state = locked_bit;
+        if (!state_.compare_exchange_strong(
+                state, 0, std::memory_order_release))
+        {
+            unlock_slow();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    void adaptive_mutex::acquired(void* self_id)
+    {
+        util::register_lock(this);
+        HPX_ITT_SYNC_ACQUIRED(this);
+        owner_id_.store(self_id, std::memory_order_relaxed);
+
+        if (++acquisitions_ == sample_interval)
+        {
+            acquisitions_ = 0;
+            statistics().acquisitions.fetch_add(
+                sample_interval, std::memory_order_relaxed);
+
+            hold_start_ = hpx::chrono::high_resolution_clock::now();
+        }
+    }
+
+    void adaptive_mutex::released()
+    {
+        if (hold_start_ == 0)
+        {
+            return;
+        }
+
+        std::uint64_t const hold_time =
+            hpx::chrono::high_resolution_clock::now() - hold_start_;
+        hold_start_ = 0;
+
+        // exponentially weighted average giving the new sample a weight of
+        // 1/4
+        std::uint64_t const average =
+            hold_time_.load(std::memory_order_relaxed);
+        std::uint64_t const updated =
+            average == 0 ? hold_time : (3 * average + hold_time) / 4;
+        hold_time_.store(
+            static_cast<std::uint32_t>((std::min)(updated,
+                std::uint64_t((std::numeric_limits<std::uint32_t>::max)()))),
+            std::memory_order_relaxed);
+
+        lcos::local::detail::lock_site_statistics& s = statistics();
+        s.hold_samples.fetch_add(1, std::memory_order_relaxed);
+        s.hold_time.fetch_add(
+            static_cast<std::int64_t>(hold_time), std::memory_order_relaxed);
+    }
+
+    void adaptive_mutex::lock_contended(char const* description)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        std::uint64_t spin_until =
+            start + spin_budget(hold_time_.load(std::memory_order_relaxed));
+        std::size_t backoff = 1;
+
+        std::uint8_t state = state_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if (!(state & locked_bit))
+            {
+                if (state_.compare_exchange_weak(state, state | locked_bit,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    break;
+                }
+                continue;
+            }
+
+            if (!(state & parked_bit))
+            {
+                // spin with exponential backoff while within the budget
+                if (hpx::chrono::high_resolution_clock::now() < spin_until)
+                {
+                    for (std::size_t i = 0; i != backoff; ++i)
+                    {
+                        HPX_SMT_PAUSE;
+                    }
+                    backoff = (std::min)(2 * backoff, max_backoff);
+
+                    state = state_.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                // announce that we are going to park
+                if (!state_.compare_exchange_weak(state, state | parked_bit,
+                        std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+            }
+
+            lcos::local::detail::parking_lot::park(
+                this,
+                [this]() {
+                    return state_.load(std::memory_order_relaxed) ==
+                        (locked_bit | parked_bit);
+                },
+                description);
+
+            // spin again, based on the most recent hold time
+            spin_until = hpx::chrono::high_resolution_clock::now() +
+                spin_budget(hold_time_.load(std::memory_order_relaxed));
+            backoff = 1;
+            state = state_.load(std::memory_order_relaxed);
+        }
+
+        // the calling thread owns the lock now
+        lcos::local::detail::lock_site_statistics& s = statistics();
+        s.contended.fetch_add(1, std::memory_order_relaxed);
+        s.wait_time.fetch_add(static_cast<std::int64_t>(
+                                  hpx::chrono::high_resolution_clock::now() -
+                                  start),
+            std::memory_order_relaxed);
+    }
+
+    void adaptive_mutex::unlock_slow()
+    {
+        lcos::local::detail::parking_lot::unpark_one(
+            this,
+            [this](lcos::local::detail::parking_lot::unpark_result result) {
+                state_.store(result.may_have_more_threads ? parked_bit : 0,
+                    std::memory_order_release);
+            },
+            threads::thread_priority::boost);
+    }
+}    // namespace hpx
@@ -10,8 +10,8 @@
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
-#include <hpx/modules/memory.hpp>
 #include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
 #include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
@@ -19,7 +19,9 @@
 #include <hpx/timing/steady_clock.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <mutex>
 #include <utility>
@@ -323,16 +325,61 @@ namespace hpx::lcos::local::detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    void intrusive_ptr_add_ref(condition_variable_data* p) noexcept
+    bool condition_variable_state::wait(std::uint32_t seq,
+        char const* description, hpx::chrono::steady_time_point const* abs_time)
     {
-        ++p->count_;
+        // park only if no notification was issued in the meantime,
+        // announcing the parked thread while the parking lot's queue is
+        // locked
+        auto validate = [&]() -> bool {
+            std::uint32_t state = state_.load(std::memory_order_relaxed);
+            while ((state & ~parked_bit) == seq)
+            {
+                if ((state & parked_bit) ||
+                    state_.compare_exchange_weak(state, state | parked_bit,
+                        std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        if (abs_time == nullptr)
+        {
+            parking_lot::park(this, validate, description);
+            return true;
+        }
+        return parking_lot::park_until(this, validate, *abs_time,
+                   description) != parking_lot::park_result::timed_out;
     }
 
-    void intrusive_ptr_release(condition_variable_data* p) noexcept
+    void condition_variable_state::notify_one_slow()
     {
-        if (0 == --p->count_)
+        // clear the parked bit while the queue is locked once the last
+        // thread has been removed from it
+        parking_lot::unpark_one(this, [this](parking_lot::unpark_result r) {
+            if (!r.may_have_more_threads)
+            {
+                state_.fetch_and(~parked_bit, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    void condition_variable_state::notify_all()
+    {
+        std::uint32_t state = state_.load(std::memory_order_relaxed);
+        while (!state_.compare_exchange_weak(state,
+            (state + sequence) & ~parked_bit, std::memory_order_release,
+            std::memory_order_relaxed))
+        {
+        }
+
+        // threads parking after the bit was cleared set it again, they may
+        // be woken up spuriously
+        if (state & parked_bit)
         {
-            delete p;
+            parking_lot::unpark_all(this);
         }
     }
 }    // namespace hpx::lcos::local::detail
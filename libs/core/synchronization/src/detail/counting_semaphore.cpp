@@ -6,110 +6,111 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
-#include <hpx/assert.hpp>
-#include <hpx/synchronization/detail/condition_variable.hpp>
 #include <hpx/synchronization/detail/counting_semaphore.hpp>
-#include <hpx/synchronization/spinlock.hpp>
-#include <hpx/type_support/assert_owns_lock.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+#include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
 #include <cstddef>
-#include <cstdint>
-#include <mutex>
-#include <utility>
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::lcos::local::detail {
 
-    counting_semaphore::counting_semaphore(std::ptrdiff_t value) noexcept
-      : value_(value)
+    bool counting_semaphore::wait_slow(std::ptrdiff_t count,
+        hpx::chrono::steady_time_point const* abs_time)
     {
-    }
-
-    counting_semaphore::~counting_semaphore() = default;
-
-    void counting_semaphore::wait(
-        std::unique_lock<mutex_type>& l, std::ptrdiff_t count)
-    {
-        HPX_ASSERT_OWNS_LOCK(l);
-
-        while (value_ < count)    //-V776
-        {
-            cond_.wait(l, "counting_semaphore::wait");
-        }
-        value_ -= count;
-    }
-
-    bool counting_semaphore::wait_until(std::unique_lock<mutex_type>& l,
-        hpx::chrono::steady_time_point const& abs_time, std::ptrdiff_t count)
-    {
-        HPX_ASSERT_OWNS_LOCK(l);
+        // park only if there are not enough credits, announcing the parked
+        // thread while the parking lot's queue is locked
+        auto validate = [&]() -> bool {
+            std::ptrdiff_t state = state_.load(std::memory_order_relaxed);
+            while ((state >> 1) < count)
+            {
+                if ((state & parked_bit) ||
+                    state_.compare_exchange_weak(state, state | parked_bit,
+                        std::memory_order_relaxed))
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
 
-        while (value_ < count)
+        while (!try_wait(count))
         {
-            // return false if unblocked by timeout expiring
-            if (cond_.wait_until(
-                    l, abs_time, "counting_semaphore::wait_until") !=
-                threads::thread_restart_state::unknown)
+            if (abs_time == nullptr)
+            {
+                parking_lot::park(this, validate, "counting_semaphore::wait");
+            }
+            else if (parking_lot::park_until(this, validate, *abs_time,
+                         "counting_semaphore::wait_until") ==
+                parking_lot::park_result::timed_out)
             {
-                return false;
+                // return false if unblocked by timeout expiring
+                return try_wait(count);
             }
         }
-        value_ -= count;
         return true;
     }
 
-    bool counting_semaphore::try_wait(
-        std::unique_lock<mutex_type>& l, std::ptrdiff_t count)
+    void counting_semaphore::signal_slow(std::ptrdiff_t count)
     {
-        HPX_ASSERT_OWNS_LOCK(l);
+        // clear the parked bit while the queue is locked once the last
+        // thread has been removed from it
+        auto callback = [this](parking_lot::unpark_result result) {
+            if (!result.may_have_more_threads)
+            {
+                state_.fetch_and(~parked_bit, std::memory_order_relaxed);
+            }
+        };
 
-        if (value_ >= count)
+        // release no more threads than we get resources, the semaphore must
+        // not be touched anymore once the last parked thread was woken up
+        for (std::ptrdiff_t i = 0; i < count; ++i)
         {
-            // enter wait_locked only if there are sufficient credits available
-            wait(l, count);
-            return true;
+            parking_lot::unpark_result const result =
+                parking_lot::unpark_one(this, callback);
+            if (!result.unparked_thread || !result.may_have_more_threads)
+            {
+                break;
+            }
         }
-        return false;
     }
 
-    bool counting_semaphore::try_acquire(std::unique_lock<mutex_type>& l)
+    std::ptrdiff_t counting_semaphore::signal_all()
     {
-        HPX_ASSERT_OWNS_LOCK(l);
-
-        if (value_ >= 1)
+        if (!(state_.load(std::memory_order_relaxed) & parked_bit))
         {
-            --value_;
-            return true;
+            return 0;
         }
-        return false;
-    }
-
-    void counting_semaphore::signal(
-        std::unique_lock<mutex_type> l, std::ptrdiff_t count)
-    {
-        HPX_ASSERT_OWNS_LOCK(l);
 
-        mutex_type* mtx = l.mutex();
+        // hand out the credit before the woken thread is resumed
+        auto callback = [this](parking_lot::unpark_result result) {
+            if (result.unparked_thread)
+            {
+                state_.fetch_add(credit, std::memory_order_release);
+            }
+            if (!result.may_have_more_threads)
+            {
+                state_.fetch_and(~parked_bit, std::memory_order_relaxed);
+            }
+        };
 
-        // release no more threads than we get resources
-        value_ += count;
-        for (std::int64_t i = 0; value_ >= 0 && i < count; ++i)
+        std::ptrdiff_t count = 0;
+        while (true)
         {
-            // notify_one() returns false if no more threads are waiting
-            if (!cond_.notify_one(HPX_MOVE(l)))
+            parking_lot::unpark_result const result =
+                parking_lot::unpark_one(this, callback);
+            if (!result.unparked_thread)
+            {
                 break;
+            }
 
-            l = std::unique_lock<mutex_type>(*mtx);
+            ++count;
+            if (!result.may_have_more_threads)
+            {
+                break;
+            }
         }
-    }
-
-    std::ptrdiff_t counting_semaphore::signal_all(
-        std::unique_lock<mutex_type> l)
-    {
-        HPX_ASSERT_OWNS_LOCK(l);
-
-        auto const count = static_cast<std::ptrdiff_t>(cond_.size(l));
-        signal(HPX_MOVE(l), count);
         return count;
     }
 }    // namespace hpx::lcos::local::detail
@@ -0,0 +1,214 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/detail/intrusive_list.hpp>
+#include <hpx/execution_base/agent_ref.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/hashing/fibhash.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx::lcos::local::detail::parking_lot {
+
+    namespace {
+
+        struct queue_entry
+        {
+            constexpr queue_entry(hpx::execution_base::agent_ref ctx,
+                void const* address) noexcept
+              : ctx_(ctx)
+              , address_(address)
+            {
+            }
+
+            hpx::execution_base::agent_ref ctx_;
+            void const* address_;
+
+            queue_entry* next = nullptr;
+            queue_entry* prev = nullptr;
+        };
+
+        using queue_type = hpx::detail::intrusive_list<queue_entry>;
+        using mutex_type = hpx::spinlock;
+
+        struct bucket
+        {
+            mutex_type mtx_;
+            queue_type queue_;
+        };
+
+        // must be a power of two
+        constexpr std::size_t num_buckets = 256;
+
+        util::cache_aligned_data<bucket> buckets[num_buckets];
+
+        bucket& bucket_for(void const* address) noexcept
+        {
+            return buckets[util::fibhash<num_buckets>(
+                               reinterpret_cast<std::size_t>(address))]
+                .data_;
+        }
+
+        // remove the entry from the queue if the thread was woken up by
+        // anything but unpark_one or unpark_all (timeout, abort)
+        struct reset_queue_entry
+        {
+            reset_queue_entry(queue_entry& e, queue_type& q) noexcept
+              : e_(e)
+              , q_(q)
+            {
+            }
+
+            reset_queue_entry(reset_queue_entry const&) = delete;
+            reset_queue_entry(reset_queue_entry&&) = delete;
+            reset_queue_entry& operator=(reset_queue_entry const&) = delete;
+            reset_queue_entry& operator=(reset_queue_entry&&) = delete;
+
+            ~reset_queue_entry()
+            {
+                if (e_.ctx_)
+                {
+                    q_.erase(&e_);
+                }
+            }
+
+            queue_entry& e_;
+            queue_type& q_;
+        };
+
+        template <typename Suspend>
+        park_result park_impl(void const* address,
+            hpx::function_ref<bool()> validate, Suspend&& suspend)
+        {
+            bucket& b = bucket_for(address);
+            std::unique_lock<mutex_type> l(b.mtx_);
+
+            if (!validate())
+            {
+                return park_result::invalid;
+            }
+
+            auto const this_ctx = hpx::execution_base::this_thread::agent();
+            queue_entry e(this_ctx, address);
+            b.queue_.push_back(e);
+
+            reset_queue_entry r(e, b.queue_);
+            {
+                // suspend this thread
+                unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                suspend(this_ctx);
+            }
+
+            return e.ctx_ ? park_result::timed_out : park_result::unparked;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    park_result park(void const* address, hpx::function_ref<bool()> validate,
+        char const* description)
+    {
+        return park_impl(address, validate,
+            [&](hpx::execution_base::agent_ref ctx) {
+                ctx.suspend(description);
+            });
+    }
+
+    park_result park_until(void const* address,
+        hpx::function_ref<bool()> validate,
+        hpx::chrono::steady_time_point const& abs_time,
+        char const* description)
+    {
+        return park_impl(address, validate,
+            [&](hpx::execution_base::agent_ref ctx) {
+                ctx.sleep_until(abs_time.value(), description);
+            });
+    }
+
+    unpark_result unpark_one(void const* address,
+        hpx::function_ref<void(unpark_result)> callback,
+        threads::thread_priority priority)
+    {
+        bucket& b = bucket_for(address);
+        std::unique_lock<mutex_type> l(b.mtx_);
+
+        unpark_result result;
+        hpx::execution_base::agent_ref ctx;
+
+        queue_entry* e = b.queue_.front();
+        while (e != nullptr && e->address_ != address)
+        {
+            e = e->next;
+        }
+
+        if (e != nullptr)
+        {
+            ctx = e->ctx_;
+
+            // look for more threads parked on the same address
+            queue_entry* next = e->next;
+            while (next != nullptr && next->address_ != address)
+            {
+                next = next->next;
+            }
+
+            // remove item from queue before resuming the thread
+            e->ctx_.reset();
+            b.queue_.erase(e);
+
+            result.unparked_thread = true;
+            result.may_have_more_threads = next != nullptr;
+        }
+
+        callback(result);
+        l.unlock();
+
+        if (ctx)
+        {
+            ctx.resume(priority);
+        }
+        return result;
+    }
+
+    std::size_t unpark_all(void const* address,
+        threads::thread_priority priority)
+    {
+        bucket& b = bucket_for(address);
+        std::unique_lock<mutex_type> l(b.mtx_);
+
+        std::size_t count = 0;
+        queue_entry* e = b.queue_.front();
+        while (e != nullptr)
+        {
+            queue_entry* next = e->next;
+            if (e->address_ == address)
+            {
+                auto const ctx = e->ctx_;
+
+                // remove item from queue before resuming the thread
+                e->ctx_.reset();
+                b.queue_.erase(e);
+
+                // the next entry can't go away while the bucket is locked,
+                // so the thread is resumed without unlocking
+                [[maybe_unused]] util::ignore_while_checking const il(&l);
+
+                ctx.resume(priority);
+                ++count;
+            }
+            e = next;
+        }
+        return count;
+    }
+}    // namespace hpx::lcos::local::detail::parking_lot
@@ -9,23 +9,31 @@
 
 #include <hpx/assert.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/itt_notify.hpp>
-#include <hpx/synchronization/condition_variable.hpp>
-#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
-#include <mutex>
-#include <utility>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 
 namespace hpx {
 
+    namespace {
+
+        // number of times a thread spins (and yields) before it parks
+        constexpr std::size_t spin_limit = 32;
+    }    // namespace
+
     ///////////////////////////////////////////////////////////////////////////
 #if HPX_HAVE_ITTNOTIFY != 0
     mutex::mutex(char const* const description)
-      : owner_id_(threads::invalid_thread_id)
+      : state_(0)
+      , owner_id_(nullptr)
     {
         HPX_ITT_SYNC_CREATE(this, "hpx::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "hpx::mutex");
@@ -46,50 +54,57 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_type const self_id = threads::get_self_id();
-        if (owner_id_ == self_id)
-        {
-            HPX_ITT_SYNC_CANCEL(this);
-            l.unlock();
-            HPX_THROWS_IF(ec, hpx::error::deadlock, description,
-                "The calling thread already owns the mutex");
-            return;
-        }
+        void* const self_id = threads::get_self_id().get();
 
-        while (owner_id_ != threads::invalid_thread_id)
+        std::uint8_t state = 0;
+        if (!state_.compare_exchange_strong(
+                state, locked_bit, std::memory_order_acquire))
         {
-            cond_.wait(l, ec);
-            if (ec)
+            // only the calling thread could have stored its own id
+            if (owner_id_.load(std::memory_order_relaxed) == self_id)
             {
                 HPX_ITT_SYNC_CANCEL(this);
+                HPX_THROWS_IF(ec, hpx::error::deadlock, description,
+                    "The calling thread already owns the mutex");
                 return;
             }
+
+            lock_slow(description);
         }
 
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+        owner_id_.store(self_id, std::memory_order_relaxed);
+
+        if (&ec != &throws)
+            ec = make_success_code();
     }
 
-    bool mutex::try_lock(char const* /* description */, error_code& /* ec */)
+    bool mutex::try_lock(char const* /* description */, error_code& ec)
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        if (owner_id_ != threads::invalid_thread_id)
+        std::uint8_t state = state_.load(std::memory_order_relaxed);
+        do
         {
-            HPX_ITT_SYNC_CANCEL(this);
-            return false;
-        }
+            if (state & locked_bit)
+            {
+                HPX_ITT_SYNC_CANCEL(this);
+                return false;
+            }
+        } while (!state_.compare_exchange_weak(state, state | locked_bit,
+            std::memory_order_acquire, std::memory_order_relaxed));
 
-        threads::thread_id_type const self_id = threads::get_self_id();
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+        owner_id_.store(
+            threads::get_self_id().get(), std::memory_order_relaxed);
+
+        if (&ec != &throws)
+            ec = make_success_code();
         return true;
     }
 
@@ -98,40 +113,118 @@ namespace hpx {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_RELEASING(this);
-        // Unregister lock early as the lock guard below may suspend.
         util::unregister_lock(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_type const self_id = threads::get_self_id();
-        if (HPX_UNLIKELY(owner_id_ != self_id))
+        if (HPX_UNLIKELY(owner_id_.load(std::memory_order_relaxed) !=
+                threads::get_self_id().get()))
         {
-            l.unlock();
             HPX_THROWS_IF(ec, hpx::error::lock_error, "mutex::unlock",
                 "The calling thread does not own the mutex");
             return;
         }
 
         HPX_ITT_SYNC_RELEASED(this);
-        owner_id_ = threads::invalid_thread_id;
+        owner_id_.store(nullptr, std::memory_order_relaxed);
 
+        std::uint8_t state = locked_bit;
+        if (!state_.compare_exchange_strong(
+                state, 0, std::memory_order_release))
         {
-            [[maybe_unused]] util::ignore_while_checking il(&l);
+            unlock_slow();
+        }
 
-            // Failing to release lock 'this->mtx' in function
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26115)
-#endif
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    bool mutex::lock_slow(char const* description,
+        hpx::chrono::steady_time_point const* abs_time)
+    {
+        std::size_t k = 0;
+        std::uint8_t state = state_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            // grab the lock if it is available, even if there are parked
+            // threads (this avoids convoys)
+            if (!(state & locked_bit))
+            {
+                if (state_.compare_exchange_weak(state, state | locked_bit,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    return true;
+                }
+                continue;
+            }
 
-            cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost, ec);
-            il.reset_owns_registration();
+            if (!(state & parked_bit))
+            {
+                // spin for a while as long as nobody has parked yet
+                if (k < spin_limit)
+                {
+                    hpx::execution_base::this_thread::yield_k(k++, description);
+                    state = state_.load(std::memory_order_relaxed);
+                    continue;
+                }
 
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
+                // announce that we are going to park
+                if (!state_.compare_exchange_weak(state, state | parked_bit,
+                        std::memory_order_relaxed, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+            }
+
+            // park until unlock() wakes us up, provided the mutex is still
+            // locked and the parked bit is set while the queue is locked
+            auto validate = [this]() {
+                return state_.load(std::memory_order_relaxed) ==
+                    (locked_bit | parked_bit);
+            };
+
+            if (abs_time == nullptr)
+            {
+                lcos::local::detail::parking_lot::park(
+                    this, validate, description);
+            }
+            else if (lcos::local::detail::parking_lot::park_until(
+                         this, validate, *abs_time, description) ==
+                lcos::local::detail::parking_lot::park_result::timed_out)
+            {
+                // make a last attempt at acquiring the lock, a stale parked
+                // bit is cleared by the next unlock()
+                state = state_.load(std::memory_order_relaxed);
+                while (!(state & locked_bit))
+                {
+                    if (state_.compare_exchange_weak(state,
+                            state | locked_bit, std::memory_order_acquire,
+                            std::memory_order_relaxed))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // compete for the lock again
+            k = 0;
+            state = state_.load(std::memory_order_relaxed);
         }
     }
 
+    void mutex::unlock_slow()
+    {
+        // The parked bit is updated while the queue is locked, so no other
+        // thread can park concurrently. The lock itself is released at the
+        // same time, the unparked thread has to compete for it.
+        lcos::local::detail::parking_lot::unpark_one(
+            this,
+            [this](lcos::local::detail::parking_lot::unpark_result result) {
+                state_.store(result.may_have_more_threads ? parked_bit : 0,
+                    std::memory_order_release);
+            },
+            threads::thread_priority::boost);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     timed_mutex::timed_mutex(char const* const description)
       : mutex(description)
@@ -142,40 +235,28 @@ namespace hpx {
 
     bool timed_mutex::try_lock_until(
         hpx::chrono::steady_time_point const& abs_time,
-        char const* /* description */, error_code& ec)
+        char const* description, error_code& ec)
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
         HPX_ITT_SYNC_PREPARE(this);
-        std::unique_lock<mutex_type> l(mtx_);
 
-        threads::thread_id_type const self_id = threads::get_self_id();
-        if (owner_id_ != threads::invalid_thread_id)
+        std::uint8_t state = 0;
+        if (!state_.compare_exchange_strong(
+                state, locked_bit, std::memory_order_acquire) &&
+            !lock_slow(description, &abs_time))
         {
-            threads::thread_restart_state const reason =
-                cond_.wait_until(l, abs_time, ec);
-            if (ec)
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
-
-            if (reason == threads::thread_restart_state::timeout)    //-V110
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
-
-            if (owner_id_ != threads::invalid_thread_id)    //-V110
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
         }
 
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+        owner_id_.store(
+            threads::get_self_id().get(), std::memory_order_relaxed);
+
+        if (&ec != &throws)
+            ec = make_success_code();
         return true;
     }
 }    // namespace hpx
@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Measure the throughput of contended lock/unlock pairs for different mutex
+//  types, similar to tests/performance/local/spinlock_overhead1.cpp.
+
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t delay_iterations = 0;
+
+double delay(double d)
+{
+    for (std::uint64_t j = 0; j < delay_iterations; ++j)
+    {
+        d += 1. / (2. * static_cast<double>(j) + 1.);
+    }
+    return d;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Mutex>
+double run_benchmark(char const* name, std::size_t num_tasks,
+    std::size_t num_mutexes, std::uint64_t iterations, bool csv)
+{
+    std::unique_ptr<Mutex[]> mtx(new Mutex[num_mutexes]);
+    std::vector<double> values(num_mutexes, 0.0);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&, i]() {
+            for (std::uint64_t j = 0; j != iterations; ++j)
+            {
+                std::size_t const idx = (i + j) % num_mutexes;
+
+                std::lock_guard<Mutex> l(mtx[idx]);
+                values[idx] = delay(values[idx]);
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    double const elapsed = t.elapsed();
+    double const ops =
+        static_cast<double>(num_tasks) * static_cast<double>(iterations);
+
+    if (csv)
+    {
+        hpx::util::format_to(std::cout, "{1},{2},{3},{4}\n", name, num_tasks,
+            num_mutexes, ops / elapsed)
+            << std::flush;
+    }
+    else
+    {
+        hpx::util::format_to(std::cout,
+            "{1}: {2} tasks, {3} mutexes: {4} [locks/s] ({5} [s/lock])\n",
+            name, num_tasks, num_mutexes, ops / elapsed, elapsed / ops)
+            << std::flush;
+    }
+    return elapsed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    delay_iterations = vm["delay-iterations"].as<std::uint64_t>();
+
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const num_mutexes = vm["mutexes"].as<std::size_t>();
+    std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+    bool const csv = vm.count("csv") != 0;
+
+    if (num_tasks == 0 || num_mutexes == 0)
+    {
+        std::cerr << "error: tasks and mutexes must not be zero\n";
+        return hpx::local::finalize();
+    }
+
+    double const mutex_time = run_benchmark<hpx::mutex>(
+        "hpx::mutex", num_tasks, num_mutexes, iterations, csv);
+    double const adaptive_mutex_time = run_benchmark<hpx::adaptive_mutex>(
+        "hpx::adaptive_mutex", num_tasks, num_mutexes, iterations, csv);
+    double const spinlock_time = run_benchmark<hpx::spinlock>(
+        "hpx::spinlock", num_tasks, num_mutexes, iterations, csv);
+    double const std_mutex_time = run_benchmark<std::mutex>(
+        "std::mutex", num_tasks, num_mutexes, iterations, csv);
+
+    hpx::util::print_cdash_timing("MutexContention", mutex_time);
+    hpx::util::print_cdash_timing(
+        "AdaptiveMutexContention", adaptive_mutex_time);
+    hpx::util::print_cdash_timing("SpinlockContention", spinlock_time);
+    hpx::util::print_cdash_timing("StdMutexContention", std_mutex_time);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("tasks", value<std::size_t>()->default_value(64),
+            "number of tasks competing for the mutexes")
+        ("mutexes", value<std::size_t>()->default_value(1),
+            "number of mutexes the tasks are distributed over")
+        ("iterations", value<std::uint64_t>()->default_value(100000),
+            "number of lock/unlock pairs per task")
+        ("delay-iterations", value<std::uint64_t>()->default_value(0),
+            "number of iterations in the delay loop run while the lock is "
+            "held")
+        ("csv", "output results as csv (format: name,tasks,mutexes,locks/s)");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using hpx::lcos::local::detail::lock_statistic;
+using hpx::lcos::local::detail::query_lock_statistics;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lock_unlock()
+{
+    hpx::adaptive_mutex mtx("test_lock_unlock");
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+
+    // locking the mutex again from the owning thread is detected
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    mtx.lock(ec);
+    HPX_TEST(ec);
+
+    mtx.unlock();
+
+    // unlocking a mutex which is not owned is detected
+    ec = hpx::error_code(hpx::throwmode::lightweight);
+    mtx.unlock(ec);
+    HPX_TEST(ec);
+
+    {
+        std::lock_guard<hpx::adaptive_mutex> l(mtx);
+        HPX_TEST(!mtx.try_lock());
+    }
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_contention()
+{
+    constexpr std::size_t num_tasks = 32;
+    constexpr std::size_t num_iterations = 1024;
+
+    hpx::adaptive_mutex mtx("test_contention");
+    std::size_t counter = 0;
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&] {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<hpx::adaptive_mutex> l(mtx);
+                ++counter;
+            }
+        }));
+    }
+
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(counter, num_tasks * num_iterations);
+
+    // acquisitions are counted in batches, all of them are complete here
+    HPX_TEST_EQ(query_lock_statistics(
+                    "test_contention", lock_statistic::acquisitions, false),
+        std::int64_t(num_tasks * num_iterations));
+
+    std::int64_t const contended = query_lock_statistics(
+        "test_contention", lock_statistic::contended, true);
+    HPX_TEST_LTE(contended, std::int64_t(num_tasks * num_iterations));
+    if (contended != 0)
+    {
+        HPX_TEST_LT(std::int64_t(0),
+            query_lock_statistics(
+                "test_contention", lock_statistic::wait_time, false));
+    }
+
+    // the values were reset
+    HPX_TEST_EQ(query_lock_statistics(
+                    "test_contention", lock_statistic::contended, false),
+        std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_hold_time()
+{
+    hpx::adaptive_mutex mtx("test_hold_time");
+    HPX_TEST_EQ(mtx.hold_time(), std::uint32_t(0));
+
+    for (int i = 0; i != 64; ++i)
+    {
+        std::lock_guard<hpx::adaptive_mutex> l(mtx);
+
+        auto const start = std::chrono::steady_clock::now();
+        while (std::chrono::steady_clock::now() - start <
+            std::chrono::microseconds(10))
+        {
+        }
+    }
+
+    // every 16th hold time is sampled
+    HPX_TEST_LTE(std::uint32_t(10000), mtx.hold_time());
+    HPX_TEST_LTE(std::int64_t(10000),
+        query_lock_statistics("test_hold_time", lock_statistic::hold_time,
+            false));
+
+    // a lock held for a long time makes the waiting threads suspend
+    std::unique_lock<hpx::adaptive_mutex> l(mtx);
+    hpx::future<void> f = hpx::async([&] {
+        std::lock_guard<hpx::adaptive_mutex> l(mtx);
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    HPX_TEST(!f.is_ready());
+
+    l.unlock();
+    f.get();
+
+    HPX_TEST_EQ(query_lock_statistics(
+                    "test_hold_time", lock_statistic::contended, false),
+        std::int64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lock_sites()
+{
+    std::vector<std::string> const sites =
+        hpx::lcos::local::detail::get_lock_sites();
+
+    // sites are registered once statistics are recorded for them
+    for (char const* site : {"test_contention", "test_hold_time"})
+    {
+        HPX_TEST(std::find(sites.begin(), sites.end(), site) != sites.end());
+    }
+
+    // the totals cover all sites
+    HPX_TEST_LTE(query_lock_statistics(
+                     "test_hold_time", lock_statistic::acquisitions, false),
+        query_lock_statistics("", lock_statistic::acquisitions, false));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_lock_unlock();
+    test_contention();
+    test_hold_time();
+    test_lock_sites();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
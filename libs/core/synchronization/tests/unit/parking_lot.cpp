@@ -0,0 +1,340 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/condition_variable.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/lock_registration.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/semaphore.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace parking_lot = hpx::lcos::local::detail::parking_lot;
+
+// the primitives don't embed a wait queue anymore
+static_assert(sizeof(hpx::mutex) <= 2 * sizeof(void*));
+static_assert(sizeof(hpx::counting_semaphore<>) == sizeof(std::ptrdiff_t));
+static_assert(sizeof(hpx::condition_variable) == sizeof(std::uint32_t));
+static_assert(sizeof(hpx::condition_variable_any) == sizeof(std::uint32_t));
+
+///////////////////////////////////////////////////////////////////////////////
+// wake up exactly one thread parked on the given address, waiting for it to
+// park first
+void wake_one(void const* address)
+{
+    while (!parking_lot::unpark_one(address, [](parking_lot::unpark_result) {})
+                .unparked_thread)
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+void test_park_invalid()
+{
+    int address = 0;
+    HPX_TEST(parking_lot::park(&address, [] { return false; }) ==
+        parking_lot::park_result::invalid);
+
+    // nobody is parked
+    bool called = false;
+    parking_lot::unpark_result const result =
+        parking_lot::unpark_one(&address, [&](parking_lot::unpark_result r) {
+            HPX_TEST(!r.unparked_thread);
+            HPX_TEST(!r.may_have_more_threads);
+            called = true;
+        });
+
+    HPX_TEST(called);
+    HPX_TEST(!result.unparked_thread);
+    HPX_TEST_EQ(parking_lot::unpark_all(&address), std::size_t(0));
+}
+
+void test_park_unpark_one()
+{
+    int address = 0;
+    std::atomic<bool> woken(false);
+
+    hpx::future<void> f = hpx::async([&] {
+        HPX_TEST(parking_lot::park(&address, [] { return true; }) ==
+            parking_lot::park_result::unparked);
+        woken = true;
+    });
+
+    wake_one(&address);
+    f.get();
+    HPX_TEST(woken.load());
+}
+
+void test_park_until()
+{
+    int address = 0;
+
+    auto const start = std::chrono::steady_clock::now();
+    HPX_TEST(parking_lot::park_until(&address, [] { return true; },
+                 start + std::chrono::milliseconds(10)) ==
+        parking_lot::park_result::timed_out);
+    HPX_TEST(std::chrono::steady_clock::now() >=
+        start + std::chrono::milliseconds(10));
+
+    // the timed out thread was removed from the queue
+    HPX_TEST(!parking_lot::unpark_one(
+        &address, [](parking_lot::unpark_result) {})
+            .unparked_thread);
+}
+
+void test_unpark_all()
+{
+    constexpr std::size_t num_threads = 8;
+
+    int address = 0;
+    int other_address = 0;
+    std::atomic<std::size_t> parked(0);
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async([&] {
+            parking_lot::park(&address, [&] {
+                ++parked;
+                return true;
+            });
+        }));
+    }
+
+    // a thread parked on another address is not affected
+    hpx::future<void> other = hpx::async(
+        [&] { parking_lot::park(&other_address, [] { return true; }); });
+
+    while (parked.load() != num_threads)
+    {
+        hpx::this_thread::yield();
+    }
+
+    HPX_TEST_EQ(parking_lot::unpark_all(&address), num_threads);
+    hpx::wait_all(futures);
+
+    HPX_TEST(!other.is_ready());
+    wake_one(&other_address);
+    other.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_mutex_contention()
+{
+    constexpr std::size_t num_tasks = 32;
+    constexpr std::size_t num_iterations = 10000;
+
+    hpx::mutex mtx;
+    std::size_t counter = 0;
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&] {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<hpx::mutex> l(mtx);
+                ++counter;
+
+                // hold the lock long enough for others to park
+                if (j % 100 == 0)
+                {
+                    hpx::util::ignore_all_while_checking il;
+                    HPX_UNUSED(il);
+
+                    hpx::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(counter, num_tasks * num_iterations);
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+void test_timed_mutex()
+{
+    hpx::timed_mutex mtx;
+
+    std::unique_lock<hpx::timed_mutex> l(mtx);
+
+    // the lock is held by this thread, the attempt has to time out
+    hpx::async([&] {
+        HPX_TEST(!mtx.try_lock_for(std::chrono::milliseconds(10)));
+    }).get();
+
+    // a waiting thread acquires the lock as soon as it is released
+    hpx::future<void> f = hpx::async([&] {
+        HPX_TEST(mtx.try_lock_for(std::chrono::seconds(10)));
+        mtx.unlock();
+    });
+
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    l.unlock();
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_semaphore_contention()
+{
+    constexpr std::size_t num_tasks = 32;
+    constexpr std::size_t num_iterations = 1000;
+    constexpr std::ptrdiff_t num_credits = 2;
+
+    hpx::counting_semaphore<> sem(num_credits);
+    std::atomic<std::ptrdiff_t> inside(0);
+    std::atomic<bool> exceeded(false);
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async([&] {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                sem.acquire();
+                if (++inside > num_credits)
+                {
+                    exceeded = true;
+                }
+
+                // hold the credit long enough for others to park
+                if (j % 100 == 0)
+                {
+                    hpx::this_thread::yield();
+                }
+
+                --inside;
+                sem.release();
+            }
+        }));
+    }
+
+    hpx::wait_all(futures);
+    HPX_TEST(!exceeded.load());
+
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(sem.try_acquire());
+    HPX_TEST(!sem.try_acquire());
+}
+
+void test_semaphore_signal_all()
+{
+    constexpr std::size_t num_threads = 8;
+
+    hpx::counting_semaphore_var<> sem;
+    std::atomic<std::size_t> woken(0);
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async([&] {
+            sem.wait();
+            ++woken;
+        }));
+    }
+
+    // every woken thread receives exactly one credit
+    std::size_t count = 0;
+    while (count != num_threads)
+    {
+        count += static_cast<std::size_t>(sem.signal_all());
+        hpx::this_thread::yield();
+    }
+
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(woken.load(), num_threads);
+    HPX_TEST(!sem.try_wait());
+}
+
+void test_condition_variable_ping_pong()
+{
+    constexpr std::size_t num_iterations = 10000;
+
+    hpx::mutex mtx;
+    hpx::condition_variable cv;
+    int turn = 0;
+
+    auto player = [&](int const self) {
+        for (std::size_t i = 0; i != num_iterations; ++i)
+        {
+            std::unique_lock<hpx::mutex> l(mtx);
+            cv.wait(l, [&] { return turn == self; });
+            turn = 1 - self;
+            l.unlock();
+
+            // a lost notification would block both players
+            cv.notify_one();
+        }
+    };
+
+    hpx::future<void> f1 = hpx::async(player, 0);
+    hpx::future<void> f2 = hpx::async(player, 1);
+
+    hpx::wait_all(f1, f2);
+    HPX_TEST_EQ(turn, 0);
+}
+
+void test_condition_variable_timeout()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable_any cv;
+
+    std::unique_lock<hpx::mutex> l(mtx);
+    HPX_TEST(cv.wait_for(l, std::chrono::milliseconds(10)) ==
+        hpx::cv_status::timeout);
+
+    // a notified thread doesn't time out
+    bool ready = false;
+    hpx::future<void> f = hpx::async([&] {
+        std::lock_guard<hpx::mutex> g(mtx);
+        ready = true;
+        cv.notify_all();
+    });
+
+    HPX_TEST(
+        cv.wait_for(l, std::chrono::seconds(10), [&] { return ready; }));
+    l.unlock();
+    f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_park_invalid();
+    test_park_unpark_one();
+    test_park_until();
+    test_unpark_all();
+
+    test_mutex_contention();
+    test_timed_mutex();
+
+    test_semaphore_contention();
+    test_semaphore_signal_all();
+    test_condition_variable_ping_pong();
+    test_condition_variable_timeout();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -83,6 +83,8 @@ namespace hpx::threads::detail {
 
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
+        void create_bulk_work(thread_init_data* first, thread_init_data* last,
+            error_code& ec) override;
 
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
@@ -189,6 +191,27 @@ namespace hpx::threads::detail {
             return active_os_thread_count;
         }
 
+        std::int64_t get_num_stolen_from_shared_cache(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_at_distance(
+                policies::steal_distance::shared_cache, num, reset);
+        }
+
+        std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_at_distance(
+                policies::steal_distance::numa_domain, num, reset);
+        }
+
+        std::int64_t get_num_stolen_from_remote_numa_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_at_distance(
+                policies::steal_distance::remote, num, reset);
+        }
+
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
         std::int64_t get_num_pending_misses(
             std::size_t num, bool reset) override
@@ -10,6 +10,7 @@
 #include <hpx/affinity/affinity_data.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concurrency/barrier.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/detail/invoke.hpp>
@@ -471,6 +472,11 @@ namespace hpx::threads::detail {
                 id_.name(), global_thread_num);
         }
 
+        // pooled coroutine stacks are kept in free lists per NUMA domain
+        threads::coroutines::detail::stack_pool::get().bind_thread(
+            topo.get_numa_node_number(
+                affinity_data_.get_pu_num(global_thread_num)));
+
         // Setting priority of worker threads to a lower priority, this needs to
         // be done in order to give the parcel pool threads higher priority
         if (get_scheduler()->has_scheduler_mode(
@@ -675,6 +681,34 @@ namespace hpx::threads::detail {
         return id;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_bulk_work(
+        thread_init_data* first, thread_init_data* last, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 &&
+            !sched_->Scheduler::is_state(hpx::state::running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                "thread_pool<Scheduler>::create_bulk_work",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        // none of the work items can be directly executed by the caller
+        for (auto* it = first; it != last; ++it)
+        {
+            it->schedulehint.runs_as_child_mode(
+                hpx::threads::thread_execution_hint::none);
+        }
+
+        detail::create_bulk_work(sched_.get(), first, last, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += last - first;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
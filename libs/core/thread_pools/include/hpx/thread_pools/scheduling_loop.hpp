@@ -18,6 +18,7 @@
 #include <hpx/threading_base/detail/switch_status.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
 #if defined(HPX_HAVE_ITTNOTIFY) && HPX_HAVE_ITTNOTIFY != 0 &&                  \
@@ -208,6 +209,12 @@ namespace hpx::threads::detail {
                                     idle_rate.take_snapshot();
                                 });
 #endif
+                            bool const traced = tracing::is_enabled();
+                            if (HPX_UNLIKELY(traced))
+                            {
+                                tracing::detail::record_activation(thrdptr);
+                            }
+
                             // thread returns new required state store the
                             // returned state in the thread
                             {
@@ -269,6 +276,12 @@ namespace hpx::threads::detail {
 #endif
                             }
 
+                            if (HPX_UNLIKELY(traced))
+                            {
+                                tracing::detail::record_deactivation(
+                                    thrdptr, thrd_stat.get_previous());
+                            }
+
                             detail::write_state_log(scheduler, num_thread, thrd,
                                 thread_schedule_state::active,
                                 thrd_stat.get_previous());
@@ -15,4 +15,8 @@ namespace hpx::threads::detail {
     HPX_CORE_EXPORT thread_id_ref_type create_work(
         policies::scheduler_base* scheduler, threads::thread_init_data& data,
         error_code& ec = throws);
+
+    HPX_CORE_EXPORT void create_bulk_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data* first, threads::thread_init_data* last,
+        error_code& ec = throws);
 }    // namespace hpx::threads::detail
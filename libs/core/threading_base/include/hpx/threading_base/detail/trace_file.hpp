@@ -0,0 +1,79 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::tracing::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The trace file starts with a header followed by a sequence of records.
+    // Metadata records are distinguished by their event code.
+    inline constexpr char trace_magic[8] = {
+        'H', 'P', 'X', 'T', 'R', 'A', 'C', 'E'};
+    inline constexpr std::uint32_t trace_version = 1;
+
+    struct file_header
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t record_size;
+    };
+
+    // A string definition: thread_id holds the address used as the key of the
+    // string, timestamp holds its length. The characters follow in as many
+    // records as needed.
+    inline constexpr std::uint8_t meta_string = 0x80;
+
+    // A clock calibration point: timestamp holds the hardware time stamp,
+    // thread_id holds the corresponding steady clock time in nanoseconds.
+    inline constexpr std::uint8_t meta_calibration = 0x81;
+
+    // The number of events dropped by a worker since the last report is
+    // stored in thread_id.
+    inline constexpr std::uint8_t meta_dropped = 0x82;
+
+    // The worker number used for threads which are not HPX worker threads.
+    inline constexpr std::uint32_t no_worker = static_cast<std::uint32_t>(-1);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The contents of a trace file as needed for converting or analyzing it.
+    struct trace_file
+    {
+        // convert a time stamp to microseconds since the start of the session
+        HPX_CORE_EXPORT double to_us(std::uint64_t ticks) const noexcept;
+
+        // return the description of the thread an event refers to
+        HPX_CORE_EXPORT std::string name_of(record const& e) const;
+
+        std::unordered_map<std::uint64_t, std::string> strings;
+
+        // all events (including dropped event counts) ordered by time stamp
+        std::vector<record> events;
+
+        std::uint64_t base = 0;
+        double us_per_tick = 1e-3;
+    };
+
+    HPX_CORE_EXPORT void read_trace_file(
+        std::istream& in, trace_file& trace, error_code& ec = throws);
+
+    HPX_CORE_EXPORT std::string to_hex(std::uint64_t value);
+}    // namespace hpx::threads::tracing::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -16,6 +16,7 @@
 
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::threads {
 
@@ -157,6 +158,52 @@ namespace hpx::threads {
     ///                   of hpx#exception.
     HPX_CORE_EXPORT thread_id_ref_type register_work(
         threads::thread_init_data& data, error_code& ec = throws);
+
+    /// \brief Create new work items using the given data.
+    ///
+    /// All work items are submitted to the given thread pool at once. The
+    /// work items are distributed across the queues of the pool in
+    /// contiguous batches, each batch requiring only a single
+    /// synchronization operation on the targeted queue.
+    ///
+    /// \param data       [in] The data to use for creating the threads. All
+    ///                   entries must have 'pending' as their initial state.
+    ///                   The entries are moved from.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws the
+    ///                   function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't throw but returns
+    ///                   the result code using the parameter \a ec. Otherwise
+    ///                   it throws an instance of hpx#exception.
+    HPX_CORE_EXPORT void register_bulk_work(
+        std::vector<threads::thread_init_data>& data,
+        threads::thread_pool_base* pool, error_code& ec = hpx::throws);
+
+    /// \brief Create new work items using the given data on the same thread
+    ///        pool as the calling thread, or on the default thread pool if
+    ///        not on an HPX thread.
+    ///
+    /// \param data       [in] The data to use for creating the threads. All
+    ///                   entries must have 'pending' as their initial state.
+    ///                   The entries are moved from.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    HPX_CORE_EXPORT void register_bulk_work(
+        std::vector<threads::thread_init_data>& data, error_code& ec = throws);
 }    // namespace hpx::threads
 
 /// \endcond
@@ -52,6 +52,21 @@ namespace hpx::threads::policies {
         };
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// The topological distance between a worker thread and the worker
+    /// thread it has stolen work from
+    enum class steal_distance : std::uint8_t
+    {
+        /// both workers share a cache (see hpx.scheduler.steal_cache_level)
+        shared_cache = 0,
+
+        /// both workers run in the same NUMA domain
+        numa_domain = 1,
+
+        /// the workers run in different NUMA domains
+        remote = 2
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     /// The scheduler_base defines the interface to be implemented by all
     /// scheduler policies
@@ -184,6 +199,15 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
 #endif
 
+        // number of tasks stolen by the given worker thread from workers at
+        // the given topological distance
+        virtual std::int64_t get_num_stolen_at_distance(
+            steal_distance /* distance */, std::size_t /* num_thread */,
+            bool /* reset */)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = static_cast<std::size_t>(-1)) const = 0;
 
@@ -216,6 +240,13 @@ namespace hpx::threads::policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create new threads for all of the given (pending) work items. The
+        // default implementation creates the threads one by one, schedulers
+        // may override this to distribute the work items in contiguous
+        // batches across their queues.
+        virtual void create_threads(
+            thread_init_data* first, thread_init_data* last, error_code& ec);
+
         virtual void schedule_thread(threads::thread_id_ref_type thrd,
             threads::thread_schedule_hint schedulehint,
             bool allow_fallback = false,
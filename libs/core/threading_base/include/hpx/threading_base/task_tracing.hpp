@@ -0,0 +1,183 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_tracing.hpp
+/// \page hpx::threads::tracing
+/// \headerfile hpx/threading_base/task_tracing.hpp
+///
+/// Low-overhead recording of the life cycle of HPX threads (create, start,
+/// suspend, resume, end). Events are written into per-worker lock-free ring
+/// buffers and flushed asynchronously to a binary trace file, which can be
+/// converted into the Chrome/Perfetto trace event JSON format offline.
+///
+/// Optionally, the dependencies between threads are recorded as well: which
+/// thread spawned a new thread and which thread made a future ready that
+/// another thread was waiting for. Those are used to compute the critical
+/// path, the parallelism profile, and the slack of each task offline.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::tracing {
+
+    /// The kinds of events recorded for each HPX thread.
+    enum class event : std::uint8_t
+    {
+        create = 0,     ///< the thread was created
+        start = 1,      ///< the thread was run for the first time
+        suspend = 2,    ///< the thread gave up its worker
+        resume = 3,     ///< the thread continued running
+        end = 4,        ///< the thread has run to completion
+
+        // dependency events, recorded only if enabled
+        spawn = 5,    ///< a thread was spawned (thread_id is a unique token)
+        bind = 6,     ///< the spawned thread has been given its id
+        ready = 7,    ///< a shared state (annotation) was made ready
+        wait = 8      ///< a thread has waited for a shared state (annotation)
+    };
+
+    /// A single entry in the binary trace. Event codes starting at 0x80 are
+    /// used for metadata records (string definitions, clock calibration,
+    /// dropped event counts).
+    struct record
+    {
+        std::uint64_t timestamp;     ///< hardware time stamp (ticks)
+        std::uint64_t thread_id;     ///< address of the thread's data
+        std::uint64_t annotation;    ///< description string or address
+        std::uint32_t worker;        ///< global worker thread number
+        std::uint8_t event;
+        std::uint8_t annotation_kind;    ///< thread_description::data_type
+        std::uint16_t reserved;
+    };
+
+    static_assert(sizeof(record) == 32, "trace records must be 32 bytes");
+
+    /// Configuration of a tracing session.
+    struct parameters
+    {
+        /// The file the binary trace is written to.
+        std::string destination = "hpx_trace.bin";
+
+        /// The number of events each worker thread can buffer before events
+        /// get dropped, rounded up to the next power of two.
+        std::size_t buffer_size = 65536;
+
+        /// The interval at which buffered events are written to the file.
+        std::chrono::milliseconds flush_interval{100};
+
+        /// Record the dependencies between threads in addition to their
+        /// execution intervals.
+        bool dependencies = false;
+    };
+
+    /// Configuration of the analysis of a trace.
+    struct analysis_parameters
+    {
+        /// The number of time intervals the parallelism profile is divided
+        /// into.
+        std::size_t profile_bins = 20;
+
+        /// The number of annotations listed in each table of the report.
+        std::size_t max_annotations = 20;
+    };
+
+    /// Start recording thread events to the given destination. Throws (or
+    /// reports through \a ec) if a tracing session is already active or if
+    /// the destination can't be opened.
+    HPX_CORE_EXPORT void enable(
+        parameters const& params, error_code& ec = throws);
+
+    /// Stop recording events, write all buffered events and close the trace
+    /// file. The memory used for buffering the events is released. Does
+    /// nothing if no tracing session is active.
+    HPX_CORE_EXPORT void disable();
+
+    /// Return the number of events written to the trace file by the current
+    /// (or last) tracing session.
+    HPX_CORE_EXPORT std::uint64_t get_written_events() noexcept;
+
+    /// Return the number of events which were dropped by the current (or
+    /// last) tracing session because a ring buffer was full.
+    HPX_CORE_EXPORT std::uint64_t get_dropped_events() noexcept;
+
+    /// Read a binary trace as written by a tracing session from \a in and
+    /// write it to \a out using the Chrome trace event JSON format, which is
+    /// understood by chrome://tracing and Perfetto.
+    HPX_CORE_EXPORT void convert_to_chrome_trace(
+        std::istream& in, std::ostream& out, error_code& ec = throws);
+
+    /// Read a binary trace recorded with dependencies enabled from \a in and
+    /// write a report to \a out which lists the critical path through the
+    /// recorded threads, the number of threads running in parallel over time,
+    /// and the slack (the amount of time a thread could have been delayed
+    /// without delaying the end of the trace) for each annotation.
+    HPX_CORE_EXPORT void analyze_trace(std::istream& in, std::ostream& out,
+        analysis_parameters const& params = analysis_parameters(),
+        error_code& ec = throws);
+
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> enabled;
+        HPX_CORE_EXPORT extern std::atomic<bool> dependencies_enabled;
+
+        HPX_CORE_EXPORT void record_event(event e, std::uint64_t thread_id,
+            thread_description const& desc) noexcept;
+
+        // record the start or resumption of the given thread
+        HPX_CORE_EXPORT void record_activation(
+            thread_data const* thrd) noexcept;
+
+        // record the suspension or termination of the given thread based on
+        // the state it returned
+        HPX_CORE_EXPORT void record_deactivation(
+            thread_data const* thrd, thread_schedule_state state) noexcept;
+
+        // record the creation of a new thread by the calling thread, the
+        // generated token is stored in the new thread's init data
+        HPX_CORE_EXPORT void record_spawn(thread_init_data& data) noexcept;
+
+        // record the id of a thread created from the given init data
+        HPX_CORE_EXPORT void record_bind(
+            thread_data const* thrd, thread_init_data const& data) noexcept;
+
+        // record that the calling thread has made a shared state ready
+        HPX_CORE_EXPORT void record_ready(void const* state) noexcept;
+
+        // record that the calling thread was suspended waiting for a shared
+        // state to become ready
+        HPX_CORE_EXPORT void record_wait(void const* state) noexcept;
+    }    // namespace detail
+
+    /// Return whether a tracing session is active.
+    [[nodiscard]] inline bool is_enabled() noexcept
+    {
+        return detail::enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Return whether the active tracing session records the dependencies
+    /// between threads.
+    [[nodiscard]] inline bool is_recording_dependencies() noexcept
+    {
+        return detail::dependencies_enabled.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::threads::tracing
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -46,6 +46,7 @@ namespace hpx::threads {
           , stacksize(thread_stacksize::default_)
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
+          , trace_token(0)
           , scheduler_base(nullptr)
         {
             if (initial_state == thread_schedule_state::staged)
@@ -65,6 +66,7 @@ namespace hpx::threads {
             stacksize = rhs.stacksize;
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
+            trace_token = rhs.trace_token;
             scheduler_base = rhs.scheduler_base;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
@@ -104,6 +106,7 @@ namespace hpx::threads {
           , stacksize(rhs.stacksize)
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
+          , trace_token(rhs.trace_token)
           , scheduler_base(rhs.scheduler_base)
         {
         }
@@ -138,6 +141,7 @@ namespace hpx::threads {
           , stacksize(stacksize_)
           , initial_state(initial_state_)
           , run_now(run_now_)
+          , trace_token(0)
           , scheduler_base(scheduler_base_)
         {
             if (initial_state == thread_schedule_state::staged)
@@ -170,6 +174,9 @@ namespace hpx::threads {
         thread_schedule_state initial_state;
         bool run_now;
 
+        // links the thread to its creator if dependencies are traced
+        std::uint64_t trace_token;
+
         policies::scheduler_base* scheduler_base;
     };
 }    // namespace hpx::threads
@@ -199,6 +199,11 @@ namespace hpx::threads {
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
 
+        // create new work items for all of the given task descriptions, the
+        // default implementation creates the work items one by one
+        virtual void create_bulk_work(
+            thread_init_data* first, thread_init_data* last, error_code& ec);
+
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) = 0;
@@ -365,6 +370,22 @@ namespace hpx::threads {
         }
 #endif
 
+        virtual std::int64_t get_num_stolen_from_shared_cache(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_stolen_from_remote_numa_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
 #if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
         virtual std::int64_t get_num_pending_misses(
             std::size_t /*thread_num*/, bool /*reset*/)
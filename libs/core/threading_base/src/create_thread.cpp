@@ -10,9 +10,12 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
+#include <cstdint>
+
 namespace hpx::threads::detail {
 
     void create_thread(policies::scheduler_base* scheduler,
@@ -83,9 +86,25 @@ namespace hpx::threads::detail {
         if (data.priority == thread_priority::default_)
             data.priority = thread_priority::normal;
 
+        if (HPX_UNLIKELY(tracing::is_recording_dependencies()))
+            tracing::detail::record_spawn(data);
+
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
+        // staged threads (run_now == false) don't have an id yet, they are
+        // recorded with a thread id of zero
+        if (HPX_UNLIKELY(tracing::is_enabled()))
+        {
+            tracing::detail::record_event(tracing::event::create,
+                reinterpret_cast<std::uint64_t>(get_thread_id_data(id)),
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+                data.description);
+#else
+                threads::thread_description());
+#endif
+        }
+
         LTM_(info)
             .format("create_thread: pool({}), scheduler({}), thread({}), "
                     "initial_state({}), run_now({})",
@@ -11,97 +11,129 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_work.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
 namespace hpx::threads::detail {
 
-    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
-        threads::thread_init_data& data, error_code& ec)
-    {
-        // verify parameters
-        switch (data.initial_state)
-        {
-        // NOLINTNEXTLINE(bugprone-branch-clone)
-        case thread_schedule_state::pending:
-            [[fallthrough]];
-        case thread_schedule_state::pending_do_not_schedule:
-            [[fallthrough]];
-        case thread_schedule_state::pending_boost:
-            [[fallthrough]];
-        case thread_schedule_state::suspended:
-            break;
-
-        default:
+    namespace {
+
+        // verify the parameters of a new work item and fill in the missing
+        // ones, returns false if the work item is invalid
+        bool prepare_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data& data, thread_self const* self,
+            char const* function_name, error_code& ec)
         {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "invalid initial state: {}",
-                data.initial_state);
-            return invalid_thread_id;
-        }
-        }
+            // verify parameters
+            switch (data.initial_state)
+            {
+            // NOLINTNEXTLINE(bugprone-branch-clone)
+            case thread_schedule_state::pending:
+                [[fallthrough]];
+            case thread_schedule_state::pending_do_not_schedule:
+                [[fallthrough]];
+            case thread_schedule_state::pending_boost:
+                [[fallthrough]];
+            case thread_schedule_state::suspended:
+                break;
+
+            default:
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, function_name,
+                    "invalid initial state: {}", data.initial_state);
+                return false;
+            }
+            }
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-        if (!data.description)
-        {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "description is nullptr");
-            return invalid_thread_id;
-        }
+            if (!data.description)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, function_name,
+                    "description is nullptr");
+                return false;
+            }
 #endif
 
-        LTM_(info)
-            .format("create_work: pool({}), scheduler({}), initial_state({}), "
-                    "thread_priority({})",
-                *scheduler->get_parent_pool(), *scheduler,
-                get_thread_state_name(data.initial_state),
-                get_thread_priority_name(data.priority))
+            LTM_(info)
+                .format("create_work: pool({}), scheduler({}), "
+                        "initial_state({}), thread_priority({})",
+                    *scheduler->get_parent_pool(), *scheduler,
+                    get_thread_state_name(data.initial_state),
+                    get_thread_priority_name(data.priority))
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            .format(", description({})", data.description)
+                .format(", description({})", data.description)
 #endif
-            ;
-
-        thread_self const* self = get_self_ptr();
+                ;
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id)
-        {
-            if (self)
+            if (nullptr == data.parent_id)
             {
-                data.parent_id = get_thread_id_data(self->get_thread_id());
-                data.parent_phase = self->get_thread_phase();
+                if (self)
+                {
+                    data.parent_id = get_thread_id_data(self->get_thread_id());
+                    data.parent_phase = self->get_thread_phase();
+                }
             }
-        }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = detail::get_locality_id(hpx::throws);
+            if (0 == data.parent_locality_id)
+                data.parent_locality_id = detail::get_locality_id(hpx::throws);
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+            if (nullptr == data.scheduler_base)
+                data.scheduler_base = scheduler;
 
-        // Pass critical priority from parent to child.
-        if (self)
-        {
-            if (data.priority == thread_priority::default_ &&
-                thread_priority::high_recursive ==
-                    get_thread_id_data(self->get_thread_id())->get_priority())
+            // Pass critical priority from parent to child.
+            if (self)
+            {
+                if (data.priority == thread_priority::default_ &&
+                    thread_priority::high_recursive ==
+                        get_thread_id_data(self->get_thread_id())
+                            ->get_priority())
+                {
+                    data.priority = thread_priority::high_recursive;
+                }
+            }
+
+            // create the new thread
+            if (data.priority == thread_priority::default_)
             {
-                data.priority = thread_priority::high_recursive;
+                data.priority = thread_priority::normal;
             }
+
+            HPX_ASSERT(!data.run_now);
+            data.run_now = (thread_priority::high == data.priority ||
+                thread_priority::high_recursive == data.priority ||
+                thread_priority::bound == data.priority ||
+                thread_priority::boost == data.priority);
+
+            // the new thread doesn't have an id yet, it is recorded with a
+            // thread id of zero
+            if (HPX_UNLIKELY(tracing::is_enabled()))
+            {
+                if (tracing::is_recording_dependencies())
+                    tracing::detail::record_spawn(data);
+
+                tracing::detail::record_event(tracing::event::create, 0,
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+                    data.description);
+#else
+                    threads::thread_description());
+#endif
+            }
+
+            return true;
         }
+    }    // namespace
 
-        // create the new thread
-        if (data.priority == thread_priority::default_)
+    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data& data, error_code& ec)
+    {
+        if (!prepare_work(scheduler, data, get_self_ptr(),
+                "thread::detail::create_work", ec))
         {
-            data.priority = thread_priority::normal;
+            return invalid_thread_id;
         }
 
-        HPX_ASSERT(!data.run_now);
-        data.run_now = (thread_priority::high == data.priority ||
-            thread_priority::high_recursive == data.priority ||
-            thread_priority::bound == data.priority ||
-            thread_priority::boost == data.priority);
-
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
 
@@ -111,4 +143,43 @@ namespace hpx::threads::detail {
 
         return id;
     }
+
+    void create_bulk_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data* first, threads::thread_init_data* last,
+        error_code& ec)
+    {
+        if (first == last)
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+
+        thread_self const* self = get_self_ptr();
+        for (auto* it = first; it != last; ++it)
+        {
+            // no thread ids are returned, thus all new threads have to be
+            // scheduled right away
+            if (it->initial_state != thread_schedule_state::pending)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "thread::detail::create_bulk_work",
+                    "bulk work items must have 'pending' as their initial "
+                    "state: {}",
+                    it->initial_state);
+                return;
+            }
+
+            if (!prepare_work(scheduler, *it, self,
+                    "thread::detail::create_bulk_work", ec))
+            {
+                return;
+            }
+        }
+
+        scheduler->create_threads(first, last, ec);
+
+        // the new threads are spread over all queues, wake up all threads
+        scheduler->do_some_work(static_cast<std::size_t>(-1));
+    }
 }    // namespace hpx::threads::detail
@@ -15,6 +15,8 @@
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
+#include <vector>
+
 namespace hpx::threads {
 
     ///////////////////////////////////////////////////////////////////////////
@@ -102,4 +104,25 @@ namespace hpx::threads {
         data.run_now = false;
         return pool->create_work(data, ec);
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_bulk_work(std::vector<threads::thread_init_data>& data,
+        threads::thread_pool_base* pool, error_code& ec)
+    {
+        HPX_ASSERT(pool);
+        for (auto& d : data)
+        {
+            d.run_now = false;
+        }
+        pool->create_bulk_work(data.data(), data.data() + data.size(), ec);
+    }
+
+    void register_bulk_work(
+        std::vector<threads::thread_init_data>& data, error_code& ec)
+    {
+        auto* pool = detail::get_self_or_default_pool();
+        HPX_ASSERT(pool);
+
+        register_bulk_work(data, pool, ec);
+    }
 }    // namespace hpx::threads
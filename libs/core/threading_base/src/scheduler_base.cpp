@@ -105,6 +105,17 @@ namespace hpx::threads::policies {
 #endif
     }
 
+    void scheduler_base::create_threads(
+        thread_init_data* first, thread_init_data* last, error_code& ec)
+    {
+        for (/**/; first != last; ++first)
+        {
+            create_thread(*first, nullptr, ec);
+            if (ec)
+                return;
+        }
+    }
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
@@ -0,0 +1,568 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/trace_file.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    namespace {
+
+        constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        ///////////////////////////////////////////////////////////////////////
+        // A single run of a thread on a worker (from its start or resumption
+        // to its suspension or termination) together with the event which
+        // allowed it to run.
+        struct activation
+        {
+            std::size_t instance;
+            double start;
+            double end;
+            std::uint32_t worker;
+
+            // the previous activation of the same thread
+            std::size_t previous = npos;
+
+            // the activation which has made ready the shared state this
+            // activation has been waiting for
+            std::size_t waker = npos;
+            double wake_time = 0.0;
+
+            // the activation which has spawned the thread (first activation
+            // of a thread only)
+            std::size_t spawner = npos;
+            double spawn_time = 0.0;
+        };
+
+        // The activations of all threads in the order of their start, each
+        // activation is started after all activations it depends on.
+        struct task_graph
+        {
+            std::vector<std::string> names;    // the name of each thread
+            std::vector<activation> activations;
+
+            std::size_t spawn_edges = 0;
+            std::size_t wake_edges = 0;
+            std::uint64_t dropped = 0;
+            std::unordered_set<std::uint32_t> workers;
+        };
+
+        struct dependency_source
+        {
+            std::size_t activation;
+            double time;
+        };
+
+        task_graph build_task_graph(detail::trace_file const& trace)
+        {
+            task_graph graph;
+
+            // the thread currently using a given id, its last activation,
+            // and whether that activation is still running
+            struct thread_state
+            {
+                std::size_t instance;
+                std::size_t last;
+                bool running;
+            };
+            std::unordered_map<std::uint64_t, thread_state> threads;
+
+            std::unordered_map<std::uint64_t, dependency_source> spawns;
+            std::unordered_map<std::uint64_t, std::uint64_t> binds;
+            std::unordered_map<std::uint64_t, dependency_source> ready;
+
+            // return the activation the given thread is currently running
+            auto const running = [&](std::uint64_t thread_id) {
+                auto const it = threads.find(thread_id);
+                return it != threads.end() && it->second.running ?
+                    it->second.last :
+                    npos;
+            };
+
+            double last_time = 0.0;
+            for (record const& e : trace.events)
+            {
+                double const ts = trace.to_us(e.timestamp);
+                last_time = ts;
+
+                switch (e.event)
+                {
+                case detail::meta_dropped:
+                    graph.dropped += e.thread_id;
+                    break;
+
+                case static_cast<std::uint8_t>(event::start):
+                    [[fallthrough]];
+                case static_cast<std::uint8_t>(event::resume):
+                {
+                    // tell starts and resumptions apart in the same way as
+                    // the conversion to the Chrome format does
+                    auto const it = threads.find(e.thread_id);
+                    bool const resumed =
+                        it != threads.end() && !it->second.running;
+
+                    activation a{};
+                    a.start = ts;
+                    a.end = ts;
+                    a.worker = e.worker;
+
+                    std::size_t const index = graph.activations.size();
+                    if (resumed)
+                    {
+                        a.instance = it->second.instance;
+                        a.previous = it->second.last;
+                    }
+                    else
+                    {
+                        a.instance = graph.names.size();
+                        graph.names.push_back(trace.name_of(e));
+
+                        // connect a newly started thread with its creator
+                        if (auto const bind = binds.find(e.thread_id);
+                            bind != binds.end())
+                        {
+                            if (auto const spawn = spawns.find(bind->second);
+                                spawn != spawns.end())
+                            {
+                                if (spawn->second.activation < index)
+                                {
+                                    a.spawner = spawn->second.activation;
+                                    a.spawn_time = spawn->second.time;
+                                    ++graph.spawn_edges;
+                                }
+                                spawns.erase(spawn);
+                            }
+                            binds.erase(bind);
+                        }
+                    }
+
+                    graph.activations.push_back(a);
+                    graph.workers.insert(e.worker);
+                    threads[e.thread_id] =
+                        thread_state{a.instance, index, true};
+                    break;
+                }
+
+                case static_cast<std::uint8_t>(event::suspend):
+                    [[fallthrough]];
+                case static_cast<std::uint8_t>(event::end):
+                {
+                    // skip threads which were already running when the
+                    // session was started
+                    auto const it = threads.find(e.thread_id);
+                    if (it == threads.end() || !it->second.running)
+                        break;
+
+                    graph.activations[it->second.last].end = ts;
+                    if (e.event == static_cast<std::uint8_t>(event::end))
+                        threads.erase(it);
+                    else
+                        it->second.running = false;
+                    break;
+                }
+
+                case static_cast<std::uint8_t>(event::spawn):
+                    spawns[e.thread_id] =
+                        dependency_source{running(e.annotation), ts};
+                    break;
+
+                case static_cast<std::uint8_t>(event::bind):
+                    binds[e.thread_id] = e.annotation;
+                    break;
+
+                case static_cast<std::uint8_t>(event::ready):
+                    ready[e.annotation] =
+                        dependency_source{running(e.thread_id), ts};
+                    break;
+
+                case static_cast<std::uint8_t>(event::wait):
+                {
+                    // only the first wait after a resumption is the reason
+                    // for the resumption
+                    std::size_t const waiter = running(e.thread_id);
+                    auto const it = ready.find(e.annotation);
+                    if (waiter == npos || it == ready.end())
+                        break;
+
+                    activation& a = graph.activations[waiter];
+                    if (a.previous != npos && a.waker == npos &&
+                        it->second.activation < waiter)
+                    {
+                        a.waker = it->second.activation;
+                        a.wake_time = it->second.time;
+                        ++graph.wake_edges;
+                    }
+                    break;
+                }
+
+                default:
+                    break;
+                }
+            }
+
+            // activations still running at the end of the trace are assumed
+            // to end with it
+            for (auto const& thread : threads)
+            {
+                if (thread.second.running)
+                    graph.activations[thread.second.last].end = last_time;
+            }
+
+            return graph;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        double non_negative(double value) noexcept
+        {
+            return (std::max)(value, 0.0);
+        }
+
+        double to_ms(double us) noexcept
+        {
+            return us * 1e-3;
+        }
+
+        double percent(double part, double total) noexcept
+        {
+            return total > 0.0 ? 100.0 * part / total : 0.0;
+        }
+
+        void report_critical_path(std::ostream& out, task_graph const& graph,
+            std::size_t last, double span,
+            analysis_parameters const& params)
+        {
+            double execution = 0.0;
+            double scheduling = 0.0;
+            double wake_up = 0.0;
+            double suspended = 0.0;
+            std::size_t length = 0;
+            std::map<std::string, double> by_name;
+
+            // walk backwards from the activation which has ended last, always
+            // following the dependency which was satisfied last; the indices
+            // of the activations decrease along the way
+            std::size_t current = last;
+            double until = graph.activations[last].end;
+            double begin = graph.activations[last].start;
+            while (current != npos)
+            {
+                activation const& a = graph.activations[current];
+                double const exec = non_negative(until - a.start);
+
+                execution += exec;
+                by_name[graph.names[a.instance]] += exec;
+                begin = a.start;
+                ++length;
+
+                std::size_t next = npos;
+                double next_until = 0.0;
+                if (a.waker != npos)
+                {
+                    next = a.waker;
+                    next_until = a.wake_time;
+                }
+                if (a.previous != npos &&
+                    (next == npos ||
+                        graph.activations[a.previous].end > next_until))
+                {
+                    next = a.previous;
+                    next_until = graph.activations[a.previous].end;
+                }
+                if (next == npos && a.spawner != npos)
+                {
+                    next = a.spawner;
+                    next_until = a.spawn_time;
+                }
+
+                if (next == npos)
+                    break;
+
+                double const gap = non_negative(a.start - next_until);
+                if (next == a.waker)
+                    wake_up += gap;
+                else if (next == a.previous)
+                    suspended += gap;
+                else
+                    scheduling += gap;
+
+                current = next;
+                until = next_until;
+            }
+
+            double const total = graph.activations[last].end - begin;
+
+            out << "critical path: " << to_ms(total) << " ms ("
+                << std::setprecision(1) << percent(total, span)
+                << std::setprecision(3) << "% of span), " << length
+                << " activations\n";
+            out << "  execution:        " << std::setw(12) << to_ms(execution)
+                << " ms\n";
+            out << "  scheduling delay: " << std::setw(12) << to_ms(scheduling)
+                << " ms\n";
+            out << "  wake-up delay:    " << std::setw(12) << to_ms(wake_up)
+                << " ms\n";
+            out << "  suspended:        " << std::setw(12) << to_ms(suspended)
+                << " ms\n\n";
+
+            std::vector<std::pair<std::string, double>> sorted(
+                by_name.begin(), by_name.end());
+            std::stable_sort(sorted.begin(), sorted.end(),
+                [](auto const& lhs, auto const& rhs) {
+                    return lhs.second > rhs.second;
+                });
+            if (sorted.size() > params.max_annotations)
+                sorted.resize(params.max_annotations);
+
+            out << "  execution on the critical path by annotation:\n";
+            out << "  " << std::setw(12) << "ms" << std::setw(8) << "%"
+                << "  annotation\n";
+            for (auto const& entry : sorted)
+            {
+                out << "  " << std::setw(12) << to_ms(entry.second)
+                    << std::setw(8) << std::setprecision(1)
+                    << percent(entry.second, total) << std::setprecision(3)
+                    << "  " << entry.first << '\n';
+            }
+            out << '\n';
+        }
+
+        void report_parallelism(std::ostream& out, task_graph const& graph,
+            double begin, double end, analysis_parameters const& params)
+        {
+            std::size_t const bins = (std::max)(params.profile_bins,
+                static_cast<std::size_t>(1));
+            double const width = (end - begin) / static_cast<double>(bins);
+
+            std::vector<double> busy(bins, 0.0);
+            if (width > 0.0)
+            {
+                for (activation const& a : graph.activations)
+                {
+                    auto const first = static_cast<std::size_t>(
+                        non_negative(a.start - begin) / width);
+                    for (std::size_t i = first; i < bins; ++i)
+                    {
+                        double const lo =
+                            begin + static_cast<double>(i) * width;
+                        double const hi = lo + width;
+                        if (a.end <= lo)
+                            break;
+
+                        busy[i] += non_negative(
+                            (std::min)(a.end, hi) - (std::max)(a.start, lo));
+                    }
+                }
+            }
+
+            double peak = 0.0;
+            for (double& value : busy)
+            {
+                value = width > 0.0 ? value / width : 0.0;
+                peak = (std::max)(peak, value);
+            }
+
+            out << "parallelism profile (average number of running "
+                   "threads):\n";
+            out << "  " << std::setw(12) << "from ms" << std::setw(12)
+                << "to ms" << std::setw(8) << "threads" << '\n';
+            for (std::size_t i = 0; i != bins; ++i)
+            {
+                double const lo = begin + static_cast<double>(i) * width;
+                auto const bar = peak > 0.0 ?
+                    static_cast<std::size_t>(40.0 * busy[i] / peak + 0.5) :
+                    0;
+
+                out << "  " << std::setw(12) << to_ms(lo - begin)
+                    << std::setw(12) << to_ms(lo + width - begin)
+                    << std::setw(8) << std::setprecision(2) << busy[i]
+                    << std::setprecision(3) << "  " << std::string(bar, '#')
+                    << '\n';
+            }
+            out << '\n';
+        }
+
+        void report_slack(std::ostream& out, task_graph const& graph,
+            double end, analysis_parameters const& params)
+        {
+            // the slack of an activation is the amount of time it could have
+            // been delayed without delaying the end of the trace, successors
+            // always have a larger index than their predecessors
+            std::size_t const count = graph.activations.size();
+            std::vector<double> slack(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                slack[i] = non_negative(end - graph.activations[i].end);
+            }
+
+            auto const propagate = [&](std::size_t from, double time,
+                                       std::size_t to) {
+                slack[from] = (std::min)(slack[from],
+                    slack[to] +
+                        non_negative(graph.activations[to].start - time));
+            };
+
+            for (std::size_t i = count; i-- != 0;)
+            {
+                activation const& a = graph.activations[i];
+                if (a.previous != npos)
+                    propagate(a.previous, graph.activations[a.previous].end, i);
+                if (a.waker != npos)
+                    propagate(a.waker, a.wake_time, i);
+                if (a.spawner != npos)
+                    propagate(a.spawner, a.spawn_time, i);
+            }
+
+            struct annotation_slack
+            {
+                std::string const* name;
+                std::size_t activations = 0;
+                double execution = 0.0;
+                double min_slack = (std::numeric_limits<double>::max)();
+                double total_slack = 0.0;
+            };
+
+            std::map<std::string, annotation_slack> by_name;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                activation const& a = graph.activations[i];
+                auto& entry = by_name[graph.names[a.instance]];
+                ++entry.activations;
+                entry.execution += a.end - a.start;
+                entry.min_slack = (std::min)(entry.min_slack, slack[i]);
+                entry.total_slack += slack[i];
+            }
+
+            std::vector<annotation_slack> sorted;
+            sorted.reserve(by_name.size());
+            for (auto& entry : by_name)
+            {
+                entry.second.name = &entry.first;
+                sorted.push_back(entry.second);
+            }
+            std::stable_sort(sorted.begin(), sorted.end(),
+                [](annotation_slack const& lhs, annotation_slack const& rhs) {
+                    return lhs.min_slack < rhs.min_slack ||
+                        (lhs.min_slack == rhs.min_slack &&
+                            lhs.execution > rhs.execution);
+                });
+            if (sorted.size() > params.max_annotations)
+                sorted.resize(params.max_annotations);
+
+            out << "slack by annotation:\n";
+            out << "  " << std::setw(12) << "activations" << std::setw(12)
+                << "exec ms" << std::setw(12) << "min ms" << std::setw(12)
+                << "mean ms"
+                << "  annotation\n";
+            for (annotation_slack const& entry : sorted)
+            {
+                out << "  " << std::setw(12) << entry.activations
+                    << std::setw(12) << to_ms(entry.execution) << std::setw(12)
+                    << to_ms(entry.min_slack) << std::setw(12)
+                    << to_ms(entry.total_slack /
+                           static_cast<double>(entry.activations))
+                    << "  " << *entry.name << '\n';
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void analyze_trace(std::istream& in, std::ostream& out,
+        analysis_parameters const& params, error_code& ec)
+    {
+        detail::trace_file trace;
+        detail::read_trace_file(in, trace, ec);
+        if (ec)
+            return;
+
+        task_graph const graph = build_task_graph(trace);
+
+        auto const flags = out.flags();
+        auto const precision = out.precision();
+        out.setf(std::ios::fixed, std::ios::floatfield);
+        out.precision(3);
+
+        if (graph.dropped != 0)
+        {
+            out << "warning: " << graph.dropped
+                << " events were dropped, the results may be incomplete\n\n";
+        }
+
+        if (graph.activations.empty())
+        {
+            out << "no thread activations found in the trace\n";
+        }
+        else
+        {
+            double begin = graph.activations.front().start;
+            double end = graph.activations.front().end;
+            std::size_t last = 0;
+            double busy = 0.0;
+            for (std::size_t i = 0; i != graph.activations.size(); ++i)
+            {
+                activation const& a = graph.activations[i];
+                begin = (std::min)(begin, a.start);
+                if (a.end > end)
+                {
+                    end = a.end;
+                    last = i;
+                }
+                busy += a.end - a.start;
+            }
+            double const span = end - begin;
+
+            out << "threads: " << graph.names.size()
+                << ", activations: " << graph.activations.size()
+                << ", workers: " << graph.workers.size() << '\n';
+            out << "dependencies: " << graph.spawn_edges << " spawned, "
+                << graph.wake_edges << " woken up\n";
+            out << "span: " << to_ms(span) << " ms, busy: " << to_ms(busy)
+                << " ms, average parallelism: " << std::setprecision(2)
+                << (span > 0.0 ? busy / span : 0.0) << std::setprecision(3)
+                << "\n\n";
+
+            if (graph.spawn_edges == 0 && graph.wake_edges == 0)
+            {
+                out << "note: the trace contains no dependencies, set "
+                       "hpx.trace.dependencies=1 to record them\n\n";
+            }
+
+            report_critical_path(out, graph, last, span, params);
+            report_parallelism(out, graph, begin, end, params);
+            report_slack(out, graph, end, params);
+        }
+
+        out.flags(flags);
+        out.precision(precision);
+
+        if (!out)
+        {
+            HPX_THROWS_IF(ec, hpx::error::filesystem_error,
+                "hpx::threads::tracing::analyze_trace",
+                "could not write the analysis of the trace");
+            return;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+}    // namespace hpx::threads::tracing
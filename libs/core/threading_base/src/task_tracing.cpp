@@ -0,0 +1,1022 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/hardware/timestamp.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/trace_file.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace hpx::threads::tracing {
+
+    namespace detail {
+
+        std::atomic<bool> enabled(false);
+        std::atomic<bool> dependencies_enabled(false);
+    }    // namespace detail
+
+    namespace {
+
+        using detail::file_header;
+        using detail::meta_calibration;
+        using detail::meta_dropped;
+        using detail::meta_string;
+        using detail::no_worker;
+        using detail::trace_magic;
+        using detail::trace_version;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Single producer (the owning OS thread), single consumer (the
+        // flusher) ring buffer of trace records. The records are allocated
+        // when the owning thread records its first event of a tracing session
+        // and are released when the session ends.
+        struct ring_buffer
+        {
+            explicit ring_buffer(std::uint32_t worker) noexcept
+              : worker(worker)
+            {
+            }
+
+            void allocate(std::size_t capacity)
+            {
+                HPX_ASSERT(capacity != 0 && (capacity & (capacity - 1)) == 0);
+                records.reset(new record[capacity]);
+                mask = capacity - 1;
+            }
+
+            void release() noexcept
+            {
+                records.reset();
+                mask = 0;
+
+                head.data_.store(0, std::memory_order_relaxed);
+                cached_tail = 0;
+                dropped.store(0, std::memory_order_relaxed);
+                tail.data_.store(0, std::memory_order_relaxed);
+                reported_dropped = 0;
+            }
+
+            void push(record const& r) noexcept
+            {
+                std::uint64_t const h = head.data_.load(
+                    std::memory_order_relaxed);
+                if (h - cached_tail > mask)
+                {
+                    cached_tail = tail.data_.load(std::memory_order_acquire);
+                    if (h - cached_tail > mask)
+                    {
+                        dropped.store(
+                            dropped.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+                        return;
+                    }
+                }
+
+                records[h & mask] = r;
+                head.data_.store(h + 1, std::memory_order_release);
+            }
+
+            std::unique_ptr<record[]> records;
+            std::uint64_t mask = 0;
+            std::uint32_t const worker;
+
+            // producer side
+            util::cache_aligned_data<std::atomic<std::uint64_t>> head;
+            std::uint64_t cached_tail = 0;
+            std::atomic<std::uint64_t> dropped{0};
+
+            // set while the owning thread is recording an event
+            std::atomic<bool> busy{false};
+
+            // consumer side
+            util::cache_aligned_data<std::atomic<std::uint64_t>> tail;
+            std::uint64_t reported_dropped = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class tracer
+        {
+        public:
+            static tracer& get()
+            {
+                static tracer t;
+                return t;
+            }
+
+            // record an event in the buffer of the calling OS thread
+            void push(record const& r) noexcept;
+
+            void enable(parameters const& params, error_code& ec);
+            void disable();
+
+            [[nodiscard]] std::uint64_t written() const noexcept
+            {
+                return written_.load(std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::uint64_t dropped() const noexcept
+            {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            // generate a unique token identifying a spawned thread
+            std::uint64_t next_token() noexcept
+            {
+                return next_token_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+        private:
+            tracer() = default;
+
+            // make sure the flusher thread has exited
+            ~tracer()
+            {
+                disable();
+            }
+
+            ring_buffer* create_buffer();
+            void allocate_records(ring_buffer& buffer);
+            std::vector<ring_buffer*> get_buffers();
+            void release_buffers();
+
+            void write(record const& r)
+            {
+                out_.write(reinterpret_cast<char const*>(&r), sizeof(r));
+            }
+
+            void write_calibration();
+            void write_string(std::uint64_t key);
+            void drain(ring_buffer& buffer);
+            void flush();
+            void run();
+
+            // serializes enable() and disable()
+            std::mutex session_mtx_;
+            bool active_ = false;
+
+            // protects the list of buffers and their configuration. The
+            // buffers are kept for the lifetime of the program as each OS
+            // thread refers to its buffer, only their records are released
+            // at the end of a tracing session.
+            std::mutex buffers_mtx_;
+            std::vector<std::unique_ptr<ring_buffer>> buffers_;
+            std::size_t capacity_ = 0;
+
+            // used by the flusher thread only (or after it has been joined)
+            std::ofstream out_;
+            std::unordered_set<std::uint64_t> strings_;
+
+            std::thread flusher_;
+            std::mutex flusher_mtx_;
+            std::condition_variable flusher_cond_;
+            bool stop_ = false;
+            std::chrono::milliseconds flush_interval_{100};
+
+            std::atomic<std::uint64_t> written_{0};
+            std::atomic<std::uint64_t> dropped_{0};
+
+            std::atomic<std::uint64_t> next_token_{1};
+        };
+
+        void tracer::push(record const& r) noexcept
+        {
+            thread_local ring_buffer* buffer = nullptr;
+            if (HPX_UNLIKELY(buffer == nullptr))
+            {
+                buffer = create_buffer();
+            }
+
+            // disable() waits for the flag to be reset before releasing the
+            // records, thus the flag has to be set before checking whether
+            // tracing is still enabled
+            buffer->busy.store(true, std::memory_order_seq_cst);
+            if (detail::enabled.load(std::memory_order_seq_cst))
+            {
+                if (HPX_UNLIKELY(buffer->records == nullptr))
+                {
+                    allocate_records(*buffer);
+                }
+                buffer->push(r);
+            }
+            buffer->busy.store(false, std::memory_order_release);
+        }
+
+        ring_buffer* tracer::create_buffer()
+        {
+            std::lock_guard<std::mutex> l(buffers_mtx_);
+            buffers_.push_back(
+                std::make_unique<ring_buffer>(static_cast<std::uint32_t>(
+                    threads::detail::get_global_thread_num_tss())));
+            return buffers_.back().get();
+        }
+
+        void tracer::allocate_records(ring_buffer& buffer)
+        {
+            std::lock_guard<std::mutex> l(buffers_mtx_);
+            buffer.allocate(capacity_);
+        }
+
+        // return the buffers holding records of the current session
+        std::vector<ring_buffer*> tracer::get_buffers()
+        {
+            std::vector<ring_buffer*> buffers;
+
+            std::lock_guard<std::mutex> l(buffers_mtx_);
+            buffers.reserve(buffers_.size());
+            for (auto const& buffer : buffers_)
+            {
+                if (buffer->records != nullptr)
+                {
+                    buffers.push_back(buffer.get());
+                }
+            }
+            return buffers;
+        }
+
+        void tracer::release_buffers()
+        {
+            std::vector<ring_buffer*> buffers;
+            {
+                std::lock_guard<std::mutex> l(buffers_mtx_);
+                buffers.reserve(buffers_.size());
+                for (auto const& buffer : buffers_)
+                {
+                    buffers.push_back(buffer.get());
+                }
+            }
+
+            // wait for threads which have seen tracing enabled just before
+            // it was disabled to finish recording their event, this must
+            // not hold the lock as the thread might allocate its records
+            for (ring_buffer* buffer : buffers)
+            {
+                while (buffer->busy.load(std::memory_order_seq_cst))
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            // write the remaining events before releasing the records
+            flush();
+
+            std::lock_guard<std::mutex> l(buffers_mtx_);
+            for (auto const& buffer : buffers_)
+            {
+                buffer->release();
+            }
+            capacity_ = 0;
+        }
+
+        void tracer::enable(parameters const& params, error_code& ec)
+        {
+            std::lock_guard<std::mutex> l(session_mtx_);
+            if (active_)
+            {
+                HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                    "hpx::threads::tracing::enable",
+                    "a tracing session is already active");
+                return;
+            }
+
+            if (params.buffer_size == 0 ||
+                params.buffer_size > (std::size_t(1) << 30))
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "hpx::threads::tracing::enable",
+                    "invalid trace buffer size: {}", params.buffer_size);
+                return;
+            }
+
+            out_.open(params.destination,
+                std::ios::binary | std::ios::out | std::ios::trunc);
+            if (!out_.is_open())
+            {
+                HPX_THROWS_IF(ec, hpx::error::filesystem_error,
+                    "hpx::threads::tracing::enable",
+                    "could not open trace destination: {}",
+                    params.destination);
+                return;
+            }
+
+            file_header header{};
+            std::memcpy(header.magic, trace_magic, sizeof(trace_magic));
+            header.version = trace_version;
+            header.record_size = sizeof(record);
+            out_.write(reinterpret_cast<char const*>(&header), sizeof(header));
+            write_calibration();
+
+            std::size_t capacity = 1;
+            while (capacity < params.buffer_size)
+            {
+                capacity <<= 1;
+            }
+
+            {
+                // the records are allocated by each thread recording events
+                std::lock_guard<std::mutex> bl(buffers_mtx_);
+                capacity_ = capacity;
+            }
+
+            strings_.clear();
+            written_.store(0, std::memory_order_relaxed);
+            dropped_.store(0, std::memory_order_relaxed);
+
+            flush_interval_ = (std::max)(
+                params.flush_interval, std::chrono::milliseconds(1));
+            stop_ = false;
+            flusher_ = std::thread(&tracer::run, this);
+
+            active_ = true;
+            detail::dependencies_enabled.store(
+                params.dependencies, std::memory_order_relaxed);
+            detail::enabled.store(true, std::memory_order_release);
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
+        void tracer::disable()
+        {
+            std::lock_guard<std::mutex> l(session_mtx_);
+            if (!active_)
+                return;
+
+            detail::enabled.store(false, std::memory_order_seq_cst);
+            detail::dependencies_enabled.store(
+                false, std::memory_order_relaxed);
+            active_ = false;
+
+            {
+                std::lock_guard<std::mutex> fl(flusher_mtx_);
+                stop_ = true;
+            }
+            flusher_cond_.notify_one();
+            flusher_.join();
+
+            release_buffers();
+            write_calibration();
+            out_.close();
+        }
+
+        void tracer::write_calibration()
+        {
+            record r{};
+            r.timestamp = util::hardware::timestamp();
+            r.thread_id = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+            r.worker = no_worker;
+            r.event = meta_calibration;
+            write(r);
+        }
+
+        void tracer::write_string(std::uint64_t key)
+        {
+            // descriptions refer to strings which stay valid for the lifetime
+            // of the program (literals or stored function annotations)
+            char const* str = reinterpret_cast<char const*>(key);
+            std::size_t const len = std::strlen(str);
+
+            record r{};
+            r.timestamp = len;
+            r.thread_id = key;
+            r.worker = no_worker;
+            r.event = meta_string;
+            write(r);
+
+            // pad the characters to a multiple of the record size
+            constexpr char zeros[sizeof(record)] = {};
+            out_.write(str, static_cast<std::streamsize>(len));
+            out_.write(zeros,
+                static_cast<std::streamsize>(
+                    (sizeof(record) - len % sizeof(record)) % sizeof(record)));
+        }
+
+        void tracer::drain(ring_buffer& buffer)
+        {
+            std::uint64_t const head =
+                buffer.head.data_.load(std::memory_order_acquire);
+            std::uint64_t const tail =
+                buffer.tail.data_.load(std::memory_order_relaxed);
+
+            if (head != tail)
+            {
+                // define the strings referenced by the records first
+                for (std::uint64_t i = tail; i != head; ++i)
+                {
+                    record const& r = buffer.records[i & buffer.mask];
+                    if (r.annotation != 0 &&
+                        r.annotation_kind ==
+                            static_cast<std::uint8_t>(
+                                thread_description::data_type::description) &&
+                        strings_.insert(r.annotation).second)
+                    {
+                        write_string(r.annotation);
+                    }
+                }
+
+                // write the records in at most two contiguous chunks
+                std::uint64_t const capacity = buffer.mask + 1;
+                std::uint64_t const first = tail & buffer.mask;
+                std::uint64_t const count = head - tail;
+                std::uint64_t const chunk = (std::min)(count, capacity - first);
+
+                out_.write(
+                    reinterpret_cast<char const*>(&buffer.records[first]),
+                    static_cast<std::streamsize>(chunk * sizeof(record)));
+                if (chunk != count)
+                {
+                    out_.write(
+                        reinterpret_cast<char const*>(&buffer.records[0]),
+                        static_cast<std::streamsize>(
+                            (count - chunk) * sizeof(record)));
+                }
+
+                buffer.tail.data_.store(head, std::memory_order_release);
+                written_.fetch_add(count, std::memory_order_relaxed);
+            }
+
+            std::uint64_t const dropped =
+                buffer.dropped.load(std::memory_order_relaxed);
+            if (dropped != buffer.reported_dropped)
+            {
+                record r{};
+                r.timestamp = util::hardware::timestamp();
+                r.thread_id = dropped - buffer.reported_dropped;
+                r.worker = buffer.worker;
+                r.event = meta_dropped;
+                write(r);
+
+                dropped_.fetch_add(r.thread_id, std::memory_order_relaxed);
+                buffer.reported_dropped = dropped;
+            }
+        }
+
+        void tracer::flush()
+        {
+            for (ring_buffer* buffer : get_buffers())
+            {
+                drain(*buffer);
+            }
+            write_calibration();
+            out_.flush();
+        }
+
+        void tracer::run()
+        {
+            std::unique_lock<std::mutex> l(flusher_mtx_);
+            while (!stop_)
+            {
+                flusher_cond_.wait_for(l, flush_interval_);
+                if (stop_)
+                    break;
+
+                l.unlock();
+                flush();
+                l.lock();
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable(parameters const& params, error_code& ec)
+    {
+        tracer::get().enable(params, ec);
+    }
+
+    void disable()
+    {
+        tracer::get().disable();
+    }
+
+    std::uint64_t get_written_events() noexcept
+    {
+        return tracer::get().written();
+    }
+
+    std::uint64_t get_dropped_events() noexcept
+    {
+        return tracer::get().dropped();
+    }
+
+    namespace detail {
+
+        void record_event(event e, std::uint64_t thread_id,
+            thread_description const& desc) noexcept
+        {
+            record r{};
+            r.timestamp = util::hardware::timestamp();
+            r.thread_id = thread_id;
+            if (desc.kind() == thread_description::data_type::description)
+            {
+                r.annotation = reinterpret_cast<std::uint64_t>(
+                    desc.get_description());
+            }
+            else
+            {
+                r.annotation = desc.get_address();
+            }
+            r.worker = static_cast<std::uint32_t>(
+                threads::detail::get_global_thread_num_tss());
+            r.event = static_cast<std::uint8_t>(e);
+            r.annotation_kind = static_cast<std::uint8_t>(desc.kind());
+
+            tracer::get().push(r);
+        }
+
+        void record_activation(thread_data const* thrd) noexcept
+        {
+            // the phase is incremented whenever the thread is run, it is
+            // always zero if phase information is not available in which
+            // case the converter tells starts and resumptions apart
+            record_event(
+                thrd->get_thread_phase() == 0 ? event::start : event::resume,
+                reinterpret_cast<std::uint64_t>(thrd),
+                thrd->get_description());
+        }
+
+        void record_deactivation(
+            thread_data const* thrd, thread_schedule_state state) noexcept
+        {
+            record r{};
+            r.timestamp = util::hardware::timestamp();
+            r.thread_id = reinterpret_cast<std::uint64_t>(thrd);
+            r.worker = static_cast<std::uint32_t>(
+                threads::detail::get_global_thread_num_tss());
+            r.event = static_cast<std::uint8_t>(
+                state == thread_schedule_state::terminated ||
+                        state == thread_schedule_state::deleted ?
+                    event::end :
+                    event::suspend);
+
+            tracer::get().push(r);
+        }
+
+        namespace {
+
+            // the key of dependency events is an address, which prevents it
+            // from being written as a string
+            void record_dependency(
+                event e, std::uint64_t thread_id, std::uint64_t key) noexcept
+            {
+                record r{};
+                r.timestamp = util::hardware::timestamp();
+                r.thread_id = thread_id;
+                r.annotation = key;
+                r.worker = static_cast<std::uint32_t>(
+                    threads::detail::get_global_thread_num_tss());
+                r.event = static_cast<std::uint8_t>(e);
+                r.annotation_kind = static_cast<std::uint8_t>(
+                    thread_description::data_type::address);
+
+                tracer::get().push(r);
+            }
+        }    // namespace
+
+        void record_spawn(thread_init_data& data) noexcept
+        {
+            data.trace_token = tracer::get().next_token();
+            record_dependency(event::spawn, data.trace_token,
+                reinterpret_cast<std::uint64_t>(get_self_id_data()));
+        }
+
+        void record_bind(
+            thread_data const* thrd, thread_init_data const& data) noexcept
+        {
+            // the thread might be created after tracing has been disabled
+            if (is_enabled())
+            {
+                record_dependency(event::bind,
+                    reinterpret_cast<std::uint64_t>(thrd), data.trace_token);
+            }
+        }
+
+        void record_ready(void const* state) noexcept
+        {
+            record_dependency(event::ready,
+                reinterpret_cast<std::uint64_t>(get_self_id_data()),
+                reinterpret_cast<std::uint64_t>(state));
+        }
+
+        void record_wait(void const* state) noexcept
+        {
+            record_dependency(event::wait,
+                reinterpret_cast<std::uint64_t>(get_self_id_data()),
+                reinterpret_cast<std::uint64_t>(state));
+        }
+    }    // namespace detail
+
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        std::string to_hex(std::uint64_t value)
+        {
+            char buffer[24];
+            std::snprintf(buffer, sizeof(buffer), "0x%016llx",
+                static_cast<unsigned long long>(value));
+            return buffer;
+        }
+
+        double trace_file::to_us(std::uint64_t ticks) const noexcept
+        {
+            return static_cast<double>(
+                       static_cast<std::int64_t>(ticks - base)) *
+                us_per_tick;
+        }
+
+        std::string trace_file::name_of(record const& e) const
+        {
+            if (e.annotation_kind ==
+                static_cast<std::uint8_t>(
+                    thread_description::data_type::address))
+            {
+                return "address " + to_hex(e.annotation);
+            }
+            if (auto const it = strings.find(e.annotation);
+                it != strings.end())
+            {
+                return it->second;
+            }
+            return "<unknown>";
+        }
+
+        void read_trace_file(
+            std::istream& in, trace_file& trace, error_code& ec)
+        {
+            file_header header{};
+            if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+                std::memcmp(header.magic, trace_magic, sizeof(trace_magic)) !=
+                    0)
+            {
+                HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                    "hpx::threads::tracing::detail::read_trace_file",
+                    "the input is not a trace written by HPX");
+                return;
+            }
+
+            if (header.version != trace_version ||
+                header.record_size != sizeof(record))
+            {
+                HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                    "hpx::threads::tracing::detail::read_trace_file",
+                    "unsupported trace format version: {}", header.version);
+                return;
+            }
+
+            std::vector<std::pair<std::uint64_t, std::uint64_t>> calibrations;
+
+            // a trailing partial record is ignored, it is most likely caused
+            // by an application which has exited without disabling tracing
+            record r{};
+            while (in.read(reinterpret_cast<char*>(&r), sizeof(r)))
+            {
+                switch (r.event)
+                {
+                case meta_string:
+                {
+                    std::size_t const len =
+                        static_cast<std::size_t>(r.timestamp);
+                    std::size_t const padded =
+                        (len + sizeof(record) - 1) / sizeof(record) *
+                        sizeof(record);
+
+                    if (len > (std::size_t(1) << 20))
+                    {
+                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                            "hpx::threads::tracing::detail::read_trace_file",
+                            "corrupted string definition in trace");
+                        return;
+                    }
+
+                    std::string str(padded, '\0');
+                    if (!in.read(
+                            str.data(), static_cast<std::streamsize>(padded)))
+                    {
+                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                            "hpx::threads::tracing::detail::read_trace_file",
+                            "corrupted string definition in trace");
+                        return;
+                    }
+                    str.resize(len);
+                    trace.strings.emplace(r.thread_id, HPX_MOVE(str));
+                    break;
+                }
+
+                case meta_calibration:
+                    calibrations.emplace_back(r.timestamp, r.thread_id);
+                    break;
+
+                case meta_dropped:
+                    trace.events.push_back(r);
+                    break;
+
+                default:
+                    if (r.event > static_cast<std::uint8_t>(event::wait))
+                    {
+                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                            "hpx::threads::tracing::detail::read_trace_file",
+                            "unknown event code in trace: {}",
+                            static_cast<unsigned int>(r.event));
+                        return;
+                    }
+                    trace.events.push_back(r);
+                    break;
+                }
+            }
+
+            std::stable_sort(trace.events.begin(), trace.events.end(),
+                [](record const& lhs, record const& rhs) {
+                    return lhs.timestamp < rhs.timestamp;
+                });
+
+            // time stamps are converted using the first and the last
+            // calibration point
+            trace.base =
+                trace.events.empty() ? 0 : trace.events.front().timestamp;
+            if (!calibrations.empty())
+            {
+                auto const& front = calibrations.front();
+                auto const& back = calibrations.back();
+
+                trace.base = front.first;
+                if (back.first > front.first && back.second > front.second)
+                {
+                    trace.us_per_tick = 1e-3 *
+                        static_cast<double>(back.second - front.second) /
+                        static_cast<double>(back.first - front.first);
+                }
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        void write_json_string(std::ostream& out, std::string const& str)
+        {
+            out << '"';
+            for (char const c : str)
+            {
+                switch (c)
+                {
+                case '"':
+                    out << "\\\"";
+                    break;
+                case '\\':
+                    out << "\\\\";
+                    break;
+                case '\n':
+                    out << "\\n";
+                    break;
+                case '\t':
+                    out << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char buffer[8];
+                        std::snprintf(buffer, sizeof(buffer), "\\u%04x",
+                            static_cast<unsigned int>(c));
+                        out << buffer;
+                    }
+                    else
+                    {
+                        out << c;
+                    }
+                    break;
+                }
+            }
+            out << '"';
+        }
+
+        // write the fields common to all trace events
+        void write_event_prefix(std::ostream& out, bool& first, char phase,
+            double ts, std::uint32_t worker)
+        {
+            out << (first ? "\n" : ",\n");
+            first = false;
+
+            out << "{\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << worker
+                << ",\"ts\":" << ts;
+        }
+
+        // a dependency is shown as an arrow from the slice running on the
+        // source worker to the start of the slice of the dependent thread
+        void write_flow(std::ostream& out, bool& first, char const* name,
+            std::uint64_t id, double from_ts, std::uint32_t from_worker,
+            double to_ts, std::uint32_t to_worker)
+        {
+            write_event_prefix(out, first, 's', from_ts, from_worker);
+            out << ",\"cat\":\"dependency\",\"name\":\"" << name
+                << "\",\"id\":" << id << "}";
+
+            write_event_prefix(out, first, 'f', to_ts, to_worker);
+            out << ",\"bp\":\"e\",\"cat\":\"dependency\",\"name\":\"" << name
+                << "\",\"id\":" << id << "}";
+        }
+
+        struct dependency_source
+        {
+            double ts;
+            std::uint32_t worker;
+        };
+    }    // namespace
+
+    void convert_to_chrome_trace(
+        std::istream& in, std::ostream& out, error_code& ec)
+    {
+        detail::trace_file trace;
+        detail::read_trace_file(in, trace, ec);
+        if (ec)
+            return;
+
+        auto const flags = out.flags();
+        auto const precision = out.precision();
+        out.setf(std::ios::fixed, std::ios::floatfield);
+        out.precision(3);
+
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        bool first = true;
+        write_event_prefix(out, first, 'M', 0.0, 0);
+        out << ",\"name\":\"process_name\",\"args\":{\"name\":\"HPX\"}}";
+
+        std::set<std::uint32_t> workers;
+        for (record const& e : trace.events)
+        {
+            workers.insert(e.worker);
+        }
+        for (std::uint32_t const worker : workers)
+        {
+            write_event_prefix(out, first, 'M', 0.0, worker);
+            out << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+            write_json_string(out, worker == no_worker ?
+                    std::string("non-worker thread") :
+                    "worker-thread#" + std::to_string(worker));
+            out << "}}";
+        }
+
+        // the thread ids of all threads which are running or suspended
+        std::unordered_map<std::uint64_t, bool> threads;
+
+        // dependency events waiting to be matched with their targets
+        std::unordered_map<std::uint64_t, dependency_source> spawns;
+        std::unordered_map<std::uint64_t, std::uint64_t> binds;
+        std::unordered_map<std::uint64_t, dependency_source> ready;
+        std::uint64_t flow_id = 0;
+
+        for (record const& e : trace.events)
+        {
+            double const ts = trace.to_us(e.timestamp);
+            switch (e.event)
+            {
+            case meta_dropped:
+                write_event_prefix(out, first, 'i', ts, e.worker);
+                out << ",\"s\":\"t\",\"name\":\"dropped events\","
+                       "\"args\":{\"count\":"
+                    << e.thread_id << "}}";
+                break;
+
+            case static_cast<std::uint8_t>(event::create):
+                write_event_prefix(out, first, 'i', ts, e.worker);
+                out << ",\"s\":\"t\",\"cat\":\"create\",\"name\":";
+                write_json_string(out, trace.name_of(e));
+                out << ",\"args\":{\"thread\":\"" << detail::to_hex(e.thread_id)
+                    << "\"}}";
+                break;
+
+            case static_cast<std::uint8_t>(event::start):
+                [[fallthrough]];
+            case static_cast<std::uint8_t>(event::resume):
+            {
+                // without phase information all activations are recorded as
+                // starts, tell them apart based on the earlier events
+                auto const it = threads.find(e.thread_id);
+                bool const resumed =
+                    e.event == static_cast<std::uint8_t>(event::resume) ||
+                    (it != threads.end() && !it->second);
+                threads[e.thread_id] = true;
+
+                write_event_prefix(out, first, 'B', ts, e.worker);
+                out << ",\"cat\":\"task\",\"name\":";
+                write_json_string(out, trace.name_of(e));
+                out << ",\"args\":{\"thread\":\"" << detail::to_hex(e.thread_id)
+                    << "\",\"event\":\"" << (resumed ? "resume" : "start")
+                    << "\"}}";
+
+                // connect a newly started thread with its creator
+                if (auto const bind = binds.find(e.thread_id);
+                    !resumed && bind != binds.end())
+                {
+                    if (auto const spawn = spawns.find(bind->second);
+                        spawn != spawns.end())
+                    {
+                        write_flow(out, first, "spawn", ++flow_id,
+                            spawn->second.ts, spawn->second.worker, ts,
+                            e.worker);
+                        spawns.erase(spawn);
+                    }
+                    binds.erase(bind);
+                }
+                break;
+            }
+
+            case static_cast<std::uint8_t>(event::suspend):
+                [[fallthrough]];
+            case static_cast<std::uint8_t>(event::end):
+            {
+                // skip threads which were already running when the session
+                // was started
+                auto const it = threads.find(e.thread_id);
+                if (it == threads.end() || !it->second)
+                    break;
+
+                bool const ended =
+                    e.event == static_cast<std::uint8_t>(event::end);
+                if (ended)
+                    threads.erase(it);
+                else
+                    it->second = false;
+
+                write_event_prefix(out, first, 'E', ts, e.worker);
+                out << ",\"args\":{\"event\":\""
+                    << (ended ? "end" : "suspend") << "\"}}";
+                break;
+            }
+
+            case static_cast<std::uint8_t>(event::spawn):
+                spawns[e.thread_id] = dependency_source{ts, e.worker};
+                break;
+
+            case static_cast<std::uint8_t>(event::bind):
+                binds[e.thread_id] = e.annotation;
+                break;
+
+            case static_cast<std::uint8_t>(event::ready):
+                ready[e.annotation] = dependency_source{ts, e.worker};
+                break;
+
+            case static_cast<std::uint8_t>(event::wait):
+                if (auto const it = ready.find(e.annotation); it != ready.end())
+                {
+                    write_flow(out, first, "ready", ++flow_id, it->second.ts,
+                        it->second.worker, ts, e.worker);
+                }
+                break;
+
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+        }
+
+        out << "\n]}\n";
+
+        out.flags(flags);
+        out.precision(precision);
+
+        if (!out)
+        {
+            HPX_THROWS_IF(ec, hpx::error::filesystem_error,
+                "hpx::threads::tracing::convert_to_chrome_trace",
+                "could not write the converted trace");
+            return;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+}    // namespace hpx::threads::tracing
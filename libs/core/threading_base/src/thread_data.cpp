@@ -14,6 +14,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
@@ -109,6 +110,10 @@ namespace hpx::threads {
 #if defined(HPX_HAVE_APEX)
         set_timer_data(init_data.timer_data);
 #endif
+
+        // connect the thread with the creator recorded in its init data
+        if (HPX_UNLIKELY(init_data.trace_token != 0))
+            tracing::detail::record_bind(this, init_data);
     }
 
     thread_data::~thread_data()
@@ -270,6 +275,10 @@ namespace hpx::threads {
 #if defined(HPX_HAVE_APEX)
         set_timer_data(init_data.timer_data);
 #endif
+
+        // connect the thread with the creator recorded in its init data
+        if (HPX_UNLIKELY(init_data.trace_token != 0))
+            tracing::detail::record_bind(this, init_data);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -87,6 +87,17 @@ namespace hpx::threads {
         return topo.cpuset_to_nodeset(used_processing_units);
     }
 
+    void thread_pool_base::create_bulk_work(
+        thread_init_data* first, thread_init_data* last, error_code& ec)
+    {
+        for (/**/; first != last; ++first)
+        {
+            create_work(*first, ec);
+            if (ec)
+                return;
+        }
+    }
+
     std::int64_t thread_pool_base::get_thread_count_unknown(
         std::size_t num_thread, bool reset)
     {
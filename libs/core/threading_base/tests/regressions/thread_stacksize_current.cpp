@@ -69,6 +69,7 @@ int main(int argc, char** argv)
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
         "local-priority-lifo",
 #endif
+        "local-priority-chase-lev",
         "static",
         "static-priority",
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
@@ -83,6 +84,7 @@ int main(int argc, char** argv)
         "local-workrequesting-lifo",
 #endif
         "local-workrequesting-mc",
+        "local-workrequesting-chase-lev",
 #endif
     };
 
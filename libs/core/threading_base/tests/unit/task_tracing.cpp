@@ -0,0 +1,223 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tracing = hpx::threads::tracing;
+
+std::string const destination = "task_tracing_test.bin";
+
+///////////////////////////////////////////////////////////////////////////////
+std::string convert(std::string const& filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    HPX_TEST(in.is_open());
+
+    std::ostringstream out;
+    tracing::convert_to_chrome_trace(in, out);
+    return out.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_toggle_through_config()
+{
+    HPX_TEST(!tracing::is_enabled());
+
+    hpx::set_config_entry("hpx.trace.destination", destination);
+    hpx::set_config_entry("hpx.trace.enabled", "1");
+    HPX_TEST(tracing::is_enabled());
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t i = 0; i != 16; ++i)
+    {
+        futures.push_back(hpx::async(hpx::annotated_function(
+            [] {
+                // suspend the thread once
+                hpx::this_thread::yield();
+            },
+            "traced_task")));
+    }
+    hpx::wait_all(futures);
+
+    hpx::set_config_entry("hpx.trace.enabled", "0");
+    HPX_TEST(!tracing::is_enabled());
+
+    // each task was created, started, suspended, resumed, and has ended
+    HPX_TEST_LTE(std::uint64_t(16 * 5),
+        tracing::get_written_events() + tracing::get_dropped_events());
+
+    std::string const trace = convert(destination);
+    HPX_TEST_NEQ(trace.find("\"traceEvents\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"event\":\"start\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"event\":\"resume\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"event\":\"suspend\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"event\":\"end\""), std::string::npos);
+    HPX_TEST_NEQ(trace.find("\"cat\":\"create\""), std::string::npos);
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_NEQ(trace.find("\"name\":\"traced_task\""), std::string::npos);
+#endif
+
+    std::remove(destination.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_dependencies()
+{
+    tracing::parameters params;
+    params.destination = destination;
+    params.dependencies = true;
+
+    tracing::enable(params);
+    HPX_TEST(tracing::is_recording_dependencies());
+
+    hpx::future<int> producer = hpx::async(hpx::annotated_function(
+        [] {
+            hpx::this_thread::yield();
+            return 42;
+        },
+        "producer"));
+
+    // the consumer is suspended until the producer has finished
+    hpx::future<int> consumer = hpx::async(hpx::annotated_function(
+        [&producer] { return producer.get() + 1; }, "consumer"));
+
+    hpx::future<int> continuation = consumer.then(hpx::annotated_function(
+        [](hpx::future<int>&& f) { return f.get() + 1; }, "continuation"));
+    HPX_TEST_EQ(continuation.get(), 44);
+
+    tracing::disable();
+    HPX_TEST(!tracing::is_recording_dependencies());
+
+    std::string const trace = convert(destination);
+    HPX_TEST_NEQ(trace.find("\"cat\":\"dependency\""), std::string::npos);
+
+    std::ifstream in(destination, std::ios::binary);
+    HPX_TEST(in.is_open());
+
+    std::ostringstream out;
+    tracing::analyze_trace(in, out);
+
+    std::string const report = out.str();
+    HPX_TEST_NEQ(report.find("critical path:"), std::string::npos);
+    HPX_TEST_NEQ(report.find("parallelism profile"), std::string::npos);
+    HPX_TEST_NEQ(report.find("slack by annotation:"), std::string::npos);
+    HPX_TEST_EQ(report.find("no dependencies"), std::string::npos);
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    HPX_TEST_NEQ(report.find("continuation"), std::string::npos);
+#endif
+
+    std::remove(destination.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sessions()
+{
+    // the buffers are released at the end of each session and are allocated
+    // again for the size requested by the next session
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        tracing::parameters params;
+        params.destination = destination;
+        params.buffer_size = i % 2 == 0 ? 64 : 4096;
+        params.flush_interval = std::chrono::milliseconds(1);
+
+        tracing::enable(params);
+
+        std::vector<hpx::future<void>> futures;
+        for (std::size_t j = 0; j != 64; ++j)
+        {
+            futures.push_back(hpx::async([] { hpx::this_thread::yield(); }));
+        }
+        hpx::wait_all(futures);
+
+        tracing::disable();
+
+        HPX_TEST_LT(std::uint64_t(0), tracing::get_written_events());
+        HPX_TEST_LTE(std::uint64_t(64 * 5),
+            tracing::get_written_events() + tracing::get_dropped_events());
+
+        std::string const trace = convert(destination);
+        HPX_TEST_NEQ(trace.find("\"event\":\"end\""), std::string::npos);
+    }
+
+    std::remove(destination.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_errors()
+{
+    tracing::parameters params;
+    params.destination = destination;
+
+    tracing::enable(params);
+    HPX_TEST(tracing::is_enabled());
+
+    // only one tracing session can be active
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    tracing::enable(params, ec);
+    HPX_TEST(ec);
+
+    tracing::disable();
+    HPX_TEST(!tracing::is_enabled());
+
+    // disabling tracing more than once is fine
+    tracing::disable();
+
+    ec = hpx::error_code(hpx::throwmode::lightweight);
+    params.buffer_size = 0;
+    tracing::enable(params, ec);
+    HPX_TEST(ec);
+    HPX_TEST(!tracing::is_enabled());
+
+    // a file which is not a trace is rejected
+    std::istringstream in("not a trace");
+    std::ostringstream out;
+    ec = hpx::error_code(hpx::throwmode::lightweight);
+    tracing::convert_to_chrome_trace(in, out, ec);
+    HPX_TEST(ec);
+
+    in.str("not a trace");
+    in.clear();
+    ec = hpx::error_code(hpx::throwmode::lightweight);
+    tracing::analyze_trace(in, out, tracing::analysis_parameters(), ec);
+    HPX_TEST(ec);
+
+    std::remove(destination.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_toggle_through_config();
+    test_dependencies();
+    test_sessions();
+    test_errors();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -279,6 +279,11 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_to_staged(bool reset) const;
 #endif
 
+        std::int64_t get_num_stolen_from_shared_cache(bool reset) const;
+        std::int64_t get_num_stolen_from_numa_domain(bool reset) const;
+        std::int64_t get_num_stolen_from_remote_numa_domain(
+            bool reset) const;
+
     private:
         policies::thread_queue_init_parameters get_init_parameters() const;
         void create_scheduler_user_defined(
@@ -293,6 +298,9 @@ namespace hpx::threads {
         void create_scheduler_local_priority_lifo(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_priority_chase_lev(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static(thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
         void create_scheduler_static_priority(
@@ -316,6 +324,9 @@ namespace hpx::threads {
         void create_scheduler_local_workrequesting_mc(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_local_workrequesting_chase_lev(
+            thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
@@ -22,6 +22,7 @@
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -31,6 +32,8 @@
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/get_entry_as.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -58,6 +61,61 @@ namespace hpx::threads {
                     "larger than number of threads (--hpx:threads)");
             }
         }
+
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        static policies::detail::workrequesting_steal_parameters
+        get_workrequesting_steal_parameters(
+            hpx::util::runtime_configuration const& rtcfg)
+        {
+            policies::detail::workrequesting_steal_parameters params;
+
+            params.hierarchical_ = hpx::util::get_entry_as<int>(rtcfg,
+                                       "hpx.scheduler.hierarchical_stealing",
+                                       params.hierarchical_) != 0;
+            params.cache_level_ = hpx::util::get_entry_as<int>(
+                rtcfg, "hpx.scheduler.steal_cache_level", params.cache_level_);
+            params.min_remote_backoff_ = hpx::util::get_entry_as<std::uint16_t>(
+                rtcfg, "hpx.scheduler.min_remote_steal_backoff",
+                params.min_remote_backoff_);
+            params.max_remote_backoff_ = (std::max)(
+                hpx::util::get_entry_as<std::uint16_t>(rtcfg,
+                    "hpx.scheduler.max_remote_steal_backoff",
+                    params.max_remote_backoff_),
+                params.min_remote_backoff_);
+
+            return params;
+        }
+#endif
+
+        // start or stop recording thread events depending on the value of
+        // hpx.trace.enabled
+        static void update_task_tracing(
+            hpx::util::runtime_configuration const& rtcfg)
+        {
+            if (hpx::util::get_entry_as<int>(rtcfg, "hpx.trace.enabled", 0) ==
+                0)
+            {
+                tracing::disable();
+                return;
+            }
+
+            if (tracing::is_enabled())
+                return;
+
+            tracing::parameters params;
+            params.destination =
+                rtcfg.get_entry("hpx.trace.destination", params.destination);
+            params.buffer_size = hpx::util::get_entry_as<std::size_t>(
+                rtcfg, "hpx.trace.buffer_size", params.buffer_size);
+            params.flush_interval =
+                std::chrono::milliseconds(hpx::util::get_entry_as<std::int64_t>(
+                    rtcfg, "hpx.trace.flush_interval",
+                    params.flush_interval.count()));
+            params.dependencies = hpx::util::get_entry_as<int>(
+                                      rtcfg, "hpx.trace.dependencies", 0) != 0;
+
+            tracing::enable(params);
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -88,6 +146,12 @@ namespace hpx::threads {
             &resource::detail::partitioner::assign_pu, std::ref(rp), _3, _1));
         notifier.add_on_stop_thread_callback(hpx::bind(
             &resource::detail::partitioner::unassign_pu, std::ref(rp), _3, _1));
+
+        // allow for tracing to be switched on and off at runtime
+        rtcfg_.add_notification_callback("hpx.trace.enabled",
+            [&rtcfg = rtcfg_](std::string const&, std::string const&) {
+                detail::update_task_tracing(rtcfg);
+            });
     }
 
     policies::thread_queue_init_parameters threadmanager::get_init_parameters()
@@ -277,6 +341,46 @@ namespace hpx::threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_local_priority_chase_lev(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t const numa_sensitive)
+    {
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::chase_lev_lifo>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_priority_queue_scheduler-chase_lev");
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_scheduler_static(
         thread_pool_init_parameters const& thread_pool_init,
         policies::thread_queue_init_parameters const& thread_queue_init,
@@ -515,7 +619,8 @@ namespace hpx::threads {
         local_sched_type::init_parameter_type const init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
-            "core-local_workrequesting_scheduler-fifo");
+            "core-local_workrequesting_scheduler-fifo",
+            detail::get_workrequesting_steal_parameters(rtcfg_));
 
         auto sched = std::make_unique<local_sched_type>(init);
 
@@ -563,7 +668,8 @@ namespace hpx::threads {
         local_sched_type::init_parameter_type const init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
-            "core-local_workrequesting_scheduler-mc");
+            "core-local_workrequesting_scheduler-mc",
+            detail::get_workrequesting_steal_parameters(rtcfg_));
 
         auto sched = std::make_unique<local_sched_type>(init);
 
@@ -587,6 +693,55 @@ namespace hpx::threads {
 #endif
     }
 
+    void threadmanager::create_scheduler_local_workrequesting_chase_lev(
+        [[maybe_unused]] thread_pool_init_parameters const& thread_pool_init,
+        [[maybe_unused]] policies::thread_queue_init_parameters const&
+            thread_queue_init,
+        [[maybe_unused]] std::size_t const numa_sensitive)
+    {
+#if defined(HPX_HAVE_WORK_REQUESTING_SCHEDULERS)
+        // set parameters for scheduler and pool instantiation and perform
+        // compatibility checks
+        std::size_t const num_high_priority_queues =
+            hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                "hpx.thread_queue.high_priority_queues",
+                thread_pool_init.num_threads_);
+        detail::check_num_high_priority_queues(
+            thread_pool_init.num_threads_, num_high_priority_queues);
+
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_workrequesting_scheduler<std::mutex,
+                hpx::threads::policies::chase_lev_lifo>;
+
+        local_sched_type::init_parameter_type const init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            num_high_priority_queues, thread_queue_init,
+            "core-local_workrequesting_scheduler-chase_lev",
+            detail::get_workrequesting_steal_parameters(rtcfg_));
+
+        auto sched = std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+#else
+        throw hpx::detail::command_line_error(
+            "Command line option --hpx:queuing=local-workrequesting-chase-lev "
+            "is not configured in this build. Please make sure "
+            "HPX_WITH_WORK_REQUESTING_SCHEDULERS is set to ON");
+#endif
+    }
+
     void threadmanager::create_scheduler_local_workrequesting_lifo(
         [[maybe_unused]] thread_pool_init_parameters const& thread_pool_init,
         [[maybe_unused]] policies::thread_queue_init_parameters const&
@@ -612,7 +767,8 @@ namespace hpx::threads {
         local_sched_type::init_parameter_type const init(
             thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
             num_high_priority_queues, thread_queue_init,
-            "core-local_workrequesting_scheduler-lifo");
+            "core-local_workrequesting_scheduler-lifo",
+            detail::get_workrequesting_steal_parameters(rtcfg_));
 
         auto sched = std::make_unique<local_sched_type>(init);
 
@@ -772,6 +928,11 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_priority_chase_lev:
+                create_scheduler_local_priority_chase_lev(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::static_:
                 create_scheduler_static(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -797,6 +958,11 @@ namespace hpx::threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_workrequesting_chase_lev:
+                create_scheduler_local_workrequesting_chase_lev(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             case resource::scheduling_policy::abp_priority_fifo:
                 create_scheduler_abp_priority_fifo(
                     thread_pool_init, thread_queue_init, numa_sensitive);
@@ -1468,6 +1634,36 @@ namespace hpx::threads {
     }
 #endif
 
+    std::int64_t threadmanager::get_num_stolen_from_shared_cache(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_from_shared_cache(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_numa_domain(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_from_numa_domain(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_stolen_from_remote_numa_domain(
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_stolen_from_remote_numa_domain(
+                all_threads, reset);
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool threadmanager::run() const
     {
@@ -1478,6 +1674,8 @@ namespace hpx::threads {
         auto const& rp = hpx::resource::get_partitioner();
         init_tss(rp.get_num_threads());
 
+        detail::update_task_tracing(rtcfg_);
+
 #ifdef HPX_HAVE_TIMER_POOL
         LTM_(info).format("run: running timer pool");
         timer_pool_.run(false);
@@ -1520,6 +1718,11 @@ namespace hpx::threads {
         {
             pool_iter->stop(lk, blocking);
         }
+
+        // write all events recorded so far once all threads have exited
+        if (blocking)
+            tracing::disable();
+
         deinit_tss();
     }
 
@@ -463,6 +463,79 @@ namespace hpx::threads {
         return empty_mask;
     }
 
+    mask_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, int level, error_code& ec) const
+    {
+        mask_cref_type core_mask = get_core_affinity_mask(num_thread, ec);
+        if (ec)
+            return empty_mask;
+
+#if HWLOC_API_VERSION >= 0x00020000
+        hwloc_obj_type_t type;
+        switch (level)
+        {
+        case 1:
+            type = HWLOC_OBJ_L1CACHE;
+            break;
+
+        case 2:
+            type = HWLOC_OBJ_L2CACHE;
+            break;
+
+        case 3:
+            type = HWLOC_OBJ_L3CACHE;
+            break;
+
+        case 4:
+            type = HWLOC_OBJ_L4CACHE;
+            break;
+
+        case 5:
+            type = HWLOC_OBJ_L5CACHE;
+            break;
+
+        default:
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "hpx::threads::topology::get_cache_affinity_mask",
+                "invalid cache level {1}", level);
+            return empty_mask;
+        }
+
+        std::size_t const num_pu = (num_thread + pu_offset) % num_of_pus_;
+        hwloc_obj_t cache_obj = nullptr;
+
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+            hwloc_obj_t const pu_obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+            if (pu_obj != nullptr)
+            {
+                cache_obj = hwloc_get_ancestor_obj_by_type(topo, type, pu_obj);
+            }
+        }
+
+        if (cache_obj == nullptr)
+        {
+            return core_mask;
+        }
+
+        auto mask = mask_type();
+        resize(mask, get_number_of_pus());
+
+        extract_node_mask(cache_obj, mask);
+        return mask;
+#else
+        if (level < 1 || level > 5)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "hpx::threads::topology::get_cache_affinity_mask",
+                "invalid cache level {1}", level);
+            return empty_mask;
+        }
+        return core_mask;
+#endif
+    }
+
     mask_cref_type topology::get_thread_affinity_mask(
         std::size_t num_thread, error_code& ec) const
     {
@@ -11,8 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/function.hpp>
@@ -63,15 +62,11 @@ namespace hpx { namespace agas {
         using mutex_type = hpx::spinlock;
 
         // gva cache
-        struct gva_cache_key;
-
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_cache_type = detail::gva_cache;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable hpx::shared_mutex gva_cache_mtx_;
         std::shared_ptr<gva_cache_type> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
@@ -0,0 +1,173 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/datastructures/detail/dynamic_bitset.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Concurrent cache mapping global ids (or ranges of global ids) to their
+    // global virtual address.
+    //
+    // The entries for single ids are distributed over a number of shards,
+    // each of which is an open addressing hash table with bounded probing.
+    // Every shard is protected by a sequence lock: lookups never write to
+    // shared memory (except for setting the reference bit of an entry that
+    // was not referenced before) and retry if a writer modified the shard
+    // concurrently. Writers are serialized per shard. Entries are evicted
+    // using the CLOCK algorithm, which approximates LRU without requiring to
+    // reorder the entries on every hit.
+    //
+    // Entries for ranges of ids (see hpx.agas.use_range_caching) are kept in
+    // a separate sorted table that is protected by a sequence lock as well.
+    // This table is consulted only if it is not empty.
+    //
+    // All entry data is stored in atomic words, which makes the optimistic
+    // reads well defined even if they race with a writer.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        HPX_NON_COPYABLE(gva_cache);
+
+        // The number of shards is rounded up to the next power of two, zero
+        // selects a number based on the available hardware concurrency.
+        explicit gva_cache(std::size_t num_shards = 0);
+        ~gva_cache();
+
+        // Change the maximum number of entries the cache can hold. Lookups
+        // may proceed concurrently, the tables that are replaced are kept
+        // alive until the cache is destroyed (this is expected to be called
+        // very rarely).
+        void reserve(std::size_t capacity);
+
+        [[nodiscard]] std::size_t capacity() const noexcept;
+        [[nodiscard]] std::size_t size() const noexcept;
+        [[nodiscard]] std::size_t num_shards() const noexcept;
+
+        // Insert or update the entry for the count ids starting at the
+        // given (stripped) id. Returns false (without modifying the cache) if
+        // the ids are covered by an entry for a different range of ids.
+        bool update(naming::gid_type const& gid, std::uint64_t count,
+            gva const& g);
+
+        // Same as above, returns the first id and the entry of the range of
+        // ids that collided in idbase and old if false is returned.
+        bool update(naming::gid_type const& gid, std::uint64_t count,
+            gva const& g, naming::gid_type& idbase, gva& old);
+
+        // Look up the entry for the given (stripped) id, returns the first id
+        // of the range the entry was stored for in idbase.
+        bool get_entry(naming::gid_type const& gid, naming::gid_type& idbase,
+            gva& g) const;
+
+        // Look up the entries for count (stripped) ids at once, found is
+        // resized to count and has the bits set for all ids that were found.
+        // Returns the number of ids that were found.
+        std::size_t get_entries(naming::gid_type const* gids,
+            std::size_t count, naming::gid_type* idbases, gva* gvas,
+            hpx::detail::dynamic_bitset<>& found) const;
+
+        // Remove the entries stored for the given (stripped) id.
+        void erase(naming::gid_type const& gid);
+
+        // Remove all entries.
+        void clear();
+
+        // statistics
+        [[nodiscard]] std::int64_t hits(bool reset) const noexcept;
+        [[nodiscard]] std::int64_t misses(bool reset) const noexcept;
+        [[nodiscard]] std::int64_t evictions(bool reset) const noexcept;
+        [[nodiscard]] std::int64_t insertions(bool reset) const noexcept;
+
+        [[nodiscard]] std::int64_t get_entry_count(bool reset) const noexcept;
+        [[nodiscard]] std::int64_t insert_entry_count(
+            bool reset) const noexcept;
+        [[nodiscard]] std::int64_t update_entry_count(
+            bool reset) const noexcept;
+        [[nodiscard]] std::int64_t erase_entry_count(
+            bool reset) const noexcept;
+
+        [[nodiscard]] std::int64_t get_entry_time(bool reset) const noexcept;
+        [[nodiscard]] std::int64_t insert_entry_time(
+            bool reset) const noexcept;
+        [[nodiscard]] std::int64_t update_entry_time(
+            bool reset) const noexcept;
+        [[nodiscard]] std::int64_t erase_entry_time(
+            bool reset) const noexcept;
+
+    private:
+        struct entry;
+        struct table;
+        struct shard;
+        struct range_table;
+        struct statistics;
+        struct padded_shard;
+        struct padded_statistics;
+        class update_on_exit;
+
+        enum class method : std::uint8_t
+        {
+            get_entry = 0,
+            insert_entry = 1,
+            update_entry = 2,
+            erase_entry = 3
+        };
+
+        shard& get_shard(std::uint64_t hash) const noexcept;
+        statistics& get_statistics() const noexcept;
+
+        bool lookup(naming::gid_type const& gid, naming::gid_type& idbase,
+            gva& g) const;
+        bool lookup_range(naming::gid_type const& gid,
+            naming::gid_type& idbase, gva& g) const;
+
+        static entry* find_range(table const& t, std::size_t size,
+            std::uint64_t msb, std::uint64_t lsb) noexcept;
+
+        bool update_range(naming::gid_type const& gid, std::uint64_t count,
+            gva const& g, naming::gid_type& idbase, gva& old);
+        bool insert_range(std::uint64_t msb, std::uint64_t lsb,
+            std::uint64_t last, gva const& g, naming::gid_type& idbase,
+            gva& old, statistics& stats);
+        void erase_covered(
+            std::uint64_t msb, std::uint64_t lsb, std::uint64_t last);
+
+        static void insert_locked(shard& s, table& t, std::uint64_t hash,
+            std::uint64_t msb, std::uint64_t lsb, gva const& g,
+            statistics& stats) noexcept;
+
+        std::int64_t accumulate(std::atomic<std::int64_t> statistics::*value,
+            bool reset) const noexcept;
+        std::int64_t accumulate(method m, bool time, bool reset) const noexcept;
+
+        std::size_t const num_shards_;
+        std::atomic<std::size_t> capacity_;
+
+        std::unique_ptr<padded_shard[]> shards_;
+        std::unique_ptr<range_table> ranges_;
+        std::unique_ptr<padded_statistics[]> statistics_;
+
+        // all tables ever created, see reserve()
+        hpx::spinlock tables_mtx_;
+        std::vector<std::unique_ptr<table>> tables_;
+    };
+}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
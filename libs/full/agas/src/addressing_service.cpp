@@ -52,69 +52,6 @@
 
 namespace hpx::agas {
 
-    struct addressing_service::gva_cache_key
-    {
-    private:
-        using key_type = std::pair<naming::gid_type, naming::gid_type>;
-
-        key_type key_;
-
-    public:
-        gva_cache_key() = default;
-
-        explicit gva_cache_key(
-            naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    };
-
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
@@ -1270,28 +1207,112 @@ namespace hpx::agas {
     {
         locals.resize(count);
 
+        naming::gid_type const here = get_local_locality();
+        bool const use_cache = caching_ && !hpx::is_starting();
+
+        // the ids that have to be looked up in the cache, those are looked up
+        // all at once below
+        std::vector<std::size_t> pending;
+        std::vector<naming::gid_type> ids;
+
         std::size_t resolved = 0;
+        bool has_migratable = false;
         for (std::size_t i = 0; i != count; ++i)
         {
             if (!addrs[i] && !locals.test(i))
             {
-                bool const was_resolved = resolve_cached(gids[i], addrs[i], ec);
-                if (ec)
-                    return false;
-                if (was_resolved)
+                naming::gid_type const id =
+                    naming::detail::get_stripped_gid_except_dont_cache(gids[i]);
+
+                // special cases
+                if (resolve_locally_known_addresses(id, addrs[i]))
+                {
                     ++resolved;
+                    if (addrs[i].locality_ == here)
+                        locals.set(i, true);
+                    continue;
+                }
 
-                if (addrs[i].locality_ == get_local_locality())
-                    locals.set(i, true);
+                // don't look at cache if id is marked as non-cache-able or
+                // if the id is locally managed
+                if (use_cache && naming::detail::store_in_cache(id) &&
+                    !naming::is_locality(id) &&
+                    naming::get_locality_id_from_gid(id) !=
+                        naming::get_locality_id_from_gid(locality_))
+                {
+                    has_migratable =
+                        has_migratable || naming::detail::is_migratable(id);
+                    pending.push_back(i);
+                    ids.push_back(id);
+                }
             }
 
-            else if (addrs[i].locality_ == get_local_locality())
+            else if (addrs[i].locality_ == here)
             {
                 ++resolved;
                 locals.set(i, true);
             }
         }
 
+        if (has_migratable)
+        {
+            // force routing if target object was migrated
+            std::lock_guard<mutex_type> lock(migrated_objects_mtx_);
+
+            std::size_t j = 0;
+            for (std::size_t k = 0; k != ids.size(); ++k)
+            {
+                if (!naming::detail::is_migratable(ids[k]) ||
+                    !was_object_migrated_locked(ids[k]))
+                {
+                    pending[j] = pending[k];
+                    ids[j] = ids[k];
+                    ++j;
+                }
+            }
+            pending.resize(j);
+            ids.resize(j);
+        }
+
+        if (!ids.empty())
+        {
+            std::vector<naming::gid_type> idbases(ids.size());
+            std::vector<gva> gvas(ids.size());
+            hpx::detail::dynamic_bitset<> found;
+
+            gva_cache_->get_entries(
+                ids.data(), ids.size(), idbases.data(), gvas.data(), found);
+
+            for (std::size_t k = 0; k != ids.size(); ++k)
+            {
+                if (!found.test(k))
+                    continue;
+
+                if (HPX_UNLIKELY(naming::detail::strip_internal_bits_from_gid(
+                                     ids[k].get_msb()) !=
+                        idbases[k].get_msb()))
+                {
+                    HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                        "addressing_service::resolve_cached",
+                        "bad entry in cache, MSBs of GID base and GID do not "
+                        "match");
+                    return false;
+                }
+
+                std::size_t const i = pending[k];
+                addrs[i].locality_ = gvas[k].prefix;
+                addrs[i].type_ = gvas[k].type;
+                addrs[i].address_ = gvas[k].lva(ids[k], idbases[k]);
+
+                ++resolved;
+                if (addrs[i].locality_ == here)
+                    locals.set(i, true);
+            }
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
         return resolved == count;    // returns whether all have been resolved
     }
 
@@ -1677,15 +1698,6 @@ namespace hpx::agas {
         return symbol_ns_.iterate_async(pattern);
     }
 
-    // This function has to return false if the key is already in the cache (true
-    // means go ahead with the cache update).
-    bool check_for_collisions(addressing_service::gva_cache_key const& new_key,
-        addressing_service::gva_cache_key const& old_key)
-    {
-        return (new_key.get_gid() != old_key.get_gid()) ||
-            (new_key.get_count() != old_key.get_count());
-    }
-
     void addressing_service::update_cache_entry(
         naming::gid_type const& id, gva const& g, error_code& ec)
     {
@@ -1747,37 +1759,16 @@ namespace hpx::agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
-            gva_cache_key const key(gid, count);
-
+            naming::gid_type idbase;
+            gva old;
+            if (!gva_cache_->update(gid, count, g, idbase, old))
             {
-                std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
-                {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
-
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
-
-                        LAGAS_(warning).format(
-                            "addressing_service::update_cache_entry, aborting "
-                            "update due to key collision in cache, "
-                            "new_gid({1}), new_count({2}), old_gid({3}), "
-                            "old_count({4})",
-                            gid, count, idbase.get_gid(), idbase.get_count());
-                    }
-                }
+                // the id is covered by an entry for a different range of ids
+                LAGAS_(warning).format(
+                    "addressing_service::update_cache_entry, aborting update "
+                    "due to key collision in cache, new_gid({1}), "
+                    "new_count({2}), old_gid({3}), old_count({4})",
+                    gid, count, idbase, old.count);
             }
 
             if (&ec != &throws)
@@ -1801,17 +1792,15 @@ namespace hpx::agas {
         // don't look at cache if gid is marked as non-cache-able
         HPX_ASSERT(naming::detail::store_in_cache(gid));
 
-        gva_cache_key const k(gid);
-
-        std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        if (gva_cache_key idbase_key; gva_cache_->get_entry(k, idbase_key, gva))
+        naming::gid_type idbase_key;
+        if (gva_cache_->get_entry(
+                naming::detail::get_stripped_gid(gid), idbase_key, gva))
         {
             std::uint64_t const id_msb =
                 naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
-            if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+            if (HPX_UNLIKELY(id_msb != idbase_key.get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
@@ -1819,7 +1808,7 @@ namespace hpx::agas {
                 return false;
             }
 
-            idbase = idbase_key.get_gid();
+            idbase = idbase_key;
             return true;
         }
 
@@ -1836,18 +1825,11 @@ namespace hpx::agas {
             return;
         }
 
-        // 26115: Failing to release lock 'this->gva_cache_mtx_'
-#if defined(HPX_MSVC)
-#pragma warning(push)
-#pragma warning(disable : 26115)
-#endif
         try
         {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
 
             if (&ec != &throws)
@@ -1858,9 +1840,6 @@ namespace hpx::agas {
             HPX_RETHROWS_IF(ec, e, "addressing_service::clear_cache");
         }
     }
-#if defined(HPX_MSVC)
-#pragma warning(pop)
-#endif
 
     void addressing_service::remove_cache_entry(
         naming::gid_type const& id, error_code& ec) const
@@ -1895,11 +1874,7 @@ namespace hpx::agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::unique_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
-                return gid == p.first.get_gid();
-            });
+            gva_cache_->erase(gid);
 
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1926,88 +1901,75 @@ namespace hpx::agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return gva_cache_->hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return gva_cache_->misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return gva_cache_->evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return gva_cache_->insertions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return gva_cache_->get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return gva_cache_->insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return gva_cache_->update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return gva_cache_->erase_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return gva_cache_->get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return gva_cache_->insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return gva_cache_->update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(
         bool reset) const
     {
-        std::shared_lock<hpx::shared_mutex> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return gva_cache_->erase_entry_time(reset);
     }
 
     void addressing_service::register_server_instances()
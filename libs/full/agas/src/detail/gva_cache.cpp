@@ -0,0 +1,1148 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx::agas::detail {
+
+    namespace {
+
+        // the number of consecutive hash table slots an entry may be stored
+        // in
+        constexpr std::size_t probe_length = 8;
+
+        // the number of (cache line aligned) sets of statistics counters,
+        // each worker thread updates its own set
+        constexpr std::size_t num_statistics = 64;
+
+        constexpr std::size_t next_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        std::size_t default_num_shards() noexcept
+        {
+            std::size_t const concurrency =
+                (std::max)(std::thread::hardware_concurrency(), 1u);
+            return (std::min)(next_power_of_two(2 * concurrency),
+                static_cast<std::size_t>(256));
+        }
+
+        constexpr std::uint64_t mix(std::uint64_t h) noexcept
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        constexpr std::uint64_t hash_gid(
+            std::uint64_t msb, std::uint64_t lsb) noexcept
+        {
+            return mix(lsb ^ mix(msb));
+        }
+
+        std::int64_t now() noexcept
+        {
+            std::chrono::nanoseconds const ns =
+                std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<std::int64_t>(ns.count());
+        }
+
+        // Invoke f until it ran without a writer modifying the data protected
+        // by the given sequence counter concurrently.
+        template <typename F>
+        bool optimistic_read(std::atomic<std::uint64_t> const& sequence, F&& f)
+        {
+            for (std::size_t k = 0;; ++k)
+            {
+                std::uint64_t const seq =
+                    sequence.load(std::memory_order_acquire);
+                if ((seq & 1) == 0)
+                {
+                    bool const result = f();
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (sequence.load(std::memory_order_relaxed) == seq)
+                    {
+                        return result;
+                    }
+                }
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::agas::detail::gva_cache::optimistic_read");
+            }
+        }
+
+        // Marks the data protected by the given sequence counter as being
+        // modified, writers have to be serialized by other means.
+        class write_section
+        {
+        public:
+            explicit write_section(
+                std::atomic<std::uint64_t>& sequence) noexcept
+              : sequence_(sequence)
+              , seq_(sequence.load(std::memory_order_relaxed))
+            {
+                HPX_ASSERT((seq_ & 1) == 0);
+                sequence_.store(seq_ + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+
+            write_section(write_section const&) = delete;
+            write_section(write_section&&) = delete;
+            write_section& operator=(write_section const&) = delete;
+            write_section& operator=(write_section&&) = delete;
+
+            ~write_section()
+            {
+                sequence_.store(seq_ + 2, std::memory_order_release);
+            }
+
+        private:
+            std::atomic<std::uint64_t>& sequence_;
+            std::uint64_t const seq_;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A single cache entry, an empty entry has a key of zero. For entries
+    // stored for a single id last_lsb is equal to key_lsb.
+    struct gva_cache::entry
+    {
+        struct value
+        {
+            std::uint64_t key_lsb = 0;
+            std::uint64_t last_lsb = 0;
+            gva g;
+        };
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return key_msb.load(std::memory_order_relaxed) == 0 &&
+                key_lsb.load(std::memory_order_relaxed) == 0;
+        }
+
+        [[nodiscard]] bool matches(
+            std::uint64_t msb, std::uint64_t lsb) const noexcept
+        {
+            return key_lsb.load(std::memory_order_relaxed) == lsb &&
+                key_msb.load(std::memory_order_relaxed) == msb;
+        }
+
+        [[nodiscard]] value load() const noexcept
+        {
+            constexpr auto relaxed = std::memory_order_relaxed;
+            return value{key_lsb.load(relaxed), last_lsb.load(relaxed),
+                gva(naming::gid_type(
+                        prefix_msb.load(relaxed), prefix_lsb.load(relaxed)),
+                    static_cast<gva::component_type>(type.load(relaxed)),
+                    count.load(relaxed), lva.load(relaxed),
+                    offset.load(relaxed))};
+        }
+
+        void store(std::uint64_t msb, std::uint64_t lsb, std::uint64_t last,
+            gva const& g) noexcept
+        {
+            constexpr auto relaxed = std::memory_order_relaxed;
+            key_msb.store(msb, relaxed);
+            key_lsb.store(lsb, relaxed);
+            last_lsb.store(last, relaxed);
+            prefix_msb.store(g.prefix.get_msb(), relaxed);
+            prefix_lsb.store(g.prefix.get_lsb(), relaxed);
+            type.store(static_cast<std::uint64_t>(g.type), relaxed);
+            count.store(g.count, relaxed);
+            lva.store(reinterpret_cast<std::uint64_t>(g.lva()), relaxed);
+            offset.store(g.offset, relaxed);
+        }
+
+        void copy_from(entry const& rhs) noexcept
+        {
+            constexpr auto relaxed = std::memory_order_relaxed;
+            key_msb.store(rhs.key_msb.load(relaxed), relaxed);
+            key_lsb.store(rhs.key_lsb.load(relaxed), relaxed);
+            last_lsb.store(rhs.last_lsb.load(relaxed), relaxed);
+            prefix_msb.store(rhs.prefix_msb.load(relaxed), relaxed);
+            prefix_lsb.store(rhs.prefix_lsb.load(relaxed), relaxed);
+            type.store(rhs.type.load(relaxed), relaxed);
+            count.store(rhs.count.load(relaxed), relaxed);
+            lva.store(rhs.lva.load(relaxed), relaxed);
+            offset.store(rhs.offset.load(relaxed), relaxed);
+            referenced.store(rhs.referenced.load(relaxed), relaxed);
+        }
+
+        void clear() noexcept
+        {
+            key_msb.store(0, std::memory_order_relaxed);
+            key_lsb.store(0, std::memory_order_relaxed);
+            referenced.store(false, std::memory_order_relaxed);
+        }
+
+        // Mark the entry as recently used, this avoids writing to the cache
+        // line if the entry is already marked.
+        void touch() noexcept
+        {
+            if (!referenced.load(std::memory_order_relaxed))
+            {
+                referenced.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        std::atomic<std::uint64_t> key_msb{0};
+        std::atomic<std::uint64_t> key_lsb{0};
+        std::atomic<std::uint64_t> last_lsb{0};
+        std::atomic<std::uint64_t> prefix_msb{0};
+        std::atomic<std::uint64_t> prefix_lsb{0};
+        std::atomic<std::uint64_t> type{0};
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> lva{0};
+        std::atomic<std::uint64_t> offset{0};
+        std::atomic<bool> referenced{false};
+    };
+
+    // The hash table of a shard, or the sorted table of ranges. The size of a
+    // table never changes, which guarantees that readers never access memory
+    // outside of the table even if they race with a writer.
+    struct gva_cache::table
+    {
+        table(std::size_t num_entries, std::size_t max_size)
+          : num_entries(num_entries)
+          , max_size(max_size)
+          , entries(new entry[num_entries])
+        {
+        }
+
+        [[nodiscard]] entry* find(std::uint64_t hash, std::uint64_t msb,
+            std::uint64_t lsb) const noexcept
+        {
+            std::size_t const start = static_cast<std::size_t>(hash >> 32);
+            for (std::size_t i = 0; i != probe_length; ++i)
+            {
+                entry& e = entries[(start + i) & (num_entries - 1)];
+                if (e.matches(msb, lsb))
+                {
+                    return &e;
+                }
+            }
+            return nullptr;
+        }
+
+        std::size_t const num_entries;
+        std::size_t const max_size;
+        std::unique_ptr<entry[]> entries;
+    };
+
+    struct gva_cache::shard
+    {
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<table*> entries{nullptr};
+
+        // the members below are modified only while holding mtx
+        std::atomic<std::size_t> size{0};
+        std::size_t hand = 0;
+        hpx::spinlock mtx;
+    };
+
+    // The entries are sorted by their first id, ranges never overlap.
+    struct gva_cache::range_table
+    {
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<table*> entries{nullptr};
+
+        // the members below are modified only while holding mtx
+        std::atomic<std::size_t> size{0};
+        std::size_t hand = 0;
+        hpx::spinlock mtx;
+    };
+
+    struct gva_cache::statistics
+    {
+        std::atomic<std::int64_t> hits{0};
+        std::atomic<std::int64_t> misses{0};
+        std::atomic<std::int64_t> evictions{0};
+        std::atomic<std::int64_t> insertions{0};
+
+        std::atomic<std::int64_t> counts[4] = {};
+        std::atomic<std::int64_t> times[4] = {};
+    };
+
+    // the shards and the statistics are accessed concurrently, keep them on
+    // separate cache lines
+    struct gva_cache::padded_shard : util::cache_aligned_data<shard>
+    {
+    };
+
+    struct gva_cache::padded_statistics : util::cache_aligned_data<statistics>
+    {
+    };
+
+    // Helper class to update timings and counts on function exit
+    class gva_cache::update_on_exit
+    {
+    public:
+        update_on_exit(
+            statistics& stats, method m, std::int64_t count = 1) noexcept
+          : stats_(stats)
+          , index_(static_cast<std::size_t>(m))
+          , count_(count)
+          , started_at_(now())
+        {
+        }
+
+        update_on_exit(update_on_exit const&) = delete;
+        update_on_exit(update_on_exit&&) = delete;
+        update_on_exit& operator=(update_on_exit const&) = delete;
+        update_on_exit& operator=(update_on_exit&&) = delete;
+
+        ~update_on_exit()
+        {
+            stats_.times[index_].fetch_add(
+                now() - started_at_, std::memory_order_relaxed);
+            stats_.counts[index_].fetch_add(count_, std::memory_order_relaxed);
+        }
+
+    private:
+        statistics& stats_;
+        std::size_t const index_;
+        std::int64_t const count_;
+        std::int64_t const started_at_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::gva_cache(std::size_t num_shards)
+      : num_shards_(next_power_of_two(
+            num_shards != 0 ? num_shards : default_num_shards()))
+      , capacity_(0)
+      , shards_(new padded_shard[num_shards_])
+      , ranges_(new range_table)
+      , statistics_(new padded_statistics[num_statistics])
+    {
+    }
+
+    gva_cache::~gva_cache() = default;
+
+    gva_cache::shard& gva_cache::get_shard(std::uint64_t hash) const noexcept
+    {
+        return shards_[static_cast<std::size_t>(hash) & (num_shards_ - 1)]
+            .data_;
+    }
+
+    gva_cache::statistics& gva_cache::get_statistics() const noexcept
+    {
+        return statistics_[hpx::get_worker_thread_num() & (num_statistics - 1)]
+            .data_;
+    }
+
+    void gva_cache::reserve(std::size_t capacity)
+    {
+        // store at least one entry per shard
+        capacity = (std::max)(capacity, num_shards_);
+
+        std::size_t const max_size = (capacity + num_shards_ - 1) / num_shards_;
+
+        // keep the load factor of the hash tables at or below 50%
+        std::size_t const num_entries =
+            (std::max)(next_power_of_two(2 * max_size), probe_length);
+
+        std::lock_guard<hpx::spinlock> l(tables_mtx_);
+
+        capacity_.store(capacity, std::memory_order_relaxed);
+
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            shard& s = shards_[i].data_;
+            auto t = std::make_unique<table>(num_entries, max_size);
+
+            std::lock_guard<hpx::spinlock> ls(s.mtx);
+            write_section w(s.sequence);
+
+            // move over as many of the existing entries as possible
+            std::size_t size = 0;
+            if (table const* old = s.entries.load(std::memory_order_relaxed))
+            {
+                for (std::size_t j = 0;
+                    j != old->num_entries && size != max_size; ++j)
+                {
+                    entry const& e = old->entries[j];
+                    if (e.empty())
+                    {
+                        continue;
+                    }
+
+                    std::uint64_t const hash =
+                        hash_gid(e.key_msb.load(std::memory_order_relaxed),
+                            e.key_lsb.load(std::memory_order_relaxed));
+                    std::size_t const start =
+                        static_cast<std::size_t>(hash >> 32);
+
+                    for (std::size_t k = 0; k != probe_length; ++k)
+                    {
+                        entry& target =
+                            t->entries[(start + k) & (num_entries - 1)];
+                        if (target.empty())
+                        {
+                            target.copy_from(e);
+                            ++size;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            s.entries.store(t.get(), std::memory_order_release);
+            s.size.store(size, std::memory_order_relaxed);
+            s.hand = 0;
+
+            tables_.push_back(HPX_MOVE(t));
+        }
+
+        // the table of ranges may hold a fraction of the overall entries
+        std::size_t const max_ranges =
+            (std::max)(capacity / 16, static_cast<std::size_t>(16));
+        auto t = std::make_unique<table>(max_ranges, max_ranges);
+
+        range_table& r = *ranges_;
+        std::lock_guard<hpx::spinlock> lr(r.mtx);
+        write_section w(r.sequence);
+
+        std::size_t size = 0;
+        if (table const* old = r.entries.load(std::memory_order_relaxed))
+        {
+            size = (std::min)(r.size.load(std::memory_order_relaxed),
+                max_ranges);
+            for (std::size_t j = 0; j != size; ++j)
+            {
+                t->entries[j].copy_from(old->entries[j]);
+            }
+        }
+
+        r.entries.store(t.get(), std::memory_order_release);
+        r.size.store(size, std::memory_order_relaxed);
+        r.hand = 0;
+
+        tables_.push_back(HPX_MOVE(t));
+    }
+
+    std::size_t gva_cache::capacity() const noexcept
+    {
+        return capacity_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t gva_cache::size() const noexcept
+    {
+        std::size_t result = ranges_->size.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            result += shards_[i].data_.size.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::size_t gva_cache::num_shards() const noexcept
+    {
+        return num_shards_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::lookup(
+        naming::gid_type const& gid, naming::gid_type& idbase, gva& g) const
+    {
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const hash = hash_gid(msb, lsb);
+
+        shard const& s = get_shard(hash);
+
+        entry* found = nullptr;
+        entry::value v;
+        bool const result = optimistic_read(s.sequence, [&]() {
+            table const* t = s.entries.load(std::memory_order_acquire);
+            found = t != nullptr ? t->find(hash, msb, lsb) : nullptr;
+            if (found == nullptr)
+            {
+                return false;
+            }
+            v = found->load();
+            return true;
+        });
+
+        if (result)
+        {
+            // tables are never deallocated while the cache is alive
+            found->touch();
+
+            idbase = gid;
+            g = v.g;
+        }
+        return result;
+    }
+
+    // Find the range covering the given id in the first size entries of the
+    // given table of ranges.
+    gva_cache::entry* gva_cache::find_range(table const& t, std::size_t size,
+        std::uint64_t msb, std::uint64_t lsb) noexcept
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        // find the last range starting at or before the given id
+        std::size_t lo = 0;
+        std::size_t hi = size;
+        while (lo < hi)
+        {
+            std::size_t const mid = lo + (hi - lo) / 2;
+            entry const& e = t.entries[mid];
+
+            std::uint64_t const e_msb = e.key_msb.load(relaxed);
+            if (e_msb < msb ||
+                (e_msb == msb && e.key_lsb.load(relaxed) <= lsb))
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        if (lo == 0)
+        {
+            return nullptr;
+        }
+
+        entry& e = t.entries[lo - 1];
+        if (e.key_msb.load(relaxed) != msb || e.last_lsb.load(relaxed) < lsb)
+        {
+            return nullptr;
+        }
+        return &e;
+    }
+
+    bool gva_cache::lookup_range(
+        naming::gid_type const& gid, naming::gid_type& idbase, gva& g) const
+    {
+        range_table const& r = *ranges_;
+
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+
+        entry* found = nullptr;
+        entry::value v;
+        bool const result = optimistic_read(r.sequence, [&]() {
+            table const* t = r.entries.load(std::memory_order_acquire);
+            if (t == nullptr)
+            {
+                return false;
+            }
+
+            found = find_range(*t,
+                (std::min)(
+                    r.size.load(std::memory_order_relaxed), t->num_entries),
+                msb, lsb);
+            if (found == nullptr)
+            {
+                return false;
+            }
+
+            v = found->load();
+            return true;
+        });
+
+        if (result)
+        {
+            found->touch();
+
+            idbase = naming::gid_type(msb, v.key_lsb);
+            g = v.g;
+        }
+        return result;
+    }
+
+    bool gva_cache::get_entry(
+        naming::gid_type const& gid, naming::gid_type& idbase, gva& g) const
+    {
+        statistics& stats = get_statistics();
+        update_on_exit update(stats, method::get_entry);
+
+        if (lookup(gid, idbase, g) ||
+            (ranges_->size.load(std::memory_order_relaxed) != 0 &&
+                lookup_range(gid, idbase, g)))
+        {
+            stats.hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        stats.misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::size_t gva_cache::get_entries(naming::gid_type const* gids,
+        std::size_t count, naming::gid_type* idbases, gva* gvas,
+        hpx::detail::dynamic_bitset<>& found) const
+    {
+        statistics& stats = get_statistics();
+        update_on_exit update(
+            stats, method::get_entry, static_cast<std::int64_t>(count));
+
+        found.resize(count);
+        found.reset();
+
+        bool const has_ranges =
+            ranges_->size.load(std::memory_order_relaxed) != 0;
+
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (lookup(gids[i], idbases[i], gvas[i]) ||
+                (has_ranges && lookup_range(gids[i], idbases[i], gvas[i])))
+            {
+                found.set(i);
+                ++hits;
+            }
+        }
+
+        stats.hits.fetch_add(
+            static_cast<std::int64_t>(hits), std::memory_order_relaxed);
+        stats.misses.fetch_add(static_cast<std::int64_t>(count - hits),
+            std::memory_order_relaxed);
+
+        return hits;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void gva_cache::insert_locked(shard& s, table& t, std::uint64_t hash,
+        std::uint64_t msb, std::uint64_t lsb, gva const& g,
+        statistics& stats) noexcept
+    {
+        // make room if the shard is full, CLOCK: skip (and reset) the entries
+        // that were referenced since the hand passed them the last time
+        if (s.size.load(std::memory_order_relaxed) >= t.max_size)
+        {
+            std::size_t const mask = t.num_entries - 1;
+            for (std::size_t n = 0; n != 2 * t.num_entries; ++n)
+            {
+                entry& e = t.entries[s.hand];
+                s.hand = (s.hand + 1) & mask;
+
+                if (e.empty() ||
+                    (n < t.num_entries &&
+                        e.referenced.exchange(
+                            false, std::memory_order_relaxed)))
+                {
+                    continue;
+                }
+
+                e.clear();
+                s.size.fetch_sub(1, std::memory_order_relaxed);
+                stats.evictions.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+        }
+
+        std::size_t const start = static_cast<std::size_t>(hash >> 32);
+        std::size_t const mask = t.num_entries - 1;
+
+        entry* target = nullptr;
+        for (std::size_t i = 0; i != probe_length; ++i)
+        {
+            entry& e = t.entries[(start + i) & mask];
+            if (e.empty())
+            {
+                target = &e;
+                break;
+            }
+        }
+
+        if (target == nullptr)
+        {
+            // all slots the entry may be stored in are occupied, evict one of
+            // them (preferably one that was not referenced recently)
+            for (std::size_t i = 0; i != probe_length; ++i)
+            {
+                entry& e = t.entries[(start + i) & mask];
+                if (!e.referenced.exchange(false, std::memory_order_relaxed))
+                {
+                    target = &e;
+                    break;
+                }
+            }
+
+            if (target == nullptr)
+            {
+                target = &t.entries[start & mask];
+            }
+
+            target->clear();
+            s.size.fetch_sub(1, std::memory_order_relaxed);
+            stats.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        target->store(msb, lsb, lsb, g);
+        s.size.fetch_add(1, std::memory_order_relaxed);
+        stats.insertions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool gva_cache::update(
+        naming::gid_type const& gid, std::uint64_t count, gva const& g)
+    {
+        naming::gid_type idbase;
+        gva old;
+        return update(gid, count, g, idbase, old);
+    }
+
+    bool gva_cache::update(naming::gid_type const& gid, std::uint64_t count,
+        gva const& g, naming::gid_type& idbase, gva& old)
+    {
+        HPX_ASSERT(count != 0);
+
+        statistics& stats = get_statistics();
+        update_on_exit update(stats, method::update_entry);
+
+        if (count != 1)
+        {
+            return update_range(gid, count, g, idbase, old);
+        }
+
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const hash = hash_gid(msb, lsb);
+
+        shard& s = get_shard(hash);
+
+        std::lock_guard<hpx::spinlock> l(s.mtx);
+
+        table* t = s.entries.load(std::memory_order_relaxed);
+        if (t == nullptr)
+        {
+            return true;    // the cache has no capacity
+        }
+
+        // An entry for a range of ids covering the given one collides. The
+        // table of ranges stays locked until the entry has been inserted,
+        // otherwise a colliding range could be added concurrently. The lock
+        // of the table of ranges is never acquired before the lock of a
+        // shard.
+        range_table& r = *ranges_;
+        std::lock_guard<hpx::spinlock> lr(r.mtx);
+
+        if (table const* rt = r.entries.load(std::memory_order_relaxed);
+            rt != nullptr)
+        {
+            if (entry const* e = find_range(
+                    *rt, r.size.load(std::memory_order_relaxed), msb, lsb);
+                e != nullptr)
+            {
+                entry::value const v = e->load();
+                idbase = naming::gid_type(msb, v.key_lsb);
+                old = v.g;
+                return false;
+            }
+        }
+
+        write_section w(s.sequence);
+
+        if (entry* e = t->find(hash, msb, lsb); e != nullptr)
+        {
+            e->store(msb, lsb, lsb, g);
+            e->touch();
+            stats.hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        stats.misses.fetch_add(1, std::memory_order_relaxed);
+        insert_locked(s, *t, hash, msb, lsb, g, stats);
+        return true;
+    }
+
+    bool gva_cache::update_range(naming::gid_type const& gid,
+        std::uint64_t count, gva const& g, naming::gid_type& idbase, gva& old)
+    {
+        statistics& stats = get_statistics();
+
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const last = lsb + (count - 1);
+        if (last < lsb)
+        {
+            return true;    // don't cache ranges crossing the msb boundary
+        }
+
+        if (!insert_range(msb, lsb, last, g, idbase, old, stats))
+        {
+            return false;
+        }
+
+        // Entries for single ids that were added before the range was
+        // installed would shadow it (the shards are consulted first). Single
+        // ids covered by the range can't be added anymore at this point.
+        erase_covered(msb, lsb, last);
+        return true;
+    }
+
+    bool gva_cache::insert_range(std::uint64_t msb, std::uint64_t lsb,
+        std::uint64_t last, gva const& g, naming::gid_type& idbase, gva& old,
+        statistics& stats)
+    {
+        range_table& r = *ranges_;
+
+        std::lock_guard<hpx::spinlock> l(r.mtx);
+
+        table* t = r.entries.load(std::memory_order_relaxed);
+        if (t == nullptr)
+        {
+            return true;    // the cache has no capacity
+        }
+
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        // find the first range that does not end before the given one
+        std::size_t size = r.size.load(relaxed);
+        auto const pos_it = std::partition_point(t->entries.get(),
+            t->entries.get() + size, [&](entry const& e) {
+                std::uint64_t const e_msb = e.key_msb.load(relaxed);
+                return e_msb < msb ||
+                    (e_msb == msb && e.last_lsb.load(relaxed) < lsb);
+            });
+        std::size_t pos =
+            static_cast<std::size_t>(pos_it - t->entries.get());
+
+        if (pos != size && pos_it->key_msb.load(relaxed) == msb &&
+            pos_it->key_lsb.load(relaxed) <= last)
+        {
+            // the ranges overlap, only an identical range may be updated
+            if (pos_it->key_lsb.load(relaxed) != lsb ||
+                pos_it->last_lsb.load(relaxed) != last)
+            {
+                entry::value const v = pos_it->load();
+                idbase = naming::gid_type(msb, v.key_lsb);
+                old = v.g;
+                return false;
+            }
+
+            write_section w(r.sequence);
+            pos_it->store(msb, lsb, last, g);
+            pos_it->touch();
+            stats.hits.fetch_add(1, relaxed);
+            return true;
+        }
+
+        stats.misses.fetch_add(1, relaxed);
+
+        write_section w(r.sequence);
+
+        if (size == t->max_size)
+        {
+            // evict one of the ranges (CLOCK), this preserves the order of
+            // the remaining entries
+            std::size_t victim = r.hand % size;
+            for (std::size_t n = 0; n != size; ++n)
+            {
+                std::size_t const i = (r.hand + n) % size;
+                if (!t->entries[i].referenced.exchange(false, relaxed))
+                {
+                    victim = i;
+                    break;
+                }
+            }
+            r.hand = victim + 1;
+
+            for (std::size_t i = victim; i + 1 < size; ++i)
+            {
+                t->entries[i].copy_from(t->entries[i + 1]);
+            }
+            t->entries[--size].clear();
+
+            if (victim < pos)
+            {
+                --pos;
+            }
+            stats.evictions.fetch_add(1, relaxed);
+        }
+
+        for (std::size_t i = size; i != pos; --i)
+        {
+            t->entries[i].copy_from(t->entries[i - 1]);
+        }
+
+        t->entries[pos].store(msb, lsb, last, g);
+        t->entries[pos].referenced.store(false, relaxed);
+
+        r.size.store(size + 1, relaxed);
+        stats.insertions.fetch_add(1, relaxed);
+        return true;
+    }
+
+    void gva_cache::erase_covered(
+        std::uint64_t msb, std::uint64_t lsb, std::uint64_t last)
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        // look up the ids one by one if that is cheaper than scanning all
+        // shards
+        if (last - lsb < capacity_.load(relaxed))
+        {
+            for (std::uint64_t id = lsb;; ++id)
+            {
+                std::uint64_t const hash = hash_gid(msb, id);
+
+                shard& s = get_shard(hash);
+                std::lock_guard<hpx::spinlock> l(s.mtx);
+
+                if (table* t = s.entries.load(relaxed); t != nullptr)
+                {
+                    if (entry* e = t->find(hash, msb, id); e != nullptr)
+                    {
+                        write_section w(s.sequence);
+                        e->clear();
+                        s.size.fetch_sub(1, relaxed);
+                    }
+                }
+
+                if (id == last)
+                {
+                    break;
+                }
+            }
+            return;
+        }
+
+        auto const covered = [&](entry const& e) {
+            std::uint64_t const e_lsb = e.key_lsb.load(relaxed);
+            return !e.empty() && e.key_msb.load(relaxed) == msb &&
+                e_lsb >= lsb && e_lsb <= last;
+        };
+
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            shard& s = shards_[i].data_;
+            std::lock_guard<hpx::spinlock> l(s.mtx);
+
+            table* t = s.entries.load(relaxed);
+            if (t == nullptr)
+            {
+                continue;
+            }
+
+            entry* const begin = t->entries.get();
+            entry* const end = begin + t->num_entries;
+
+            entry* it = std::find_if(begin, end, covered);
+            if (it == end)
+            {
+                continue;
+            }
+
+            write_section w(s.sequence);
+            for (/**/; it != end; ++it)
+            {
+                if (covered(*it))
+                {
+                    it->clear();
+                    s.size.fetch_sub(1, relaxed);
+                }
+            }
+        }
+    }
+
+    void gva_cache::erase(naming::gid_type const& gid)
+    {
+        statistics& stats = get_statistics();
+        update_on_exit update(stats, method::erase_entry);
+
+        std::uint64_t const msb = gid.get_msb();
+        std::uint64_t const lsb = gid.get_lsb();
+        std::uint64_t const hash = hash_gid(msb, lsb);
+
+        {
+            shard& s = get_shard(hash);
+            std::lock_guard<hpx::spinlock> l(s.mtx);
+
+            if (table* t = s.entries.load(std::memory_order_relaxed);
+                t != nullptr)
+            {
+                if (entry* e = t->find(hash, msb, lsb); e != nullptr)
+                {
+                    write_section w(s.sequence);
+                    e->clear();
+                    s.size.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        range_table& r = *ranges_;
+        if (r.size.load(std::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        std::lock_guard<hpx::spinlock> l(r.mtx);
+
+        table* t = r.entries.load(std::memory_order_relaxed);
+        std::size_t const size = r.size.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; t != nullptr && i != size; ++i)
+        {
+            if (t->entries[i].matches(msb, lsb))
+            {
+                write_section w(r.sequence);
+                for (std::size_t j = i; j + 1 < size; ++j)
+                {
+                    t->entries[j].copy_from(t->entries[j + 1]);
+                }
+                t->entries[size - 1].clear();
+                r.size.store(size - 1, std::memory_order_relaxed);
+                break;
+            }
+        }
+    }
+
+    void gva_cache::clear()
+    {
+        statistics& stats = get_statistics();
+        update_on_exit update(stats, method::erase_entry);
+
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            shard& s = shards_[i].data_;
+            std::lock_guard<hpx::spinlock> l(s.mtx);
+
+            if (table* t = s.entries.load(std::memory_order_relaxed);
+                t != nullptr)
+            {
+                write_section w(s.sequence);
+                for (std::size_t j = 0; j != t->num_entries; ++j)
+                {
+                    t->entries[j].clear();
+                }
+                s.size.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        range_table& r = *ranges_;
+        std::lock_guard<hpx::spinlock> l(r.mtx);
+
+        if (table* t = r.entries.load(std::memory_order_relaxed); t != nullptr)
+        {
+            write_section w(r.sequence);
+            for (std::size_t j = 0; j != t->num_entries; ++j)
+            {
+                t->entries[j].clear();
+            }
+            r.size.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t gva_cache::accumulate(
+        std::atomic<std::int64_t> statistics::*value,
+        bool reset) const noexcept
+    {
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_statistics; ++i)
+        {
+            auto& counter = statistics_[i].data_.*value;
+            result += reset ? counter.exchange(0, std::memory_order_relaxed) :
+                              counter.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::int64_t gva_cache::accumulate(
+        method m, bool time, bool reset) const noexcept
+    {
+        std::size_t const index = static_cast<std::size_t>(m);
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != num_statistics; ++i)
+        {
+            statistics& stats = statistics_[i].data_;
+            auto& counter = time ? stats.times[index] : stats.counts[index];
+            result += reset ? counter.exchange(0, std::memory_order_relaxed) :
+                              counter.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    std::int64_t gva_cache::hits(bool reset) const noexcept
+    {
+        return accumulate(&statistics::hits, reset);
+    }
+
+    std::int64_t gva_cache::misses(bool reset) const noexcept
+    {
+        return accumulate(&statistics::misses, reset);
+    }
+
+    std::int64_t gva_cache::evictions(bool reset) const noexcept
+    {
+        return accumulate(&statistics::evictions, reset);
+    }
+
+    std::int64_t gva_cache::insertions(bool reset) const noexcept
+    {
+        return accumulate(&statistics::insertions, reset);
+    }
+
+    std::int64_t gva_cache::get_entry_count(bool reset) const noexcept
+    {
+        return accumulate(method::get_entry, false, reset);
+    }
+
+    std::int64_t gva_cache::insert_entry_count(bool reset) const noexcept
+    {
+        return accumulate(method::insert_entry, false, reset);
+    }
+
+    std::int64_t gva_cache::update_entry_count(bool reset) const noexcept
+    {
+        return accumulate(method::update_entry, false, reset);
+    }
+
+    std::int64_t gva_cache::erase_entry_count(bool reset) const noexcept
+    {
+        return accumulate(method::erase_entry, false, reset);
+    }
+
+    std::int64_t gva_cache::get_entry_time(bool reset) const noexcept
+    {
+        return accumulate(method::get_entry, true, reset);
+    }
+
+    std::int64_t gva_cache::insert_entry_time(bool reset) const noexcept
+    {
+        return accumulate(method::insert_entry, true, reset);
+    }
+
+    std::int64_t gva_cache::update_entry_time(bool reset) const noexcept
+    {
+        return accumulate(method::update_entry, true, reset);
+    }
+
+    std::int64_t gva_cache::erase_entry_time(bool reset) const noexcept
+    {
+        return accumulate(method::erase_entry, true, reset);
+    }
+}    // namespace hpx::agas::detail
@@ -0,0 +1,472 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/datastructures/detail/dynamic_bitset.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::detail::gva_cache;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::uint64_t test_msb = 0x0000000100000001ULL;
+constexpr std::uint64_t test_prefix_msb = 0x0000000200000000ULL;
+
+gid_type make_gid(std::uint64_t lsb)
+{
+    return gid_type(test_msb, lsb);
+}
+
+// the gva stored for the given id, this allows to verify that entries are
+// returned for the correct id and are never mixed up
+gva make_gva(std::uint64_t lsb, std::uint64_t count = 1)
+{
+    return gva(gid_type(test_prefix_msb, std::uint64_t(0)), 42, count,
+        static_cast<std::uint64_t>(0x1000 + 16 * lsb), 16);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_update_get()
+{
+    gva_cache cache(4);
+    HPX_TEST_EQ(cache.num_shards(), std::size_t(4));
+
+    // the cache can't hold any entries before reserve was called
+    HPX_TEST(cache.update(make_gid(1), 1, make_gva(1)));
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+
+    cache.reserve(1024);
+    HPX_TEST_EQ(cache.capacity(), std::size_t(1024));
+
+    for (std::uint64_t i = 1; i <= 100; ++i)
+    {
+        HPX_TEST(cache.update(make_gid(i), 1, make_gva(i)));
+    }
+    HPX_TEST_EQ(cache.size(), std::size_t(100));
+    HPX_TEST_EQ(cache.insertions(true), std::int64_t(100));
+
+    HPX_UNUSED(cache.hits(true));
+    HPX_UNUSED(cache.misses(true));
+
+    for (std::uint64_t i = 1; i <= 100; ++i)
+    {
+        gid_type idbase;
+        gva g;
+        HPX_TEST(cache.get_entry(make_gid(i), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(i));
+        HPX_TEST(g == make_gva(i));
+    }
+
+    gid_type idbase;
+    gva g;
+    HPX_TEST(!cache.get_entry(make_gid(1000), idbase, g));
+
+    HPX_TEST_EQ(cache.hits(true), std::int64_t(100));
+    HPX_TEST_EQ(cache.misses(true), std::int64_t(1));
+
+    // updating an existing entry replaces the stored gva
+    HPX_TEST(cache.update(make_gid(7), 1, make_gva(1007)));
+    HPX_TEST(cache.get_entry(make_gid(7), idbase, g));
+    HPX_TEST(g == make_gva(1007));
+    HPX_TEST_EQ(cache.size(), std::size_t(100));
+    HPX_TEST_EQ(cache.insertions(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_collisions()
+{
+    gva_cache cache(4);
+    cache.reserve(1024);
+
+    // a range of ten ids
+    HPX_TEST(cache.update(make_gid(100), 10, make_gva(100, 10)));
+
+    gid_type idbase;
+    gva g;
+    HPX_TEST(cache.get_entry(make_gid(105), idbase, g));
+    HPX_TEST_EQ(idbase, make_gid(100));
+    HPX_TEST(g == make_gva(100, 10));
+    HPX_TEST(!cache.get_entry(make_gid(110), idbase, g));
+    HPX_TEST(!cache.get_entry(make_gid(99), idbase, g));
+
+    // single ids covered by the range collide, the colliding range is
+    // reported
+    gid_type old_idbase;
+    gva old;
+    HPX_TEST(!cache.update(make_gid(100), 1, make_gva(100), old_idbase, old));
+    HPX_TEST_EQ(old_idbase, make_gid(100));
+    HPX_TEST(old == make_gva(100, 10));
+
+    HPX_TEST(!cache.update(make_gid(109), 1, make_gva(109), old_idbase, old));
+    HPX_TEST_EQ(old_idbase, make_gid(100));
+
+    // overlapping ranges collide
+    HPX_TEST(
+        !cache.update(make_gid(105), 10, make_gva(105, 10), old_idbase, old));
+    HPX_TEST_EQ(old_idbase, make_gid(100));
+    HPX_TEST(old == make_gva(100, 10));
+
+    HPX_TEST(
+        !cache.update(make_gid(95), 10, make_gva(95, 10), old_idbase, old));
+    HPX_TEST_EQ(old_idbase, make_gid(100));
+
+    HPX_TEST(!cache.update(make_gid(100), 5, make_gva(100, 5)));
+
+    // the identical range may be updated
+    HPX_TEST(cache.update(make_gid(100), 10, make_gva(200, 10)));
+    HPX_TEST(cache.get_entry(make_gid(101), idbase, g));
+    HPX_TEST(g == make_gva(200, 10));
+
+    // adjacent ranges and single ids outside of the range don't collide
+    HPX_TEST(cache.update(make_gid(110), 5, make_gva(110, 5)));
+    HPX_TEST(cache.update(make_gid(90), 10, make_gva(90, 10)));
+    HPX_TEST(cache.update(make_gid(115), 1, make_gva(115)));
+    HPX_TEST(cache.update(make_gid(89), 1, make_gva(89)));
+
+    HPX_TEST(cache.get_entry(make_gid(112), idbase, g));
+    HPX_TEST_EQ(idbase, make_gid(110));
+    HPX_TEST(cache.get_entry(make_gid(99), idbase, g));
+    HPX_TEST_EQ(idbase, make_gid(90));
+    HPX_TEST(cache.get_entry(make_gid(115), idbase, g));
+    HPX_TEST_EQ(idbase, make_gid(115));
+    HPX_TEST_EQ(cache.size(), std::size_t(5));
+
+    // ranges with a different msb never collide
+    HPX_TEST(cache.update(gid_type(test_msb + 1, 105), 1, make_gva(105)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_range_replaces_single_ids()
+{
+    gid_type idbase;
+    gva g;
+
+    // few ids, looked up one by one
+    {
+        gva_cache cache(4);
+        cache.reserve(1024);
+
+        HPX_TEST(cache.update(make_gid(203), 1, make_gva(203)));
+        HPX_TEST(cache.update(make_gid(209), 1, make_gva(209)));
+        HPX_TEST(cache.update(make_gid(210), 1, make_gva(210)));
+
+        // installing the range removes the single ids it covers
+        HPX_TEST(cache.update(make_gid(200), 10, make_gva(200, 10)));
+        HPX_TEST_EQ(cache.size(), std::size_t(2));
+
+        HPX_TEST(cache.get_entry(make_gid(203), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(200));
+        HPX_TEST(g == make_gva(200, 10));
+        HPX_TEST(cache.get_entry(make_gid(209), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(200));
+
+        HPX_TEST(cache.get_entry(make_gid(210), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(210));
+        HPX_TEST(g == make_gva(210));
+    }
+
+    // more ids than the cache can hold, all shards are scanned
+    {
+        gva_cache cache(4);
+        cache.reserve(64);
+
+        HPX_TEST(cache.update(make_gid(5), 1, make_gva(5)));
+        HPX_TEST(cache.update(make_gid(1000), 1, make_gva(1000)));
+        HPX_TEST(cache.update(make_gid(5000), 1, make_gva(5000)));
+
+        HPX_TEST(cache.update(make_gid(1), 1000, make_gva(1, 1000)));
+        HPX_TEST_EQ(cache.size(), std::size_t(2));
+
+        HPX_TEST(cache.get_entry(make_gid(5), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(1));
+        HPX_TEST(cache.get_entry(make_gid(1000), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(1));
+        HPX_TEST(cache.get_entry(make_gid(5000), idbase, g));
+        HPX_TEST_EQ(idbase, make_gid(5000));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eviction()
+{
+    // a single shard holding 64 entries
+    gva_cache cache(1);
+    cache.reserve(64);
+    HPX_TEST_EQ(cache.capacity(), std::size_t(64));
+
+    for (std::uint64_t i = 1; i <= 64; ++i)
+    {
+        HPX_TEST(cache.update(make_gid(i), 1, make_gva(i)));
+    }
+    HPX_TEST_EQ(cache.size(), std::size_t(64));
+    HPX_TEST_EQ(cache.evictions(false), std::int64_t(0));
+
+    // reference every other entry, those survive the next evictions
+    gid_type idbase;
+    gva g;
+    for (std::uint64_t i = 2; i <= 64; i += 2)
+    {
+        HPX_TEST(cache.get_entry(make_gid(i), idbase, g));
+    }
+
+    for (std::uint64_t i = 65; i <= 80; ++i)
+    {
+        HPX_TEST(cache.update(make_gid(i), 1, make_gva(i)));
+
+        // the new entry is always stored
+        HPX_TEST(cache.get_entry(make_gid(i), idbase, g));
+        HPX_TEST(g == make_gva(i));
+        HPX_TEST_LTE(cache.size(), std::size_t(64));
+    }
+
+    // every insertion into the full cache evicts at least one entry
+    std::int64_t const evictions = cache.evictions(true);
+    HPX_TEST_LTE(std::int64_t(16), evictions);
+    HPX_TEST_EQ(cache.size() + static_cast<std::size_t>(evictions),
+        std::size_t(80));
+
+    std::size_t referenced_found = 0;
+    std::size_t unreferenced_found = 0;
+    for (std::uint64_t i = 1; i <= 64; ++i)
+    {
+        if (cache.get_entry(make_gid(i), idbase, g))
+        {
+            HPX_TEST(g == make_gva(i));
+            ++(i % 2 == 0 ? referenced_found : unreferenced_found);
+        }
+    }
+
+    // the entries that were not referenced are evicted first
+    HPX_TEST_LT(unreferenced_found, referenced_found);
+    HPX_TEST_LTE(std::size_t(32) - referenced_found,
+        static_cast<std::size_t>(evictions) - 16);
+
+    // ranges are evicted if the table of ranges is full
+    gva_cache ranges(1);
+    ranges.reserve(64);
+    for (std::uint64_t i = 0; i != 17; ++i)
+    {
+        HPX_TEST(ranges.update(make_gid(100 * i), 10, make_gva(100 * i, 10)));
+    }
+    HPX_TEST_EQ(ranges.size(), std::size_t(16));
+    HPX_TEST_EQ(ranges.evictions(false), std::int64_t(1));
+    HPX_TEST(ranges.get_entry(make_gid(1605), idbase, g));
+    HPX_TEST_EQ(idbase, make_gid(1600));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_erase_clear()
+{
+    gva_cache cache(4);
+    cache.reserve(1024);
+
+    for (std::uint64_t i = 1; i <= 10; ++i)
+    {
+        HPX_TEST(cache.update(make_gid(i), 1, make_gva(i)));
+    }
+    HPX_TEST(cache.update(make_gid(100), 10, make_gva(100, 10)));
+    HPX_TEST_EQ(cache.size(), std::size_t(11));
+
+    gid_type idbase;
+    gva g;
+
+    cache.erase(make_gid(5));
+    HPX_TEST(!cache.get_entry(make_gid(5), idbase, g));
+    HPX_TEST(cache.get_entry(make_gid(6), idbase, g));
+    HPX_TEST_EQ(cache.size(), std::size_t(10));
+
+    // erasing an id which is not in the cache does nothing
+    cache.erase(make_gid(5));
+    cache.erase(make_gid(1000));
+    HPX_TEST_EQ(cache.size(), std::size_t(10));
+
+    // ranges are erased using their first id
+    cache.erase(make_gid(103));
+    HPX_TEST(cache.get_entry(make_gid(103), idbase, g));
+    cache.erase(make_gid(100));
+    HPX_TEST(!cache.get_entry(make_gid(103), idbase, g));
+    HPX_TEST_EQ(cache.size(), std::size_t(9));
+
+    // the erased range doesn't collide anymore
+    HPX_TEST(cache.update(make_gid(103), 1, make_gva(103)));
+
+    cache.clear();
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+    for (std::uint64_t i = 1; i <= 10; ++i)
+    {
+        HPX_TEST(!cache.get_entry(make_gid(i), idbase, g));
+    }
+    HPX_TEST(!cache.get_entry(make_gid(103), idbase, g));
+
+    // the cache can be used after being cleared
+    HPX_TEST(cache.update(make_gid(1), 1, make_gva(1)));
+    HPX_TEST(cache.get_entry(make_gid(1), idbase, g));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reserve_concurrent_readers()
+{
+    constexpr std::uint64_t num_ids = 256;
+
+    gva_cache cache(4);
+    cache.reserve(1024);
+
+    for (std::uint64_t i = 1; i <= num_ids; ++i)
+    {
+        HPX_TEST(cache.update(make_gid(i), 1, make_gva(i)));
+    }
+    HPX_TEST(cache.update(make_gid(1000), 100, make_gva(1000, 100)));
+
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> mismatches(0);
+    std::atomic<std::size_t> found(0);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t != 4; ++t)
+    {
+        readers.emplace_back([&]() {
+            std::size_t local_found = 0;
+            do
+            {
+                for (std::uint64_t i = 1; i <= num_ids; ++i)
+                {
+                    // entries may be dropped while shrinking the cache, but
+                    // found entries have to be consistent
+                    gid_type idbase;
+                    gva g;
+                    if (cache.get_entry(make_gid(i), idbase, g))
+                    {
+                        ++local_found;
+                        if (idbase != make_gid(i) || g != make_gva(i))
+                        {
+                            ++mismatches;
+                        }
+                    }
+
+                    if (cache.get_entry(make_gid(1000 + i % 100), idbase, g))
+                    {
+                        if (idbase != make_gid(1000) ||
+                            g != make_gva(1000, 100))
+                        {
+                            ++mismatches;
+                        }
+                    }
+                }
+            } while (!done.load());
+            found += local_found;
+        });
+    }
+
+    for (int i = 0; i != 50; ++i)
+    {
+        cache.reserve(i % 2 == 0 ? 128 : 2048);
+        HPX_TEST_LTE(cache.size(), cache.capacity() + 16);
+    }
+    cache.reserve(4096);
+    done = true;
+
+    for (auto& t : readers)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(mismatches.load(), std::size_t(0));
+    HPX_TEST_LT(std::size_t(0), found.load());
+
+    // the entries that survived are still usable
+    for (std::uint64_t i = 1; i <= num_ids; ++i)
+    {
+        HPX_TEST(cache.update(make_gid(i), 1, make_gva(i)));
+
+        gid_type idbase;
+        gva g;
+        HPX_TEST(cache.get_entry(make_gid(i), idbase, g));
+        HPX_TEST(g == make_gva(i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_get_entries()
+{
+    gva_cache cache(4);
+    cache.reserve(1024);
+
+    for (std::uint64_t i = 1; i <= 10; ++i)
+    {
+        HPX_TEST(cache.update(make_gid(i), 1, make_gva(i)));
+    }
+    HPX_TEST(cache.update(make_gid(100), 10, make_gva(100, 10)));
+
+    std::vector<gid_type> const gids = {make_gid(3), make_gid(50),
+        make_gid(105), make_gid(10), make_gid(110), make_gid(1)};
+
+    std::vector<gid_type> idbases(gids.size());
+    std::vector<gva> gvas(gids.size());
+    hpx::detail::dynamic_bitset<> found;
+
+    HPX_UNUSED(cache.hits(true));
+    HPX_UNUSED(cache.misses(true));
+
+    std::size_t const hits = cache.get_entries(
+        gids.data(), gids.size(), idbases.data(), gvas.data(), found);
+
+    HPX_TEST_EQ(hits, std::size_t(4));
+    HPX_TEST_EQ(found.size(), gids.size());
+    HPX_TEST_EQ(found.count(), std::size_t(4));
+
+    HPX_TEST(found.test(0));
+    HPX_TEST_EQ(idbases[0], make_gid(3));
+    HPX_TEST(gvas[0] == make_gva(3));
+
+    HPX_TEST(!found.test(1));
+
+    HPX_TEST(found.test(2));
+    HPX_TEST_EQ(idbases[2], make_gid(100));
+    HPX_TEST(gvas[2] == make_gva(100, 10));
+
+    HPX_TEST(found.test(3));
+    HPX_TEST_EQ(idbases[3], make_gid(10));
+
+    HPX_TEST(!found.test(4));
+
+    HPX_TEST(found.test(5));
+    HPX_TEST(gvas[5] == make_gva(1));
+
+    HPX_TEST_EQ(cache.hits(false), std::int64_t(4));
+    HPX_TEST_EQ(cache.misses(false), std::int64_t(2));
+    HPX_TEST_EQ(cache.get_entry_count(false), std::int64_t(6));
+
+    // the bitset is reset for every invocation
+    cache.clear();
+    HPX_TEST_EQ(cache.get_entries(gids.data(), gids.size(), idbases.data(),
+                    gvas.data(), found),
+        std::size_t(0));
+    HPX_TEST(found.none());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_update_get();
+    test_collisions();
+    test_range_replaces_single_ids();
+    test_eviction();
+    test_erase_clear();
+    test_reserve_concurrent_readers();
+    test_get_entries();
+
+    return hpx::util::report_errors();
+}
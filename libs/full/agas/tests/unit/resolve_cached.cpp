@@ -0,0 +1,99 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the bulk version of addressing_service::resolve_cached returns
+// the same addresses as resolving the ids one by one.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/agas/addressing_service.hpp>
+#include <hpx/agas/agas_fwd.hpp>
+#include <hpx/datastructures/detail/dynamic_bitset.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_resolve_cached(hpx::id_type const& target)
+{
+    constexpr std::size_t num_objects = 16;
+
+    hpx::agas::addressing_service& agas = hpx::naming::get_agas_client();
+
+    std::vector<hpx::id_type> objects;
+    std::vector<hpx::naming::gid_type> gids;
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        objects.push_back(hpx::new_<test_server>(target).get());
+        gids.push_back(objects.back().get_gid());
+
+        // resolving the id remotely stores its address in the cache
+        HPX_TEST(agas.resolve_local(gids.back()));
+    }
+
+    // an id of the target locality that was never resolved
+    hpx::naming::gid_type const& last = gids.back();
+    gids.emplace_back(last.get_msb(), last.get_lsb() + 0x100000);
+
+    std::vector<hpx::naming::address> addrs(gids.size());
+    hpx::detail::dynamic_bitset<> locals;
+
+    // not all ids are in the cache
+    HPX_TEST(!agas.resolve_cached(
+        gids.data(), addrs.data(), gids.size(), locals));
+
+    HPX_TEST_EQ(locals.size(), gids.size());
+    HPX_TEST(!addrs.back());
+
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        HPX_TEST(addrs[i]);
+        HPX_TEST(!locals.test(i));
+
+        hpx::naming::address addr;
+        HPX_TEST(agas.resolve_cached(gids[i], addr));
+        HPX_TEST_EQ(addrs[i], addr);
+    }
+
+    hpx::naming::address addr;
+    HPX_TEST(!agas.resolve_cached(gids.back(), addr));
+
+    // all ids are in the cache
+    gids.pop_back();
+    addrs.assign(gids.size(), hpx::naming::address());
+    locals.clear();
+
+    HPX_TEST(
+        agas.resolve_cached(gids.data(), addrs.data(), gids.size(), locals));
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        HPX_TEST(addrs[i]);
+    }
+}
+
+int main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_resolve_cached(id);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
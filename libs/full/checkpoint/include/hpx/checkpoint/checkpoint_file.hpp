@@ -0,0 +1,188 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the save_checkpoint_file and restore_checkpoint_file
+/// functions. In contrast to save_checkpoint, which produces the byte stream
+/// in memory, save_checkpoint_file streams the serialized data into a file
+/// while the serialization is still in progress. Repeated checkpoints to the
+/// same file rewrite only the parts of the file that have changed.
+
+/// \file hpx/checkpoint/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        struct save_file_funct_obj
+        {
+            std::string filename;
+            checkpoint_file_options options;
+
+            template <typename... Ts>
+            checkpoint_file_info operator()(Ts&&... ts) const
+            {
+                checkpoint_file_writer writer(filename, options);
+                hpx::util::save_checkpoint_data(
+                    writer, HPX_FORWARD(Ts, ts)...);
+                return writer.commit();
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file
+    ///
+    /// \tparam T            Containers passed to save_checkpoint_file to be
+    ///                      serialized and written to the file.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint_file
+    ///                      to be serialized and written to the file.
+    ///
+    /// \param filename      The name of the file to write the checkpoint to.
+    ///
+    /// \param options       Controls the chunk size, whether only changed
+    ///                      chunks are rewritten, and whether the chunks are
+    ///                      written asynchronously.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// Save_checkpoint_file takes any number of objects which a user may wish
+    /// to store and writes them to the given file. Like save_checkpoint, this
+    /// function can also store a component by passing a component's client
+    /// instance or a shared_ptr to the component. If the file holds a
+    /// checkpoint written with the same chunk size before, only those chunks
+    /// of the serialized data are written whose content has changed. The file
+    /// holds a valid checkpoint only after the returned future has become
+    /// ready.
+    ///
+    /// \returns Save_checkpoint_file returns a future to the information
+    ///          about the written checkpoint.
+    template <typename T, typename... Ts>
+    hpx::future<checkpoint_file_info> save_checkpoint_file(std::string filename,
+        checkpoint_file_options const& options, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(
+            detail::save_file_funct_obj{HPX_MOVE(filename), options},
+            detail::prepare_client(HPX_FORWARD(T, t)),
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file - Default options
+    ///
+    /// \tparam T            Containers passed to save_checkpoint_file to be
+    ///                      serialized and written to the file.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint_file
+    ///                      to be serialized and written to the file.
+    ///
+    /// \tparam U            This parameter is used to make sure that T
+    ///                      is not a checkpoint_file_options. This forces the
+    ///                      compiler to choose the correct overload.
+    ///
+    /// \param filename      The name of the file to write the checkpoint to.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// \returns Save_checkpoint_file returns a future to the information
+    ///          about the written checkpoint.
+    template <typename T, typename... Ts,
+        typename U = std::enable_if_t<
+            !std::is_same_v<std::decay_t<T>, checkpoint_file_options>>>
+    hpx::future<checkpoint_file_info> save_checkpoint_file(
+        std::string filename, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(
+            detail::save_file_funct_obj{
+                HPX_MOVE(filename), checkpoint_file_options()},
+            detail::prepare_client(HPX_FORWARD(T, t)),
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file - Sync_policy overload
+    ///
+    /// \tparam T            Containers passed to save_checkpoint_file to be
+    ///                      serialized and written to the file.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint_file
+    ///                      to be serialized and written to the file.
+    ///
+    /// \param sync_p        hpx::launch::sync_policy
+    ///
+    /// \param filename      The name of the file to write the checkpoint to.
+    ///
+    /// \param options       Controls the chunk size, whether only changed
+    ///                      chunks are rewritten, and whether the chunks are
+    ///                      written asynchronously.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// \returns Save_checkpoint_file which is passed
+    ///          hpx::launch::sync_policy returns the information about the
+    ///          written checkpoint once the file is complete.
+    template <typename T, typename... Ts>
+    checkpoint_file_info save_checkpoint_file(
+        hpx::launch::sync_policy sync_p, std::string filename,
+        checkpoint_file_options const& options, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(sync_p,
+            detail::save_file_funct_obj{HPX_MOVE(filename), options},
+            detail::prepare_client(HPX_FORWARD(T, t)),
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...)
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_file
+    ///
+    /// Restore_checkpoint_file takes the name of a file written by
+    /// save_checkpoint_file and the containers which will be filled from the
+    /// byte stream (in the same order as they were passed to
+    /// save_checkpoint_file). The file is mapped into memory, its content is
+    /// read on demand while the containers are restored.
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore. Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// \param filename     The name of the file holding the checkpoint.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// \returns Restore_checkpoint_file returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint_file(std::string const& filename, T& t, Ts&... ts)
+    {
+        mapped_checkpoint_file const file(filename);
+        hpx::util::restore_checkpoint_data_func(
+            file, detail::restore_impl{}, t, ts...);
+    }
+}}    // namespace hpx::util
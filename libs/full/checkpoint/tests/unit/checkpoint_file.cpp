@@ -0,0 +1,99 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This example tests the functionality of save_checkpoint_file and
+// restore_checkpoint_file.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_file_info;
+using hpx::util::checkpoint_file_options;
+using hpx::util::restore_checkpoint_file;
+using hpx::util::save_checkpoint_file;
+
+int main()
+{
+    std::string const filename = "checkpoint_file_test.ckpt";
+    hpx::filesystem::remove(filename);
+    hpx::filesystem::remove(filename + ".1");
+
+    int integer = 10;
+    std::string str = "I am a string of characters";
+    std::vector<int> vec(50000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<int>(i);
+    }
+
+    //[check_file_test_1
+    hpx::future<checkpoint_file_info> f = save_checkpoint_file(
+        filename, integer, str, hpx::make_ready_future(vec));
+    checkpoint_file_info info = f.get();
+    //]
+
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(1));
+    HPX_TEST_EQ(info.chunks_written, info.num_chunks);
+
+    {
+        //[check_file_test_2
+        int integer2;
+        std::string str2;
+        hpx::future<std::vector<int>> vec2;
+
+        restore_checkpoint_file(filename, integer2, str2, vec2);
+        //]
+
+        HPX_TEST_EQ(integer, integer2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST(vec == vec2.get());
+    }
+
+    // a subsequent checkpoint writes only the chunks that have changed
+    checkpoint_file_options options;
+    options.chunk_size = 4096;
+
+    info = save_checkpoint_file(
+        hpx::launch::sync, filename, options, integer, str, vec);
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(2));
+    HPX_TEST_EQ(info.chunks_written, info.num_chunks);
+
+    // the checkpoint replaces the first one, which used a different chunk
+    // size
+    info = save_checkpoint_file(filename, options, integer, str, vec).get();
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(3));
+    HPX_TEST_EQ(info.chunks_written, info.num_chunks);
+
+    vec.back() = -1;
+    info = save_checkpoint_file(filename, options, integer, str, vec).get();
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(4));
+    HPX_TEST_EQ(info.chunks_written, static_cast<std::size_t>(1));
+
+    {
+        int integer2;
+        std::string str2;
+        std::vector<int> vec2;
+
+        restore_checkpoint_file(filename, integer2, str2, vec2);
+
+        HPX_TEST_EQ(integer, integer2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST(vec == vec2);
+    }
+
+    hpx::filesystem::remove(filename);
+    hpx::filesystem::remove(filename + ".1");
+
+    return hpx::util::report_errors();
+}
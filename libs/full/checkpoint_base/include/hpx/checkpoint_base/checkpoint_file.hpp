@@ -0,0 +1,338 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/checkpoint_base/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Options controlling how checkpoint data is written to a file.
+    struct checkpoint_file_options
+    {
+        /// The serialized data is split into chunks of this size (in bytes).
+        /// Every chunk is hashed and written as a whole.
+        std::size_t chunk_size = 1024 * 1024;
+
+        /// Rewrite only those chunks whose content differs from the checkpoint
+        /// that is being replaced (see checkpoint_file_writer). If this is
+        /// false, all chunks are written.
+        bool incremental = true;
+
+        /// Write the chunks on the I/O thread pool while the serialization of
+        /// the subsequent chunk continues (only if invoked on an HPX thread).
+        bool asynchronous_writes = true;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Information about a checkpoint written to a file.
+    struct checkpoint_file_info
+    {
+        /// The number of checkpoints that were written to the file so far
+        std::uint64_t generation = 0;
+
+        /// The number of bytes of serialized data
+        std::size_t size = 0;
+
+        /// The number of chunks the data was split into
+        std::size_t num_chunks = 0;
+
+        /// The number of chunks that had to be written, this is less than
+        /// num_chunks for incremental checkpoints if some of the chunks did
+        /// not change
+        std::size_t chunks_written = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// checkpoint_file_writer
+    ///
+    /// A container for serialization archives (see save_checkpoint_data) that
+    /// streams the serialized data into a file instead of holding it in
+    /// memory. Only two chunks of data are kept in memory at any time: one
+    /// that is being filled by the serialization and one that is being
+    /// written to the file (plus one for comparing unchanged chunks).
+    ///
+    /// Checkpoints are written alternately to the file with the given name
+    /// and to a second file with the suffix ".1" appended to the name. A new
+    /// checkpoint replaces the older of the two, thus the most recent
+    /// checkpoint stays valid until the new one was committed. The new
+    /// checkpoint becomes valid once \a commit was called and all of its
+    /// data has reached the storage device.
+    ///
+    /// If the replaced file holds a checkpoint written with the same chunk
+    /// size, incremental checkpoints rewrite only those chunks whose content
+    /// changed. The content hash is not collision resistant, a chunk with an
+    /// unchanged hash is compared with the data in the file before it is
+    /// skipped.
+    class HPX_EXPORT checkpoint_file_writer
+    {
+    public:
+        explicit checkpoint_file_writer(std::string filename,
+            checkpoint_file_options const& options = checkpoint_file_options());
+
+        checkpoint_file_writer(checkpoint_file_writer const&) = delete;
+        checkpoint_file_writer(checkpoint_file_writer&&) = delete;
+        checkpoint_file_writer& operator=(
+            checkpoint_file_writer const&) = delete;
+        checkpoint_file_writer& operator=(checkpoint_file_writer&&) = delete;
+
+        ~checkpoint_file_writer();
+
+        /// The number of bytes written so far
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// Append the given data, the serialization archive writes the data
+        /// strictly sequentially.
+        void write(std::size_t offset, void const* data, std::size_t count);
+
+        /// Flush all data to the file and mark the checkpoint as complete.
+        checkpoint_file_info commit();
+
+    private:
+        void complete_chunk(std::size_t length);
+        void write_chunk(std::vector<char> const& chunk, std::size_t index,
+            std::size_t length);
+        bool is_unchanged(std::size_t index, std::size_t length);
+        void wait_for_pending_write();
+
+        std::string filename_;
+        std::string slot_filename_;
+        checkpoint_file_options options_;
+        std::fstream file_;
+
+        std::uint64_t generation_ = 0;
+        std::vector<std::uint64_t> previous_hashes_;
+        std::vector<std::uint64_t> hashes_;
+
+        // reads the replaced chunks, the file is written concurrently
+        // through file_ but never at the position of a chunk that is read
+        std::ifstream previous_;
+        std::vector<char> compare_;
+
+        std::vector<char> buffer_;
+        std::vector<char> spare_;
+        hpx::future<void> pending_;
+
+        std::size_t size_ = 0;
+        std::size_t chunks_written_ = 0;
+        bool committed_ = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// mapped_checkpoint_file
+    ///
+    /// Provides read access to a checkpoint written by a
+    /// checkpoint_file_writer. The file is mapped into memory, its pages are
+    /// read on demand while the data is being de-serialized (see
+    /// restore_checkpoint_data). On platforms not supporting memory mapped
+    /// files the data is read at construction.
+    class HPX_EXPORT mapped_checkpoint_file
+    {
+    public:
+        /// Map the most recent committed checkpoint.
+        explicit mapped_checkpoint_file(std::string const& filename);
+
+        /// Map the committed checkpoint with the given generation, which
+        /// allows to restore the checkpoint referred to by some other file
+        /// even if a newer checkpoint was committed since. Throws if neither
+        /// of the two files holds this generation anymore.
+        mapped_checkpoint_file(
+            std::string const& filename, std::uint64_t generation);
+
+        mapped_checkpoint_file(mapped_checkpoint_file const&) = delete;
+        mapped_checkpoint_file(mapped_checkpoint_file&& rhs) noexcept
+          : mapping_(std::exchange(rhs.mapping_, nullptr))
+          , mapping_size_(std::exchange(rhs.mapping_size_, 0))
+          , buffer_(HPX_MOVE(rhs.buffer_))
+          , data_(std::exchange(rhs.data_, nullptr))
+          , size_(std::exchange(rhs.size_, 0))
+          , generation_(std::exchange(rhs.generation_, 0))
+        {
+        }
+
+        mapped_checkpoint_file& operator=(
+            mapped_checkpoint_file const&) = delete;
+        mapped_checkpoint_file& operator=(mapped_checkpoint_file&&) = delete;
+
+        ~mapped_checkpoint_file();
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] char const& operator[](std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+        /// The number of checkpoints that were written to the file
+        [[nodiscard]] std::uint64_t generation() const noexcept
+        {
+            return generation_;
+        }
+
+    private:
+        void map(std::string const& filename);
+
+        void* mapping_ = nullptr;
+        std::size_t mapping_size_ = 0;
+        std::vector<char> buffer_;
+
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+        std::uint64_t generation_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// checkpoint_file_appender
+    ///
+    /// A container for serialization archives that appends the serialized
+    /// data to the data already written to a checkpoint_file_writer. This
+    /// allows to store the output of several archives in the same file, each
+    /// of which can be restored separately using a checkpoint_data_view.
+    class checkpoint_file_appender
+    {
+    public:
+        explicit checkpoint_file_appender(
+            checkpoint_file_writer& writer) noexcept
+          : writer_(writer)
+          , offset_(writer.size())
+        {
+        }
+
+        /// The position of the appended data in the file's data
+        [[nodiscard]] std::size_t offset() const noexcept
+        {
+            return offset_;
+        }
+
+        /// The number of bytes appended so far
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return writer_.size() - offset_;
+        }
+
+        void write(std::size_t offset, void const* data, std::size_t count)
+        {
+            writer_.write(offset_ + offset, data, count);
+        }
+
+    private:
+        checkpoint_file_writer& writer_;
+        std::size_t offset_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// checkpoint_data_view
+    ///
+    /// A container for serialization archives referring to a range of bytes
+    /// owned by somebody else, e.g. the data appended to a checkpoint file by
+    /// a checkpoint_file_appender.
+    class checkpoint_data_view
+    {
+    public:
+        constexpr checkpoint_data_view(
+            char const* data, std::size_t size) noexcept
+          : data_(data)
+          , size_(size)
+        {
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] constexpr char const& operator[](
+            std::size_t i) const noexcept
+        {
+            return data_[i];
+        }
+
+    private:
+        char const* data_;
+        std::size_t size_;
+    };
+}    // namespace hpx::util
+
+namespace hpx::traits {
+
+    // The checkpoint_file_writer can't hand out references to its data as
+    // the chunks are written to the file as soon as they are filled.
+    template <>
+    struct serialization_access_data<util::checkpoint_file_writer>
+      : default_serialization_access_data<util::checkpoint_file_writer>
+    {
+        [[nodiscard]] static std::size_t size(
+            util::checkpoint_file_writer const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static constexpr void resize(
+            util::checkpoint_file_writer&, std::size_t) noexcept
+        {
+        }
+
+        static void write(util::checkpoint_file_writer& cont,
+            std::size_t count, std::size_t current, void const* address)
+        {
+            cont.write(current, address, count);
+        }
+    };
+
+    template <>
+    struct serialization_access_data<util::checkpoint_file_appender>
+      : default_serialization_access_data<util::checkpoint_file_appender>
+    {
+        [[nodiscard]] static std::size_t size(
+            util::checkpoint_file_appender const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static constexpr void resize(
+            util::checkpoint_file_appender&, std::size_t) noexcept
+        {
+        }
+
+        static void write(util::checkpoint_file_appender& cont,
+            std::size_t count, std::size_t current, void const* address)
+        {
+            cont.write(current, address, count);
+        }
+    };
+}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,652 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::util {
+
+    namespace {
+
+        // Layout of a checkpoint file:
+        //
+        //  [0, 64)                      file_header
+        //  [data_offset, +data_size)    serialized data, split into chunks
+        //  [table_offset, +8*chunks)    content hash of each chunk
+        //
+        // The data starts at a page boundary to allow for mapping it
+        // directly. All values are stored in native byte order.
+        //
+        // Checkpoints are written alternately to two files (slots), the
+        // file with the given name and the same name with the suffix ".1".
+        // A new checkpoint always replaces the older of the two, the most
+        // recent checkpoint stays intact until the new one was committed.
+        constexpr char file_magic[8] = {'H', 'P', 'X', 'C', 'K', 'P', 'T', 0};
+        constexpr std::uint32_t file_version = 1;
+        constexpr std::uint64_t data_offset = 4096;
+
+        struct file_header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t complete;
+            std::uint64_t generation;
+            std::uint64_t chunk_size;
+            std::uint64_t data_size;
+            std::uint64_t num_chunks;
+            std::uint64_t table_offset;
+            std::uint64_t reserved;
+        };
+        static_assert(sizeof(file_header) == 64);
+
+        [[nodiscard]] file_header make_header(std::uint64_t generation,
+            std::uint64_t chunk_size, bool complete) noexcept
+        {
+            file_header header{};
+            std::memcpy(header.magic, file_magic, sizeof(file_magic));
+            header.version = file_version;
+            header.complete = complete ? 1 : 0;
+            header.generation = generation;
+            header.chunk_size = chunk_size;
+            header.table_offset = data_offset;
+            return header;
+        }
+
+        [[nodiscard]] bool is_checkpoint_file(
+            file_header const& header) noexcept
+        {
+            return std::memcmp(header.magic, file_magic, sizeof(file_magic)) ==
+                0 &&
+                header.version == file_version;
+        }
+
+        // a header is valid if it describes a committed checkpoint that
+        // fits into the file
+        [[nodiscard]] bool is_valid(
+            file_header const& header, std::uint64_t file_size) noexcept
+        {
+            return is_checkpoint_file(header) && header.complete == 1 &&
+                header.chunk_size != 0 &&
+                header.data_size <= file_size - data_offset &&
+                header.table_offset >= data_offset + header.data_size &&
+                header.table_offset <= file_size &&
+                header.num_chunks <= (file_size - header.table_offset) / 8;
+        }
+
+        [[nodiscard]] std::uint64_t rotl(std::uint64_t x, int r) noexcept
+        {
+            return (x << r) | (x >> (64 - r));
+        }
+
+        // Content hash of a chunk, this processes the data a word at a time
+        // using the mixing steps of MurmurHash3. The length of the chunk is
+        // used as the seed.
+        [[nodiscard]] std::uint64_t chunk_hash(
+            char const* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t c1 = 0x87c37b91114253d5ULL;
+            constexpr std::uint64_t c2 = 0x4cf5ad432745937fULL;
+
+            auto const mix = [](std::uint64_t k) noexcept {
+                k *= c1;
+                k = rotl(k, 31);
+                k *= c2;
+                return k;
+            };
+
+            std::uint64_t h = size;
+
+            std::size_t i = 0;
+            for (/**/; i + 8 <= size; i += 8)
+            {
+                std::uint64_t k;
+                std::memcpy(&k, data + i, 8);
+
+                h ^= mix(k);
+                h = rotl(h, 27) * 5 + 0x52dce729;
+            }
+
+            if (i != size)
+            {
+                std::uint64_t k = 0;
+                std::memcpy(&k, data + i, size - i);
+                h ^= mix(k);
+            }
+
+            // finalization mix
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        constexpr std::size_t num_slots = 2;
+
+        [[nodiscard]] std::string slot_filename(
+            std::string const& filename, std::size_t slot)
+        {
+            return slot == 0 ? filename : filename + ".1";
+        }
+
+        // Read the header of the given file, returns false if the file does
+        // not exist or is not a checkpoint file.
+        [[nodiscard]] bool read_header(std::string const& filename,
+            file_header& header, std::uint64_t& file_size)
+        {
+            std::error_code ec;
+            file_size = filesystem::file_size(filename, ec);
+            if (ec || file_size < data_offset)
+            {
+                return false;
+            }
+
+            std::ifstream file(
+                filename, std::ios_base::in | std::ios_base::binary);
+            return file &&
+                file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+                is_checkpoint_file(header);
+        }
+
+        // Returns the slot holding the most recent committed checkpoint, or
+        // num_slots if there is none.
+        [[nodiscard]] std::size_t find_latest_slot(std::string const& filename,
+            file_header* headers, std::uint64_t* file_sizes, bool* exists)
+        {
+            std::size_t latest = num_slots;
+            for (std::size_t slot = 0; slot != num_slots; ++slot)
+            {
+                headers[slot] = file_header{};
+                exists[slot] = read_header(slot_filename(filename, slot),
+                    headers[slot], file_sizes[slot]);
+
+                if (exists[slot] && is_valid(headers[slot], file_sizes[slot]) &&
+                    (latest == num_slots ||
+                        headers[slot].generation > headers[latest].generation))
+                {
+                    latest = slot;
+                }
+            }
+            return latest;
+        }
+
+        // Make sure that everything written to the given file so far has
+        // reached the storage device.
+        void sync_file(std::string const& filename)
+        {
+#if !defined(HPX_WINDOWS)
+            int const fd = ::open(filename.c_str(), O_RDWR);
+            if (fd == -1 || ::fsync(fd) == -1)
+            {
+                int const err = errno;
+                if (fd != -1)
+                {
+                    ::close(fd);
+                }
+                HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                    "hpx::util::checkpoint_file_writer",
+                    "could not synchronize checkpoint file {}: {}", filename,
+                    std::strerror(err));
+            }
+            ::close(fd);
+#else
+            HANDLE const h = ::CreateFileA(filename.c_str(), GENERIC_WRITE,
+                FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL, nullptr);
+            bool const synced =
+                h != INVALID_HANDLE_VALUE && ::FlushFileBuffers(h) != 0;
+            if (h != INVALID_HANDLE_VALUE)
+            {
+                ::CloseHandle(h);
+            }
+            if (!synced)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                    "hpx::util::checkpoint_file_writer",
+                    "could not synchronize checkpoint file {}", filename);
+            }
+#endif
+        }
+
+        void write_at(std::fstream& file, std::uint64_t offset,
+            void const* data, std::size_t count, std::string const& filename)
+        {
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(static_cast<char const*>(data),
+                static_cast<std::streamsize>(count));
+            if (!file)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                    "hpx::util::checkpoint_file_writer",
+                    "could not write to checkpoint file {}", filename);
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_writer::checkpoint_file_writer(
+        std::string filename, checkpoint_file_options const& options)
+      : filename_(HPX_MOVE(filename))
+      , options_(options)
+    {
+        if (options_.chunk_size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::util::checkpoint_file_writer::checkpoint_file_writer",
+                "the chunk size must not be zero");
+        }
+
+        // The new checkpoint replaces the older of the two slots (or a slot
+        // that does not hold a committed checkpoint).
+        file_header headers[num_slots];
+        std::uint64_t file_sizes[num_slots] = {};
+        bool exists[num_slots] = {};
+        std::size_t const latest =
+            find_latest_slot(filename_, headers, file_sizes, exists);
+
+        std::size_t const slot = latest == num_slots ? 0 : 1 - latest;
+        slot_filename_ = slot_filename(filename_, slot);
+
+        // continue counting even if the last checkpoint was not completed
+        for (std::size_t i = 0; i != num_slots; ++i)
+        {
+            if (exists[i])
+            {
+                generation_ = (std::max)(generation_, headers[i].generation);
+            }
+        }
+
+        if (exists[slot])
+        {
+            // The older checkpoint is overwritten in place, remember its
+            // chunk hashes to be able to skip all unchanged chunks.
+            file_.open(slot_filename_,
+                std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+
+            file_header const& header = headers[slot];
+            if (file_ && options_.incremental &&
+                is_valid(header, file_sizes[slot]) &&
+                header.chunk_size == options_.chunk_size)
+            {
+                previous_hashes_.resize(header.num_chunks);
+                file_.seekg(static_cast<std::streamoff>(header.table_offset));
+                if (!file_.read(
+                        reinterpret_cast<char*>(previous_hashes_.data()),
+                        static_cast<std::streamsize>(
+                            previous_hashes_.size() * 8)))
+                {
+                    previous_hashes_.clear();
+                }
+                else
+                {
+                    previous_.open(slot_filename_,
+                        std::ios_base::in | std::ios_base::binary);
+                    if (!previous_.is_open())
+                    {
+                        previous_hashes_.clear();
+                    }
+                }
+            }
+            file_.clear();
+        }
+        else
+        {
+            file_.open(slot_filename_,
+                std::ios_base::out | std::ios_base::trunc |
+                    std::ios_base::binary);
+        }
+
+        if (!file_.is_open())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::checkpoint_file_writer::checkpoint_file_writer",
+                "could not open checkpoint file {}", slot_filename_);
+        }
+
+        // The slot does not hold a valid checkpoint anymore until commit
+        // was called.
+        file_header const header =
+            make_header(generation_, options_.chunk_size, false);
+        write_at(file_, 0, &header, sizeof(header), slot_filename_);
+        file_.flush();
+
+        buffer_.reserve(options_.chunk_size);
+    }
+
+    checkpoint_file_writer::~checkpoint_file_writer()
+    {
+        // the pending write refers to this object
+        if (pending_.valid())
+        {
+            pending_.wait();
+        }
+    }
+
+    void checkpoint_file_writer::write(
+        std::size_t offset, void const* data, std::size_t count)
+    {
+        HPX_ASSERT(!committed_);
+        HPX_ASSERT(offset == size_);
+        HPX_UNUSED(offset);
+
+        auto const* p = static_cast<char const*>(data);
+        while (count != 0)
+        {
+            std::size_t const n =
+                (std::min)(count, options_.chunk_size - buffer_.size());
+
+            buffer_.insert(buffer_.end(), p, p + n);
+            if (buffer_.size() == options_.chunk_size)
+            {
+                complete_chunk(buffer_.size());
+            }
+
+            p += n;
+            count -= n;
+            size_ += n;
+        }
+    }
+
+    checkpoint_file_info checkpoint_file_writer::commit()
+    {
+        HPX_ASSERT(!committed_);
+
+        if (!buffer_.empty())
+        {
+            complete_chunk(buffer_.size());
+        }
+        wait_for_pending_write();
+
+        file_header header =
+            make_header(generation_ + 1, options_.chunk_size, true);
+        header.data_size = size_;
+        header.num_chunks = hashes_.size();
+        header.table_offset = (data_offset + size_ + 7) & ~std::uint64_t(7);
+
+        write_at(file_, header.table_offset, hashes_.data(),
+            hashes_.size() * 8, slot_filename_);
+        file_.close();
+        previous_.close();
+
+        // drop the remainder of a previous (larger) checkpoint
+        std::error_code ec;
+        filesystem::resize_file(
+            slot_filename_, header.table_offset + hashes_.size() * 8, ec);
+        if (ec)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::checkpoint_file_writer::commit",
+                "could not resize checkpoint file {}: {}", slot_filename_,
+                ec.message());
+        }
+
+        // The checkpoint becomes valid only after all data has reached the
+        // storage device, otherwise the header could be persisted before
+        // the data it describes.
+        sync_file(slot_filename_);
+
+        file_.open(slot_filename_,
+            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        write_at(file_, 0, &header, sizeof(header), slot_filename_);
+        file_.close();
+
+        sync_file(slot_filename_);
+
+        committed_ = true;
+        ++generation_;
+
+        return checkpoint_file_info{
+            generation_, size_, hashes_.size(), chunks_written_};
+    }
+
+    void checkpoint_file_writer::complete_chunk(std::size_t length)
+    {
+        std::size_t const index = hashes_.size();
+        std::uint64_t const hash = chunk_hash(buffer_.data(), length);
+        hashes_.push_back(hash);
+
+        // the hash includes the length of the chunk, an equal hash implies
+        // that the previous checkpoint most likely stored the same data at
+        // this place
+        if (index < previous_hashes_.size() &&
+            previous_hashes_[index] == hash && is_unchanged(index, length))
+        {
+            buffer_.clear();
+            return;
+        }
+
+        // The chunk is written while the serialization continues filling the
+        // other buffer.
+        wait_for_pending_write();
+        std::swap(buffer_, spare_);
+        buffer_.clear();
+        ++chunks_written_;
+
+        if (options_.asynchronous_writes && threads::get_self_ptr() != nullptr)
+        {
+            pending_ = hpx::run_as_os_thread([this, index, length]() {
+                write_chunk(spare_, index, length);
+            });
+        }
+        else
+        {
+            write_chunk(spare_, index, length);
+        }
+    }
+
+    void checkpoint_file_writer::write_chunk(
+        std::vector<char> const& chunk, std::size_t index, std::size_t length)
+    {
+        write_at(file_, data_offset + index * options_.chunk_size,
+            chunk.data(), length, slot_filename_);
+    }
+
+    // The hash is not collision resistant, compare the chunk with the data
+    // stored in the file. The chunk at this position was not written yet.
+    bool checkpoint_file_writer::is_unchanged(
+        std::size_t index, std::size_t length)
+    {
+        compare_.resize(length);
+        previous_.seekg(static_cast<std::streamoff>(
+            data_offset + index * options_.chunk_size));
+        if (!previous_.read(
+                compare_.data(), static_cast<std::streamsize>(length)))
+        {
+            previous_.clear();
+            return false;
+        }
+        return std::memcmp(compare_.data(), buffer_.data(), length) == 0;
+    }
+
+    void checkpoint_file_writer::wait_for_pending_write()
+    {
+        if (pending_.valid())
+        {
+            // rethrows the exception if the write failed
+            pending_.get();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_checkpoint_file::mapped_checkpoint_file(
+        std::string const& filename_base)
+    {
+        // restore the most recent committed checkpoint
+        file_header headers[num_slots];
+        std::uint64_t file_sizes[num_slots] = {};
+        bool exists[num_slots] = {};
+        std::size_t const latest =
+            find_latest_slot(filename_base, headers, file_sizes, exists);
+
+        map(slot_filename(filename_base, latest == num_slots ? 0 : latest));
+    }
+
+    mapped_checkpoint_file::mapped_checkpoint_file(
+        std::string const& filename_base, std::uint64_t generation)
+    {
+        std::size_t slot = 0;
+        for (/**/; slot != num_slots; ++slot)
+        {
+            file_header header{};
+            std::uint64_t file_size = 0;
+            if (read_header(slot_filename(filename_base, slot), header,
+                    file_size) &&
+                is_valid(header, file_size) && header.generation == generation)
+            {
+                break;
+            }
+        }
+
+        if (slot == num_slots)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "{} does not hold checkpoint generation {}", filename_base,
+                generation);
+        }
+
+        map(slot_filename(filename_base, slot));
+
+        // the slot might have been replaced in the meantime
+        if (generation_ != generation)
+        {
+#if !defined(HPX_WINDOWS)
+            ::munmap(mapping_, mapping_size_);
+            mapping_ = nullptr;
+#endif
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "{} does not hold checkpoint generation {}", filename_base,
+                generation);
+        }
+    }
+
+    void mapped_checkpoint_file::map(std::string const& filename)
+    {
+        file_header header{};
+
+#if !defined(HPX_WINDOWS)
+        int const fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            int const err = errno;
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "could not open checkpoint file {}: {}", filename,
+                std::strerror(err));
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1 ||
+            static_cast<std::uint64_t>(st.st_size) < data_offset)
+        {
+            ::close(fd);
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "{} is not a checkpoint file", filename);
+        }
+
+        // The pages are read from the file only once they are accessed
+        // during de-serialization.
+        mapping_size_ = static_cast<std::size_t>(st.st_size);
+        void* mapping =
+            ::mmap(nullptr, mapping_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (mapping == MAP_FAILED)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "mmap failed for checkpoint file {}: {}", filename,
+                std::strerror(err));
+        }
+        mapping_ = mapping;
+
+        std::memcpy(&header, mapping_, sizeof(header));
+        if (!is_valid(header, mapping_size_))
+        {
+            ::munmap(mapping_, mapping_size_);
+            mapping_ = nullptr;
+
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "{} does not hold a complete checkpoint", filename);
+        }
+
+#if defined(MADV_SEQUENTIAL)
+        // the data is de-serialized front to back
+        ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+#endif
+        data_ = static_cast<char const*>(mapping_) + data_offset;
+#else
+        std::ifstream file(filename, std::ios_base::in | std::ios_base::binary);
+
+        std::error_code ec;
+        std::uint64_t const file_size = filesystem::file_size(filename, ec);
+        if (!file || ec || file_size < data_offset ||
+            !file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            !is_valid(header, file_size))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "{} does not hold a complete checkpoint", filename);
+        }
+
+        buffer_.resize(header.data_size);
+        file.seekg(static_cast<std::streamoff>(data_offset));
+        if (!file.read(buffer_.data(),
+                static_cast<std::streamsize>(buffer_.size())))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::mapped_checkpoint_file::mapped_checkpoint_file",
+                "could not read checkpoint file {}", filename);
+        }
+        data_ = buffer_.data();
+#endif
+
+        size_ = header.data_size;
+        generation_ = header.generation;
+    }
+
+    mapped_checkpoint_file::~mapped_checkpoint_file()
+    {
+#if !defined(HPX_WINDOWS)
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, mapping_size_);
+        }
+#endif
+    }
+}    // namespace hpx::util
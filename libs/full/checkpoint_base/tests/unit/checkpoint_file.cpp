@@ -0,0 +1,202 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint_base.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/filesystem.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_file_info;
+using hpx::util::checkpoint_file_options;
+using hpx::util::checkpoint_file_writer;
+using hpx::util::mapped_checkpoint_file;
+
+checkpoint_file_info save(std::string const& filename,
+    checkpoint_file_options const& options, std::string const& str,
+    std::vector<double> const& vec)
+{
+    checkpoint_file_writer writer(filename, options);
+    hpx::util::save_checkpoint_data(writer, str, vec);
+    return writer.commit();
+}
+
+void restore(std::string const& filename, std::string const& str,
+    std::vector<double> const& vec)
+{
+    std::string str2;
+    std::vector<double> vec2;
+
+    mapped_checkpoint_file const file(filename);
+    hpx::util::restore_checkpoint_data(file, str2, vec2);
+
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST(vec == vec2);
+}
+
+int main()
+{
+    std::string const filename = "checkpoint_file_test.ckpt";
+    hpx::filesystem::remove(filename);
+    hpx::filesystem::remove(filename + ".1");
+
+    std::string str = "I am a string of characters";
+    std::vector<double> vec(100000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<double>(i);
+    }
+
+    checkpoint_file_options options;
+    options.chunk_size = 4096;
+
+    // the file holds the same data as an in-memory checkpoint
+    checkpoint_file_info info = save(filename, options, str, vec);
+    {
+        std::vector<char> archive;
+        hpx::util::save_checkpoint_data(archive, str, vec);
+
+        mapped_checkpoint_file const file(filename);
+        HPX_TEST_EQ(file.size(), archive.size());
+        HPX_TEST(std::equal(archive.begin(), archive.end(), file.data()));
+        HPX_TEST_EQ(file.generation(), static_cast<std::uint64_t>(1));
+    }
+
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(1));
+    HPX_TEST_EQ(info.num_chunks, (info.size + 4095) / 4096);
+    HPX_TEST_EQ(info.chunks_written, info.num_chunks);
+    restore(filename, str, vec);
+
+    // the second checkpoint is stored in a separate file
+    info = save(filename, options, str, vec);
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(2));
+    HPX_TEST_EQ(info.chunks_written, info.num_chunks);
+    HPX_TEST(hpx::filesystem::exists(filename + ".1"));
+    restore(filename, str, vec);
+
+    // unchanged data is not written again
+    info = save(filename, options, str, vec);
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(3));
+    HPX_TEST_EQ(info.chunks_written, static_cast<std::size_t>(0));
+    restore(filename, str, vec);
+
+    // only the chunk(s) holding the modified element are written
+    vec[vec.size() / 2] = -1.0;
+    info = save(filename, options, str, vec);
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(4));
+    HPX_TEST_LTE(info.chunks_written, static_cast<std::size_t>(2));
+    HPX_TEST_LT(static_cast<std::size_t>(0), info.chunks_written);
+    restore(filename, str, vec);
+
+    // a shorter checkpoint truncates the file, only the first chunk (holding
+    // the size of the vector) and the last chunk have changed
+    vec.resize(vec.size() / 4);
+    info = save(filename, options, str, vec);
+    HPX_TEST_EQ(info.chunks_written, static_cast<std::size_t>(2));
+    restore(filename, str, vec);
+
+    // all chunks are written if requested
+    options.incremental = false;
+    info = save(filename, options, str, vec);
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(6));
+    HPX_TEST_EQ(info.chunks_written, info.num_chunks);
+    restore(filename, str, vec);
+
+    // the previous checkpoint stays valid if the next one is not committed
+    {
+        std::vector<double> vec2(vec.size(), 42.0);
+
+        checkpoint_file_writer writer(filename, options);
+        hpx::util::save_checkpoint_data(writer, str, vec2);
+    }
+
+    {
+        mapped_checkpoint_file const file(filename);
+        HPX_TEST_EQ(file.generation(), static_cast<std::uint64_t>(6));
+    }
+    restore(filename, str, vec);
+
+    // ... and the interrupted checkpoint is replaced by the next one
+    options.incremental = true;
+    info = save(filename, options, str, vec);
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(7));
+    HPX_TEST_EQ(info.chunks_written, info.num_chunks);
+    restore(filename, str, vec);
+
+    // the previous checkpoint can be mapped as long as it was not replaced
+    {
+        mapped_checkpoint_file const file(filename, 6);
+        HPX_TEST_EQ(file.generation(), static_cast<std::uint64_t>(6));
+
+        std::vector<char> archive;
+        hpx::util::save_checkpoint_data(archive, str, vec);
+        HPX_TEST_EQ(file.size(), archive.size());
+        HPX_TEST(std::equal(archive.begin(), archive.end(), file.data()));
+    }
+
+    {
+        bool caught_exception = false;
+        try
+        {
+            mapped_checkpoint_file const file(filename, 5);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::error::filesystem_error);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // a chunk with an unchanged hash is written if its data differs, modify
+    // the data of the replaced checkpoint (starting at offset 4096) without
+    // updating its hashes
+    {
+        std::fstream file(filename + ".1",
+            std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        file.seekp(4096 + 3 * 4096 + 10);
+        file.put(42);
+    }
+
+    info = save(filename, options, str, vec);
+    HPX_TEST_EQ(info.generation, static_cast<std::uint64_t>(8));
+    HPX_TEST_EQ(info.chunks_written, static_cast<std::size_t>(1));
+    restore(filename, str, vec);
+
+    hpx::filesystem::remove(filename);
+    hpx::filesystem::remove(filename + ".1");
+
+    // a checkpoint that was never committed can't be restored
+    {
+        checkpoint_file_writer writer(filename, options);
+        hpx::util::save_checkpoint_data(writer, str, vec);
+    }
+
+    bool caught_exception = false;
+    try
+    {
+        mapped_checkpoint_file const file(filename);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::filesystem_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    hpx::filesystem::remove(filename);
+
+    return hpx::util::report_errors();
+}
@@ -210,10 +210,13 @@ namespace hpx { namespace collectives {
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
+#include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -259,6 +262,23 @@ namespace hpx::traits {
     };
 }    // namespace hpx::traits
 
+namespace hpx::collectives::detail {
+
+    // all_gather based on point-to-point communication between the sites
+    template <typename T>
+    hpx::future<std::vector<T>> all_gather_p2p(
+        collective_plan&& plan, T&& value)
+    {
+        HPX_ASSERT(plan.algorithm == collective_algorithm::ring);
+        return hpx::async([plan = HPX_MOVE(plan),
+                              value = HPX_MOVE(value)]() mutable {
+            collective_channel channel(plan);
+            return all_gather_ring(
+                channel, plan.num_sites, plan.this_site, HPX_MOVE(value));
+        });
+    }
+}    // namespace hpx::collectives::detail
+
 namespace hpx::collectives {
 
     ///////////////////////////////////////////////////////////////////////////
@@ -286,6 +306,14 @@ namespace hpx::collectives {
                                    this_site,
                                    generation](communicator&& c) mutable
             -> hpx::future<std::vector<arg_type>> {
+            detail::collective_plan plan = detail::select_collective_algorithm(
+                c, collective_operation::all_gather, generation);
+            if (plan.algorithm != collective_algorithm::centralized)
+            {
+                return detail::all_gather_p2p(
+                    HPX_MOVE(plan), HPX_MOVE(local_result));
+            }
+
             using action_type =
                 detail::communicator_server::communication_get_direct_action<
                     traits::communication::all_gather_tag,
@@ -223,7 +223,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -303,6 +305,36 @@ namespace hpx::traits {
     };
 }    // namespace hpx::traits
 
+namespace hpx::collectives::detail {
+
+    // all_reduce based on point-to-point communication between the sites
+    template <typename T, typename F>
+    hpx::future<T> all_reduce_p2p(collective_plan&& plan, T&& value, F&& op)
+    {
+        return hpx::async(
+            [plan = HPX_MOVE(plan), value = HPX_MOVE(value),
+                op = HPX_MOVE(op)]() mutable -> T {
+                collective_channel channel(plan);
+
+                if constexpr (is_segmentable<T, F>::value)
+                {
+                    if (plan.algorithm == collective_algorithm::rabenseifner)
+                    {
+                        return all_reduce_rabenseifner(channel, plan.num_sites,
+                            plan.this_site, HPX_MOVE(value), op);
+                    }
+                }
+
+                HPX_ASSERT(plan.algorithm ==
+                        collective_algorithm::recursive_doubling ||
+                    plan.algorithm == collective_algorithm::rabenseifner);
+
+                return all_reduce_recursive_doubling(channel, plan.num_sites,
+                    plan.this_site, HPX_MOVE(value), op);
+            });
+    }
+}    // namespace hpx::collectives::detail
+
 namespace hpx::collectives {
 
     ////////////////////////////////////////////////////////////////////////////
@@ -330,6 +362,17 @@ namespace hpx::collectives {
                 op = HPX_FORWARD(F, op), generation,
                 this_site](communicator&& c) mutable -> hpx::future<arg_type> {
             using func_type = std::decay_t<F>;
+
+            detail::collective_plan plan = detail::select_collective_algorithm(
+                c, collective_operation::all_reduce, generation,
+                detail::message_size(local_result),
+                detail::is_segmentable<arg_type, func_type>::value);
+            if (plan.algorithm != collective_algorithm::centralized)
+            {
+                return detail::all_reduce_p2p(
+                    HPX_MOVE(plan), HPX_MOVE(local_result), HPX_MOVE(op));
+            }
+
             using action_type =
                 detail::communicator_server::communication_get_direct_action<
                     traits::communication::all_reduce_tag,
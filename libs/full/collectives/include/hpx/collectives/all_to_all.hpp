@@ -210,13 +210,17 @@ namespace hpx { namespace collectives {
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
+#include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/async_distributed/sync.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/format.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -271,6 +275,23 @@ namespace hpx::traits {
     };
 }    // namespace hpx::traits
 
+namespace hpx::collectives::detail {
+
+    // all_to_all based on point-to-point communication between the sites
+    template <typename T>
+    hpx::future<std::vector<T>> all_to_all_p2p(
+        collective_plan&& plan, std::vector<T>&& values)
+    {
+        HPX_ASSERT(plan.algorithm == collective_algorithm::pairwise);
+        return hpx::async([plan = HPX_MOVE(plan),
+                              values = HPX_MOVE(values)]() mutable {
+            collective_channel channel(plan);
+            return all_to_all_pairwise(
+                channel, plan.num_sites, plan.this_site, HPX_MOVE(values));
+        });
+    }
+}    // namespace hpx::collectives::detail
+
 namespace hpx::collectives {
 
     ///////////////////////////////////////////////////////////////////////////
@@ -296,6 +317,24 @@ namespace hpx::collectives {
         auto all_to_all_data =
             [local_result = HPX_MOVE(local_result), this_site, generation](
                 communicator&& c) mutable -> hpx::future<std::vector<T>> {
+            detail::collective_plan plan = detail::select_collective_algorithm(
+                c, collective_operation::all_to_all, generation);
+            if (plan.algorithm != collective_algorithm::centralized)
+            {
+                if (local_result.size() != plan.num_sites)
+                {
+                    return hpx::make_exceptional_future<std::vector<T>>(
+                        HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::collectives::all_to_all",
+                            hpx::util::format(
+                                "the number of values ({}) has to be equal to "
+                                "the number of sites ({})",
+                                local_result.size(), plan.num_sites)));
+                }
+                return detail::all_to_all_p2p(
+                    HPX_MOVE(plan), HPX_MOVE(local_result));
+            }
+
             using action_type =
                 detail::communicator_server::communication_get_direct_action<
                     traits::communication::all_to_all_tag,
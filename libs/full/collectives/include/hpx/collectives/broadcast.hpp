@@ -389,9 +389,12 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/format.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -456,6 +459,23 @@ namespace hpx::traits {
     };
 }    // namespace hpx::traits
 
+namespace hpx::collectives::detail {
+
+    // broadcast based on point-to-point communication between the sites, the
+    // value is used on the root site only
+    template <typename T>
+    hpx::future<T> broadcast_p2p(collective_plan&& plan, T&& value)
+    {
+        HPX_ASSERT(plan.algorithm == collective_algorithm::binomial_tree);
+        return hpx::async(
+            [plan = HPX_MOVE(plan), value = HPX_MOVE(value)]() mutable -> T {
+                collective_channel channel(plan);
+                return broadcast_binomial_tree(channel, plan.num_sites,
+                    plan.this_site, plan.root_site, HPX_MOVE(value));
+            });
+    }
+}    // namespace hpx::collectives::detail
+
 namespace hpx::collectives {
 
     template <typename T>
@@ -479,6 +499,25 @@ namespace hpx::collectives {
         auto broadcast_data =
             [local_result = HPX_FORWARD(T, local_result), this_site,
                 generation](communicator&& c) mutable -> hpx::future<arg_type> {
+            detail::collective_plan plan = detail::select_collective_algorithm(
+                c, collective_operation::broadcast, generation);
+            if (plan.algorithm != collective_algorithm::centralized)
+            {
+                // the tree is rooted at the root site of the communicator
+                if (plan.this_site != plan.root_site)
+                {
+                    return hpx::make_exceptional_future<arg_type>(
+                        HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::collectives::broadcast_to",
+                            hpx::util::format(
+                                "the value has to be sent from the root site "
+                                "of the communicator ({}), this site is {}",
+                                plan.root_site, plan.this_site)));
+                }
+                return detail::broadcast_p2p(
+                    HPX_MOVE(plan), HPX_MOVE(local_result));
+            }
+
             using action_type =
                 detail::communicator_server::communication_set_direct_action<
                     traits::communication::broadcast_tag, hpx::future<arg_type>,
@@ -573,6 +612,13 @@ namespace hpx::collectives {
 
         auto broadcast_data = [this_site, generation](
                                   communicator&& c) -> hpx::future<T> {
+            detail::collective_plan plan = detail::select_collective_algorithm(
+                c, collective_operation::broadcast, generation);
+            if (plan.algorithm != collective_algorithm::centralized)
+            {
+                return detail::broadcast_p2p(HPX_MOVE(plan), T());
+            }
+
             using action_type =
                 detail::communicator_server::communication_get_direct_action<
                     traits::communication::broadcast_tag, hpx::future<T>>;
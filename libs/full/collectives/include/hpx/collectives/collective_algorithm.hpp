@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file collective_algorithm.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    /// The collective operations for which the algorithm used for exchanging
+    /// the data between the participating sites can be selected.
+    enum class collective_operation : std::uint8_t
+    {
+        all_gather = 0,
+        all_reduce = 1,
+        all_to_all = 2,
+        broadcast = 3,
+        reduce = 4
+    };
+
+    /// The algorithms available for exchanging the data of a collective
+    /// operation between the participating sites.
+    ///
+    /// All algorithms except \a centralized exchange the data between the
+    /// sites directly (using a channel communicator that is created on first
+    /// use), which avoids funneling all data through the root site.
+    enum class collective_algorithm : std::uint8_t
+    {
+        /// Select an algorithm based on the number of participating sites
+        /// and on the size of the data (see hpx.lcos.collectives).
+        automatic = 0,
+
+        /// All sites send their data to a single server object located on the
+        /// root site of the communicator (all operations).
+        centralized = 1,
+
+        /// The data is passed along a binomial tree rooted at the root site,
+        /// which takes log(num_sites) steps (broadcast, reduce).
+        binomial_tree = 2,
+
+        /// Pairs of sites exchange their partial results in log(num_sites)
+        /// steps (all_reduce).
+        recursive_doubling = 3,
+
+        /// Reduce-scatter by recursive halving followed by an all-gather by
+        /// recursive doubling, this requires an element-wise reduction of
+        /// std::vector values (all_reduce, falls back to recursive_doubling
+        /// otherwise).
+        rabenseifner = 4,
+
+        /// Each site forwards the values to its right neighbor in
+        /// num_sites - 1 steps (all_gather).
+        ring = 5,
+
+        /// Each site exchanges the data with a different site in each of
+        /// num_sites - 1 steps (all_to_all).
+        pairwise = 6
+    };
+
+    /// Return whether the given algorithm can be used to implement the given
+    /// collective operation.
+    [[nodiscard]] HPX_EXPORT bool is_supported_collective_algorithm(
+        collective_operation op, collective_algorithm algorithm) noexcept;
+
+    /// Return the name of the given collective algorithm, this is the name
+    /// that is accepted in the configuration database.
+    [[nodiscard]] HPX_EXPORT char const* get_collective_algorithm_name(
+        collective_algorithm algorithm) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Wraps a binary operation on values such that it is applied element by
+    /// element to two std::vector's of the same size. Passing an elementwise
+    /// operation to all_reduce allows to split the vectors into segments
+    /// (see collective_algorithm::rabenseifner).
+    template <typename F>
+    struct elementwise_op
+    {
+        template <typename T>
+        std::vector<T> operator()(
+            std::vector<T> lhs, std::vector<T> const& rhs) const
+        {
+            HPX_ASSERT(lhs.size() == rhs.size());
+            std::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs.begin(),
+                [this](T const& l, T const& r) -> T {
+                    return HPX_INVOKE(f_, l, r);
+                });
+            return lhs;
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & f_;
+            // clang-format on
+        }
+
+        F f_;
+    };
+
+    template <typename F>
+    elementwise_op<std::decay_t<F>> elementwise(F&& f)
+    {
+        return elementwise_op<std::decay_t<F>>{HPX_FORWARD(F, f)};
+    }
+}    // namespace hpx::collectives
+
+namespace hpx::traits {
+
+    /// Customization point specifying whether applying the given reduction
+    /// operation to two std::vector's is equivalent to applying it to each
+    /// pair of corresponding elements. Specializations have to derive from
+    /// std::true_type.
+    template <typename F, typename Enable = void>
+    struct is_elementwise_reduction : std::false_type
+    {
+    };
+
+    template <typename F>
+    struct is_elementwise_reduction<collectives::elementwise_op<F>>
+      : std::true_type
+    {
+    };
+
+    template <typename F>
+    inline constexpr bool is_elementwise_reduction_v =
+        is_elementwise_reduction<std::decay_t<F>>::value;
+}    // namespace hpx::traits
@@ -37,6 +37,17 @@ namespace hpx { namespace collectives {
         /// Return whether this communicator instance represents the root site
         /// of the communication operation.
         [[nodiscard]] bool is_root() const;
+
+        /// Force the algorithm used for exchanging the data of the given
+        /// collective operation on this communicator, overriding the
+        /// configured default (see hpx.lcos.collectives.algorithm). This has
+        /// to be done consistently on all participating sites.
+        ///
+        /// \param  op          The collective operation to configure.
+        /// \param  algorithm   The algorithm to use, this has to be supported
+        ///                     for the given operation.
+        void set_algorithm(
+            collective_operation op, collective_algorithm algorithm);
     };
 
     /// Create a new communicator object usable with any collective operation
@@ -107,23 +118,29 @@ namespace hpx { namespace collectives {
 
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/modules/async_base.hpp>
 #include <hpx/type_support/extra_data.hpp>
 
+#include <memory>
 #include <tuple>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::collectives::detail {
 
+    // State needed for the point-to-point based collective algorithms
+    struct collective_state;
+
     // Data stored in the shared state of the communicator client type below
     struct communicator_data
     {
         num_sites_arg num_sites_;
         this_site_arg this_site_;
         root_site_arg root_site_;
+        std::shared_ptr<collective_state> state_;
     };
 }    // namespace hpx::collectives::detail
 
@@ -189,6 +206,9 @@ namespace hpx::collectives {
         {
             return !base_type::registered_name().empty();
         }
+
+        HPX_EXPORT void set_algorithm(
+            collective_operation op, collective_algorithm algorithm);
     };
 
     ///////////////////////////////////////////////////////////////////////////
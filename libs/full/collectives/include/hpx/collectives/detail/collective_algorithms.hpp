@@ -0,0 +1,550 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    struct communicator;
+}    // namespace hpx::collectives
+
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Describes how a particular invocation of a collective operation will be
+    // performed. For all algorithms but 'centralized' the data is exchanged
+    // through the channel communicator associated with the communicator,
+    // using the tags starting at 'tag'.
+    struct collective_plan
+    {
+        collective_algorithm algorithm = collective_algorithm::centralized;
+        hpx::shared_future<hpx::collectives::channel_communicator> channel;
+        std::size_t num_sites = 0;
+        std::size_t this_site = 0;
+        std::size_t root_site = 0;
+        std::size_t tag = 0;
+    };
+
+    // Select the algorithm to use for the given operation invoked on the
+    // given communicator. The selection depends only on values that are the
+    // same on all participating sites. The message size is taken into account
+    // only for segmentable data (see collective_algorithm::rabenseifner).
+    HPX_EXPORT collective_plan select_collective_algorithm(
+        communicator const& comm, collective_operation op,
+        std::size_t generation, std::size_t message_size = 0,
+        bool segmentable = false);
+
+    // Attach the state needed for the point-to-point based algorithms to a
+    // newly created communicator, the given name has to be unique.
+    HPX_EXPORT void attach_collective_state(
+        communicator& comm, std::string const& name);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of bytes represented by a value, used for selecting the
+    // algorithm for segmentable data.
+    template <typename T>
+    std::size_t message_size(T const&) noexcept
+    {
+        return sizeof(T);
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t message_size(std::vector<T, Allocator> const& v) noexcept
+    {
+        return v.size() * sizeof(T);
+    }
+
+    template <typename T, typename F>
+    struct is_segmentable : std::false_type
+    {
+    };
+
+    template <typename T, typename Allocator, typename F>
+    struct is_segmentable<std::vector<T, Allocator>, F>
+      : std::bool_constant<traits::is_elementwise_reduction_v<F>>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sends and receives the messages of one invocation of a collective
+    // operation. Each message is identified by the step of the algorithm it
+    // belongs to, the sends are waited for at the end.
+    class collective_channel
+    {
+    public:
+        explicit collective_channel(collective_plan const& plan)
+          : comm_(plan.channel.get())
+          , tag_(plan.tag)
+        {
+        }
+
+        collective_channel(collective_channel const&) = delete;
+        collective_channel(collective_channel&&) = delete;
+        collective_channel& operator=(collective_channel const&) = delete;
+        collective_channel& operator=(collective_channel&&) = delete;
+
+        ~collective_channel() = default;
+
+        template <typename T>
+        void send(std::size_t site, T&& value, std::size_t step)
+        {
+            sends_.push_back(set(comm_, that_site_arg(site),
+                HPX_FORWARD(T, value), tag_arg(tag_ + step)));
+        }
+
+        template <typename T>
+        T receive(std::size_t site, std::size_t step)
+        {
+            return get<T>(hpx::launch::sync, comm_, that_site_arg(site),
+                tag_arg(tag_ + step));
+        }
+
+        // wait for all sends to finish, rethrows errors
+        void wait()
+        {
+            for (auto& f : sends_)
+            {
+                f.get();
+            }
+            sends_.clear();
+        }
+
+    private:
+        hpx::collectives::channel_communicator comm_;
+        std::size_t tag_;
+        std::vector<hpx::future<void>> sends_;
+    };
+
+    // Protect against vector<bool> idiosyncrasies
+    template <typename T>
+    T take_value(std::vector<T>& data, std::size_t i)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            return static_cast<bool>(data[i]);
+        }
+        else
+        {
+            return HPX_MOVE(data[i]);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Binomial tree broadcast, 'value' is used on the root site only. Every
+    // site receives the value from its parent and forwards it to its
+    // children, the root has log(num_sites) children.
+    template <typename Channel, typename T>
+    T broadcast_binomial_tree(Channel& channel, std::size_t num_sites,
+        std::size_t this_site, std::size_t root_site, T value)
+    {
+        std::size_t const rank =
+            (this_site + num_sites - root_site) % num_sites;
+
+        std::size_t mask = 1;
+        while (mask < num_sites)
+        {
+            if (rank & mask)
+            {
+                std::size_t const parent =
+                    (rank - mask + root_site) % num_sites;
+                value = channel.template receive<T>(parent, 0);
+                break;
+            }
+            mask <<= 1;
+        }
+
+        for (mask >>= 1; mask != 0; mask >>= 1)
+        {
+            if (rank + mask < num_sites)
+            {
+                channel.send((rank + mask + root_site) % num_sites, value, 0);
+            }
+        }
+
+        channel.wait();
+        return value;
+    }
+
+    // Binomial tree gather of the values of all sites to the root site. The
+    // values of the sites in a subtree are collected at the root of the
+    // subtree and are forwarded to its parent as a whole. The values are
+    // returned on the root site only, ordered by the site rank relative to the
+    // root.
+    template <typename Channel, typename T>
+    std::vector<T> gather_binomial_tree(Channel& channel, std::size_t num_sites,
+        std::size_t this_site, std::size_t root_site, T value)
+    {
+        std::size_t const rank =
+            (this_site + num_sites - root_site) % num_sites;
+
+        std::vector<T> values;
+        values.push_back(HPX_MOVE(value));
+
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1)
+        {
+            if ((rank & mask) == 0)
+            {
+                if ((rank | mask) < num_sites)
+                {
+                    std::size_t const child =
+                        ((rank | mask) + root_site) % num_sites;
+                    auto received =
+                        channel.template receive<std::vector<T>>(child, 0);
+                    for (std::size_t i = 0; i != received.size(); ++i)
+                    {
+                        values.push_back(take_value(received, i));
+                    }
+                }
+            }
+            else
+            {
+                std::size_t const parent =
+                    ((rank & ~mask) + root_site) % num_sites;
+                channel.send(parent, HPX_MOVE(values), 0);
+                channel.wait();
+                return {};
+            }
+        }
+        return values;
+    }
+
+    // The reduction is performed on the root site only as the other sites do
+    // not know the reduction operation (see reduce_there).
+    template <typename T, typename F>
+    T reduce_gathered_values(std::vector<T>& values, F& op)
+    {
+        HPX_ASSERT(!values.empty());
+
+        T result = take_value(values, 0);
+        for (std::size_t i = 1; i != values.size(); ++i)
+        {
+            result = op(HPX_MOVE(result), take_value(values, i));
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sites in [0, 2 * remainder) are paired up for the algorithms based on
+    // recursive doubling, the even sites pass their data on to the odd ones
+    // and do not participate in the main phase. This leaves a power of two
+    // participating sites.
+    struct recursive_doubling_ranks
+    {
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        // the step used for passing the result back to the even sites, this
+        // is larger than the number of steps of the main phase
+        static constexpr std::size_t final_step = 2 * 64 + 1;
+
+        recursive_doubling_ranks(
+            std::size_t num_sites, std::size_t this_site) noexcept
+          : pof2(1)
+        {
+            while (pof2 * 2 <= num_sites)
+            {
+                pof2 *= 2;
+            }
+            remainder = num_sites - pof2;
+
+            if (this_site < 2 * remainder)
+            {
+                rank = (this_site % 2 == 0) ? npos : this_site / 2;
+            }
+            else
+            {
+                rank = this_site - remainder;
+            }
+        }
+
+        // the site corresponding to a rank in the main phase
+        [[nodiscard]] std::size_t site(std::size_t r) const noexcept
+        {
+            return r < remainder ? r * 2 + 1 : r + remainder;
+        }
+
+        std::size_t pof2;
+        std::size_t remainder;
+        std::size_t rank;
+    };
+
+    // Recursive doubling all_reduce, in each step pairs of sites exchange
+    // their partial results, which takes log(num_sites) steps (plus two if
+    // num_sites is not a power of two).
+    template <typename Channel, typename T, typename F>
+    T all_reduce_recursive_doubling(Channel& channel, std::size_t num_sites,
+        std::size_t this_site, T value, F& op)
+    {
+        recursive_doubling_ranks const ranks(num_sites, this_site);
+
+        std::size_t step = 0;
+        if (this_site < 2 * ranks.remainder)
+        {
+            if (this_site % 2 == 0)
+            {
+                channel.send(this_site + 1, value, step);
+            }
+            else
+            {
+                T lhs = channel.template receive<T>(this_site - 1, step);
+                value = op(HPX_MOVE(lhs), HPX_MOVE(value));
+            }
+        }
+        ++step;
+
+        if (ranks.rank != recursive_doubling_ranks::npos)
+        {
+            for (std::size_t mask = 1; mask < ranks.pof2; mask <<= 1, ++step)
+            {
+                std::size_t const partner = ranks.site(ranks.rank ^ mask);
+
+                channel.send(partner, value, step);
+                T other = channel.template receive<T>(partner, step);
+
+                // preserve the order of the values for non-commutative
+                // operations
+                if (partner < this_site)
+                {
+                    value = op(HPX_MOVE(other), HPX_MOVE(value));
+                }
+                else
+                {
+                    value = op(HPX_MOVE(value), HPX_MOVE(other));
+                }
+            }
+        }
+
+        if (this_site < 2 * ranks.remainder)
+        {
+            if (this_site % 2 == 0)
+            {
+                value = channel.template receive<T>(
+                    this_site + 1, recursive_doubling_ranks::final_step);
+            }
+            else
+            {
+                channel.send(this_site - 1, value,
+                    recursive_doubling_ranks::final_step);
+            }
+        }
+
+        channel.wait();
+        return value;
+    }
+
+    // Rabenseifner all_reduce: a reduce-scatter by recursive halving leaves
+    // each site with the result for one segment of the vector, which is then
+    // distributed by an all-gather based on recursive doubling. This sends
+    // about 2 * size bytes per site independently of the number of sites, the
+    // reduction operation has to be element-wise.
+    template <typename Channel, typename T, typename Allocator, typename F>
+    std::vector<T, Allocator> all_reduce_rabenseifner(Channel& channel,
+        std::size_t num_sites, std::size_t this_site,
+        std::vector<T, Allocator> value, F& op)
+    {
+        using vector_type = std::vector<T, Allocator>;
+
+        recursive_doubling_ranks const ranks(num_sites, this_site);
+
+        if (this_site < 2 * ranks.remainder)
+        {
+            if (this_site % 2 == 0)
+            {
+                channel.send(this_site + 1, value, 0);
+            }
+            else
+            {
+                vector_type lhs =
+                    channel.template receive<vector_type>(this_site - 1, 0);
+                value = op(HPX_MOVE(lhs), HPX_MOVE(value));
+            }
+        }
+
+        if (ranks.rank != recursive_doubling_ranks::npos)
+        {
+            std::size_t const pof2 = ranks.pof2;
+            std::size_t const rank = ranks.rank;
+
+            // the vector is split into pof2 segments of (almost) equal size
+            std::vector<std::size_t> disps(pof2 + 1, 0);
+            for (std::size_t i = 0; i != pof2; ++i)
+            {
+                disps[i + 1] = disps[i] + value.size() / pof2 +
+                    (i < value.size() % pof2 ? 1 : 0);
+            }
+
+            auto segment = [&](std::size_t first, std::size_t last) {
+                return vector_type(value.begin() + disps[first],
+                    value.begin() + disps[last]);
+            };
+
+            // reduce-scatter (recursive halving)
+            std::size_t step = 1;
+            std::size_t send_idx = 0;
+            std::size_t recv_idx = 0;
+            std::size_t last_idx = pof2;
+
+            std::size_t mask = 1;
+            for (/**/; mask < pof2; mask <<= 1, ++step)
+            {
+                std::size_t const partner_rank = rank ^ mask;
+                std::size_t const partner = ranks.site(partner_rank);
+
+                std::size_t const half = pof2 / (mask * 2);
+                std::size_t send_first, send_last;
+                if (rank < partner_rank)
+                {
+                    send_idx = recv_idx + half;
+                    send_first = send_idx;
+                    send_last = last_idx;
+                }
+                else
+                {
+                    recv_idx = send_idx + half;
+                    send_first = send_idx;
+                    send_last = recv_idx;
+                }
+
+                channel.send(partner, segment(send_first, send_last), step);
+                vector_type other =
+                    channel.template receive<vector_type>(partner, step);
+
+                std::size_t const recv_last =
+                    rank < partner_rank ? send_idx : last_idx;
+                vector_type mine = segment(recv_idx, recv_last);
+                HPX_ASSERT(mine.size() == other.size());
+
+                mine = rank < partner_rank ?
+                    op(HPX_MOVE(mine), HPX_MOVE(other)) :
+                    op(HPX_MOVE(other), HPX_MOVE(mine));
+                std::move(mine.begin(), mine.end(),
+                    value.begin() + disps[recv_idx]);
+
+                send_idx = recv_idx;
+                last_idx = recv_idx + half;
+            }
+
+            // all-gather (recursive doubling)
+            for (mask >>= 1; mask != 0; mask >>= 1, ++step)
+            {
+                std::size_t const partner_rank = rank ^ mask;
+                std::size_t const partner = ranks.site(partner_rank);
+
+                std::size_t const half = pof2 / (mask * 2);
+                std::size_t recv_first, recv_last;
+                if (rank < partner_rank)
+                {
+                    recv_first = send_idx + half;
+                    recv_last = recv_first + half;
+                }
+                else
+                {
+                    recv_first = send_idx - half;
+                    recv_last = send_idx;
+                }
+
+                channel.send(partner, segment(send_idx, send_idx + half), step);
+                vector_type other =
+                    channel.template receive<vector_type>(partner, step);
+
+                HPX_ASSERT(
+                    other.size() == disps[recv_last] - disps[recv_first]);
+                std::move(other.begin(), other.end(),
+                    value.begin() + disps[recv_first]);
+
+                send_idx = (std::min)(send_idx, recv_first);
+            }
+        }
+
+        if (this_site < 2 * ranks.remainder)
+        {
+            if (this_site % 2 == 0)
+            {
+                value = channel.template receive<vector_type>(
+                    this_site + 1, recursive_doubling_ranks::final_step);
+            }
+            else
+            {
+                channel.send(this_site - 1, value,
+                    recursive_doubling_ranks::final_step);
+            }
+        }
+
+        channel.wait();
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Ring all_gather, in each step every site passes the value it received
+    // last on to its right neighbor.
+    template <typename Channel, typename T>
+    std::vector<T> all_gather_ring(Channel& channel, std::size_t num_sites,
+        std::size_t this_site, T value)
+    {
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        for (std::size_t step = 0; step + 1 < num_sites; ++step)
+        {
+            std::size_t const send_idx =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const recv_idx =
+                (this_site + num_sites - step - 1) % num_sites;
+
+            channel.send(right, T(result[send_idx]), step);
+            result[recv_idx] = channel.template receive<T>(left, step);
+        }
+
+        channel.wait();
+        return result;
+    }
+
+    // Pairwise all_to_all, in step i every site sends to the site i places to
+    // its right and receives from the site i places to its left.
+    template <typename Channel, typename T>
+    std::vector<T> all_to_all_pairwise(Channel& channel, std::size_t num_sites,
+        std::size_t this_site, std::vector<T> values)
+    {
+        HPX_ASSERT(values.size() == num_sites);
+
+        std::vector<T> result(num_sites);
+        result[this_site] = take_value(values, this_site);
+
+        for (std::size_t step = 1; step < num_sites; ++step)
+        {
+            std::size_t const dest = (this_site + step) % num_sites;
+            std::size_t const src = (this_site + num_sites - step) % num_sites;
+
+            channel.send(dest, take_value(values, dest), step);
+            result[src] = channel.template receive<T>(src, step);
+        }
+
+        channel.wait();
+        return result;
+    }
+}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
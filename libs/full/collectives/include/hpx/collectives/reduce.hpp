@@ -401,15 +401,19 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/format.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::traits {
 
@@ -492,6 +496,24 @@ namespace hpx::traits {
     };
 }    // namespace hpx::traits
 
+namespace hpx::collectives::detail {
+
+    // reduce based on point-to-point communication between the sites, the
+    // values are gathered along a binomial tree and are reduced on the root
+    // site (the other sites do not know the reduction operation)
+    template <typename T>
+    hpx::future<std::vector<T>> reduce_p2p(collective_plan&& plan, T&& value)
+    {
+        HPX_ASSERT(plan.algorithm == collective_algorithm::binomial_tree);
+        return hpx::async([plan = HPX_MOVE(plan),
+                              value = HPX_MOVE(value)]() mutable {
+            collective_channel channel(plan);
+            return gather_binomial_tree(channel, plan.num_sites,
+                plan.this_site, plan.root_site, HPX_MOVE(value));
+        });
+    }
+}    // namespace hpx::collectives::detail
+
 namespace hpx::collectives {
 
     ///////////////////////////////////////////////////////////////////////////
@@ -518,6 +540,31 @@ namespace hpx::collectives {
             [local_result = HPX_FORWARD(T, local_result),
                 op = HPX_FORWARD(F, op), this_site,
                 generation](communicator&& c) mutable -> hpx::future<arg_type> {
+            detail::collective_plan plan = detail::select_collective_algorithm(
+                c, collective_operation::reduce, generation);
+            if (plan.algorithm != collective_algorithm::centralized)
+            {
+                // the tree is rooted at the root site of the communicator
+                if (plan.this_site != plan.root_site)
+                {
+                    return hpx::make_exceptional_future<arg_type>(
+                        HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::collectives::reduce_here",
+                            hpx::util::format(
+                                "the value has to be reduced on the root site "
+                                "of the communicator ({}), this site is {}",
+                                plan.root_site, plan.this_site)));
+                }
+                return detail::reduce_p2p(
+                    HPX_MOVE(plan), arg_type(HPX_FORWARD(T, local_result)))
+                    .then(hpx::launch::sync,
+                        [op = HPX_FORWARD(F, op)](
+                            hpx::future<std::vector<arg_type>>&& f) mutable {
+                            auto values = f.get();
+                            return detail::reduce_gathered_values(values, op);
+                        });
+            }
+
             using func_type = std::decay_t<F>;
             using action_type =
                 detail::communicator_server::communication_get_direct_action<
@@ -616,6 +663,14 @@ namespace hpx::collectives {
         auto reduction_data =
             [local_result = HPX_FORWARD(T, local_result), this_site,
                 generation](communicator&& c) mutable -> hpx::future<void> {
+            detail::collective_plan plan = detail::select_collective_algorithm(
+                c, collective_operation::reduce, generation);
+            if (plan.algorithm != collective_algorithm::centralized)
+            {
+                return hpx::future<void>(detail::reduce_p2p(
+                    HPX_MOVE(plan), std::decay_t<T>(HPX_MOVE(local_result))));
+            }
+
             using action_type =
                 detail::communicator_server::communication_set_direct_action<
                     traits::communication::reduce_tag, hpx::future<void>,
@@ -0,0 +1,301 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/modules/lock_registration.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/synchronization/mutex.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hpx::collectives {
+
+    namespace {
+
+        constexpr char const* const operation_names[] = {
+            "all_gather", "all_reduce", "all_to_all", "broadcast", "reduce"};
+
+        constexpr char const* const algorithm_names[] = {"automatic",
+            "centralized", "binomial_tree", "recursive_doubling",
+            "rabenseifner", "ring", "pairwise"};
+
+        constexpr std::size_t num_operations = std::size(operation_names);
+    }    // namespace
+
+    bool is_supported_collective_algorithm(
+        collective_operation op, collective_algorithm algorithm) noexcept
+    {
+        switch (algorithm)
+        {
+        case collective_algorithm::automatic:
+            [[fallthrough]];
+        case collective_algorithm::centralized:
+            return true;
+
+        case collective_algorithm::binomial_tree:
+            return op == collective_operation::broadcast ||
+                op == collective_operation::reduce;
+
+        case collective_algorithm::recursive_doubling:
+            [[fallthrough]];
+        case collective_algorithm::rabenseifner:
+            return op == collective_operation::all_reduce;
+
+        case collective_algorithm::ring:
+            return op == collective_operation::all_gather;
+
+        case collective_algorithm::pairwise:
+            return op == collective_operation::all_to_all;
+
+        default:
+            break;
+        }
+        return false;
+    }
+
+    char const* get_collective_algorithm_name(
+        collective_algorithm algorithm) noexcept
+    {
+        auto const index = static_cast<std::size_t>(algorithm);
+        if (index < std::size(algorithm_names))
+        {
+            return algorithm_names[index];
+        }
+        return "<unknown>";
+    }
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        struct collective_state
+        {
+            explicit collective_state(std::string basename)
+              : basename_(HPX_MOVE(basename))
+              , min_sites_(hpx::util::from_string<std::size_t>(
+                    get_config_entry("hpx.lcos.collectives.p2p_threshold",
+                        32)))    //-V112
+              , segmented_threshold_(hpx::util::from_string<std::size_t>(
+                    get_config_entry("hpx.lcos.collectives.segmented_threshold",
+                        65536)))
+            {
+                for (std::size_t i = 0; i != num_operations; ++i)
+                {
+                    auto const op = static_cast<collective_operation>(i);
+                    algorithms_[i] = parse_algorithm(op,
+                        get_config_entry(
+                            std::string("hpx.lcos.collectives.algorithm.") +
+                                operation_names[i],
+                            "automatic"));
+                }
+            }
+
+            static collective_algorithm parse_algorithm(
+                collective_operation op, std::string const& name)
+            {
+                auto const* it = std::find(std::begin(algorithm_names),
+                    std::end(algorithm_names), name);
+                if (it != std::end(algorithm_names))
+                {
+                    auto const algorithm = static_cast<collective_algorithm>(
+                        it - std::begin(algorithm_names));
+                    if (is_supported_collective_algorithm(op, algorithm))
+                    {
+                        return algorithm;
+                    }
+                }
+
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::detail::collective_state",
+                    "invalid collective algorithm configured for {}: '{}'",
+                    operation_names[static_cast<std::size_t>(op)], name);
+            }
+
+            // The algorithm to use if none was forced explicitly, all sites
+            // have to arrive at the same result.
+            [[nodiscard]] collective_algorithm select(collective_operation op,
+                std::size_t num_sites, std::size_t message_size,
+                bool segmentable) const noexcept
+            {
+                if (num_sites < min_sites_)
+                {
+                    return collective_algorithm::centralized;
+                }
+
+                switch (op)
+                {
+                case collective_operation::all_gather:
+                    return collective_algorithm::ring;
+
+                case collective_operation::all_reduce:
+                    return segmentable && message_size >= segmented_threshold_ ?
+                        collective_algorithm::rabenseifner :
+                        collective_algorithm::recursive_doubling;
+
+                case collective_operation::all_to_all:
+                    return collective_algorithm::pairwise;
+
+                case collective_operation::broadcast:
+                    [[fallthrough]];
+                case collective_operation::reduce:
+                    return collective_algorithm::binomial_tree;
+
+                default:
+                    break;
+                }
+                return collective_algorithm::centralized;
+            }
+
+            // the number of operations that may use the channel communicator
+            // concurrently without their messages interfering
+            static constexpr std::size_t num_tag_ranges = 16;
+
+            hpx::mutex mtx_;
+            std::string const basename_;
+            std::size_t const min_sites_;
+            std::size_t const segmented_threshold_;
+            std::array<collective_algorithm, num_operations> algorithms_;
+            hpx::shared_future<collectives::channel_communicator> channel_;
+            std::size_t sequence_number_ = 0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        void attach_collective_state(
+            communicator& comm, std::string const& name)
+        {
+            std::string basename(name);
+            if (basename.empty() || basename.back() != '/')
+            {
+                basename += '/';
+            }
+            basename += "p2p";
+
+            comm.get_extra_data<communicator_data>().state_ =
+                std::make_shared<collective_state>(HPX_MOVE(basename));
+        }
+
+        collective_plan select_collective_algorithm(communicator const& comm,
+            collective_operation op, std::size_t generation,
+            std::size_t message_size, bool segmentable)
+        {
+            collective_plan plan;
+
+            auto const* data = comm.try_get_extra_data<communicator_data>();
+            if (data == nullptr || !data->state_ ||
+                data->num_sites_ == static_cast<std::size_t>(-1) ||
+                data->this_site_ == static_cast<std::size_t>(-1))
+            {
+                // no support for point-to-point based algorithms (local
+                // communicator)
+                return plan;
+            }
+
+            collective_state& state = *data->state_;
+
+            plan.num_sites = data->num_sites_;
+            plan.this_site = data->this_site_;
+            plan.root_site = data->root_site_;
+
+            std::unique_lock l(state.mtx_);
+            [[maybe_unused]] util::ignore_while_checking il(&l);
+
+            plan.algorithm = state.algorithms_[static_cast<std::size_t>(op)];
+            if (plan.algorithm == collective_algorithm::automatic)
+            {
+                plan.algorithm =
+                    state.select(op, plan.num_sites, message_size, segmentable);
+            }
+            else if (plan.algorithm == collective_algorithm::rabenseifner &&
+                !segmentable)
+            {
+                plan.algorithm = collective_algorithm::recursive_doubling;
+            }
+
+            if (plan.algorithm == collective_algorithm::centralized ||
+                plan.num_sites == 1)
+            {
+                plan.algorithm = collective_algorithm::centralized;
+                return plan;
+            }
+
+            // create the channel communicator on first use, all sites do
+            // this for the same operation
+            if (!state.channel_.valid())
+            {
+                state.channel_ = create_channel_communicator(
+                    state.basename_.c_str(), num_sites_arg(plan.num_sites),
+                    this_site_arg(plan.this_site));
+            }
+            plan.channel = state.channel_;
+
+            // The operations are identified by their generation, if given,
+            // or by the order in which they are invoked otherwise.
+            std::size_t const sequence_number =
+                generation != static_cast<std::size_t>(-1) ?
+                generation :
+                ++state.sequence_number_;
+
+            // Every operation uses its own range of tags, the ranges are
+            // reused such that the number of channels stays bounded.
+            std::size_t const tags_per_operation = (std::max)(plan.num_sites,
+                2 * recursive_doubling_ranks::final_step);
+            plan.tag = (sequence_number % collective_state::num_tag_ranges) *
+                tags_per_operation;
+
+            return plan;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void communicator::set_algorithm(
+        collective_operation op, collective_algorithm algorithm)
+    {
+        if (!is_supported_collective_algorithm(op, algorithm))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::collectives::communicator::set_algorithm",
+                "the collective algorithm {} can't be used for {}",
+                get_collective_algorithm_name(algorithm),
+                operation_names[static_cast<std::size_t>(op)]);
+        }
+
+        wait();    // make sure the communicator was created
+
+        auto const* data = try_get_extra_data<detail::communicator_data>();
+        if (data == nullptr || !data->state_)
+        {
+            if (algorithm == collective_algorithm::automatic ||
+                algorithm == collective_algorithm::centralized)
+            {
+                return;    // nothing to do
+            }
+
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "hpx::collectives::communicator::set_algorithm",
+                "this communicator supports only the centralized algorithm");
+        }
+
+        std::unique_lock l(data->state_->mtx_);
+        data->state_->algorithms_[static_cast<std::size_t>(op)] = algorithm;
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
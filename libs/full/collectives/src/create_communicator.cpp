@@ -11,6 +11,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components/basename_registration.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/server/component.hpp>
@@ -75,12 +76,11 @@ namespace hpx::collectives {
     void communicator::set_info(num_sites_arg num_sites,
         this_site_arg this_site, root_site_arg root_site) noexcept
     {
-        auto& [num_sites_, this_site_, root_site_] =
-            get_extra_data<detail::communicator_data>();
+        auto& data = get_extra_data<detail::communicator_data>();
 
-        num_sites_ = num_sites;
-        this_site_ = this_site;
-        root_site_ = root_site;
+        data.num_sites_ = num_sites;
+        data.this_site_ = this_site;
+        data.root_site_ = root_site;
     }
 
     std::pair<num_sites_arg, this_site_arg> communicator::get_info()
@@ -150,7 +150,7 @@ namespace hpx::collectives {
             // register the communicator's id using the given basename, this
             // keeps the communicator alive
             auto f = c.register_as(
-                hpx::detail::name_from_basename(HPX_MOVE(name), this_site));
+                hpx::detail::name_from_basename(name, this_site));
 
             return f.then(hpx::launch::sync,
                 [=, target = HPX_MOVE(c)](hpx::future<bool>&& fut) mutable {
@@ -163,14 +163,16 @@ namespace hpx::collectives {
                             target.registered_name());
                     }
                     target.set_info(num_sites, this_site, root_site);
+                    detail::attach_collective_state(target, name);
                     return target;
                 });
         }
 
         // find existing communicator
-        return hpx::find_from_basename<communicator>(HPX_MOVE(name), root_site)
+        return hpx::find_from_basename<communicator>(name, root_site)
             .then(hpx::launch::sync, [=](communicator&& c) {
                 c.set_info(num_sites, this_site, root_site);
+                detail::attach_collective_state(c, name);
                 return HPX_MOVE(c);
             });
     }
@@ -210,7 +212,7 @@ namespace hpx::collectives {
             // register the communicator's id using the given basename, this
             // keeps the communicator alive
             auto f = c.register_as(
-                hpx::detail::name_from_basename(HPX_MOVE(name), this_site));
+                hpx::detail::name_from_basename(name, this_site));
 
             if (bool const result = f.get(); !result)
             {
@@ -222,13 +224,14 @@ namespace hpx::collectives {
             }
 
             c.set_info(num_sites, this_site, root_site);
+            detail::attach_collective_state(c, name);
             return c;
         }
 
         // find existing communicator
-        auto c = hpx::find_from_basename<communicator>(
-            policy, HPX_MOVE(name), root_site);
+        auto c = hpx::find_from_basename<communicator>(policy, name, root_site);
         c.set_info(num_sites, this_site, root_site);
+        detail::attach_collective_state(c, name);
         return c;
     }
 
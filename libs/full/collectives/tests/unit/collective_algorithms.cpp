@@ -0,0 +1,256 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr char const* collective_algorithms_basename =
+    "/test/collective_algorithms/";
+#if defined(HPX_DEBUG)
+constexpr int ITERATIONS = 10;
+#else
+constexpr int ITERATIONS = 100;
+#endif
+
+communicator make_communicator(
+    char const* name, collective_operation op, collective_algorithm algorithm)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto comm =
+        create_communicator((std::string(collective_algorithms_basename) + name)
+                                .c_str(),
+            num_sites_arg(num_localities), this_site_arg(here));
+
+    // all sites have to select the same algorithm
+    comm.set_algorithm(op, algorithm);
+    return comm;
+}
+
+void test_broadcast()
+{
+    std::uint32_t const here = hpx::get_locality_id();
+
+    auto const comm = make_communicator("broadcast",
+        collective_operation::broadcast, collective_algorithm::binomial_tree);
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        if (here == 0)
+        {
+            hpx::future<std::uint32_t> result = broadcast_to(comm,
+                static_cast<std::uint32_t>(42 + i), generation_arg(i + 1));
+            HPX_TEST_EQ(static_cast<std::uint32_t>(42 + i), result.get());
+        }
+        else
+        {
+            hpx::future<std::uint32_t> result =
+                broadcast_from<std::uint32_t>(comm, generation_arg(i + 1));
+            HPX_TEST_EQ(static_cast<std::uint32_t>(42 + i), result.get());
+        }
+    }
+}
+
+void test_reduce()
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto const comm = make_communicator("reduce",
+        collective_operation::reduce, collective_algorithm::binomial_tree);
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        if (here == 0)
+        {
+            hpx::future<std::uint32_t> result = reduce_here(comm, here + i,
+                std::plus<std::uint32_t>{}, generation_arg(i + 1));
+
+            std::uint32_t sum = 0;
+            for (std::uint32_t j = 0; j != num_localities; ++j)
+            {
+                sum += j + i;
+            }
+            HPX_TEST_EQ(sum, result.get());
+        }
+        else
+        {
+            reduce_there(comm, here + i, generation_arg(i + 1)).get();
+        }
+    }
+}
+
+void test_all_reduce(collective_algorithm algorithm)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto const comm = make_communicator(
+        get_collective_algorithm_name(algorithm),
+        collective_operation::all_reduce, algorithm);
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        hpx::future<std::uint32_t> result = all_reduce(comm, here + i,
+            std::plus<std::uint32_t>{}, generation_arg(2 * i + 1));
+
+        std::uint32_t sum = 0;
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            sum += j + i;
+        }
+        HPX_TEST_EQ(sum, result.get());
+
+        // element-wise reduction of vectors, the segment sizes differ if the
+        // number of elements is not divisible by the number of sites
+        std::size_t const size = 2 * num_localities + 1;
+        std::vector<std::uint32_t> values(size);
+        for (std::size_t j = 0; j != size; ++j)
+        {
+            values[j] = static_cast<std::uint32_t>(here * size + j);
+        }
+
+        hpx::future<std::vector<std::uint32_t>> vector_result =
+            all_reduce(comm, std::move(values),
+                elementwise(std::plus<std::uint32_t>{}),
+                generation_arg(2 * i + 2));
+
+        std::vector<std::uint32_t> expected(size, 0);
+        for (std::uint32_t site = 0; site != num_localities; ++site)
+        {
+            for (std::size_t j = 0; j != size; ++j)
+            {
+                expected[j] += static_cast<std::uint32_t>(site * size + j);
+            }
+        }
+        HPX_TEST(expected == vector_result.get());
+    }
+}
+
+void test_all_gather()
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto const comm = make_communicator("all_gather",
+        collective_operation::all_gather, collective_algorithm::ring);
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        hpx::future<std::vector<std::uint32_t>> result =
+            all_gather(comm, here + i, generation_arg(i + 1));
+
+        std::vector<std::uint32_t> const r = result.get();
+        HPX_TEST_EQ(r.size(), static_cast<std::size_t>(num_localities));
+        for (std::size_t j = 0; j != r.size(); ++j)
+        {
+            HPX_TEST_EQ(r[j], static_cast<std::uint32_t>(j + i));
+        }
+    }
+}
+
+void test_all_to_all()
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    auto const comm = make_communicator("all_to_all",
+        collective_operation::all_to_all, collective_algorithm::pairwise);
+
+    for (int i = 0; i != ITERATIONS; ++i)
+    {
+        std::vector<std::uint32_t> values(num_localities);
+        for (std::uint32_t j = 0; j != num_localities; ++j)
+        {
+            values[j] = 100 * here + j + i;
+        }
+
+        hpx::future<std::vector<std::uint32_t>> result =
+            all_to_all(comm, std::move(values), generation_arg(i + 1));
+
+        std::vector<std::uint32_t> const r = result.get();
+        HPX_TEST_EQ(r.size(), static_cast<std::size_t>(num_localities));
+        for (std::uint32_t j = 0; j != r.size(); ++j)
+        {
+            HPX_TEST_EQ(r[j], 100 * j + here + i);
+        }
+    }
+}
+
+void test_supported_algorithms()
+{
+    HPX_TEST(is_supported_collective_algorithm(
+        collective_operation::reduce, collective_algorithm::binomial_tree));
+    HPX_TEST(!is_supported_collective_algorithm(
+        collective_operation::reduce, collective_algorithm::ring));
+    HPX_TEST(is_supported_collective_algorithm(
+        collective_operation::all_to_all, collective_algorithm::centralized));
+
+    bool caught_exception = false;
+    try
+    {
+        make_communicator("invalid", collective_operation::all_gather,
+            collective_algorithm::pairwise);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_NETWORKING)
+    if (hpx::get_num_localities(hpx::launch::sync) > 1)
+    {
+        test_broadcast();
+        test_reduce();
+        test_all_reduce(collective_algorithm::recursive_doubling);
+        test_all_reduce(collective_algorithm::rabenseifner);
+        test_all_gather();
+        test_all_to_all();
+    }
+#endif
+
+    test_supported_algorithms();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+
+#endif
@@ -0,0 +1,291 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Run the point-to-point collective algorithms for 1 to 9 sites inside a
+// single process. Each site is represented by a thread, the messages are
+// exchanged through an in-memory channel. This covers the paths which depend
+// on the number of sites (e.g. the remainder handling of the recursive
+// doubling based algorithms) without having to launch that many localities.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/collectives/detail/collective_algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <any>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives::detail;
+
+constexpr std::size_t max_sites = 9;
+
+///////////////////////////////////////////////////////////////////////////////
+// The messages in flight, identified by sender, receiver, and step.
+struct local_network
+{
+    using key_type = std::tuple<std::size_t, std::size_t, std::size_t>;
+
+    std::mutex mtx;
+    std::condition_variable cond;
+    std::map<key_type, std::deque<std::any>> messages;
+};
+
+// Implements the channel interface expected by the algorithms (see
+// collective_channel) for one of the sites.
+class local_channel
+{
+public:
+    local_channel(local_network& network, std::size_t this_site) noexcept
+      : network_(network)
+      , this_site_(this_site)
+    {
+    }
+
+    template <typename T>
+    void send(std::size_t site, T&& value, std::size_t step)
+    {
+        {
+            std::lock_guard<std::mutex> l(network_.mtx);
+            network_.messages[{this_site_, site, step}].emplace_back(
+                std::decay_t<T>(HPX_FORWARD(T, value)));
+        }
+        network_.cond.notify_all();
+    }
+
+    template <typename T>
+    T receive(std::size_t site, std::size_t step)
+    {
+        std::unique_lock<std::mutex> l(network_.mtx);
+        auto& queue = network_.messages[{site, this_site_, step}];
+        network_.cond.wait(l, [&] { return !queue.empty(); });
+
+        T value = std::any_cast<T>(HPX_MOVE(queue.front()));
+        queue.pop_front();
+        return value;
+    }
+
+    void wait() noexcept {}
+
+private:
+    local_network& network_;
+    std::size_t this_site_;
+};
+
+// Invoke f(channel, site) concurrently for all sites, returns the results
+// of all sites.
+template <typename F>
+auto run_sites(std::size_t num_sites, F f)
+{
+    local_network network;
+
+    using result_type =
+        decltype(f(std::declval<local_channel&>(), std::size_t()));
+    std::vector<result_type> results(num_sites);
+
+    std::vector<std::thread> threads;
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        threads.emplace_back([&, site] {
+            local_channel channel(network, site);
+            results[site] = f(channel, site);
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // all messages were consumed
+    for (auto const& message : network.messages)
+    {
+        HPX_TEST(message.second.empty());
+    }
+
+    return results;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_broadcast(std::size_t num_sites)
+{
+    for (std::size_t root = 0; root != num_sites; ++root)
+    {
+        auto const results = run_sites(
+            num_sites, [&](local_channel& channel, std::size_t site) {
+                std::uint32_t const value =
+                    site == root ? static_cast<std::uint32_t>(42 + root) : 0;
+                return broadcast_binomial_tree(
+                    channel, num_sites, site, root, value);
+            });
+
+        for (std::uint32_t r : results)
+        {
+            HPX_TEST_EQ(r, static_cast<std::uint32_t>(42 + root));
+        }
+    }
+}
+
+void test_gather(std::size_t num_sites)
+{
+    for (std::size_t root = 0; root != num_sites; ++root)
+    {
+        auto const results = run_sites(
+            num_sites, [&](local_channel& channel, std::size_t site) {
+                return gather_binomial_tree(channel, num_sites, site, root,
+                    static_cast<std::uint32_t>(site * 10));
+            });
+
+        // the values are ordered by the site rank relative to the root
+        HPX_TEST_EQ(results[root].size(), num_sites);
+        for (std::size_t i = 0; i != results[root].size(); ++i)
+        {
+            HPX_TEST_EQ(results[root][i],
+                static_cast<std::uint32_t>((root + i) % num_sites * 10));
+        }
+
+        for (std::size_t site = 0; site != num_sites; ++site)
+        {
+            if (site != root)
+            {
+                HPX_TEST(results[site].empty());
+            }
+        }
+    }
+}
+
+void test_all_reduce_recursive_doubling(std::size_t num_sites)
+{
+    // a non-commutative operation verifies the order the values are
+    // combined in
+    auto const results =
+        run_sites(num_sites, [&](local_channel& channel, std::size_t site) {
+            auto op = [](std::string lhs, std::string const& rhs) {
+                return lhs += rhs;
+            };
+            return all_reduce_recursive_doubling(
+                channel, num_sites, site, std::to_string(site), op);
+        });
+
+    std::string expected;
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        expected += std::to_string(site);
+    }
+
+    for (auto const& r : results)
+    {
+        HPX_TEST_EQ(r, expected);
+    }
+}
+
+void test_all_reduce_rabenseifner(std::size_t num_sites)
+{
+    // the sizes include vectors with less elements than sites and sizes not
+    // divisible by the number of participating sites
+    for (std::size_t size : {std::size_t(0), std::size_t(1), num_sites,
+             2 * num_sites + 1, std::size_t(100)})
+    {
+        auto const results = run_sites(
+            num_sites, [&](local_channel& channel, std::size_t site) {
+                std::vector<std::uint32_t> values(size);
+                for (std::size_t j = 0; j != size; ++j)
+                {
+                    values[j] = static_cast<std::uint32_t>(site * size + j);
+                }
+
+                auto op = hpx::collectives::elementwise(
+                    [](std::uint32_t lhs, std::uint32_t rhs) {
+                        return lhs + rhs;
+                    });
+                return all_reduce_rabenseifner(
+                    channel, num_sites, site, HPX_MOVE(values), op);
+            });
+
+        std::vector<std::uint32_t> expected(size, 0);
+        for (std::size_t site = 0; site != num_sites; ++site)
+        {
+            for (std::size_t j = 0; j != size; ++j)
+            {
+                expected[j] += static_cast<std::uint32_t>(site * size + j);
+            }
+        }
+
+        for (auto const& r : results)
+        {
+            HPX_TEST(r == expected);
+        }
+    }
+}
+
+void test_all_gather_ring(std::size_t num_sites)
+{
+    auto const results =
+        run_sites(num_sites, [&](local_channel& channel, std::size_t site) {
+            return all_gather_ring(channel, num_sites, site,
+                static_cast<std::uint32_t>(site + 7));
+        });
+
+    for (auto const& r : results)
+    {
+        HPX_TEST_EQ(r.size(), num_sites);
+        for (std::size_t j = 0; j != r.size(); ++j)
+        {
+            HPX_TEST_EQ(r[j], static_cast<std::uint32_t>(j + 7));
+        }
+    }
+}
+
+void test_all_to_all_pairwise(std::size_t num_sites)
+{
+    auto const results =
+        run_sites(num_sites, [&](local_channel& channel, std::size_t site) {
+            std::vector<std::uint32_t> values(num_sites);
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                values[j] = static_cast<std::uint32_t>(100 * site + j);
+            }
+            return all_to_all_pairwise(
+                channel, num_sites, site, HPX_MOVE(values));
+        });
+
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        HPX_TEST_EQ(results[site].size(), num_sites);
+        for (std::size_t j = 0; j != results[site].size(); ++j)
+        {
+            HPX_TEST_EQ(
+                results[site][j], static_cast<std::uint32_t>(100 * j + site));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    for (std::size_t num_sites = 1; num_sites <= max_sites; ++num_sites)
+    {
+        test_broadcast(num_sites);
+        test_gather(num_sites);
+        test_all_reduce_recursive_doubling(num_sites);
+        test_all_reduce_rabenseifner(num_sites);
+        test_all_gather_ring(num_sites);
+        test_all_to_all_pairwise(num_sites);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -9,3 +9,5 @@
 
 #include <hpx/parallel/algorithms/partition.hpp>
 #include <hpx/parallel/container_algorithms/partition.hpp>
+
+#include <hpx/parallel/segmented_algorithms/partition.hpp>
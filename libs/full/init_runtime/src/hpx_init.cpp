@@ -13,6 +13,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling/command_line_handling.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 #include <hpx/execution/detail/execution_parameter_callbacks.hpp>
 #include <hpx/executors/exception_list.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -430,6 +431,8 @@ namespace hpx {
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
 #endif
+            threads::coroutines::detail::stack_pool::get().configure(
+                cmdline.rtcfg_.get_stack_pool_parameters());
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
             {
@@ -23,6 +23,7 @@
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/performance_counters/agas_counter_types.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
+#include <hpx/performance_counters/synchronization_counter_types.hpp>
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
@@ -68,6 +69,10 @@ namespace hpx { namespace detail {
         lbt_ << "(2nd stage) pre_main: registered thread-manager performance "
                 "counter types";
 
+        performance_counters::register_synchronization_counter_types();
+        lbt_ << "(2nd stage) pre_main: registered synchronization performance "
+                "counter types";
+
 #if defined(HPX_HAVE_NETWORKING)
         performance_counters::register_parcelhandler_counter_types(
             applier::get_applier().get_parcel_handler());
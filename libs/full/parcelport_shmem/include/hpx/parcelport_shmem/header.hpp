@@ -0,0 +1,114 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/parcelport_shmem/ring.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::parcelset::policies::shmem {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every message is announced by a record in the ring of the receiving
+    // locality. The record starts with this header. Small messages are
+    // placed into the ring directly (following the header), large messages
+    // are placed into a separate shared memory segment created by the sender
+    // which is mapped (and thereby taken over) by the receiver.
+    struct header
+    {
+        // size of the non-zero-copy data (parcel_buffer::size_)
+        std::uint64_t size;
+
+        // overall size of the serialized data (parcel_buffer::data_size_)
+        std::uint64_t data_size;
+
+        std::uint32_t num_zero_copy_chunks;
+        std::uint32_t num_non_zero_copy_chunks;
+
+        // id of the segment holding the message, zero if the message follows
+        // the header in the ring
+        std::uint64_t segment;
+    };
+
+    static_assert(sizeof(header) % record_alignment == 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Describes where the parts of a message are placed, relative to the
+    // beginning of the message payload (the transmission chunks, the
+    // non-zero-copy data, and all zero-copy chunks, in this order).
+    class message_layout
+    {
+    public:
+        using buffer_type = parcel_buffer<>;
+        using transmission_chunk_type = buffer_type::transmission_chunk_type;
+
+        // Data placed into a segment is aligned to cache lines, which allows
+        // de-serialized objects to directly refer to the received data.
+        message_layout(header const& hdr,
+            transmission_chunk_type const* transmission_chunks,
+            bool in_segment) noexcept
+          : alignment_(in_segment ? ring_alignment : record_alignment)
+          , hdr_(hdr)
+          , transmission_chunks_(transmission_chunks)
+        {
+        }
+
+        [[nodiscard]] std::size_t num_transmission_chunks() const noexcept
+        {
+            return static_cast<std::size_t>(hdr_.num_zero_copy_chunks) +
+                static_cast<std::size_t>(hdr_.num_non_zero_copy_chunks);
+        }
+
+        [[nodiscard]] std::size_t data_offset() const noexcept
+        {
+            return align_up(num_transmission_chunks() *
+                    sizeof(transmission_chunk_type),
+                alignment_);
+        }
+
+        // offset of the first zero-copy chunk, the offsets of the remaining
+        // chunks are found using next_chunk_offset()
+        [[nodiscard]] std::size_t first_chunk_offset() const noexcept
+        {
+            return align_up(data_offset() + hdr_.size, alignment_);
+        }
+
+        [[nodiscard]] std::size_t chunk_size(std::size_t i) const noexcept
+        {
+            return static_cast<std::size_t>(transmission_chunks_[i].second);
+        }
+
+        [[nodiscard]] std::size_t next_chunk_offset(
+            std::size_t offset, std::size_t i) const noexcept
+        {
+            return align_up(offset + chunk_size(i), alignment_);
+        }
+
+        // overall size of the payload
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            std::size_t offset = first_chunk_offset();
+            for (std::size_t i = 0; i != hdr_.num_zero_copy_chunks; ++i)
+            {
+                offset = next_chunk_offset(offset, i);
+            }
+            return offset;
+        }
+
+    private:
+        std::size_t alignment_;
+        header const& hdr_;
+        transmission_chunk_type const* transmission_chunks_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,305 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/ring.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    template <typename Parcelport>
+    struct receiver
+    {
+        using buffer_type = parcel_buffer<>;
+        using transmission_chunk_type = buffer_type::transmission_chunk_type;
+
+        receiver(Parcelport& pp, std::uint64_t here, std::size_t num_rings,
+            std::size_t ring_size)
+          : pp_(pp)
+          , segment_(shared_memory_segment::create(make_segment_name(here),
+                mailbox::segment_size(num_rings, ring_size)))
+          , mailbox_(
+                mailbox::initialize(segment_.data(), num_rings, ring_size))
+          , rings_(num_rings)
+          , num_claimed_(0)
+          , next_ring_(0)
+        {
+        }
+
+        static constexpr void run() noexcept {}
+
+        // receive at most one message, returns whether a message was received
+        bool background_work(std::size_t num_thread)
+        {
+            std::size_t const num_rings = update_claimed_rings();
+            if (num_rings == 0)
+            {
+                return false;
+            }
+
+            std::size_t const first =
+                next_ring_.fetch_add(1, std::memory_order_relaxed) % num_rings;
+
+            for (std::size_t i = 0; i != num_rings; ++i)
+            {
+                ring_data& r = rings_[(first + i) % num_rings];
+
+                std::unique_lock l(r.mtx, std::try_to_lock);
+                if (!l.owns_lock())
+                {
+                    continue;
+                }
+
+                std::size_t size = 0;
+                void const* record = r.view.try_peek(size);
+                if (record != nullptr)
+                {
+                    HPX_ASSERT(size >= sizeof(header));
+                    receive_message(l, r, record, size, num_thread);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        struct ring_data
+        {
+            hpx::spinlock mtx;
+            ring view;
+            std::uint64_t owner = 0;
+        };
+
+        // Rings are claimed by the senders in order and are never handed
+        // back, which allows to look at the claimed rings only.
+        std::size_t update_claimed_rings() noexcept
+        {
+            std::size_t claimed = num_claimed_.load(std::memory_order_acquire);
+            if (claimed == rings_.size())
+            {
+                return claimed;
+            }
+
+            std::unique_lock l(claim_mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                return claimed;
+            }
+
+            claimed = num_claimed_.load(std::memory_order_relaxed);
+            while (claimed != rings_.size())
+            {
+                ring const view = mailbox_.get_ring(claimed);
+                std::uint64_t const owner =
+                    view.control()->owner.load(std::memory_order_acquire);
+                if (owner == 0)
+                {
+                    break;
+                }
+
+                rings_[claimed].view = view;
+                rings_[claimed].owner = owner;
+                ++claimed;
+            }
+
+            num_claimed_.store(claimed, std::memory_order_release);
+            return claimed;
+        }
+
+        template <typename Lock>
+        void receive_message(Lock& l, ring_data& r, void const* record,
+            std::size_t size, std::size_t num_thread)
+        {
+            header hdr;
+            std::memcpy(&hdr, record, sizeof(header));
+
+            buffer_type buffer;
+            buffer.size_ = hdr.size;
+            buffer.data_size_ = hdr.data_size;
+            buffer.num_chunks_.first = hdr.num_zero_copy_chunks;
+            buffer.num_chunks_.second = hdr.num_non_zero_copy_chunks;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer.data_point_.bytes_ = static_cast<std::size_t>(size);
+#endif
+            if (hdr.segment != 0)
+            {
+                // the message was placed into a segment of its own, the
+                // segment is removed as soon as it has been mapped
+                HPX_ASSERT(size == sizeof(header));
+                auto segment = std::make_shared<shared_memory_segment>(
+                    shared_memory_segment::open(
+                        make_segment_name(r.owner, hdr.segment)));
+                segment->unlink();
+
+                r.view.release();
+                l.unlock();
+
+                receive_from_segment(HPX_MOVE(buffer), hdr,
+                    HPX_MOVE(segment), num_thread);
+                return;
+            }
+
+            char const* payload =
+                static_cast<char const*>(record) + sizeof(header);
+            message_layout const layout =
+                read_layout(buffer, hdr, payload, false);
+
+            auto const num_zero_copy_chunks =
+                static_cast<std::size_t>(hdr.num_zero_copy_chunks);
+            buffer.chunks_.resize(num_zero_copy_chunks);
+
+            if (num_zero_copy_chunks != 0 &&
+                pp_.allow_zero_copy_receive_optimizations())
+            {
+                // De-serialize the parcels such that the zero-copy chunks are
+                // copied from the ring directly into their final location.
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    buffer.chunks_[i] = serialization::create_pointer_chunk(
+                        nullptr, layout.chunk_size(i));
+                }
+
+                std::vector<parcelset::parcel> parcels =
+                    decode_parcels_zero_copy(pp_, buffer, num_thread);
+
+                std::size_t offset = layout.first_chunk_offset();
+                std::size_t idx = 0;
+                for (auto& c : buffer.chunks_)
+                {
+                    if (c.type_ == serialization::chunk_type::chunk_type_index)
+                    {
+                        continue;    // skip non-zero-copy chunks
+                    }
+
+                    std::memcpy(c.data(), payload + offset, c.size());
+                    offset = layout.next_chunk_offset(offset, idx++);
+                }
+                HPX_ASSERT(idx == num_zero_copy_chunks);
+
+                r.view.release();
+                l.unlock();
+
+                handle_received_parcels(HPX_MOVE(parcels), num_thread);
+                return;
+            }
+
+            if (num_zero_copy_chunks != 0)
+            {
+                // Copy all zero-copy chunks into a single buffer which is
+                // handed to the de-serialization, this allows for types like
+                // serialize_buffer to take ownership of the received data.
+                std::size_t const first_chunk = layout.first_chunk_offset();
+                std::size_t const chunks_size = layout.size() - first_chunk;
+                std::shared_ptr<char[]> const chunks(new char[chunks_size]);
+
+                std::memcpy(chunks.get(), payload + first_chunk, chunks_size);
+
+                std::size_t offset = first_chunk;
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    char* data = chunks.get() + (offset - first_chunk);
+                    buffer.chunks_[i] = serialization::create_pointer_chunk(
+                        data, layout.chunk_size(i));
+                    buffer.received_chunks_.add(
+                        data, std::shared_ptr<void>(chunks, data));
+
+                    offset = layout.next_chunk_offset(offset, i);
+                }
+            }
+
+            r.view.release();
+            l.unlock();
+
+            handle_received_parcels(
+                decode_parcels(pp_, HPX_MOVE(buffer), num_thread), num_thread);
+        }
+
+        void receive_from_segment(buffer_type&& buffer, header const& hdr,
+            std::shared_ptr<shared_memory_segment>&& segment,
+            std::size_t num_thread)
+        {
+            char* payload = static_cast<char*>(segment->data());
+            message_layout const layout =
+                read_layout(buffer, hdr, payload, true);
+
+            // The zero-copy chunks are left in place, the de-serialized
+            // objects may refer to them directly. The segment is unmapped
+            // once the last of those objects has been destroyed.
+            auto const num_zero_copy_chunks =
+                static_cast<std::size_t>(hdr.num_zero_copy_chunks);
+            buffer.chunks_.resize(num_zero_copy_chunks);
+
+            std::size_t offset = layout.first_chunk_offset();
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                char* data = payload + offset;
+                buffer.chunks_[i] = serialization::create_pointer_chunk(
+                    data, layout.chunk_size(i));
+                buffer.received_chunks_.add(
+                    data, std::shared_ptr<void>(segment, data));
+
+                offset = layout.next_chunk_offset(offset, i);
+            }
+
+            handle_received_parcels(
+                decode_parcels(pp_, HPX_MOVE(buffer), num_thread), num_thread);
+        }
+
+        // extract the transmission chunks and the non-zero-copy data
+        static message_layout read_layout(buffer_type& buffer,
+            header const& hdr, char const* payload, bool in_segment)
+        {
+            auto& tchunks = buffer.transmission_chunks_;
+            tchunks.resize(static_cast<std::size_t>(hdr.num_zero_copy_chunks) +
+                static_cast<std::size_t>(hdr.num_non_zero_copy_chunks));
+            if (!tchunks.empty())
+            {
+                std::memcpy(static_cast<void*>(tchunks.data()), payload,
+                    tchunks.size() * sizeof(transmission_chunk_type));
+            }
+
+            message_layout layout(hdr, tchunks.data(), in_segment);
+
+            buffer.data_.resize(static_cast<std::size_t>(hdr.size));
+            std::memcpy(buffer.data_.data(), payload + layout.data_offset(),
+                buffer.data_.size());
+
+            return layout;
+        }
+
+        Parcelport& pp_;
+
+        shared_memory_segment segment_;
+        mailbox mailbox_;
+
+        std::vector<ring_data> rings_;
+        hpx::spinlock claim_mtx_;
+        std::atomic<std::size_t> num_claimed_;
+        std::atomic<std::size_t> next_ring_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
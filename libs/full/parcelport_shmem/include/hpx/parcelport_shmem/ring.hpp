@@ -0,0 +1,287 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The atomics below are placed into memory shared between processes,
+    // which is well defined only for address-free (i.e. lock-free) atomics.
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+    inline constexpr std::size_t ring_alignment = 64;
+    inline constexpr std::size_t record_alignment = 8;
+
+    [[nodiscard]] constexpr std::size_t align_up(
+        std::size_t size, std::size_t alignment) noexcept
+    {
+        return (size + alignment - 1) & ~(alignment - 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Control block of a single producer single consumer ring. head and tail
+    // are monotonically increasing byte positions, they are kept on separate
+    // cache lines as they are written by different processes.
+    struct ring_control
+    {
+        // id of the producing locality, zero if the ring is unused
+        alignas(ring_alignment) std::atomic<std::uint64_t> owner{0};
+
+        // written by the producer only
+        alignas(ring_alignment) std::atomic<std::uint64_t> head{0};
+
+        // written by the consumer only
+        alignas(ring_alignment) std::atomic<std::uint64_t> tail{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A view of a byte ring residing in shared memory. Each record is
+    // prefixed by its size, records never wrap around the end of the ring
+    // (the remainder of the ring is skipped instead). Records are written and
+    // read in place.
+    class ring
+    {
+        static constexpr std::uint64_t wrap_marker = ~std::uint64_t(0);
+        static constexpr std::size_t prefix_size = sizeof(std::uint64_t);
+
+    public:
+        ring() noexcept = default;
+
+        ring(ring_control* control, char* data, std::size_t capacity) noexcept
+          : control_(control)
+          , data_(data)
+          , capacity_(capacity)
+        {
+            HPX_ASSERT(capacity_ % record_alignment == 0);
+        }
+
+        // The largest record which is guaranteed to fit into the ring once
+        // the consumer has caught up, regardless of the current position.
+        [[nodiscard]] static constexpr std::size_t max_record_size(
+            std::size_t capacity) noexcept
+        {
+            return capacity / 2 - prefix_size;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] ring_control* control() const noexcept
+        {
+            return control_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // producer side: reserve space for a record of the given size, the
+        // record becomes visible to the consumer on commit()
+        [[nodiscard]] void* try_reserve(std::size_t size) noexcept
+        {
+            HPX_ASSERT(size <= max_record_size(capacity_));
+
+            std::uint64_t head = control_->head.load(std::memory_order_relaxed);
+            std::uint64_t const tail =
+                control_->tail.load(std::memory_order_acquire);
+
+            std::size_t const needed =
+                prefix_size + align_up(size, record_alignment);
+            std::size_t const pos = head % capacity_;
+            std::size_t const contiguous = capacity_ - pos;
+
+            std::size_t const skipped = needed > contiguous ? contiguous : 0;
+            if (head + skipped + needed - tail > capacity_)
+            {
+                return nullptr;    // the consumer has to catch up first
+            }
+
+            if (skipped != 0)
+            {
+                std::memcpy(data_ + pos, &wrap_marker, prefix_size);
+                head += skipped;
+            }
+
+            char* const record = data_ + head % capacity_;
+            std::uint64_t const record_size = size;
+            std::memcpy(record, &record_size, prefix_size);
+
+            reserved_head_ = head + needed;
+            return record + prefix_size;
+        }
+
+        void commit() noexcept
+        {
+            control_->head.store(reserved_head_, std::memory_order_release);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // consumer side: access the oldest record (if any), the space is
+        // handed back to the producer on release()
+        [[nodiscard]] void const* try_peek(std::size_t& size) noexcept
+        {
+            std::uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+            std::uint64_t const head =
+                control_->head.load(std::memory_order_acquire);
+
+            if (tail == head)
+            {
+                return nullptr;
+            }
+
+            std::uint64_t record_size = 0;
+            std::memcpy(&record_size, data_ + tail % capacity_, prefix_size);
+            if (record_size == wrap_marker)
+            {
+                tail += capacity_ - tail % capacity_;
+                HPX_ASSERT(tail != head);
+                std::memcpy(
+                    &record_size, data_ + tail % capacity_, prefix_size);
+            }
+
+            size = static_cast<std::size_t>(record_size);
+            released_tail_ =
+                tail + prefix_size + align_up(size, record_alignment);
+            return data_ + tail % capacity_ + prefix_size;
+        }
+
+        void release() noexcept
+        {
+            control_->tail.store(released_tail_, std::memory_order_release);
+        }
+
+    private:
+        ring_control* control_ = nullptr;
+        char* data_ = nullptr;
+        std::size_t capacity_ = 0;
+
+        std::uint64_t reserved_head_ = 0;
+        std::uint64_t released_tail_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The mailbox of a locality is a shared memory segment holding one ring
+    // for each (co-located) locality sending messages to it. Senders claim a
+    // ring when connecting for the first time.
+    class mailbox
+    {
+        static constexpr std::uint64_t mailbox_magic = 0x6870786d61696c31;
+
+        struct alignas(ring_alignment) mailbox_header
+        {
+            std::atomic<std::uint64_t> magic;
+            std::uint64_t num_rings;
+            std::uint64_t ring_size;
+        };
+
+        static constexpr std::size_t ring_stride(std::size_t ring_size) noexcept
+        {
+            return sizeof(ring_control) + align_up(ring_size, ring_alignment);
+        }
+
+    public:
+        mailbox() noexcept = default;
+
+        explicit mailbox(void* base) noexcept
+          : base_(static_cast<char*>(base))
+        {
+        }
+
+        [[nodiscard]] static constexpr std::size_t segment_size(
+            std::size_t num_rings, std::size_t ring_size) noexcept
+        {
+            return sizeof(mailbox_header) + num_rings * ring_stride(ring_size);
+        }
+
+        // construct an empty mailbox in freshly created shared memory
+        static mailbox initialize(
+            void* base, std::size_t num_rings, std::size_t ring_size) noexcept
+        {
+            auto* hdr = ::new (base) mailbox_header{};
+            hdr->num_rings = num_rings;
+            hdr->ring_size = align_up(ring_size, ring_alignment);
+
+            mailbox mb(base);
+            for (std::size_t i = 0; i != num_rings; ++i)
+            {
+                ::new (mb.ring_base(i)) ring_control();
+            }
+
+            hdr->magic.store(mailbox_magic, std::memory_order_release);
+            return mb;
+        }
+
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return base_ != nullptr &&
+                header().magic.load(std::memory_order_acquire) ==
+                mailbox_magic;
+        }
+
+        [[nodiscard]] std::size_t num_rings() const noexcept
+        {
+            return static_cast<std::size_t>(header().num_rings);
+        }
+
+        [[nodiscard]] std::size_t ring_size() const noexcept
+        {
+            return static_cast<std::size_t>(header().ring_size);
+        }
+
+        [[nodiscard]] ring get_ring(std::size_t i) const noexcept
+        {
+            HPX_ASSERT(i < num_rings());
+            char* const base = ring_base(i);
+            return {std::launder(reinterpret_cast<ring_control*>(base)),
+                base + sizeof(ring_control), ring_size()};
+        }
+
+        // claim an unused ring for the given producer, returns the number of
+        // rings if all rings are in use
+        [[nodiscard]] std::size_t claim(std::uint64_t producer) const noexcept
+        {
+            HPX_ASSERT(producer != 0);
+            for (std::size_t i = 0; i != num_rings(); ++i)
+            {
+                auto& owner = get_ring(i).control()->owner;
+                std::uint64_t expected = 0;
+                if (owner.load(std::memory_order_relaxed) == 0 &&
+                    owner.compare_exchange_strong(expected, producer,
+                        std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    return i;
+                }
+            }
+            return num_rings();
+        }
+
+    private:
+        [[nodiscard]] mailbox_header& header() const noexcept
+        {
+            return *std::launder(reinterpret_cast<mailbox_header*>(base_));
+        }
+
+        [[nodiscard]] char* ring_base(std::size_t i) const noexcept
+        {
+            return base_ + sizeof(mailbox_header) +
+                i * ring_stride(static_cast<std::size_t>(header().ring_size));
+        }
+
+        char* base_ = nullptr;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
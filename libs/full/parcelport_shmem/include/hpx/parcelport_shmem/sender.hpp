@@ -0,0 +1,128 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        sender(std::uint64_t here, std::size_t segment_threshold) noexcept
+          : here_(here)
+          , segment_threshold_(segment_threshold)
+        {
+        }
+
+        constexpr static void run() noexcept {}
+
+        connection_ptr create_connection(
+            parcelset::locality const& dest, parcelset::parcelport* pp)
+        {
+            return std::make_shared<connection_type>(this, here_,
+                get_channel(dest.get<locality>()), segment_threshold_, pp,
+                dest);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code const ec(throwmode::lightweight);
+                hpx::move_only_function<void(error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                if (postprocess_handler)
+                    postprocess_handler(
+                        ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work() noexcept
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock const l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            bool has_work = false;
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                has_work = true;
+            }
+            return has_work;
+        }
+
+    private:
+        // all connections to the same destination share the ring claimed in
+        // its mailbox, the ring is claimed on first use
+        std::shared_ptr<channel> get_channel(locality const& dest)
+        {
+            std::unique_lock l(channels_mtx_);
+
+            auto it = channels_.find(dest.mailbox());
+            if (it == channels_.end())
+            {
+                it = channels_
+                         .emplace(dest.mailbox(),
+                             std::make_shared<channel>(here_, dest))
+                         .first;
+            }
+            return it->second;
+        }
+
+        std::uint64_t here_;
+        std::size_t segment_threshold_;
+
+        hpx::spinlock channels_mtx_;
+        std::map<std::uint64_t, std::shared_ptr<channel>> channels_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,300 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/ring.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The channel to a co-located locality is the ring claimed by this
+    // locality in the mailbox of the destination. All connections to the same
+    // destination share the channel.
+    class channel
+    {
+    public:
+        channel(std::uint64_t here, locality const& there)
+          : segment_(shared_memory_segment::open(
+                make_segment_name(there.mailbox())))
+        {
+            mailbox const mb(segment_.data());
+            if (!mb.valid())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::network_error,
+                    "shmem::channel::channel",
+                    "the mailbox of locality {} is not initialized", there);
+            }
+
+            std::size_t const idx = mb.claim(here);
+            if (idx == mb.num_rings())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::network_error,
+                    "shmem::channel::channel",
+                    "the mailbox of locality {} has no unused rings left "
+                    "(increase hpx.parcel.shmem.max_rings)",
+                    there);
+            }
+            ring_ = mb.get_ring(idx);
+        }
+
+        [[nodiscard]] std::size_t max_record_size() const noexcept
+        {
+            return ring::max_record_size(ring_.capacity());
+        }
+
+        // write a record of the given size using the supplied function,
+        // returns false if the ring is currently full
+        template <typename F>
+        bool try_write(std::size_t size, F&& f)
+        {
+            std::lock_guard l(mtx_);
+
+            void* record = ring_.try_reserve(size);
+            if (record == nullptr)
+            {
+                return false;
+            }
+
+            f(static_cast<char*>(record));
+            ring_.commit();
+            return true;
+        }
+
+    private:
+        hpx::spinlock mtx_;
+        shared_memory_segment segment_;
+        ring ring_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct sender_connection
+      : parcelset::parcelport_connection<sender_connection>
+    {
+    private:
+        using sender_type = sender;
+
+        using write_handler_type =
+            hpx::function<void(std::error_code const&, parcel const&)>;
+
+        using base_type = parcelset::parcelport_connection<sender_connection>;
+
+    public:
+        sender_connection(sender_type* s, std::uint64_t here,
+            std::shared_ptr<channel> ch, std::size_t segment_threshold,
+            parcelset::parcelport* pp, parcelset::locality there)
+          : sender_(s)
+          , here_(here)
+          , channel_(HPX_MOVE(ch))
+          , segment_threshold_(segment_threshold)
+          , pp_(pp)
+          , there_(HPX_MOVE(there))
+        {
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        using handler_type = hpx::move_only_function<void(error_code const&)>;
+        using post_handler_type = hpx::move_only_function<void(
+            error_code const&, parcelset::locality const&,
+            std::shared_ptr<sender_connection>)>;
+
+        void async_write(
+            handler_type&& handler, post_handler_type&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+#endif
+            header_.size = buffer_.size_;
+            header_.data_size = buffer_.data_size_;
+            header_.num_zero_copy_chunks = buffer_.num_chunks_.first;
+            header_.num_non_zero_copy_chunks = buffer_.num_chunks_.second;
+            header_.segment = 0;
+
+            handler_ = HPX_MOVE(handler);
+
+            // large messages are placed into a segment of their own, only
+            // the header is sent through the ring
+            message_layout const inline_layout(
+                header_, buffer_.transmission_chunks_.data(), false);
+            std::size_t const inline_size =
+                sizeof(header) + inline_layout.size();
+
+            if (inline_size > segment_threshold_ ||
+                inline_size > channel_->max_record_size())
+            {
+                write_segment();
+            }
+
+            if (!send())
+            {
+                postprocess_handler_ = HPX_MOVE(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                if (parcel_postprocess)
+                    parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // try to place the message into the ring of the destination, returns
+        // false if the ring is full
+        bool send()
+        {
+            bool const in_segment = header_.segment != 0;
+            message_layout const layout(
+                header_, buffer_.transmission_chunks_.data(), in_segment);
+
+            std::size_t const record_size =
+                in_segment ? sizeof(header) : sizeof(header) + layout.size();
+
+            bool const written =
+                channel_->try_write(record_size, [&](char* record) {
+                    std::memcpy(record, &header_, sizeof(header));
+                    if (!in_segment)
+                    {
+                        write_payload(record + sizeof(header), layout);
+                    }
+                });
+
+            if (!written)
+            {
+                return false;
+            }
+
+            // the receiver is now responsible for the segment
+            if (in_segment)
+            {
+                segment_.release_name();
+                segment_ = shared_memory_segment();
+            }
+
+            return done();
+        }
+
+        bool done()
+        {
+            error_code const ec(throwmode::lightweight);
+            handler_(ec);
+            handler_.reset();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now()) -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            buffer_.clear();
+            return true;
+        }
+
+    private:
+        // copy the transmission chunks, the non-zero-copy data, and the
+        // zero-copy chunks to the given location
+        void write_payload(char* dest, message_layout const& layout) const
+        {
+            auto const& tchunks = buffer_.transmission_chunks_;
+            if (!tchunks.empty())
+            {
+                std::memcpy(dest, tchunks.data(),
+                    tchunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+
+            std::memcpy(
+                dest + layout.data_offset(), buffer_.data_.data(), header_.size);
+
+            std::size_t offset = layout.first_chunk_offset();
+            std::size_t idx = 0;
+            for (auto const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    HPX_ASSERT(c.size() == layout.chunk_size(idx));
+                    std::memcpy(dest + offset, c.data(), c.size());
+                    offset = layout.next_chunk_offset(offset, idx++);
+                }
+            }
+            HPX_ASSERT(idx == header_.num_zero_copy_chunks);
+        }
+
+        // create a new segment holding the whole message, the segment is
+        // mapped by the receiver, which allows to hand the zero-copy chunks
+        // to the de-serialized objects without copying them again
+        void write_segment()
+        {
+            message_layout const layout(
+                header_, buffer_.transmission_chunks_.data(), true);
+
+            header_.segment = make_unique_id();
+            segment_ = shared_memory_segment::create(
+                make_segment_name(here_, header_.segment), layout.size());
+
+            write_payload(static_cast<char*>(segment_.data()), layout);
+        }
+
+        sender_type* sender_;
+        std::uint64_t here_;
+        std::shared_ptr<channel> channel_;
+        std::size_t segment_threshold_;
+
+        header header_ = {};
+        shared_memory_segment segment_;
+
+        parcelset::parcelport* pp_;
+        parcelset::locality there_;
+
+    public:
+        handler_type handler_;
+        post_handler_type postprocess_handler_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
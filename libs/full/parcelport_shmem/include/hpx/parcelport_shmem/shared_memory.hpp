@@ -0,0 +1,103 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Return an identifier of the node the calling process runs on. Two
+    // processes see the same node id only if they share the kernel instance
+    // and the IPC namespace, i.e. if they can exchange data through POSIX
+    // shared memory.
+    HPX_EXPORT std::uint64_t get_node_id();
+
+    // Return the host name of the node the calling process runs on
+    HPX_EXPORT std::string get_host_name();
+
+    // Return a new identifier which is unique on this node, the returned
+    // values are never zero.
+    HPX_EXPORT std::uint64_t make_unique_id();
+
+    // Return the name of the shared memory segment identified by the given
+    // owner and segment ids (a segment id of zero denotes the mailbox of the
+    // owner).
+    HPX_EXPORT std::string make_segment_name(
+        std::uint64_t owner, std::uint64_t id = 0);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A POSIX shared memory segment mapped into the address space of the
+    // calling process. The mapping is released on destruction, the name of
+    // the segment is released by unlink() (or on destruction, if the segment
+    // was created by this instance and not unlinked before).
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment() noexcept = default;
+
+        // create a new segment of the given size, throws if a segment with
+        // the same name exists already
+        static shared_memory_segment create(
+            std::string const& name, std::size_t size);
+
+        // map an existing segment, throws if no segment with the given name
+        // exists
+        static shared_memory_segment open(std::string const& name);
+
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(shared_memory_segment const&) = delete;
+
+        shared_memory_segment(shared_memory_segment&& rhs) noexcept;
+        shared_memory_segment& operator=(shared_memory_segment&& rhs) noexcept;
+
+        ~shared_memory_segment();
+
+        [[nodiscard]] void* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+        // remove the name of the segment, the mapping stays valid
+        void unlink() noexcept;
+
+        // hand the responsibility for removing the name of the segment to
+        // the process the segment is passed to
+        void release_name() noexcept
+        {
+            owns_name_ = false;
+        }
+
+    private:
+        shared_memory_segment(
+            std::string name, void* data, std::size_t size, bool owns_name);
+
+        void reset() noexcept;
+
+        std::string name_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool owns_name_ = false;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
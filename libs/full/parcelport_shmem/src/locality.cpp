@@ -0,0 +1,39 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+
+#include <ostream>
+
+namespace hpx::parcelset::policies::shmem {
+
+    void locality::save(serialization::output_archive& ar) const
+    {
+        ar << node_;
+        ar << mailbox_;
+    }
+
+    void locality::load(serialization::input_archive& ar)
+    {
+        ar >> node_;
+        ar >> mailbox_;
+    }
+
+    std::ostream& operator<<(std::ostream& os, locality const& loc) noexcept
+    {
+        hpx::util::ios_flags_saver ifs(os);
+        os << std::hex << loc.node_ << ":" << loc.mailbox_;
+        return os;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
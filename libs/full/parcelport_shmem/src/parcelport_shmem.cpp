@@ -0,0 +1,292 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+        using is_connectionless = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        // The shared memory parcelport connects localities running on the
+        // same node. It can't be used for bootstrapping, the localities
+        // exchange their mailbox names through the endpoints registered with
+        // AGAS by the bootstrap parcelport.
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            static parcelset::locality here()
+            {
+                return parcelset::locality(
+                    locality(get_node_id(), make_unique_id()));
+            }
+
+            static std::size_t max_rings(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.max_rings", 64);
+            }
+
+            static std::size_t ring_size(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", 1048576);
+            }
+
+            static std::size_t segment_threshold(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.segment_threshold", 65536);
+            }
+
+            std::uint64_t mailbox() const
+            {
+                return parcelset::parcelport::here().get<locality>().mailbox();
+            }
+
+        public:
+            using sender_type = sender;
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(false)
+              , sender_(mailbox(), segment_threshold(ini))
+              , receiver_(*this, mailbox(), max_rings(ini), ring_size(ini))
+            {
+            }
+
+            parcelport(parcelport const&) = delete;
+            parcelport(parcelport&&) = delete;
+            parcelport& operator=(parcelport const&) = delete;
+            parcelport& operator=(parcelport&&) = delete;
+
+            ~parcelport() override = default;
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                receiver_.run();
+                sender_.run();
+
+                for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    io_service_pool_.get_io_service(static_cast<int>(i))
+                        .post(hpx::bind(&parcelport::io_service_work, this));
+                }
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode::all))
+                {
+                    if (threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                    }
+                }
+                stopped_.store(true, std::memory_order_release);
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return get_host_name();
+            }
+
+            /// Only localities running on the same node (sharing the IPC
+            /// namespace) can be reached through shared memory.
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override
+            {
+                return use_alternative_parcelport &&
+                    dest.get<locality>().node() == get_node_id();
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code&)
+            {
+                return sender_.create_connection(l, this);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                // the AGAS locality is never reached through this parcelport
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_.load(std::memory_order_acquire))
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode::send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode::receive)
+                {
+                    has_work =
+                        receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            void io_service_work()
+            {
+                std::size_t k = 0;
+
+                // We only execute work on the IO service while HPX is starting
+                while (hpx::is_starting())
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work(0) || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                    }
+                    else
+                    {
+                        ++k;
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                            "io_service_work");
+                    }
+                }
+            }
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+// Inject additional configuration data into the factory registry for this
+// type. This information ends up in the system-wide configuration database
+// under the plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 200
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::parcelport>
+{
+    // prefer shared memory over the network based parcelports whenever the
+    // destination runs on the same node
+    static constexpr char const* priority() noexcept
+    {
+        return "200";
+    }
+
+    static constexpr void init(
+        int*, char***, util::command_line_handling&) noexcept
+    {
+    }
+
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return
+            // size of each of the rings in the mailbox of a locality (in bytes)
+            "ring_size = ${HPX_PARCEL_SHMEM_RING_SIZE:1048576}\n"
+            // maximal number of localities sending to the same locality
+            "max_rings = ${HPX_PARCEL_SHMEM_MAX_RINGS:64}\n"
+            // messages larger than this are sent through a segment of their
+            // own instead of being copied through the ring (in bytes)
+            "segment_threshold = ${HPX_PARCEL_SHMEM_SEGMENT_THRESHOLD:65536}\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
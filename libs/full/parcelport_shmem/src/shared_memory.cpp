@@ -0,0 +1,263 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <hpx/parcelport_shmem/shared_memory.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        // FNV-1a
+        std::uint64_t hash_combine(std::uint64_t h, std::string const& s)
+        {
+            for (char const c : s)
+            {
+                h ^= static_cast<std::uint8_t>(c);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        std::string read_boot_id()
+        {
+            std::string boot_id;
+            std::ifstream in("/proc/sys/kernel/random/boot_id");
+            if (in)
+            {
+                std::getline(in, boot_id);
+            }
+            return boot_id;
+        }
+
+        std::string read_ipc_namespace()
+        {
+            char buffer[PATH_MAX];
+            ssize_t const len =
+                ::readlink("/proc/self/ns/ipc", buffer, sizeof(buffer) - 1);
+            if (len <= 0)
+            {
+                return {};
+            }
+            return {buffer, static_cast<std::size_t>(len)};
+        }
+
+        std::string read_host_name()
+        {
+            char buffer[HOST_NAME_MAX + 1] = {};
+            if (::gethostname(buffer, sizeof(buffer) - 1) != 0)
+            {
+                return {};
+            }
+            return buffer;
+        }
+
+        std::uint32_t get_session_tag()
+        {
+            static std::uint32_t const tag = []() {
+                std::random_device rd;
+                std::uint32_t t = 0;
+                while (t == 0)
+                {
+                    t = rd() ^ static_cast<std::uint32_t>(::getpid());
+                }
+                return t;
+            }();
+            return tag;
+        }
+    }    // namespace
+
+    std::uint64_t get_node_id()
+    {
+        static std::uint64_t const node_id = []() {
+            std::uint64_t h = 14695981039346656037ull;
+            h = hash_combine(h, read_boot_id());
+            h = hash_combine(h, read_ipc_namespace());
+            h = hash_combine(h, read_host_name());
+            return h;
+        }();
+        return node_id;
+    }
+
+    std::string get_host_name()
+    {
+        return read_host_name();
+    }
+
+    std::uint64_t make_unique_id()
+    {
+        static std::atomic<std::uint32_t> counter(0);
+        return (static_cast<std::uint64_t>(get_session_tag()) << 32) |
+            static_cast<std::uint64_t>(++counter);
+    }
+
+    std::string make_segment_name(std::uint64_t owner, std::uint64_t id)
+    {
+        return hpx::util::format("/hpx{:016x}{:016x}", owner, id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    shared_memory_segment::shared_memory_segment(
+        std::string name, void* data, std::size_t size, bool owns_name)
+      : name_(HPX_MOVE(name))
+      , data_(data)
+      , size_(size)
+      , owns_name_(owns_name)
+    {
+    }
+
+    shared_memory_segment shared_memory_segment::create(
+        std::string const& name, std::size_t size)
+    {
+        int const fd = ::shm_open(
+            name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "shm_open failed for segment {}: {}", name,
+                std::strerror(errno));
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            int const err = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "ftruncate failed for segment {}: {}", name,
+                std::strerror(err));
+        }
+
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::create",
+                "mmap failed for segment {}: {}", name, std::strerror(err));
+        }
+
+        return {name, data, size, true};
+    }
+
+    shared_memory_segment shared_memory_segment::open(std::string const& name)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "shm_open failed for segment {}: {}", name,
+                std::strerror(errno));
+        }
+
+        struct stat st = {};
+        if (::fstat(fd, &st) != 0)
+        {
+            int const err = errno;
+            ::close(fd);
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "fstat failed for segment {}: {}", name, std::strerror(err));
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::shared_memory_segment::open",
+                "mmap failed for segment {}: {}", name, std::strerror(err));
+        }
+
+        return {name, data, size, false};
+    }
+
+    shared_memory_segment::shared_memory_segment(
+        shared_memory_segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+      , owns_name_(std::exchange(rhs.owns_name_, false))
+    {
+    }
+
+    shared_memory_segment& shared_memory_segment::operator=(
+        shared_memory_segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+            owns_name_ = std::exchange(rhs.owns_name_, false);
+        }
+        return *this;
+    }
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        reset();
+    }
+
+    void shared_memory_segment::unlink() noexcept
+    {
+        if (!name_.empty())
+        {
+            ::shm_unlink(name_.c_str());
+            owns_name_ = false;
+        }
+    }
+
+    void shared_memory_segment::reset() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+        if (owns_name_)
+        {
+            unlink();
+        }
+        name_.clear();
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
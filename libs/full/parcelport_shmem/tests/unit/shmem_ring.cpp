@@ -0,0 +1,377 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exercise the shared memory rings in process local memory: records
+// wrapping around the end of the ring, full and empty rings, and messages
+// consisting of multiple zero-copy chunks.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/ring.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using namespace hpx::parcelset::policies::shmem;
+
+///////////////////////////////////////////////////////////////////////////////
+// process local stand-in for a shared memory segment holding a mailbox
+struct local_mailbox
+{
+    local_mailbox(std::size_t num_rings, std::size_t ring_size)
+      : storage(new(std::align_val_t(ring_alignment))
+                char[mailbox::segment_size(num_rings, ring_size)])
+      , mb(mailbox::initialize(storage.get(), num_rings, ring_size))
+    {
+    }
+
+    struct deleter
+    {
+        void operator()(char* p) const noexcept
+        {
+            ::operator delete[](p, std::align_val_t(ring_alignment));
+        }
+    };
+
+    std::unique_ptr<char[], deleter> storage;
+    mailbox mb;
+};
+
+// fill a record with a pattern derived from its sequence number
+void fill(void* p, std::size_t size, std::uint64_t seq)
+{
+    auto* const data = static_cast<unsigned char*>(p);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<unsigned char>(seq * 31 + i);
+    }
+}
+
+bool verify(void const* p, std::size_t size, std::uint64_t seq)
+{
+    auto const* const data = static_cast<unsigned char const*>(p);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        if (data[i] != static_cast<unsigned char>(seq * 31 + i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_mailbox()
+{
+    local_mailbox lm(3, 1000);
+    HPX_TEST(lm.mb.valid());
+    HPX_TEST_EQ(lm.mb.num_rings(), std::size_t(3));
+    HPX_TEST_EQ(lm.mb.ring_size() % ring_alignment, std::size_t(0));
+    HPX_TEST_LTE(std::size_t(1000), lm.mb.ring_size());
+
+    // every producer gets a ring of its own until all rings are taken
+    HPX_TEST_EQ(lm.mb.claim(1), std::size_t(0));
+    HPX_TEST_EQ(lm.mb.claim(2), std::size_t(1));
+    HPX_TEST_EQ(lm.mb.claim(3), std::size_t(2));
+    HPX_TEST_EQ(lm.mb.claim(4), std::size_t(3));
+
+    HPX_TEST_EQ(lm.mb.get_ring(1).control()->owner.load(), std::uint64_t(2));
+
+    // a mailbox attached to the same memory sees the same rings
+    mailbox const attached(lm.storage.get());
+    HPX_TEST(attached.valid());
+    HPX_TEST_EQ(attached.num_rings(), std::size_t(3));
+    HPX_TEST_EQ(attached.get_ring(2).control(), lm.mb.get_ring(2).control());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty_and_full()
+{
+    local_mailbox lm(1, 256);
+    ring producer = lm.mb.get_ring(0);
+    ring consumer = lm.mb.get_ring(0);
+
+    std::size_t size = 0;
+    HPX_TEST(consumer.try_peek(size) == nullptr);
+
+    // each record occupies 8 bytes of prefix and 24 bytes of data
+    std::size_t const record_size = 20;
+    std::size_t const records = producer.capacity() / 32;
+
+    for (std::size_t i = 0; i != records; ++i)
+    {
+        void* p = producer.try_reserve(record_size);
+        HPX_TEST(p != nullptr);
+        if (p == nullptr)
+        {
+            return;
+        }
+        fill(p, record_size, i);
+        producer.commit();
+    }
+
+    // the ring is full, reserving fails without modifying the ring
+    HPX_TEST(producer.try_reserve(record_size) == nullptr);
+    HPX_TEST(producer.try_reserve(1) == nullptr);
+    HPX_TEST_EQ(producer.control()->head.load(),
+        static_cast<std::uint64_t>(producer.capacity()));
+
+    // peeking without releasing returns the same record
+    void const* first = consumer.try_peek(size);
+    HPX_TEST(first != nullptr);
+    HPX_TEST_EQ(size, record_size);
+    HPX_TEST(consumer.try_peek(size) == first);
+
+    // releasing a single record makes room for exactly one record
+    consumer.release();
+    void* p = producer.try_reserve(record_size);
+    HPX_TEST(p != nullptr);
+    fill(p, record_size, records);
+    producer.commit();
+    HPX_TEST(producer.try_reserve(record_size) == nullptr);
+
+    // drain the ring, records arrive in order
+    for (std::size_t i = 1; i != records + 1; ++i)
+    {
+        void const* r = consumer.try_peek(size);
+        HPX_TEST(r != nullptr);
+        if (r == nullptr)
+        {
+            return;
+        }
+        HPX_TEST_EQ(size, record_size);
+        HPX_TEST(verify(r, size, i));
+        consumer.release();
+    }
+
+    HPX_TEST(consumer.try_peek(size) == nullptr);
+    HPX_TEST_EQ(
+        consumer.control()->tail.load(), consumer.control()->head.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_wrap_around()
+{
+    local_mailbox lm(1, 512);
+    ring producer = lm.mb.get_ring(0);
+    ring consumer = lm.mb.get_ring(0);
+
+    std::size_t const max_size = ring::max_record_size(producer.capacity());
+
+    // record sizes which do not divide the capacity force the producer to
+    // skip the remainder of the ring regularly
+    std::size_t const sizes[] = {1, 13, 100, 57, max_size, 8, 200, 3};
+    std::size_t const num_sizes = std::size(sizes);
+
+    std::uint64_t sent = 0;
+    std::uint64_t received = 0;
+    std::size_t wrapped = 0;
+
+    while (sent != 1000)
+    {
+        // produce as much as fits, then consume part of it
+        for (;;)
+        {
+            std::size_t const size = sizes[sent % num_sizes];
+            std::size_t const pos = static_cast<std::size_t>(
+                producer.control()->head.load() % producer.capacity());
+
+            void* p = producer.try_reserve(size);
+            if (p == nullptr)
+            {
+                break;
+            }
+
+            // the record did not fit into the remainder of the ring
+            if (sizeof(std::uint64_t) + align_up(size, record_alignment) >
+                producer.capacity() - pos)
+            {
+                ++wrapped;
+            }
+
+            fill(p, size, sent++);
+            producer.commit();
+            if (sent == 1000)
+            {
+                break;
+            }
+        }
+
+        for (int i = 0; i != 3; ++i)
+        {
+            std::size_t size = 0;
+            void const* r = consumer.try_peek(size);
+            if (r == nullptr)
+            {
+                break;
+            }
+            HPX_TEST_EQ(size, sizes[received % num_sizes]);
+            HPX_TEST(verify(r, size, received));
+            consumer.release();
+            ++received;
+        }
+    }
+
+    std::size_t size = 0;
+    while (void const* r = consumer.try_peek(size))
+    {
+        HPX_TEST_EQ(size, sizes[received % num_sizes]);
+        HPX_TEST(verify(r, size, received));
+        consumer.release();
+        ++received;
+    }
+
+    HPX_TEST_EQ(received, sent);
+    HPX_TEST_LT(std::size_t(0), wrapped);
+    HPX_TEST_LT(static_cast<std::uint64_t>(10 * producer.capacity()),
+        producer.control()->head.load());
+
+    // the largest record fits once the consumer has caught up, regardless of
+    // the current position
+    HPX_TEST(producer.try_reserve(max_size) != nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Place a message consisting of the transmission chunks, the non-zero-copy
+// data, and several zero-copy chunks into a ring record, the way the sender
+// does, and locate all parts again from the received header.
+void test_multi_chunk_message()
+{
+    using transmission_chunk_type = message_layout::transmission_chunk_type;
+
+    local_mailbox lm(1, 4096);
+    ring producer = lm.mb.get_ring(0);
+    ring consumer = lm.mb.get_ring(0);
+
+    std::vector<char> const data(37, 'd');
+    std::vector<std::vector<char>> const chunks = {
+        std::vector<char>(5, 'a'), std::vector<char>(64, 'b'),
+        std::vector<char>(1, 'c'), std::vector<char>(129, 'e')};
+
+    // the non-zero-copy chunks are described by an index entry
+    std::vector<transmission_chunk_type> tchunks;
+    for (auto const& c : chunks)
+    {
+        tchunks.emplace_back(0, c.size());
+    }
+    tchunks.emplace_back(3, 0);
+
+    header hdr{};
+    hdr.size = data.size();
+    hdr.data_size = data.size();
+    hdr.num_zero_copy_chunks = static_cast<std::uint32_t>(chunks.size());
+    hdr.num_non_zero_copy_chunks = 1;
+    hdr.segment = 0;
+
+    for (int round = 0; round != 20; ++round)
+    {
+        message_layout const layout(hdr, tchunks.data(), false);
+        HPX_TEST_EQ(layout.num_transmission_chunks(), tchunks.size());
+
+        std::size_t const size = sizeof(header) + layout.size();
+        HPX_TEST_LTE(size, ring::max_record_size(producer.capacity()));
+
+        auto* record = static_cast<char*>(producer.try_reserve(size));
+        HPX_TEST(record != nullptr);
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        std::memcpy(record, &hdr, sizeof(header));
+        char* const payload = record + sizeof(header);
+        std::memcpy(payload, tchunks.data(),
+            tchunks.size() * sizeof(transmission_chunk_type));
+        std::memcpy(payload + layout.data_offset(), data.data(), hdr.size);
+
+        std::size_t offset = layout.first_chunk_offset();
+        for (std::size_t i = 0; i != chunks.size(); ++i)
+        {
+            HPX_TEST_EQ(offset % record_alignment, std::size_t(0));
+            std::memcpy(payload + offset, chunks[i].data(), chunks[i].size());
+            offset = layout.next_chunk_offset(offset, i);
+        }
+        HPX_TEST_EQ(offset, layout.size());
+        producer.commit();
+
+        // receive side
+        std::size_t received_size = 0;
+        auto const* received =
+            static_cast<char const*>(consumer.try_peek(received_size));
+        HPX_TEST(received != nullptr);
+        if (received == nullptr)
+        {
+            return;
+        }
+        HPX_TEST_EQ(received_size, size);
+
+        header received_hdr{};
+        std::memcpy(&received_hdr, received, sizeof(header));
+        HPX_TEST_EQ(received_hdr.size, hdr.size);
+        HPX_TEST_EQ(
+            received_hdr.num_zero_copy_chunks, hdr.num_zero_copy_chunks);
+        HPX_TEST_EQ(received_hdr.num_non_zero_copy_chunks,
+            hdr.num_non_zero_copy_chunks);
+
+        char const* const received_payload = received + sizeof(header);
+        std::vector<transmission_chunk_type> received_tchunks(
+            received_hdr.num_zero_copy_chunks +
+            received_hdr.num_non_zero_copy_chunks);
+        std::memcpy(static_cast<void*>(received_tchunks.data()),
+            received_payload,
+            received_tchunks.size() * sizeof(transmission_chunk_type));
+        HPX_TEST(received_tchunks == tchunks);
+
+        message_layout const received_layout(
+            received_hdr, received_tchunks.data(), false);
+        HPX_TEST_EQ(received_layout.size(), layout.size());
+        char const* const received_data =
+            received_payload + received_layout.data_offset();
+        HPX_TEST_EQ(std::memcmp(received_data, data.data(), hdr.size), 0);
+
+        offset = received_layout.first_chunk_offset();
+        for (std::size_t i = 0; i != chunks.size(); ++i)
+        {
+            HPX_TEST_EQ(received_layout.chunk_size(i), chunks[i].size());
+            HPX_TEST_EQ(std::memcmp(received_payload + offset,
+                            chunks[i].data(), chunks[i].size()),
+                0);
+            offset = received_layout.next_chunk_offset(offset, i);
+        }
+        consumer.release();
+
+        // messages which do not fit the remainder of the ring wrap around
+        // as a whole
+        hdr.size = data.size() - static_cast<std::size_t>(round % 7);
+    }
+
+    // messages placed into separate segments use cache line alignment
+    message_layout const segment_layout(hdr, tchunks.data(), true);
+    HPX_TEST_EQ(segment_layout.data_offset() % ring_alignment, std::size_t(0));
+    std::size_t offset = segment_layout.first_chunk_offset();
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        HPX_TEST_EQ(offset % ring_alignment, std::size_t(0));
+        offset = segment_layout.next_chunk_offset(offset, i);
+    }
+    HPX_TEST_EQ(offset, segment_layout.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_mailbox();
+    test_empty_and_full();
+    test_wrap_around();
+    test_multi_chunk_message();
+
+    return hpx::util::report_errors();
+}
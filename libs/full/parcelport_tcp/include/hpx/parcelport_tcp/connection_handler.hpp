@@ -16,6 +16,7 @@
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
 #include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset/receive_buffer_pool.hpp>
 #include <hpx/parcelset_base/locality.hpp>
 
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__)
@@ -109,6 +110,16 @@ namespace hpx::parcelset {
 
             parcelset::locality create_locality() const override;
 
+            // Return the pool the zero-copy chunks of incoming messages are
+            // received into.
+            parcelset::receive_buffer_pool& get_receive_buffer_pool() noexcept
+            {
+                return *receive_buffer_pool_;
+            }
+
+            std::int64_t get_receive_buffer_pool_statistics(
+                receive_buffer_pool_statistics_type t, bool reset) override;
+
         private:
             void handle_accept(std::error_code const& e,
                 std::shared_ptr<receiver> receiver_conn);
@@ -125,6 +136,9 @@ namespace hpx::parcelset {
                 std::set<std::shared_ptr<receiver>>;
             accepted_connections_set accepted_connections_;
 
+            std::shared_ptr<parcelset::receive_buffer_pool>
+                receive_buffer_pool_;
+
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
             using write_connections_set = std::set<std::weak_ptr<sender>>;
             write_connections_set write_connections_;
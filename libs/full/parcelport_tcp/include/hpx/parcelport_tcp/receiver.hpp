@@ -97,7 +97,6 @@ namespace hpx::parcelset::policies::tcp {
             data.num_parcels_ = 0;
 #endif
             parcels_.clear();
-            chunk_buffers_.clear();
 
             // Issue a read operation to read the message size.
             using asio::buffer;
@@ -332,19 +331,26 @@ namespace hpx::parcelset::policies::tcp {
                 }
                 else
                 {
-                    chunk_buffers_.resize(num_zero_copy_chunks);
+                    // Receive the zero-copy chunks into pooled buffers. The
+                    // buffers are handed to the de-serialization, which
+                    // allows for types like serialize_buffer to take
+                    // ownership of the received data instead of copying it.
+                    auto& pool = parcelport_.get_receive_buffer_pool();
                     for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
                     {
                         auto const chunk_size = static_cast<std::size_t>(
                             buffer_.transmission_chunks_[i].second);
 
-                        chunk_buffers_[i].resize(chunk_size);
-                        buffers.emplace_back(
-                            chunk_buffers_[i].data(), chunk_size);
+                        auto chunk_buffer = pool.allocate(chunk_size);
+                        void* data = chunk_buffer.get();
+
+                        buffers.emplace_back(data, chunk_size);
 
                         buffer_.chunks_[i] =
                             serialization::create_pointer_chunk(
-                                chunk_buffers_[i].data(), chunk_size);
+                                data, chunk_size);
+                        buffer_.received_chunks_.add(
+                            data, HPX_MOVE(chunk_buffer));
                     }
                 }
 
@@ -388,7 +394,6 @@ namespace hpx::parcelset::policies::tcp {
                 --operation_in_flight_;
                 buffer_ = parcel_buffer_type();
                 parcels_.clear();
-                chunk_buffers_.clear();
             }
             else
             {
@@ -450,7 +455,6 @@ namespace hpx::parcelset::policies::tcp {
 
             buffer_ = parcel_buffer_type();
             parcels_.clear();
-            chunk_buffers_.clear();
 
             // Issue a read operation to read the next parcel.
             if (!e)
@@ -477,7 +481,6 @@ namespace hpx::parcelset::policies::tcp {
         hpx::util::atomic_count operation_in_flight_;
 
         std::vector<parcelset::parcel> parcels_;
-        std::vector<std::vector<char>> chunk_buffers_;
     };
 }    // namespace hpx::parcelset::policies::tcp
 
@@ -67,6 +67,11 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , receive_buffer_pool_(
+            std::make_shared<parcelset::receive_buffer_pool>(
+                hpx::util::get_entry_as<std::size_t>(ini,
+                    "hpx.parcel.tcp.receive_buffer_pool_size",
+                    HPX_PARCELPORT_TCP_RECEIVE_BUFFER_POOL_SIZE)))
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -280,6 +285,30 @@ namespace hpx::parcelset::policies::tcp {
         return parcelset::locality(locality());
     }
 
+    std::int64_t connection_handler::get_receive_buffer_pool_statistics(
+        receive_buffer_pool_statistics_type t, bool reset)
+    {
+        switch (t)
+        {
+        case receive_buffer_pool_hits:
+            return receive_buffer_pool_->get_hit_count(reset);
+
+        case receive_buffer_pool_misses:
+            return receive_buffer_pool_->get_miss_count(reset);
+
+        case receive_buffer_pool_cached_bytes:
+            return static_cast<std::int64_t>(
+                receive_buffer_pool_->cached_bytes());
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+            "tcp::connection_handler::get_receive_buffer_pool_statistics",
+            "invalid receive buffer pool statistics type");
+    }
+
     // accepted new incoming connection
     void connection_handler::handle_accept(
         std::error_code const& e, std::shared_ptr<receiver> receiver_conn)
@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#include <hpx/modules/preprocessor.hpp>
 #include <hpx/modules/resource_partitioner.hpp>
 #include <hpx/parcelport_tcp/connection_handler.hpp>
 #include <hpx/plugin/traits/plugin_config_data.hpp>
@@ -19,6 +20,7 @@
 //      [hpx.parcel.tcp]
 //      ...
 //      priority = 1
+//      receive_buffer_pool_size = 268435456
 //
 template <>
 struct hpx::traits::plugin_config_data<
@@ -42,7 +44,9 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
-        return "";
+        return "receive_buffer_pool_size = "
+               "${HPX_PARCEL_TCP_RECEIVE_BUFFER_POOL_SIZE:" HPX_PP_STRINGIZE(
+                   HPX_PARCELPORT_TCP_RECEIVE_BUFFER_POOL_SIZE) "}\n";
     }
 };    // namespace hpx::traits
 
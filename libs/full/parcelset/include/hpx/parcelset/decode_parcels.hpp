@@ -426,6 +426,14 @@ namespace hpx::parcelset {
         serialization::input_archive archive(
             buffer.data_, inbound_data_size, &chunks);
 
+        // allow for the received zero-copy chunks to be shared with the
+        // de-serialized objects
+        if (!buffer.received_chunks_.empty())
+        {
+            archive.get_extra_data<serialization::detail::received_chunks>() =
+                HPX_MOVE(buffer.received_chunks_);
+        }
+
         return decode_message_with_chunks(
             archive, pp, buffer, parcel_count, num_thread);
     }
@@ -66,6 +66,7 @@ namespace hpx::parcelset {
             data_.clear();
             chunks_.clear();
             transmission_chunks_.clear();
+            received_chunks_.clear();
             num_chunks_ = count_chunks_type(0, 0);
             size_ = 0;
             data_size_ = 0;
@@ -80,6 +81,10 @@ namespace hpx::parcelset {
         std::vector<ChunkType> chunks_;
         std::vector<transmission_chunk_type> transmission_chunks_;
 
+        // owners of the buffers the zero-copy chunks were received into (if
+        // those buffers can be shared with the de-serialized objects)
+        serialization::detail::received_chunks received_chunks_;
+
         // pair of (zero-copy, non-zero-copy) chunks
         count_chunks_type num_chunks_;
 
@@ -0,0 +1,85 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/synchronization.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A pool of page-aligned buffers used by the parcelports to receive the
+    // zero-copy chunks of incoming messages into. Buffers are handed out as
+    // reference counted handles. The de-serialized objects may keep the
+    // handles alive (see serialize_buffer); a buffer is put back into the
+    // pool once its last reference has gone away.
+    //
+    // Buffers are managed in power-of-two size classes, starting at the size
+    // of a memory page. Unused buffers are kept only as long as the overall
+    // size of all pooled buffers does not exceed the configured limit.
+    class HPX_EXPORT receive_buffer_pool
+      : public std::enable_shared_from_this<receive_buffer_pool>
+    {
+    public:
+        using handle_type = std::shared_ptr<void>;
+
+        explicit receive_buffer_pool(std::size_t max_cached_bytes);
+        ~receive_buffer_pool();
+
+        receive_buffer_pool(receive_buffer_pool const&) = delete;
+        receive_buffer_pool(receive_buffer_pool&&) = delete;
+        receive_buffer_pool& operator=(receive_buffer_pool const&) = delete;
+        receive_buffer_pool& operator=(receive_buffer_pool&&) = delete;
+
+        // Return a buffer of at least the given size.
+        [[nodiscard]] handle_type allocate(std::size_t size);
+
+        // The overall size of all buffers currently held by the pool.
+        [[nodiscard]] std::size_t cached_bytes() const noexcept;
+
+        // The number of allocations served from (or missing) the pool.
+        [[nodiscard]] std::int64_t get_hit_count(bool reset) noexcept;
+        [[nodiscard]] std::int64_t get_miss_count(bool reset) noexcept;
+
+    private:
+        struct deleter;
+
+        void release(void* p, std::size_t size_class) noexcept;
+
+        [[nodiscard]] static std::size_t get_size_class(
+            std::size_t size) noexcept;
+        [[nodiscard]] static std::size_t get_buffer_size(
+            std::size_t size_class) noexcept;
+
+        static void* allocate_buffer(std::size_t size_class);
+        static void deallocate_buffer(void* p, std::size_t size_class) noexcept;
+
+        using mutex_type = hpx::spinlock;
+
+        mutable mutex_type mtx_;
+        std::vector<std::vector<void*>> buffers_;
+        std::size_t cached_bytes_;
+        std::size_t const max_cached_bytes_;
+
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+    };
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -1336,6 +1336,18 @@ namespace hpx::parcelset {
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // receive buffer pool statistics
+    std::int64_t parcelhandler::get_receive_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::receive_buffer_pool_statistics_type stat_type,
+        bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_receive_buffer_pool_statistics(stat_type, reset) :
+                    0;
+    }
+
     std::vector<plugins::parcelport_factory_base*>&
     parcelhandler::get_parcelport_factories()
     {
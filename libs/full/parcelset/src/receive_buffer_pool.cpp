@@ -0,0 +1,167 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/topology.hpp>
+
+#include <hpx/parcelset/receive_buffer_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the buffer to the pool it was allocated from, if the pool is
+    // still alive.
+    struct receive_buffer_pool::deleter
+    {
+        void operator()(void* p) const noexcept
+        {
+            if (auto pool = pool_.lock())
+            {
+                pool->release(p, size_class_);
+            }
+            else
+            {
+                receive_buffer_pool::deallocate_buffer(p, size_class_);
+            }
+        }
+
+        std::weak_ptr<receive_buffer_pool> pool_;
+        std::size_t size_class_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    receive_buffer_pool::receive_buffer_pool(std::size_t max_cached_bytes)
+      : cached_bytes_(0)
+      , max_cached_bytes_(max_cached_bytes)
+      , hits_(0)
+      , misses_(0)
+    {
+    }
+
+    receive_buffer_pool::~receive_buffer_pool()
+    {
+        for (std::size_t size_class = 0; size_class != buffers_.size();
+             ++size_class)
+        {
+            for (void* p : buffers_[size_class])
+            {
+                deallocate_buffer(p, size_class);
+            }
+        }
+    }
+
+    receive_buffer_pool::handle_type receive_buffer_pool::allocate(
+        std::size_t size)
+    {
+        std::size_t const size_class = get_size_class(size);
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (size_class < buffers_.size() && !buffers_[size_class].empty())
+            {
+                void* p = buffers_[size_class].back();
+                buffers_[size_class].pop_back();
+                cached_bytes_ -= get_buffer_size(size_class);
+
+                ++hits_;
+                return handle_type(p, deleter{weak_from_this(), size_class});
+            }
+        }
+
+        ++misses_;
+        return handle_type(allocate_buffer(size_class),
+            deleter{weak_from_this(), size_class});
+    }
+
+    void receive_buffer_pool::release(
+        void* p, std::size_t size_class) noexcept
+    {
+        std::size_t const size = get_buffer_size(size_class);
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (cached_bytes_ + size <= max_cached_bytes_)
+            {
+                try
+                {
+                    if (buffers_.size() <= size_class)
+                    {
+                        buffers_.resize(size_class + 1);
+                    }
+                    buffers_[size_class].push_back(p);
+                    cached_bytes_ += size;
+                    return;
+                }
+                catch (...)
+                {
+                    // fall through and deallocate the buffer
+                }
+            }
+        }
+
+        deallocate_buffer(p, size_class);
+    }
+
+    std::size_t receive_buffer_pool::cached_bytes() const noexcept
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return cached_bytes_;
+    }
+
+    std::int64_t receive_buffer_pool::get_hit_count(bool reset) noexcept
+    {
+        return reset ? hits_.exchange(0) : hits_.load();
+    }
+
+    std::int64_t receive_buffer_pool::get_miss_count(bool reset) noexcept
+    {
+        return reset ? misses_.exchange(0) : misses_.load();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t receive_buffer_pool::get_size_class(std::size_t size) noexcept
+    {
+        std::size_t size_class = 0;
+        while (get_buffer_size(size_class) < size)
+        {
+            ++size_class;
+        }
+        return size_class;
+    }
+
+    std::size_t receive_buffer_pool::get_buffer_size(
+        std::size_t size_class) noexcept
+    {
+        return threads::get_memory_page_size() << size_class;
+    }
+
+    void* receive_buffer_pool::allocate_buffer(std::size_t size_class)
+    {
+        return ::operator new(get_buffer_size(size_class),
+            static_cast<std::align_val_t>(threads::get_memory_page_size()));
+    }
+
+    void receive_buffer_pool::deallocate_buffer(
+        void* p, std::size_t size_class) noexcept
+    {
+        ::operator delete(p, get_buffer_size(size_class),
+            static_cast<std::align_val_t>(threads::get_memory_page_size()));
+    }
+}    // namespace hpx::parcelset
+
+#endif
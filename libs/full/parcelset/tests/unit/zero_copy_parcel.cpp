@@ -53,6 +53,39 @@ void test_zero_copy_parcel(hpx::id_type const& id)
     HPX_TEST(f.get() == expected);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+buffer_type test_buffer(buffer_type const& data1, buffer_type const& data2)
+{
+    buffer_type data(data1.size() + data2.size());
+    std::copy(data1.data(), data1.data() + data1.size(), data.data());
+    std::copy(data2.data(), data2.data() + data2.size(),
+        data.data() + data1.size());
+    return data;
+}
+
+HPX_PLAIN_ACTION(test_buffer)
+
+void test_zero_copy_serialize_buffer(hpx::id_type const& id)
+{
+    // depending on the configuration, the received buffers are either
+    // de-serialized in place or adopted from the parcelport
+    buffer_type data1(num_elements);
+    buffer_type data2(num_elements);
+
+    std::generate(data1.begin(), data1.end(), std::rand);
+    std::generate(data2.begin(), data2.end(), std::rand);
+
+    buffer_type result =
+        hpx::async(test_buffer_action(), id, data1, data2).get();
+
+    HPX_TEST_EQ(result.size(), data1.size() + data2.size());
+    HPX_TEST(std::equal(data1.begin(), data1.end(), result.begin()));
+    HPX_TEST(std::equal(
+        data2.begin(), data2.end(), result.begin() + data1.size()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -66,6 +99,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     for (hpx::id_type const& id : hpx::find_remote_localities())
     {
         test_zero_copy_parcel(id);
+        test_zero_copy_serialize_buffer(id);
     }
     return hpx::finalize();
 }
@@ -182,6 +182,19 @@ namespace hpx::parcelset {
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given receive buffer pool statistic
+        enum receive_buffer_pool_statistics_type
+        {
+            receive_buffer_pool_hits = 0,
+            receive_buffer_pool_misses = 1,
+            receive_buffer_pool_cached_bytes = 2
+        };
+
+        // retrieve performance counter value for given statistics type, the
+        // default reports zero for parcelports that do not pool buffers
+        virtual std::int64_t get_receive_buffer_pool_statistics(
+            receive_buffer_pool_statistics_type, bool reset);
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -113,6 +113,12 @@ namespace hpx::parcelset {
         return use_alternative_parcelport || can_bootstrap();
     }
 
+    std::int64_t parcelport::get_receive_buffer_pool_statistics(
+        receive_buffer_pool_statistics_type, bool)
+    {
+        return 0;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Update performance counter data
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
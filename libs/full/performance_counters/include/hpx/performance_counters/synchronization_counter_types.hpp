@@ -0,0 +1,16 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+namespace hpx::performance_counters {
+
+    // Install the counter types exposing the contention statistics collected
+    // by hpx::adaptive_mutex (invoked from pre_main)
+    HPX_EXPORT void register_synchronization_counter_types();
+}    // namespace hpx::performance_counters
@@ -566,6 +566,78 @@ namespace hpx::performance_counters {
         performance_counters::install_counter_types(
             connection_cache_types, std::size(connection_cache_types));
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // register connection specific performance counters related to the pool
+    // incoming message buffers are received into
+    static void register_receive_buffer_pool_counter_types(
+        parcelset::parcelhandler& ph, std::string const& pp_type)
+    {
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcelhandler;
+        using parcelset::parcelport;
+
+        hpx::function<std::int64_t(bool)> pool_hits(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                &ph, pp_type, parcelport::receive_buffer_pool_hits));
+        hpx::function<std::int64_t(bool)> pool_misses(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                &ph, pp_type, parcelport::receive_buffer_pool_misses));
+        hpx::function<std::int64_t(bool)> pool_cached_bytes(
+            hpx::bind_front(&parcelhandler::get_receive_buffer_pool_statistics,
+                &ph, pp_type, parcelport::receive_buffer_pool_cached_bytes));
+
+        performance_counters::generic_counter_type_data const
+            receive_buffer_pool_types[] = {
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-buffer-pool/hits", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of receive buffers which were "
+                        "served from the receive buffer pool for the {} "
+                        "connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_hits), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-buffer-pool/misses",
+                     pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of receive buffers which had to "
+                        "be newly allocated because the receive buffer pool "
+                        "for the {} connection type on the referenced "
+                        "locality had no matching buffer",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_misses), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/receive-buffer-pool/cached-bytes",
+                     pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the overall size of the buffers currently "
+                        "held by the receive buffer pool for the {} "
+                        "connection type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_cached_bytes), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"}};
+
+        performance_counters::install_counter_types(
+            receive_buffer_pool_types, std::size(receive_buffer_pool_types));
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -582,6 +654,7 @@ namespace hpx::performance_counters {
         ph.enum_parcelports([&](std::string const& type) -> bool {
             register_parcelhandler_counter_types(ph, type);
             register_connection_cache_counter_types(ph, type);
+            register_receive_buffer_pool_counter_types(ph, type);
             return true;
         });
 
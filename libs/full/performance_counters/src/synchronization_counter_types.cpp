@@ -0,0 +1,117 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/performance_counters/synchronization_counter_types.hpp>
+#include <hpx/synchronization/adaptive_mutex.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters {
+
+    namespace detail {
+
+        // Creation function for lock contention counters. The counter
+        // parameter selects the lock site, the values for all lock sites are
+        // accumulated if no lock site is given:
+        //
+        //   /synchronization(locality#<locality_id>/total)/<name>@<site>
+        //
+        naming::gid_type lock_statistics_counter_creator(
+            lcos::local::detail::lock_statistic which, counter_info const& info,
+            error_code& ec)
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "lock_statistics_counter_creator",
+                    "invalid counter instance parent name: " +
+                        paths.parentinstancename_);
+                return naming::invalid_gid;
+            }
+
+            if (paths.instancename_ != "total" || paths.instanceindex_ != -1)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "lock_statistics_counter_creator",
+                    "invalid counter instance name: " + paths.instancename_);
+                return naming::invalid_gid;
+            }
+
+            hpx::function<std::int64_t(bool)> f(
+                [site = HPX_MOVE(paths.parameters_), which](bool reset) {
+                    return lcos::local::detail::query_lock_statistics(
+                        site, which, reset);
+                });
+
+            return detail::create_raw_counter(info, HPX_MOVE(f), ec);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_synchronization_counter_types()
+    {
+        using lcos::local::detail::lock_statistic;
+
+        // clang-format off
+        generic_counter_type_data const counter_types[] = {
+            {"/synchronization/count/acquisitions",
+                counter_type::monotonically_increasing,
+                "returns the number of acquisitions of all adaptive mutexes "
+                "of the lock site given as the counter parameter (or of all "
+                "lock sites), counted in batches of 16",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_statistics_counter_creator,
+                    lock_statistic::acquisitions),
+                &locality_counter_discoverer, ""},
+            {"/synchronization/count/contended",
+                counter_type::monotonically_increasing,
+                "returns the number of acquisitions which found the adaptive "
+                "mutex locked for the lock site given as the counter "
+                "parameter (or for all lock sites)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_statistics_counter_creator,
+                    lock_statistic::contended),
+                &locality_counter_discoverer, ""},
+            {"/synchronization/time/wait",
+                counter_type::monotonically_increasing,
+                "returns the overall time spent waiting for contended "
+                "adaptive mutexes of the lock site given as the counter "
+                "parameter (or of all lock sites)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_statistics_counter_creator,
+                    lock_statistic::wait_time),
+                &locality_counter_discoverer, "ns"},
+            // the lock statistics already report the average hold time
+            {"/synchronization/time/hold", counter_type::raw,
+                "returns the average sampled time adaptive mutexes of the "
+                "lock site given as the counter parameter (or of all lock "
+                "sites) were held",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_statistics_counter_creator,
+                    lock_statistic::hold_time),
+                &locality_counter_discoverer, "ns"}
+        };
+        // clang-format on
+
+        install_counter_types(counter_types, std::size(counter_types));
+    }
+}    // namespace hpx::performance_counters
@@ -10,8 +10,15 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_SLAB)
+#include <hpx/allocator_support/slab_allocator.hpp>
+#endif
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
@@ -359,6 +366,29 @@ namespace hpx::performance_counters {
             hpx::bind_front(&detail::thread_counts_counter_creator));
 #endif
 
+        using threads::coroutines::detail::stack_pool;
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        hpx::function<std::int64_t(bool)> stack_pool_hits(hpx::bind_front(
+            &stack_pool::get_hit_count, &stack_pool::get()));
+        hpx::function<std::int64_t(bool)> stack_pool_misses(hpx::bind_front(
+            &stack_pool::get_miss_count, &stack_pool::get()));
+        hpx::function<std::int64_t(bool)> stack_pool_resident_bytes(
+            hpx::bind_front(
+                &stack_pool::get_resident_bytes, &stack_pool::get()));
+        hpx::function<std::int64_t(bool)> stack_pool_promotions(
+            hpx::bind_front(
+                &stack_pool::get_promotion_count, &stack_pool::get()));
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_SLAB)
+        hpx::function<std::int64_t(bool)> slab_reserved_bytes(
+            &hpx::util::get_slab_reserved_bytes);
+        hpx::function<std::int64_t(bool)> slab_allocated_bytes(
+            &hpx::util::get_slab_allocated_bytes);
+        hpx::function<std::int64_t(bool)> slab_remote_frees(
+            &hpx::util::get_slab_remote_free_count);
+#endif
+
         generic_counter_type_data const counter_types[] = {
             // length of thread queue(s)
             {"/threadqueue/length", counter_type::raw,
@@ -615,6 +645,64 @@ namespace hpx::performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
 #endif
+#endif
+            {"/threads/count/stack-pool/hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of coroutine stacks that were taken "
+                "from the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    HPX_MOVE(stack_pool_hits), _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool/misses",
+                counter_type::monotonically_increasing,
+                "returns the total number of coroutine stacks that had to be "
+                "allocated from the operating system because the stack pool "
+                "was empty for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    HPX_MOVE(stack_pool_misses), _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/resident", counter_type::raw,
+                "returns the overall size of all coroutine stacks currently "
+                "held by the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    HPX_MOVE(stack_pool_resident_bytes), _2),
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/count/stack-pool/promotions",
+                counter_type::monotonically_increasing,
+                "returns the total number of threads running on a lazily "
+                "bound stack that were suspended and therefore kept their "
+                "stack for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    HPX_MOVE(stack_pool_promotions), _2),
+                &locality_counter_discoverer, ""},
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_SLAB)
+            {"/threads/slab-allocator/reserved", counter_type::raw,
+                "returns the overall size of all slabs held by the slab "
+                "allocator for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    HPX_MOVE(slab_reserved_bytes), _2),
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/slab-allocator/allocated", counter_type::raw,
+                "returns the overall size of all blocks currently handed out "
+                "by the slab allocator for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    HPX_MOVE(slab_allocated_bytes), _2),
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/count/slab-allocator/remote-frees",
+                counter_type::monotonically_increasing,
+                "returns the total number of blocks that were freed by a "
+                "thread different from the one that allocated them for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    HPX_MOVE(slab_remote_frees), _2),
+                &locality_counter_discoverer, ""},
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
@@ -678,6 +766,39 @@ namespace hpx::performance_counters {
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
 #endif
+            {"/threads/count/stolen-from-shared-cache",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from "
+                "worker threads sharing a cache with the "
+                "referenced worker thread (work-requesting schedulers only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_from_shared_cache,
+                    &threads::thread_pool_base::get_num_stolen_from_shared_cache),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-numa-domain",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from "
+                "other worker threads in the same NUMA domain as the "
+                "referenced worker thread (work-requesting schedulers only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_from_numa_domain,
+                    &threads::thread_pool_base::get_num_stolen_from_numa_domain),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/stolen-from-remote-numa-domain",
+                counter_type::monotonically_increasing,
+                "returns the overall number of HPX-threads stolen from "
+                "worker threads in other NUMA domains than the "
+                "referenced worker thread (work-requesting schedulers only)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm,
+                    &threads::threadmanager::get_num_stolen_from_remote_numa_domain,
+                    &threads::thread_pool_base::get_num_stolen_from_remote_numa_domain),
+                &locality_pool_thread_counter_discoverer, ""},
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
                 "returns the current scheduler utilization",
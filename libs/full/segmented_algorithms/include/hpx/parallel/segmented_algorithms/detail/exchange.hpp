@@ -0,0 +1,260 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+
+    // The segmented algorithms that move elements between segments (sort,
+    // unique, partition) run one task per segment on the locality of the
+    // segment (a 'site'). The sites exchange the elements directly with each
+    // other using collective operations, no data is sent through the
+    // locality that invoked the algorithm.
+    template <typename SegIter>
+    struct segmented_sites
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+        using local_iterator = typename traits::local_iterator;
+
+        void add(hpx::id_type const& id, local_iterator beg,
+            local_iterator end)
+        {
+            if (beg != end)
+            {
+                std::size_t const count = std::distance(beg, end);
+                ids.push_back(id);
+                begins.push_back(HPX_MOVE(beg));
+                ends.push_back(HPX_MOVE(end));
+                offsets.push_back(offsets.back() + count);
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return ids.size();
+        }
+
+        std::vector<hpx::id_type> ids;
+        std::vector<local_iterator> begins;
+        std::vector<local_iterator> ends;
+
+        // offsets[i] is the position of the first element of site i in the
+        // sequence, offsets.back() is the length of the sequence
+        std::vector<std::size_t> offsets = std::vector<std::size_t>(1, 0);
+    };
+
+    // Collect the non-empty segments of the sequence [first, last)
+    template <typename SegIter>
+    segmented_sites<SegIter> get_segmented_sites(SegIter first, SegIter last)
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+
+        auto sit = traits::segment(first);
+        auto send = traits::segment(last);
+
+        segmented_sites<SegIter> sites;
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            sites.add(traits::get_id(sit), traits::local(first),
+                traits::local(last));
+        }
+        else
+        {
+            // handle the remaining part of the first partition
+            sites.add(
+                traits::get_id(sit), traits::local(first), traits::end(sit));
+
+            // handle all full partitions
+            for (++sit; sit != send; ++sit)
+            {
+                sites.add(
+                    traits::get_id(sit), traits::begin(sit), traits::end(sit));
+            }
+
+            // handle the beginning of the last partition
+            sites.add(
+                traits::get_id(sit), traits::begin(sit), traits::local(last));
+        }
+        return sites;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A range of elements to be stored at the given position of a site
+    template <typename T>
+    struct segmented_block
+    {
+        std::size_t offset = 0;
+        std::vector<T> data;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & offset & data;
+            // clang-format on
+        }
+    };
+
+    template <typename T>
+    using segmented_blocks = std::vector<std::vector<segmented_block<T>>>;
+
+    // Split the elements [first, last), which have to be stored starting at
+    // the position pos of the sequence, into blocks for the sites holding
+    // these positions.
+    template <typename T, typename Iter>
+    void route_segmented_blocks(std::vector<std::size_t> const& offsets,
+        std::size_t pos, Iter first, Iter last, segmented_blocks<T>& blocks)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        std::size_t site =
+            std::upper_bound(offsets.begin(), offsets.end(), pos) -
+            offsets.begin() - 1;
+
+        while (first != last)
+        {
+            std::size_t const count =
+                (std::min)(static_cast<std::size_t>(std::distance(first, last)),
+                    offsets[site + 1] - pos);
+
+            Iter next = std::next(first, count);
+            blocks[site].push_back(segmented_block<T>{
+                pos - offsets[site], std::vector<T>(first, next)});
+
+            first = next;
+            pos += count;
+            ++site;
+        }
+    }
+
+    // Store the blocks received from all sites
+    template <typename T, typename Iter>
+    void store_segmented_blocks(segmented_blocks<T>&& blocks, Iter dest)
+    {
+        for (auto& site_blocks : blocks)
+        {
+            for (auto& block : site_blocks)
+            {
+                std::move(block.data.begin(), block.data.end(),
+                    std::next(dest, block.offset));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The collective operations of the sites running a segmented algorithm
+    class segmented_site_communicator
+    {
+    public:
+        segmented_site_communicator(std::string const& basename,
+            std::size_t num_sites, std::size_t this_site)
+          : comm_(hpx::collectives::create_communicator(basename.c_str(),
+                hpx::collectives::num_sites_arg(num_sites),
+                hpx::collectives::this_site_arg(this_site)))
+          , this_site_(this_site)
+        {
+        }
+
+        template <typename T>
+        std::vector<T> all_gather(T value)
+        {
+            return hpx::collectives::all_gather(hpx::launch::sync, comm_,
+                HPX_MOVE(value),
+                hpx::collectives::this_site_arg(this_site_),
+                hpx::collectives::generation_arg(++generation_));
+        }
+
+        template <typename T>
+        std::vector<T> all_to_all(std::vector<T>&& values)
+        {
+            return hpx::collectives::all_to_all(hpx::launch::sync, comm_,
+                HPX_MOVE(values),
+                hpx::collectives::this_site_arg(this_site_),
+                hpx::collectives::generation_arg(++generation_));
+        }
+
+    private:
+        hpx::collectives::communicator comm_;
+        std::size_t this_site_;
+        std::size_t generation_ = 0;
+    };
+
+    // Every invocation of a segmented algorithm uses its own communicator
+    inline std::string get_segmented_basename(char const* algorithm)
+    {
+        static std::atomic<std::size_t> count(0);
+        return std::string("/hpx/segmented_algorithms/") + algorithm + "/" +
+            std::to_string(hpx::get_locality_id()) + "/" +
+            std::to_string(++count);
+    }
+
+    // Launch the given action on all sites. The action is invoked as
+    //
+    //     act(basename, num_sites, this_site, offsets, beg, end, ts...)
+    //
+    // and returns a std::size_t, all sites have to return the same value.
+    template <typename ExPolicy, typename Action, typename SegIter,
+        typename... Ts>
+    hpx::future<std::size_t> run_on_segmented_sites(Action act,
+        char const* algorithm, segmented_sites<SegIter> const& sites,
+        Ts const&... ts)
+    {
+        std::string const basename = get_segmented_basename(algorithm);
+
+        std::vector<hpx::future<std::size_t>> results;
+        results.reserve(sites.size());
+        for (std::size_t i = 0; i != sites.size(); ++i)
+        {
+            results.push_back(hpx::async(act, hpx::colocated(sites.ids[i]),
+                basename, sites.size(), i, sites.offsets, sites.begins[i],
+                sites.ends[i], ts...));
+        }
+
+        return hpx::dataflow(
+            [](std::vector<hpx::future<std::size_t>>&& r) -> std::size_t {
+                // handle any remote exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(r, errors);
+                return r.front().get();
+            },
+            HPX_MOVE(results));
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
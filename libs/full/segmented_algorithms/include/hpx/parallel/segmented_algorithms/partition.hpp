@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_partition
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Executed on every site: partition the local elements and move them
+        // to their position in the partitioned sequence. The elements for
+        // which the predicate returns true are stored in the order of the
+        // sites, followed by the remaining elements. Returns the number of
+        // elements for which the predicate returned true.
+        template <typename ExPolicy, typename LocalIter, typename Pred>
+        std::size_t segmented_partition_site(std::string basename,
+            std::size_t num_sites, std::size_t this_site,
+            std::vector<std::size_t> offsets, LocalIter beg, LocalIter end,
+            ExPolicy policy, Pred pred)
+        {
+            using local_traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+            using value_type =
+                typename std::iterator_traits<LocalIter>::value_type;
+
+            auto first = local_traits::local(beg);
+            auto last = local_traits::local(end);
+
+            auto const middle = hpx::partition(policy, first, last, pred);
+
+            segmented_site_communicator comm(basename, num_sites, this_site);
+
+            std::vector<std::size_t> const counts =
+                comm.all_gather(static_cast<std::size_t>(
+                    std::distance(first, middle)));
+            std::size_t const num_true = std::accumulate(
+                counts.begin(), counts.end(), static_cast<std::size_t>(0));
+            std::size_t const pos_true = std::accumulate(counts.begin(),
+                counts.begin() + this_site, static_cast<std::size_t>(0));
+            std::size_t const pos_false =
+                num_true + offsets[this_site] - pos_true;
+
+            segmented_blocks<value_type> blocks(num_sites);
+            route_segmented_blocks(offsets, pos_true,
+                std::make_move_iterator(first),
+                std::make_move_iterator(middle), blocks);
+            route_segmented_blocks(offsets, pos_false,
+                std::make_move_iterator(middle), std::make_move_iterator(last),
+                blocks);
+            store_segmented_blocks(comm.all_to_all(HPX_MOVE(blocks)), first);
+
+            return num_true;
+        }
+
+        template <typename ExPolicy, typename LocalIter, typename Pred>
+        struct segmented_partition_action
+          : hpx::actions::make_action<
+                decltype(&segmented_partition_site<ExPolicy, LocalIter, Pred>),
+                &segmented_partition_site<ExPolicy, LocalIter, Pred>,
+                segmented_partition_action<ExPolicy, LocalIter, Pred>>::type
+        {
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, SegIter>
+        segmented_partition(
+            ExPolicy&& policy, SegIter first, SegIter last, Pred&& pred)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, SegIter>;
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using local_iterator_type = typename traits::local_iterator;
+
+            if (first == last)
+            {
+                return result::get(HPX_MOVE(first));
+            }
+
+            auto local_policy =
+                hpx::execution::experimental::to_non_task(policy);
+
+            segmented_partition_action<decltype(local_policy),
+                local_iterator_type, std::decay_t<Pred>>
+                act;
+
+            return result::get(hpx::make_future<SegIter>(
+                run_on_segmented_sites<std::decay_t<ExPolicy>>(act,
+                    "partition", get_segmented_sites(first, last),
+                    local_policy, pred),
+                [first](std::size_t count) -> SegIter {
+                    return std::next(first, count);
+                }));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::partition_t, SegIter first, SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_partition(
+            hpx::execution::seq, first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::partition_t, ExPolicy&& policy, SegIter first,
+        SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_partition(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
@@ -0,0 +1,234 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Merge the sorted runs pairwise until a single run is left
+        template <typename ExPolicy, typename T, typename Comp>
+        std::vector<T> merge_sorted_runs(ExPolicy const& policy,
+            std::vector<std::vector<T>>&& runs, Comp const& comp)
+        {
+            while (runs.size() > 1)
+            {
+                std::vector<std::vector<T>> merged;
+                merged.reserve((runs.size() + 1) / 2);
+
+                for (std::size_t i = 0; i + 1 < runs.size(); i += 2)
+                {
+                    std::vector<T> out(runs[i].size() + runs[i + 1].size());
+                    hpx::merge(policy, runs[i].begin(), runs[i].end(),
+                        runs[i + 1].begin(), runs[i + 1].end(), out.begin(),
+                        comp);
+                    merged.push_back(HPX_MOVE(out));
+                }
+
+                if (runs.size() % 2 != 0)
+                {
+                    merged.push_back(HPX_MOVE(runs.back()));
+                }
+                runs = HPX_MOVE(merged);
+            }
+
+            return runs.empty() ? std::vector<T>() : HPX_MOVE(runs.front());
+        }
+
+        // Sample sort, executed on every site:
+        //
+        // - sort the local elements,
+        // - select the splitters from a regular sample of every site,
+        // - send the elements between two splitters to the site responsible
+        //   for this bucket (all-to-all),
+        // - merge the sorted runs received from all sites, and
+        // - store the merged bucket at its position in the sequence.
+        template <typename ExPolicy, typename LocalIter, typename Comp>
+        std::size_t segmented_sort_site(std::string basename,
+            std::size_t num_sites, std::size_t this_site,
+            std::vector<std::size_t> offsets, LocalIter beg, LocalIter end,
+            ExPolicy policy, Comp comp)
+        {
+            using local_traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+            using value_type =
+                typename std::iterator_traits<LocalIter>::value_type;
+
+            auto first = local_traits::local(beg);
+            auto last = local_traits::local(end);
+
+            hpx::sort(policy, first, last, comp);
+
+            segmented_site_communicator comm(basename, num_sites, this_site);
+
+            // every site contributes up to num_sites evenly spaced samples,
+            // all sites select the same splitters
+            std::size_t const count = std::distance(first, last);
+            std::size_t const num_samples = (std::min)(count, num_sites);
+
+            std::vector<value_type> samples;
+            samples.reserve(num_samples);
+            for (std::size_t i = 0; i != num_samples; ++i)
+            {
+                samples.push_back(*std::next(first, (i * count) / num_samples));
+            }
+
+            std::vector<value_type> splitters;
+            {
+                std::vector<std::vector<value_type>> const all_samples =
+                    comm.all_gather(HPX_MOVE(samples));
+
+                std::vector<value_type> sorted_samples;
+                for (auto const& s : all_samples)
+                {
+                    sorted_samples.insert(
+                        sorted_samples.end(), s.begin(), s.end());
+                }
+                std::sort(sorted_samples.begin(), sorted_samples.end(), comp);
+
+                std::size_t const total = sorted_samples.size();
+                splitters.reserve(num_sites - 1);
+                for (std::size_t i = 1; i != num_sites; ++i)
+                {
+                    splitters.push_back(
+                        sorted_samples[(i * total) / num_sites]);
+                }
+            }
+
+            // bucket i holds the elements in [splitters[i-1], splitters[i])
+            std::vector<std::vector<value_type>> buckets(num_sites);
+            auto it = first;
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                auto next = (i + 1 == num_sites) ?
+                    last :
+                    std::lower_bound(it, last, splitters[i], comp);
+                buckets[i].assign(
+                    std::make_move_iterator(it), std::make_move_iterator(next));
+                it = next;
+            }
+
+            std::vector<value_type> bucket = merge_sorted_runs(
+                policy, comm.all_to_all(HPX_MOVE(buckets)), comp);
+
+            // the merged bucket follows the buckets of all preceding sites
+            std::vector<std::size_t> const sizes =
+                comm.all_gather(bucket.size());
+            std::size_t const pos = std::accumulate(sizes.begin(),
+                sizes.begin() + this_site, static_cast<std::size_t>(0));
+
+            segmented_blocks<value_type> blocks(num_sites);
+            route_segmented_blocks(offsets, pos,
+                std::make_move_iterator(bucket.begin()),
+                std::make_move_iterator(bucket.end()), blocks);
+            store_segmented_blocks(comm.all_to_all(HPX_MOVE(blocks)), first);
+
+            return 0;
+        }
+
+        template <typename ExPolicy, typename LocalIter, typename Comp>
+        struct segmented_sort_action
+          : hpx::actions::make_action<
+                decltype(&segmented_sort_site<ExPolicy, LocalIter, Comp>),
+                &segmented_sort_site<ExPolicy, LocalIter, Comp>,
+                segmented_sort_action<ExPolicy, LocalIter, Comp>>::type
+        {
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Comp>
+        util::detail::algorithm_result_t<ExPolicy> segmented_sort(
+            ExPolicy&& policy, SegIter first, SegIter last, Comp&& comp)
+        {
+            using result = util::detail::algorithm_result<ExPolicy>;
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using local_iterator_type = typename traits::local_iterator;
+
+            if (first == last)
+            {
+                return result::get();
+            }
+
+            auto local_policy =
+                hpx::execution::experimental::to_non_task(policy);
+
+            segmented_sort_action<decltype(local_policy), local_iterator_type,
+                std::decay_t<Comp>>
+                act;
+
+            return result::get(
+                run_on_segmented_sites<std::decay_t<ExPolicy>>(act, "sort",
+                    get_segmented_sites(first, last), local_policy, comp));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(
+        hpx::sort_t, SegIter first, SegIter last, Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        hpx::parallel::detail::segmented_sort(
+            hpx::execution::seq, first, last, HPX_MOVE(comp));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        return hpx::parallel::detail::segmented_sort(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(comp));
+    }
+}    // namespace hpx::segmented
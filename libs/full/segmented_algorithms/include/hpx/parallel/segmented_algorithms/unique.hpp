@@ -0,0 +1,168 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/unique.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_unique
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Executed on every site: remove the consecutive duplicates from the
+        // local elements and move the remaining elements to their position in
+        // the compacted sequence. Returns the length of the compacted
+        // sequence.
+        template <typename ExPolicy, typename LocalIter, typename Pred>
+        std::size_t segmented_unique_site(std::string basename,
+            std::size_t num_sites, std::size_t this_site,
+            std::vector<std::size_t> offsets, LocalIter beg, LocalIter end,
+            ExPolicy policy, Pred pred)
+        {
+            using local_traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+            using value_type =
+                typename std::iterator_traits<LocalIter>::value_type;
+
+            auto first = local_traits::local(beg);
+            auto last = local_traits::local(end);
+
+            segmented_site_communicator comm(basename, num_sites, this_site);
+
+            // the leading elements that are equal to the last element of the
+            // preceding site are duplicates
+            std::vector<value_type> const last_elements =
+                comm.all_gather(value_type(*std::prev(last)));
+
+            auto it = first;
+            if (this_site != 0)
+            {
+                value_type const& prev = last_elements[this_site - 1];
+                while (it != last && HPX_INVOKE(pred, prev, *it))
+                {
+                    ++it;
+                }
+            }
+
+            auto const new_last = hpx::unique(policy, it, last, pred);
+
+            std::vector<std::size_t> const counts =
+                comm.all_gather(static_cast<std::size_t>(
+                    std::distance(it, new_last)));
+            std::size_t const pos = std::accumulate(counts.begin(),
+                counts.begin() + this_site, static_cast<std::size_t>(0));
+
+            segmented_blocks<value_type> blocks(num_sites);
+            route_segmented_blocks(offsets, pos, std::make_move_iterator(it),
+                std::make_move_iterator(new_last), blocks);
+            store_segmented_blocks(comm.all_to_all(HPX_MOVE(blocks)), first);
+
+            return std::accumulate(
+                counts.begin(), counts.end(), static_cast<std::size_t>(0));
+        }
+
+        template <typename ExPolicy, typename LocalIter, typename Pred>
+        struct segmented_unique_action
+          : hpx::actions::make_action<
+                decltype(&segmented_unique_site<ExPolicy, LocalIter, Pred>),
+                &segmented_unique_site<ExPolicy, LocalIter, Pred>,
+                segmented_unique_action<ExPolicy, LocalIter, Pred>>::type
+        {
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, SegIter> segmented_unique(
+            ExPolicy&& policy, SegIter first, SegIter last, Pred&& pred)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, SegIter>;
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using local_iterator_type = typename traits::local_iterator;
+
+            if (first == last)
+            {
+                return result::get(HPX_MOVE(first));
+            }
+
+            auto local_policy =
+                hpx::execution::experimental::to_non_task(policy);
+
+            segmented_unique_action<decltype(local_policy),
+                local_iterator_type, std::decay_t<Pred>>
+                act;
+
+            return result::get(hpx::make_future<SegIter>(
+                run_on_segmented_sites<std::decay_t<ExPolicy>>(act, "unique",
+                    get_segmented_sites(first, last), local_policy, pred),
+                [first](std::size_t count) -> SegIter {
+                    return std::next(first, count);
+                }));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::unique_t, SegIter first, SegIter last, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_unique(
+            hpx::execution::seq, first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::unique_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_unique(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
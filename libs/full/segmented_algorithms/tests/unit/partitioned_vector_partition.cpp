@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct less_than_42
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return val < T(42);
+    }
+};
+
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v, std::vector<T>& values)
+{
+    values.clear();
+
+    std::size_t i = 0;
+    for (auto it = v.begin(); it != v.end(); ++it, ++i)
+    {
+        T const val = T((i * 7919) % 101);
+        *it = val;
+        values.push_back(val);
+    }
+}
+
+template <typename T, typename Iter>
+void verify_partition(hpx::partitioned_vector<T> const& v, Iter result,
+    std::vector<T> values)
+{
+    std::vector<T> partitioned;
+    for (auto it = v.begin(); it != v.end(); ++it)
+    {
+        partitioned.push_back(*it);
+    }
+
+    std::size_t const num_true = static_cast<std::size_t>(
+        std::count_if(values.begin(), values.end(), less_than_42()));
+    HPX_TEST_EQ(
+        static_cast<std::size_t>(std::distance(v.begin(), result)), num_true);
+    HPX_TEST(std::is_partitioned(
+        partitioned.begin(), partitioned.end(), less_than_42()));
+    HPX_TEST(std::all_of(partitioned.begin(),
+        partitioned.begin() + num_true, less_than_42()));
+
+    // no element was lost
+    std::sort(values.begin(), values.end());
+    std::sort(partitioned.begin(), partitioned.end());
+    HPX_TEST(values == partitioned);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void partition_algo_tests_with_policy(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& part_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    std::vector<T> values;
+
+    fill_vector(c, values);
+    auto result =
+        hpx::partition(part_policy, c.begin(), c.end(), less_than_42());
+    verify_partition(c, result, values);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void partition_algo_tests_with_policy_async(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& part_policy)
+{
+    using iterator = typename hpx::partitioned_vector<T>::iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+    std::vector<T> values;
+
+    fill_vector(c, values);
+    hpx::future<iterator> f =
+        hpx::partition(part_policy, c.begin(), c.end(), less_than_42());
+    verify_partition(c, f.get(), values);
+}
+
+template <typename T, typename DistPolicy>
+void partition_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    partition_algo_tests_with_policy<T>(size, policy, seq);
+    partition_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    partition_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    partition_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void partition_tests()
+{
+    std::size_t const length = 1000;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    partition_tests_with_policy<T>(length, hpx::container_layout);
+    partition_tests_with_policy<T>(length, hpx::container_layout(3));
+    partition_tests_with_policy<T>(
+        length, hpx::container_layout(3, localities));
+    partition_tests_with_policy<T>(length, hpx::container_layout(localities));
+    partition_tests_with_policy<T>(
+        length, hpx::container_layout(4 * localities.size(), localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    partition_tests<double>();
+    partition_tests<int>();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v, std::vector<T>& expected)
+{
+    expected.clear();
+
+    std::size_t i = 0;
+    for (auto it = v.begin(); it != v.end(); ++it, ++i)
+    {
+        // many duplicates, spread over all partitions
+        T const val = T((i * 7919) % 1009);
+        *it = val;
+        expected.push_back(val);
+    }
+}
+
+template <typename T>
+void verify_vector(
+    hpx::partitioned_vector<T> const& v, std::vector<T> const& expected)
+{
+    std::vector<T> values;
+    for (auto it = v.begin(); it != v.end(); ++it)
+    {
+        values.push_back(*it);
+    }
+    HPX_TEST(values == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    std::vector<T> expected;
+
+    fill_vector(c, expected);
+    hpx::sort(sort_policy, c.begin(), c.end());
+    std::sort(expected.begin(), expected.end());
+    verify_vector(c, expected);
+
+    // sort a sub-range using a custom comparison
+    fill_vector(c, expected);
+    hpx::sort(sort_policy, c.begin() + 1, c.end() - 1, std::greater<T>());
+    std::sort(expected.begin() + 1, expected.end() - 1, std::greater<T>());
+    verify_vector(c, expected);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    std::vector<T> expected;
+
+    fill_vector(c, expected);
+    hpx::future<void> f = hpx::sort(sort_policy, c.begin(), c.end());
+    f.get();
+
+    std::sort(expected.begin(), expected.end());
+    verify_vector(c, expected);
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    sort_algo_tests_with_policy<T>(size, policy, seq);
+    sort_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    sort_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    sort_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::size_t const length = 1000;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(length, hpx::container_layout);
+    sort_tests_with_policy<T>(length, hpx::container_layout(3));
+    sort_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+    sort_tests_with_policy<T>(
+        length, hpx::container_layout(4 * localities.size(), localities));
+
+    // less elements than partitions
+    sort_tests_with_policy<T>(3, hpx::container_layout(8, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,143 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_unique.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+// two values are equivalent if they differ by less than 3
+struct close_to
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs / 3 == rhs / 3;
+    }
+};
+
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v, std::vector<T>& expected)
+{
+    expected.clear();
+
+    std::size_t i = 0;
+    for (auto it = v.begin(); it != v.end(); ++it, ++i)
+    {
+        // groups of duplicates of varying length spanning partitions
+        T const val = T((i / (1 + i % 7)) % 50);
+        *it = val;
+        expected.push_back(val);
+    }
+}
+
+template <typename T, typename Iter>
+void verify_values(hpx::partitioned_vector<T> const& v, Iter result,
+    std::vector<T> const& expected, std::size_t expected_length)
+{
+    HPX_TEST_EQ(static_cast<std::size_t>(std::distance(v.begin(), result)),
+        expected_length);
+
+    std::size_t i = 0;
+    for (auto it = v.begin(); it != result; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void unique_algo_tests_with_policy(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& unique_policy)
+{
+    hpx::partitioned_vector<T> c(size, policy);
+    std::vector<T> expected;
+
+    fill_vector(c, expected);
+    auto result = hpx::unique(unique_policy, c.begin(), c.end());
+    auto expected_end = std::unique(expected.begin(), expected.end());
+    verify_values(c, result, expected,
+        static_cast<std::size_t>(
+            std::distance(expected.begin(), expected_end)));
+
+    // use a custom predicate
+    fill_vector(c, expected);
+    result = hpx::unique(unique_policy, c.begin(), c.end(), close_to());
+    expected_end = std::unique(expected.begin(), expected.end(), close_to());
+    verify_values(c, result, expected,
+        static_cast<std::size_t>(
+            std::distance(expected.begin(), expected_end)));
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void unique_algo_tests_with_policy_async(
+    std::size_t size, DistPolicy const& policy, ExPolicy const& unique_policy)
+{
+    using iterator = typename hpx::partitioned_vector<T>::iterator;
+
+    hpx::partitioned_vector<T> c(size, policy);
+    std::vector<T> expected;
+
+    fill_vector(c, expected);
+    hpx::future<iterator> f =
+        hpx::unique(unique_policy, c.begin(), c.end());
+    iterator result = f.get();
+
+    auto expected_end = std::unique(expected.begin(), expected.end());
+    verify_values(c, result, expected,
+        static_cast<std::size_t>(
+            std::distance(expected.begin(), expected_end)));
+}
+
+template <typename T, typename DistPolicy>
+void unique_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    unique_algo_tests_with_policy<T>(size, policy, seq);
+    unique_algo_tests_with_policy<T>(size, policy, par);
+
+    //async
+    unique_algo_tests_with_policy_async<T>(size, policy, seq(task));
+    unique_algo_tests_with_policy_async<T>(size, policy, par(task));
+}
+
+template <typename T>
+void unique_tests()
+{
+    std::size_t const length = 1000;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    unique_tests_with_policy<T>(length, hpx::container_layout);
+    unique_tests_with_policy<T>(length, hpx::container_layout(3));
+    unique_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    unique_tests_with_policy<T>(length, hpx::container_layout(localities));
+    unique_tests_with_policy<T>(
+        length, hpx::container_layout(4 * localities.size(), localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    unique_tests<int>();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -1,4 +1,5 @@
 //  Copyright (c) 2016 Hartmut Kaiser
+//  Copyright (c) 2026 The STE||AR-Group
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -14,6 +15,7 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
@@ -30,6 +32,8 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -230,6 +234,104 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Concurrent lookups from all worker threads, the original cache has to be
+// locked exclusively as looking up an entry modifies its LRU state.
+template <typename Lookup>
+double test_concurrent_get(Lookup lookup, hpx::naming::gid_type first_key,
+    std::size_t num_entries, std::size_t num_lookups)
+{
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_threads);
+
+    hpx::chrono::high_resolution_timer const t;
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        // every task uses its own copy of the lookup function
+        tasks.push_back(hpx::async([=]() mutable {
+            for (std::size_t j = 0; j != num_lookups; ++j)
+            {
+                std::uint64_t const offset = (i * 7919 + j) % num_entries;
+                lookup(first_key + (offset + 1));
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    return t.elapsed() / static_cast<double>(num_threads * num_lookups);
+}
+
+void test_concurrent(std::size_t cache_size, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = to_int(hpx::components::component_enum_type::invalid);
+
+    // original cache protected by a shared_mutex
+    gva_cache_type cache;
+    cache.reserve(cache_size);
+    hpx::shared_mutex mtx;
+
+    // sharded cache
+    hpx::agas::detail::gva_cache sharded_cache;
+    sharded_cache.reserve(cache_size);
+
+    hpx::naming::gid_type const first_key = hpx::detail::get_next_id();
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::gid_type const key = hpx::detail::get_next_id();
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+        cache.insert(gva_cache_key(key, 1), value);
+        sharded_cache.update(
+            hpx::naming::detail::get_stripped_gid(key), 1, value);
+    }
+
+    double const locked = test_concurrent_get(
+        [&](hpx::naming::gid_type const& id) {
+            gva_cache_key idbase;
+            gva_cache_type::entry_type e;
+
+            std::unique_lock<hpx::shared_mutex> l(mtx);
+            cache.get_entry(gva_cache_key(id, 1), idbase, e);
+        },
+        first_key, num_entries, num_lookups);
+
+    double const sharded = test_concurrent_get(
+        [&](hpx::naming::gid_type const& id) {
+            hpx::naming::gid_type idbase;
+            hpx::agas::gva g;
+            sharded_cache.get_entry(
+                hpx::naming::detail::get_stripped_gid(id), idbase, g);
+        },
+        first_key, num_entries, num_lookups);
+
+    // batched lookups
+    std::size_t const batch_size = 64;
+    double const batched = test_concurrent_get(
+        [&, batch = std::vector<hpx::naming::gid_type>(), n = std::size_t(0)](
+            hpx::naming::gid_type const& id) mutable {
+            batch.push_back(hpx::naming::detail::get_stripped_gid(id));
+            if (++n % batch_size == 0)
+            {
+                std::vector<hpx::naming::gid_type> idbases(batch.size());
+                std::vector<hpx::agas::gva> gvas(batch.size());
+                hpx::detail::dynamic_bitset<> found;
+                sharded_cache.get_entries(batch.data(), batch.size(),
+                    idbases.data(), gvas.data(), found);
+                batch.clear();
+            }
+        },
+        first_key, num_entries, num_lookups);
+
+    std::cout << "concurrent get (" << hpx::get_num_worker_threads()
+              << " threads, per lookup): locked: " << locked * 1e9
+              << "[ns], sharded: " << sharded * 1e9
+              << "[ns], sharded (batched): " << batched * 1e9 << "[ns]\n";
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -241,6 +343,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -252,6 +358,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_get(cache, first_key);
     test_update(cache, first_key);
 
+    test_concurrent(cache_size, num_entries, num_lookups);
+
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
@@ -268,7 +376,9 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>(),
+        "number of concurrent lookups per worker thread (default: 100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
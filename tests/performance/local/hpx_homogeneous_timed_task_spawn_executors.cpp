@@ -9,8 +9,10 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/modules/format.hpp>
-#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
@@ -25,9 +27,6 @@ using hpx::program_options::variables_map;
 
 using hpx::get_os_thread_count;
 
-using hpx::this_thread::suspend;
-using hpx::threads::get_thread_count;
-
 using hpx::chrono::high_resolution_timer;
 
 using hpx::cout;
@@ -36,25 +35,69 @@ using hpx::cout;
 // Command-line variables.
 std::uint64_t tasks = 500000;
 std::uint64_t delay = 0;
+std::uint64_t batch_size = 0;
 bool header = true;
 
 ///////////////////////////////////////////////////////////////////////////////
 void print_results(std::uint64_t cores, double walltime)
 {
     if (header)
-        cout << "OS-threads,Tasks,Delay (iterations),"
+        cout << "OS-threads,Tasks,Delay (iterations),Batch Size,"
                 "Total Walltime (seconds),Walltime per Task (seconds)\n"
              << std::flush;
 
     std::string const cores_str = hpx::util::format("{},", cores);
     std::string const tasks_str = hpx::util::format("{},", tasks);
     std::string const delay_str = hpx::util::format("{},", delay);
+    std::string const batch_str = hpx::util::format("{},", batch_size);
 
-    hpx::util::format_to(cout, "{:-21} {:-21} {:-21} {:10.12}, {:10.12}\n",
-        cores_str, tasks_str, delay_str, walltime, walltime / tasks)
+    hpx::util::format_to(cout,
+        "{:-21} {:-21} {:-21} {:-21} {:10.12}, {:10.12}\n", cores_str,
+        tasks_str, delay_str, batch_str, walltime, walltime / tasks)
         << std::flush;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::uint64_t> tasks_done(0);
+
+void worker(std::uint64_t delay_ns)
+{
+    worker_timed(delay_ns);
+    ++tasks_done;
+}
+
+// spawn all tasks one by one through the executor
+void spawn_tasks(std::size_t num_executors)
+{
+    std::vector<hpx::execution::parallel_executor> executors(num_executors);
+    for (std::uint64_t i = 0; i < tasks; ++i)
+    {
+        hpx::parallel::execution::post(
+            executors[i % num_executors], &worker, delay * 1000);
+    }
+}
+
+// spawn the tasks in batches using the bulk submission API
+void spawn_tasks_bulk()
+{
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(batch_size);
+
+    for (std::uint64_t i = 0; i < tasks; /**/)
+    {
+        std::uint64_t const end = (std::min)(tasks, i + batch_size);
+        for (/**/; i != end; ++i)
+        {
+            data.emplace_back(hpx::threads::make_thread_function_nullary(
+                                  hpx::bind(&worker, delay * 1000)),
+                "worker");
+        }
+
+        hpx::threads::register_bulk_work(data);
+        data.clear();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(variables_map& vm)
 {
@@ -68,49 +111,24 @@ int hpx_main(variables_map& vm)
         throw std::invalid_argument(
             "number of executors to use must be larger than 0");
 
-    if (std::size_t(num_executors) > num_os_threads)
-        throw std::invalid_argument("number of executors to use must be \
-                                        smaller than number of OS threads");
-
-    std::size_t num_cores_per_executor = vm["cores"].as<int>();
-
-    if ((num_executors - 1) * num_cores_per_executor > num_os_threads)
-        throw std::invalid_argument("number of cores per executor should not \
-                                     cause oversubscription");
-
     if (0 == tasks)
         throw std::invalid_argument("count of 0 tasks specified\n");
 
+    if (vm.count("bulk") && batch_size == 0)
+        batch_size = tasks;
+    else if (!vm.count("bulk"))
+        batch_size = 0;
+
     // Start the clock.
     high_resolution_timer t;
 
-    // create the executor instances
-    using hpx::threads::executors::local_priority_queue_executor;
+    if (batch_size != 0)
+        spawn_tasks_bulk();
+    else
+        spawn_tasks(static_cast<std::size_t>(num_executors));
 
-    {
-        std::vector<local_priority_queue_executor> executors;
-        for (std::size_t i = 0; i != std::size_t(num_executors); ++i)
-        {
-            // make sure we don't oversubscribe the cores, the last executor will
-            // be bound to the remaining number of cores
-            if ((i + 1) * num_cores_per_executor > num_os_threads)
-            {
-                HPX_TEST_EQ(i, std::size_t(num_executors) - 1);
-                num_cores_per_executor =
-                    num_os_threads - i * num_cores_per_executor;
-            }
-            executors.push_back(
-                local_priority_queue_executor(num_cores_per_executor));
-        }
-
-        t.restart();
-
-        // schedule normal threads
-        for (std::uint64_t i = 0; i < tasks; ++i)
-            executors[i % num_executors].add(
-                hpx::bind(&worker_timed, delay * 1000));
-        // destructors of executors will wait for all tasks to finish executing
-    }
+    // wait for all tasks to finish executing
+    hpx::util::yield_while([]() { return tasks_done != tasks; });
 
     print_results(num_os_threads, t.elapsed());
 
@@ -133,10 +151,16 @@ int main(int argc, char* argv[])
             ("executors,e", value<int>()->default_value(1),
                 "number of executor instances to use")
 
-                ("cores", value<int>()->default_value(1),
-                    "number of cores to bind to each of the executor instances")
+                ("bulk",
+                    "submit the tasks in batches using the bulk submission "
+                    "API instead of one by one through the executors")
+
+                    ("batch-size",
+                        value<std::uint64_t>(&batch_size)->default_value(0),
+                        "number of tasks submitted at once in bulk mode "
+                        "(default: all tasks)")
 
-                    ("no-header", "do not print out the csv header row");
+                        ("no-header", "do not print out the csv header row");
 
     // Initialize and run HPX.
     hpx::init_params init_args;
@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the segmented sort, unique, and partition algorithms on a
+// partitioned_vector spread over all localities. Run it on several
+// localities to include the exchange of the elements between them.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+unsigned int seed = 0;
+
+struct is_even
+{
+    bool operator()(int val) const
+    {
+        return (val % 2) == 0;
+    }
+};
+
+void fill_random(hpx::partitioned_vector<int>& v, int max_value)
+{
+    auto const& partitions = v.partitions();
+
+    std::vector<hpx::future<void>> fills;
+    fills.reserve(partitions.size());
+    for (std::size_t part = 0; part != partitions.size(); ++part)
+    {
+        std::size_t const size = partitions[part].size_;
+
+        std::mt19937 gen(seed + static_cast<unsigned int>(part));
+        std::uniform_int_distribution<int> dist(0, max_value);
+
+        std::vector<std::size_t> positions(size);
+        std::vector<int> values(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            positions[i] = i;
+            values[i] = dist(gen);
+        }
+        fills.push_back(v.set_values(part, positions, values));
+    }
+    hpx::wait_all(fills);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Policy, typename F>
+std::uint64_t measure(Policy const& policy, hpx::partitioned_vector<int>& v,
+    int max_value, F&& f)
+{
+    std::uint64_t elapsed = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        fill_random(v, max_value);
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        f(policy, v);
+        elapsed += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return elapsed / test_count;
+}
+
+template <typename Policy>
+void run_benchmarks(Policy const& policy, char const* name,
+    hpx::partitioned_vector<int>& v, std::size_t num_partitions)
+{
+    auto const sort = [](auto const& p, hpx::partitioned_vector<int>& v) {
+        hpx::sort(p, v.begin(), v.end());
+    };
+    auto const unique = [](auto const& p, hpx::partitioned_vector<int>& v) {
+        hpx::sort(p, v.begin(), v.end());
+        hpx::unique(p, v.begin(), v.end());
+    };
+    auto const partition = [](auto const& p,
+                               hpx::partitioned_vector<int>& v) {
+        hpx::partition(p, v.begin(), v.end(), is_even());
+    };
+
+    int const max_value = static_cast<int>(v.size());
+    hpx::cout << "sort(" << name << ", " << num_partitions
+              << " partitions): " << measure(policy, v, max_value, sort) / 1e9
+              << " [s]\n"
+              << "sort+unique(" << name << ", " << num_partitions
+              << " partitions): "
+              << measure(policy, v, max_value / 10, unique) / 1e9 << " [s]\n"
+              << "partition(" << name << ", " << num_partitions
+              << " partitions): "
+              << measure(policy, v, max_value, partition) / 1e9 << " [s]\n"
+              << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t const partitions_per_locality =
+        vm["partitions_per_locality"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+    seed = vm["seed"].as<unsigned int>();
+
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << std::flush;
+        return hpx::finalize();
+    }
+
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    std::size_t const num_partitions =
+        partitions_per_locality * localities.size();
+
+    hpx::cout << "localities: " << localities.size()
+              << ", vector size: " << vector_size << "\n";
+
+    hpx::partitioned_vector<int> v(
+        vector_size, hpx::container_layout(num_partitions, localities));
+
+    run_benchmarks(hpx::execution::seq, "seq", v, num_partitions);
+    run_benchmarks(hpx::execution::par, "par", v, num_partitions);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1000000)
+        , "size of vector (default: 1000000)")
+
+        ("partitions_per_locality"
+        , hpx::program_options::value<std::size_t>()->default_value(1)
+        , "number of partitions per locality (default: 1)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to be averaged (default: 10)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(0)
+        , "the seed for the random number generator (default: 0)")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+// Measures the push, pop, and steal overheads of the Chase-Lev work-stealing
+// deque compared to the moodycamel concurrent queue. One thread (the owner)
+// repeatedly pushes a block of items and pops them again while all other
+// threads continuously try to steal items.
+
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+char const* benchmark_name = "Work-Stealing Deque Overhead";
+
+using hpx::program_options::command_line_parser;
+using hpx::program_options::notify;
+using hpx::program_options::options_description;
+using hpx::program_options::store;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::chrono::high_resolution_timer;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t threads = 1;
+std::uint64_t blocksize = 10000;
+std::uint64_t iterations = 2000000;
+bool header = true;
+
+///////////////////////////////////////////////////////////////////////////////
+struct results
+{
+    double push = 0.0;     // accumulated time for pushing
+    double pop = 0.0;      // accumulated time for popping (owner)
+    double steal = 0.0;    // accumulated time for stealing (thieves)
+    std::uint64_t pushed = 0;
+    std::uint64_t popped = 0;
+    std::uint64_t stolen = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::string format_build_date()
+{
+    std::chrono::time_point<std::chrono::system_clock> now =
+        std::chrono::system_clock::now();
+
+    std::time_t current_time = std::chrono::system_clock::to_time_t(now);
+
+    std::string ts = std::ctime(&current_time);
+    ts.resize(ts.size() - 1);    // remove trailing '\n'
+    return ts;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double per_item(double elapsed, std::uint64_t count)
+{
+    return count != 0 ? (elapsed / static_cast<double>(count)) * 1e9 : 0.0;
+}
+
+void print_results(results const& chase_lev, results const& moodycamel)
+{
+    if (header)
+    {
+        std::cout << "# BENCHMARK: " << benchmark_name << "\n";
+
+        std::cout << "# VERSION: " << format_build_date() << "\n"
+                  << "#\n";
+
+        std::cout
+            << "## 0:ITER:Iterations - Independent Variable\n"
+               "## 1:BSIZE:Maximum Queue Depth - Independent Variable\n"
+               "## 2:OSTHRDS:OS-threads (owner and thieves) - Independent "
+               "Variable\n"
+               "## 3:WTIME_CL_PUSH:Walltime/Push for "
+               "hpx::lockfree::chase_lev_deque [nanoseconds]\n"
+               "## 4:WTIME_CL_POP:Walltime/Pop for "
+               "hpx::lockfree::chase_lev_deque [nanoseconds]\n"
+               "## 5:WTIME_CL_STEAL:Walltime/Steal for "
+               "hpx::lockfree::chase_lev_deque [nanoseconds]\n"
+               "## 6:WTIME_MC_PUSH:Walltime/Push for "
+               "hpx::concurrency::ConcurrentQueue [nanoseconds]\n"
+               "## 7:WTIME_MC_POP:Walltime/Pop for "
+               "hpx::concurrency::ConcurrentQueue [nanoseconds]\n"
+               "## 8:WTIME_MC_STEAL:Walltime/Steal for "
+               "hpx::concurrency::ConcurrentQueue [nanoseconds]\n";
+    }
+
+    hpx::util::format_to(std::cout,
+        "{} {} {} {:.14g} {:.14g} {:.14g} {:.14g} {:.14g} {:.14g}\n",
+        iterations, blocksize, threads,
+        per_item(chase_lev.push, chase_lev.pushed),
+        per_item(chase_lev.pop, chase_lev.popped),
+        per_item(chase_lev.steal, chase_lev.stolen),
+        per_item(moodycamel.push, moodycamel.pushed),
+        per_item(moodycamel.pop, moodycamel.popped),
+        per_item(moodycamel.steal, moodycamel.stolen));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// adapt both containers to the same interface
+struct chase_lev_adaptor
+{
+    explicit chase_lev_adaptor(std::size_t size)
+      : deque_(size)
+    {
+    }
+
+    void push(std::uint64_t* val)
+    {
+        deque_.push_bottom(val);
+    }
+
+    bool pop(std::uint64_t*& val)
+    {
+        return deque_.pop_bottom(val);
+    }
+
+    bool steal(std::uint64_t*& val)
+    {
+        return deque_.steal(val);
+    }
+
+    hpx::lockfree::chase_lev_deque<std::uint64_t*> deque_;
+};
+
+struct moodycamel_adaptor
+{
+    explicit moodycamel_adaptor(std::size_t size)
+      : queue_(size)
+    {
+    }
+
+    void push(std::uint64_t* val)
+    {
+        queue_.enqueue(val);
+    }
+
+    bool pop(std::uint64_t*& val)
+    {
+        return queue_.try_dequeue(val);
+    }
+
+    bool steal(std::uint64_t*& val)
+    {
+        return queue_.try_dequeue(val);
+    }
+
+    hpx::concurrency::ConcurrentQueue<std::uint64_t*> queue_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Queue>
+void owner(Queue& queue, results& r)
+{
+    std::uint64_t seed = 0;
+    high_resolution_timer t;
+
+    for (std::uint64_t block = 0; block < (iterations / blocksize); ++block)
+    {
+        // Push.
+        t.restart();
+
+        for (std::uint64_t i = 0; i < blocksize; ++i)
+        {
+            queue.push(&seed);
+        }
+
+        r.push += t.elapsed();
+        r.pushed += blocksize;
+
+        // Pop whatever was not stolen in the meantime.
+        t.restart();
+
+        std::uint64_t* val = nullptr;
+        while (queue.pop(val))
+        {
+            ++r.popped;
+        }
+
+        r.pop += t.elapsed();
+    }
+}
+
+template <typename Queue>
+void thief(Queue& queue, std::atomic<bool>& done, results& r)
+{
+    high_resolution_timer t;
+
+    std::uint64_t* val = nullptr;
+    while (!done.load(std::memory_order_relaxed))
+    {
+        if (queue.steal(val))
+        {
+            ++r.stolen;
+        }
+    }
+
+    r.steal = t.elapsed();
+}
+
+template <typename Queue>
+results bench_queue()
+{
+    Queue queue(blocksize);
+    std::atomic<bool> done(false);
+
+    std::vector<results> thief_results(threads - 1);
+    std::vector<std::thread> thieves;
+    thieves.reserve(threads - 1);
+
+    for (std::uint64_t i = 0; i != threads - 1; ++i)
+    {
+        thieves.emplace_back(thief<Queue>, std::ref(queue), std::ref(done),
+            std::ref(thief_results[i]));
+    }
+
+    results r;
+    owner(queue, r);
+
+    done = true;
+    for (std::thread& thread : thieves)
+    {
+        thread.join();
+    }
+
+    for (results const& tr : thief_results)
+    {
+        r.steal += tr.steal;
+        r.stolen += tr.stolen;
+    }
+    return r;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int app_main(variables_map&)
+{
+    // Warmup.
+    std::uint64_t const iter = iterations;
+    iterations = blocksize;
+    bench_queue<chase_lev_adaptor>();
+    bench_queue<moodycamel_adaptor>();
+    iterations = iter;
+
+    results const chase_lev = bench_queue<chase_lev_adaptor>();
+    results const moodycamel = bench_queue<moodycamel_adaptor>();
+
+    // Print out the results.
+    print_results(chase_lev, moodycamel);
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Parse command line.
+    variables_map vm;
+
+    options_description cmdline(
+        "Usage: work_stealing_deque_overhead [options]");
+
+    cmdline.add_options()("help,h", "print out program usage (this message)")
+
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(1),
+            "number of threads to use (one owner, all others are thieves)")
+
+            ("iterations",
+                value<std::uint64_t>(&iterations)->default_value(2000000),
+                "number of iterations to perform (most be divisible by block "
+                "size)")
+
+                ("blocksize",
+                    value<std::uint64_t>(&blocksize)->default_value(10000),
+                    "size of each block")
+
+                    ("no-header", "do not print out the header");
+
+    store(command_line_parser(argc, argv).options(cmdline).run(), vm);
+
+    notify(vm);
+
+    // Print help screen.
+    if (vm.count("help"))
+    {
+        std::cout << cmdline;
+        return 0;
+    }
+
+    if (threads == 0)
+        throw std::invalid_argument("at least one thread is required\n");
+
+    if (iterations % blocksize)
+        throw std::invalid_argument(
+            "iterations must be cleanly divisible by blocksize\n");
+
+    if (vm.count("no-header"))
+        header = false;
+
+    return app_main(vm);
+}
@@ -12,6 +12,7 @@
 #include <hpx/include/serialization.hpp>
 #include <hpx/iostream.hpp>
 
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 #include <string>
@@ -27,10 +28,48 @@ namespace pingpong { namespace server {
 HPX_PLAIN_ACTION(pingpong::server::get_element, pingpong_get_element_action)
 //HPX_ACTION_USES_MESSAGE_COALESCING(pingpong_get_element_action)
 
+namespace pingpong { namespace server {
+    using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+    // return the received buffer, large buffers are sent as zero-copy chunks
+    // in both directions
+    buffer_type echo_buffer(buffer_type const& buffer)
+    {
+        return buffer;
+    }
+}}    // namespace pingpong::server
+
+HPX_PLAIN_ACTION(pingpong::server::echo_buffer, pingpong_echo_buffer_action)
+
+void run_buffer_pingpong(
+    hpx::id_type const& other_locality, std::size_t n, std::size_t size)
+{
+    using pingpong::server::buffer_type;
+
+    buffer_type buffer(size);
+    std::fill(buffer.data(), buffer.data() + size, 'x');
+
+    pingpong_echo_buffer_action act;
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        buffer = act(other_locality, buffer);
+    }
+
+    double const elapsed = t.elapsed();
+    hpx::cout << "Echoed " << n << " buffers of " << size << " bytes in "
+              << elapsed << " [s], "
+              << (2.0 * static_cast<double>(n * size)) / (elapsed * 1e6)
+              << " [MB/s]\n"
+              << std::flush;
+}
+
 int hpx_main(hpx::program_options::variables_map& vm)
 {
     //Commandline specific code
     std::size_t const n = vm["nparcels"].as<std::size_t>();
+    std::size_t const message_size = vm["message-size"].as<std::size_t>();
 
     if (0 == hpx::get_locality_id())
     {
@@ -47,6 +86,12 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::vector<hpx::id_type> dummy = hpx::find_remote_localities();
     hpx::id_type other_locality = dummy[0];
 
+    if (message_size != 0)
+    {
+        run_buffer_pingpong(other_locality, n, message_size);
+        return hpx::finalize();
+    }
+
     for (std::size_t i = 0; i < n; ++i)
     {
         vec.push_back(hpx::async(act, other_locality));
@@ -78,7 +123,10 @@ int main(int argc, char* argv[])
 
     cmdline.add_options()("nparcels,n",
         hpx::program_options::value<std::size_t>()->default_value(100),
-        "the number of parcels to create");
+        "the number of parcels to create")("message-size",
+        hpx::program_options::value<std::size_t>()->default_value(0),
+        "echo buffers of the given size (in bytes) instead of sending "
+        "single elements");
     // Initialize and run HPX
     std::vector<std::string> cfg;
     cfg.push_back("hpx.run_hpx_main!=1");
@@ -0,0 +1,77 @@
+//  Copyright (c) 2026 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Convert a binary thread event trace (as written if hpx.trace.enabled=1) into
+// the Chrome trace event JSON format, which can be loaded into Perfetto
+// (https://ui.perfetto.dev) or chrome://tracing.
+//
+//     hpx_trace [--analyze] <trace file> [<output file>]
+//
+// With --analyze, a report listing the critical path, the parallelism profile
+// and the slack of the annotated tasks is written instead. This requires the
+// trace to be recorded with hpx.trace.dependencies=1.
+//
+// The output is written to standard output if no output file is given.
+
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/task_tracing.hpp>
+
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    bool const analyze = argc > 1 && std::string(argv[1]) == "--analyze";
+    if (analyze)
+    {
+        --argc;
+        ++argv;
+    }
+
+    if (argc < 2 || argc > 3 || std::string(argv[1]) == "--help")
+    {
+        std::cerr
+            << "usage: hpx_trace [--analyze] <trace file> [<output file>]\n";
+        return argc == 2 ? 0 : 1;
+    }
+
+    std::ifstream in(argv[1], std::ios::binary);
+    if (!in.is_open())
+    {
+        std::cerr << "hpx_trace: could not open " << argv[1] << "\n";
+        return 1;
+    }
+
+    try
+    {
+        std::ofstream file;
+        if (argc == 3)
+        {
+            file.open(argv[2]);
+            if (!file.is_open())
+            {
+                std::cerr << "hpx_trace: could not open " << argv[2] << "\n";
+                return 1;
+            }
+        }
+        std::ostream& out = argc == 3 ? file : std::cout;
+
+        if (analyze)
+            hpx::threads::tracing::analyze_trace(in, out);
+        else
+            hpx::threads::tracing::convert_to_chrome_trace(in, out);
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << "hpx_trace: " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}